@@ -121,6 +121,8 @@ class ImageFile(enum.Enum) :
     Png = 5
     ## A JPEG (Joint Photographic Experts Group) image file format.
     Jpeg = 6
+    ## A QOI (Quite OK Image) lossless image file format.
+    Qoi = 7
 
 ## @ingroup python
 # Describes pixel format type. It is used in Simd.Image.
@@ -165,6 +167,8 @@ class PixelFormat(enum.Enum) :
 	Uyvy16 = 18
     ## A 32-bit (4 8-bit channels) ARGB (Alpha, Red, Green, Blue) pixel format.
 	Argb32 = 19
+    ## A 16-bit (2 8-bit channels) YUYV422 pixel format.
+	Yuyv16 = 20
 	
 	## Gets pixel size in bytes.
 	# @return pixel size in bytes.	
@@ -189,6 +193,7 @@ class PixelFormat(enum.Enum) :
 		elif self == Simd.PixelFormat.Rgba32 : return 4
 		elif self == Simd.PixelFormat.Uyvy16 : return 2
 		elif self == Simd.PixelFormat.Argb32 : return 4
+		elif self == Simd.PixelFormat.Yuyv16 : return 2
 		else : return 0
 		
 	## Gets channel size in bytes.
@@ -214,6 +219,7 @@ class PixelFormat(enum.Enum) :
 		elif self == Simd.PixelFormat.Rgba32 : return 1
 		elif self == Simd.PixelFormat.Uyvy16 : return 1
 		elif self == Simd.PixelFormat.Argb32 : return 1
+		elif self == Simd.PixelFormat.Yuyv16 : return 1
 		else : return 0
 		
 	## Gets channels count.
@@ -239,6 +245,7 @@ class PixelFormat(enum.Enum) :
 		elif self == Simd.PixelFormat.Rgba32 : return 4
 		elif self == Simd.PixelFormat.Uyvy16 : return 2
 		elif self == Simd.PixelFormat.Argb32 : return 4
+		elif self == Simd.PixelFormat.Yuyv16 : return 2
 		else : return 0
 
 ## @ingroup python
@@ -293,6 +300,8 @@ class ResizeMethod(enum.Enum) :
 	Area = 6
     ## Area method for previously reduced in 2 times image.
 	AreaFast = 7
+    ## Lanczos method (with window of size 3). It is relevant only for Simd.ResizeChannel.Byte (8-bit integer channel type) and Simd.ResizeChannel.Float (32-bit float channel type).
+	Lanczos = 8
 	
 ## @ingroup python
 # 4D-tensor format type.
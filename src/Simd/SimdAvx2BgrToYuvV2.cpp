@@ -249,6 +249,80 @@ namespace Simd
             default:
                 assert(0);
             }
+#endif
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T> SIMD_INLINE void BgrToNv12V2(const uint8_t* bgr0, size_t bgrStride, uint8_t* y0, size_t yStride, uint8_t* uv)
+        {
+            const uint8_t* bgr1 = bgr0 + bgrStride;
+            uint8_t* y1 = y0 + yStride;
+
+            __m256i blue[2][2], green[2][2], red[2][2];
+
+            LoadBgr<false>((__m256i*)bgr0 + 0, blue[0][0], green[0][0], red[0][0]);
+            _mm256_storeu_si256((__m256i*)y0 + 0, BgrToY8<T>(blue[0][0], green[0][0], red[0][0]));
+
+            LoadBgr<false>((__m256i*)bgr0 + 3, blue[0][1], green[0][1], red[0][1]);
+            _mm256_storeu_si256((__m256i*)y0 + 1, BgrToY8<T>(blue[0][1], green[0][1], red[0][1]));
+
+            LoadBgr<false>((__m256i*)bgr1 + 0, blue[1][0], green[1][0], red[1][0]);
+            _mm256_storeu_si256((__m256i*)y1 + 0, BgrToY8<T>(blue[1][0], green[1][0], red[1][0]));
+
+            LoadBgr<false>((__m256i*)bgr1 + 3, blue[1][1], green[1][1], red[1][1]);
+            _mm256_storeu_si256((__m256i*)y1 + 1, BgrToY8<T>(blue[1][1], green[1][1], red[1][1]));
+
+            blue[0][0] = Average16(blue[0][0], blue[1][0]);
+            blue[0][1] = Average16(blue[0][1], blue[1][1]);
+            green[0][0] = Average16(green[0][0], green[1][0]);
+            green[0][1] = Average16(green[0][1], green[1][1]);
+            red[0][0] = Average16(red[0][0], red[1][0]);
+            red[0][1] = Average16(red[0][1], red[1][1]);
+
+            // lane-wise packing gives the permuted order expected by UnpackU8
+            __m256i _u = _mm256_packus_epi16(BgrToU16<T>(blue[0][0], green[0][0], red[0][0]), BgrToU16<T>(blue[0][1], green[0][1], red[0][1]));
+            __m256i _v = _mm256_packus_epi16(BgrToV16<T>(blue[0][0], green[0][0], red[0][0]), BgrToV16<T>(blue[0][1], green[0][1], red[0][1]));
+            _mm256_storeu_si256((__m256i*)uv + 0, UnpackU8<0>(_u, _v));
+            _mm256_storeu_si256((__m256i*)uv + 1, UnpackU8<1>(_u, _v));
+        }
+
+        template <class T>  void BgrToNv12V2(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* y, size_t yStride,
+            uint8_t* uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+
+            size_t widthDA = AlignLo(width, DA);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgr = 0; colY < widthDA; colY += DA, colBgr += A * 6)
+                    BgrToNv12V2<T>(bgr + colBgr, bgrStride, y + colY, yStride, uv + colY);
+                if (width != widthDA)
+                {
+                    size_t colY = width - DA;
+                    BgrToNv12V2<T>(bgr + colY * 3, bgrStride, y + colY, yStride, uv + colY);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        void BgrToNv12V2(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* y, size_t yStride,
+            uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+#if defined(SIMD_X86_ENABLE) && defined(NDEBUG) && defined(_MSC_VER) && _MSC_VER <= 1900
+            Base::BgrToNv12V2(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+#else
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToNv12V2<Base::Bt601>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgrToNv12V2<Base::Bt709>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgrToNv12V2<Base::Bt2020>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvTrect871: BgrToNv12V2<Base::Trect871>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            default:
+                assert(0);
+            }
 #endif
         }
     }
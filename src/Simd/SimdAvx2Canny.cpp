@@ -0,0 +1,158 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<bool l2> SIMD_INLINE __m256i CannyMagnitude(__m256i dx, __m256i dy)
+        {
+            return l2 ? _mm256_add_epi32(_mm256_mullo_epi32(dx, dx), _mm256_mullo_epi32(dy, dy)) : _mm256_add_epi32(_mm256_abs_epi32(dx), _mm256_abs_epi32(dy));
+        }
+
+        SIMD_INLINE __m256i CannyDirection(__m256i dx, __m256i dy)
+        {
+            __m256i ax = _mm256_abs_epi32(dx), ay = _mm256_slli_epi32(_mm256_abs_epi32(dy), 15);
+            __m256i tg22x = _mm256_mullo_epi32(ax, _mm256_set1_epi32(Base::CANNY_TG22));
+            __m256i tg67x = _mm256_add_epi32(tg22x, _mm256_slli_epi32(ax, 16));
+            __m256i dir = _mm256_sub_epi32(_mm256_set1_epi32(Base::CannyDirMainDiagonal), _mm256_srai_epi32(_mm256_xor_si256(dx, dy), 31));
+            dir = _mm256_blendv_epi8(dir, _mm256_set1_epi32(Base::CannyDirVertical), _mm256_cmpgt_epi32(ay, tg67x));
+            return _mm256_blendv_epi8(dir, _mm256_set1_epi32(Base::CannyDirHorizontal), _mm256_cmpgt_epi32(tg22x, ay));
+        }
+
+        SIMD_INLINE __m256i LoadU8(const uint8_t* src)
+        {
+            return _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+        }
+
+        template<bool l2> SIMD_INLINE void CannyGradient(const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, size_t x, int32_t* mag, uint8_t* dir)
+        {
+            __m256i a0 = LoadU8(s0 + x - 1), b0 = LoadU8(s0 + x), c0 = LoadU8(s0 + x + 1);
+            __m256i a1 = LoadU8(s1 + x - 1), c1 = LoadU8(s1 + x + 1);
+            __m256i a2 = LoadU8(s2 + x - 1), b2 = LoadU8(s2 + x), c2 = LoadU8(s2 + x + 1);
+            __m256i dx = _mm256_sub_epi16(_mm256_add_epi16(_mm256_add_epi16(c0, c2), _mm256_slli_epi16(c1, 1)), _mm256_add_epi16(_mm256_add_epi16(a0, a2), _mm256_slli_epi16(a1, 1)));
+            __m256i dy = _mm256_sub_epi16(_mm256_add_epi16(_mm256_add_epi16(a2, c2), _mm256_slli_epi16(b2, 1)), _mm256_add_epi16(_mm256_add_epi16(a0, c0), _mm256_slli_epi16(b0, 1)));
+            __m256i dx0 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(dx)), dx1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(dx, 1));
+            __m256i dy0 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(dy)), dy1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(dy, 1));
+            _mm256_storeu_si256((__m256i*)(mag + x) + 0, CannyMagnitude<l2>(dx0, dy0));
+            _mm256_storeu_si256((__m256i*)(mag + x) + 1, CannyMagnitude<l2>(dx1, dy1));
+            __m256i d16 = PackI32ToI16(CannyDirection(dx0, dy0), CannyDirection(dx1, dy1));
+            _mm_storeu_si128((__m128i*)(dir + x), _mm_packus_epi16(_mm256_castsi256_si128(d16), _mm256_extracti128_si256(d16, 1)));
+        }
+
+        template<bool l2> void CannyGradientRow(const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, size_t width, int32_t* mag, uint8_t* dir)
+        {
+            if (width < HA + 2)
+            {
+                for (size_t x = 0; x < width; ++x)
+                    Base::CannyGradient<l2>(s0, s1, s2, x ? x - 1 : 0, x, Simd::Min(x + 1, width - 1), mag, dir);
+                return;
+            }
+            Base::CannyGradient<l2>(s0, s1, s2, 0, 0, 1, mag, dir);
+            size_t body = width - 1, x = 1;
+            for (; x + HA <= body; x += HA)
+                CannyGradient<l2>(s0, s1, s2, x, mag, dir);
+            if (x < body)
+                CannyGradient<l2>(s0, s1, s2, body - HA, mag, dir);
+            Base::CannyGradient<l2>(s0, s1, s2, width - 2, width - 1, width - 1, mag, dir);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m256i CannyNms(const int32_t* m0, const int32_t* m1, const int32_t* m2, const uint8_t* dir, size_t x, __m256i low, __m256i high)
+        {
+            __m256i m = _mm256_loadu_si256((__m256i*)(m1 + x));
+            __m256i d = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(dir + x)));
+            __m256i isH = _mm256_cmpeq_epi32(d, _mm256_set1_epi32(Base::CannyDirHorizontal));
+            __m256i isV = _mm256_cmpeq_epi32(d, _mm256_set1_epi32(Base::CannyDirVertical));
+            __m256i isM = _mm256_cmpeq_epi32(d, _mm256_set1_epi32(Base::CannyDirMainDiagonal));
+            __m256i prev = _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)(m0 + x + 1)), _mm256_loadu_si256((__m256i*)(m0 + x - 1)), isM);
+            prev = _mm256_blendv_epi8(prev, _mm256_loadu_si256((__m256i*)(m0 + x)), isV);
+            prev = _mm256_blendv_epi8(prev, _mm256_loadu_si256((__m256i*)(m1 + x - 1)), isH);
+            __m256i next = _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)(m2 + x - 1)), _mm256_loadu_si256((__m256i*)(m2 + x + 1)), isM);
+            next = _mm256_blendv_epi8(next, _mm256_loadu_si256((__m256i*)(m2 + x)), isV);
+            next = _mm256_blendv_epi8(next, _mm256_loadu_si256((__m256i*)(m1 + x + 1)), isH);
+            __m256i cand = _mm256_andnot_si256(_mm256_cmpgt_epi32(next, m), _mm256_and_si256(_mm256_cmpgt_epi32(m, low), _mm256_cmpgt_epi32(m, prev)));
+            __m256i strong = _mm256_and_si256(cand, _mm256_cmpgt_epi32(m, high));
+            return _mm256_sub_epi32(K_ZERO, _mm256_add_epi32(cand, strong));
+        }
+
+        static void CannyNmsRow(const int32_t* m0, const int32_t* m1, const int32_t* m2, const uint8_t* dir, size_t width, int32_t low, int32_t high, uint8_t* map)
+        {
+            __m256i _low = _mm256_set1_epi32(low), _high = _mm256_set1_epi32(high);
+            size_t widthF = AlignLo(width, F), widthA = AlignLo(width, A), x = 0;
+            for (; x < widthA; x += A)
+            {
+                __m256i lo = PackI32ToI16(CannyNms(m0, m1, m2, dir, x + 0 * F, _low, _high), CannyNms(m0, m1, m2, dir, x + 1 * F, _low, _high));
+                __m256i hi = PackI32ToI16(CannyNms(m0, m1, m2, dir, x + 2 * F, _low, _high), CannyNms(m0, m1, m2, dir, x + 3 * F, _low, _high));
+                _mm256_storeu_si256((__m256i*)(map + x), PackI16ToU8(lo, hi));
+            }
+            for (; x < widthF; x += F)
+            {
+                __m256i codes = CannyNms(m0, m1, m2, dir, x, _low, _high);
+                __m128i c16 = _mm_packs_epi32(_mm256_castsi256_si128(codes), _mm256_extracti128_si256(codes, 1));
+                _mm_storel_epi64((__m128i*)(map + x), _mm_packus_epi16(c16, Sse41::K_ZERO));
+            }
+            for (; x < width; ++x)
+                map[x] = Base::CannyNms(m0, m1, m2, dir, x, low, high);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void CannyOutput(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            __m256i edge = _mm256_set1_epi8(2);
+            size_t widthA = AlignLo(width, A), x = 0;
+            for (; x < widthA; x += A)
+                _mm256_storeu_si256((__m256i*)(dst + x), _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(map + x)), edge));
+            for (; x < width; ++x)
+                dst[x] = map[x] == 2 ? 0xFF : 0x00;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        CannyDefault::CannyDefault(const CannyParam& param)
+            : Sse41::CannyDefault(param)
+        {
+            _gradient = _param.l2 ? CannyGradientRow<true> : CannyGradientRow<false>;
+            _nms = CannyNmsRow;
+            _output = CannyOutput;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CannyInit(size_t width, size_t height, float low, float high, SimdBool l2)
+        {
+            CannyParam param(width, height, low, high, l2);
+            if (!param.Valid())
+                return NULL;
+            return new CannyDefault(param);
+        }
+    }
+#endif
+}
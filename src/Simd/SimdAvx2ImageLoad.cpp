@@ -134,6 +134,7 @@ namespace Simd
             case SimdImageFilePpmBin: return new ImagePpmBinLoader(param);
             case SimdImageFilePng: return new Sse41::ImagePngLoader(param);
             case SimdImageFileJpeg: return new Avx2::ImageJpegLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
             default:
                 return NULL;
             }
@@ -153,6 +154,11 @@ namespace Simd
             }
             return NULL;
         }
+
+        void* ImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            return Simd::ImageMapFromFile(CreateImageLoader, path, width, height, format);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
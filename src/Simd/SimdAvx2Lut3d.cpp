@@ -0,0 +1,168 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdLut3d.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K32_LUT3D_ROUND = SIMD_MM256_SET1_EPI32(Base::LUT3D_ROUND);
+        const __m256i K32_LUT3D_FINAL_ROUND = SIMD_MM256_SET1_EPI32(Base::LUT3D_FINAL_ROUND);
+        const __m256i K32_LUT3D_ALPHA = SIMD_MM256_SET1_EPI32(0xFF000000);
+
+        const __m256i K8_LUT3D_BGRX_TO_BGR = SIMD_MM256_SETR_EPI8(
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+        const __m256i K8_LUT3D_BGRX_TO_RGB = SIMD_MM256_SETR_EPI8(
+            0x2, 0x1, 0x0, 0x6, 0x5, 0x4, 0xA, 0x9, 0x8, 0xE, 0xD, 0xC, -1, -1, -1, -1,
+            0x2, 0x1, 0x0, 0x6, 0x5, 0x4, 0xA, 0x9, 0x8, 0xE, 0xD, 0xC, -1, -1, -1, -1);
+        const __m256i K8_LUT3D_BGRX_TO_RGBX = SIMD_MM256_SETR_EPI8(
+            0x2, 0x1, 0x0, 0x3, 0x6, 0x5, 0x4, 0x7, 0xA, 0x9, 0x8, 0xB, 0xE, 0xD, 0xC, 0xF,
+            0x2, 0x1, 0x0, 0x3, 0x6, 0x5, 0x4, 0x7, 0xA, 0x9, 0x8, 0xB, 0xE, 0xD, 0xC, 0xF);
+
+        SIMD_INLINE __m256i LoadNodes(const int16_t* p0, const int16_t* p1)
+        {
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadl_epi64((__m128i*)p0)), _mm_loadl_epi64((__m128i*)p1), 1);
+        }
+
+        SIMD_INLINE __m256i Lut3dWeight(int w00, int w01, int w10, int w11)
+        {
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_set1_epi32(w00 | w01 << 16)), _mm_set1_epi32(w10 | w11 << 16), 1);
+        }
+
+        SIMD_INLINE __m256i Lut3dWeight(int w0, int w1)
+        {
+            return Lut3dWeight(Base::LUT3D_WEIGHT_ONE - w0, w0, Base::LUT3D_WEIGHT_ONE - w1, w1);
+        }
+
+        SIMD_INLINE __m256i Lut3dPair(__m256i lo, __m256i hi)
+        {
+            return _mm256_or_si256(lo, _mm256_slli_epi32(hi, 16));
+        }
+
+        SIMD_INLINE __m256i Lut3dLerp(__m256i pair, __m256i weight)
+        {
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(pair, weight), K32_LUT3D_ROUND), Base::LUT3D_WEIGHT_SHIFT);
+        }
+
+        template<bool tetrahedral, bool rgb> SIMD_INLINE __m256i Lut3dPixel2(const Base::Lut3dIndex& index, const int16_t* nodes, const uint8_t* src0, const uint8_t* src1)
+        {
+            int b0 = src0[rgb ? 2 : 0], g0 = src0[1], r0 = src0[rgb ? 0 : 2];
+            int b1 = src1[rgb ? 2 : 0], g1 = src1[1], r1 = src1[rgb ? 0 : 2];
+            const int16_t* p0 = nodes + index.offset[0][b0] + index.offset[1][g0] + index.offset[2][r0];
+            const int16_t* p1 = nodes + index.offset[0][b1] + index.offset[1][g1] + index.offset[2][r1];
+            int wb0 = index.weight[0][b0], wg0 = index.weight[1][g0], wr0 = index.weight[2][r0];
+            int wb1 = index.weight[0][b1], wg1 = index.weight[1][g1], wr1 = index.weight[2][r1];
+            __m256i sum;
+            if (tetrahedral)
+            {
+                int o0[4], w0[4], o1[4], w1[4];
+                Base::Lut3dTetrahedral(index, wb0, wg0, wr0, o0, w0);
+                Base::Lut3dTetrahedral(index, wb1, wg1, wr1, o1, w1);
+                __m256i n01 = _mm256_unpacklo_epi16(LoadNodes(p0 + o0[0], p1 + o1[0]), LoadNodes(p0 + o0[1], p1 + o1[1]));
+                __m256i n23 = _mm256_unpacklo_epi16(LoadNodes(p0 + o0[2], p1 + o1[2]), LoadNodes(p0 + o0[3], p1 + o1[3]));
+                sum = _mm256_add_epi32(_mm256_madd_epi16(n01, Lut3dWeight(w0[0], w0[1], w1[0], w1[1])),
+                    _mm256_madd_epi16(n23, Lut3dWeight(w0[2], w0[3], w1[2], w1[3])));
+            }
+            else
+            {
+                int sb = index.step[0], sg = index.step[1], sr = index.step[2];
+                __m256i _wr = Lut3dWeight(wr0, wr1);
+                __m256i _wg = Lut3dWeight(wg0, wg1);
+                __m256i _wb = Lut3dWeight(wb0, wb1);
+                __m256i r00 = Lut3dLerp(_mm256_unpacklo_epi16(LoadNodes(p0, p1), LoadNodes(p0 + sr, p1 + sr)), _wr);
+                __m256i r10 = Lut3dLerp(_mm256_unpacklo_epi16(LoadNodes(p0 + sg, p1 + sg), LoadNodes(p0 + sg + sr, p1 + sg + sr)), _wr);
+                p0 += sb, p1 += sb;
+                __m256i r01 = Lut3dLerp(_mm256_unpacklo_epi16(LoadNodes(p0, p1), LoadNodes(p0 + sr, p1 + sr)), _wr);
+                __m256i r11 = Lut3dLerp(_mm256_unpacklo_epi16(LoadNodes(p0 + sg, p1 + sg), LoadNodes(p0 + sg + sr, p1 + sg + sr)), _wr);
+                __m256i c0 = Lut3dLerp(Lut3dPair(r00, r10), _wg);
+                __m256i c1 = Lut3dLerp(Lut3dPair(r01, r11), _wg);
+                sum = _mm256_madd_epi16(Lut3dPair(c0, c1), _wb);
+            }
+            return _mm256_srai_epi32(_mm256_add_epi32(sum, K32_LUT3D_FINAL_ROUND), Base::LUT3D_SHIFT);
+        }
+
+        template<bool tetrahedral, size_t channels, bool rgb> void Lut3dRow(const Base::Lut3dIndex& index, const int16_t* nodes, const uint8_t* src, size_t width, uint8_t* dst)
+        {
+            size_t width8 = AlignLo(width, 8), x = 0;
+            for (; x < width8; x += 8, src += 8 * channels, dst += 8 * channels)
+            {
+                __m256i p0 = Lut3dPixel2<tetrahedral, rgb>(index, nodes, src + 0 * channels, src + 4 * channels);
+                __m256i p1 = Lut3dPixel2<tetrahedral, rgb>(index, nodes, src + 1 * channels, src + 5 * channels);
+                __m256i p2 = Lut3dPixel2<tetrahedral, rgb>(index, nodes, src + 2 * channels, src + 6 * channels);
+                __m256i p3 = Lut3dPixel2<tetrahedral, rgb>(index, nodes, src + 3 * channels, src + 7 * channels);
+                __m256i bgrx = _mm256_packus_epi16(_mm256_packs_epi32(p0, p1), _mm256_packs_epi32(p2, p3));
+                if (channels == 4)
+                {
+                    if (rgb)
+                        bgrx = _mm256_shuffle_epi8(bgrx, K8_LUT3D_BGRX_TO_RGBX);
+                    _mm256_storeu_si256((__m256i*)dst, _mm256_blendv_epi8(bgrx, _mm256_loadu_si256((__m256i*)src), K32_LUT3D_ALPHA));
+                }
+                else
+                {
+                    __m256i bgr = _mm256_shuffle_epi8(bgrx, rgb ? K8_LUT3D_BGRX_TO_RGB : K8_LUT3D_BGRX_TO_BGR);
+                    __m128i lo = _mm256_castsi256_si128(bgr), hi = _mm256_extracti128_si256(bgr, 1);
+                    _mm_storel_epi64((__m128i*)dst, lo);
+                    *(int32_t*)(dst + 8) = _mm_extract_epi32(lo, 2);
+                    _mm_storel_epi64((__m128i*)(dst + 12), hi);
+                    *(int32_t*)(dst + 20) = _mm_extract_epi32(hi, 2);
+                }
+            }
+            for (; x < width; ++x, src += channels, dst += channels)
+                Base::Lut3dPixel<tetrahedral, channels, rgb>(index, nodes, src, dst);
+        }
+
+        template<bool tetrahedral> void SetRows(Base::Lut3dInt::RowPtr rows[4])
+        {
+            rows[0] = Lut3dRow<tetrahedral, 3, false>;
+            rows[1] = Lut3dRow<tetrahedral, 4, false>;
+            rows[2] = Lut3dRow<tetrahedral, 3, true>;
+            rows[3] = Lut3dRow<tetrahedral, 4, true>;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        Lut3dInt::Lut3dInt(const Lut3dParam& param, const float* table)
+            : Sse41::Lut3dInt(param, table)
+        {
+            if (param.interpolation == SimdLut3dInterpolationTetrahedral)
+                SetRows<true>(_rows);
+            else
+                SetRows<false>(_rows);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* Lut3dInit(size_t size, const float* table, SimdLut3dInterpolationType interpolation)
+        {
+            Lut3dParam param(size, interpolation);
+            if (!param.Valid() || table == NULL)
+                return NULL;
+            return new Lut3dInt(param, table);
+        }
+    }
+#endif
+}
@@ -0,0 +1,63 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMedianFilter.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        static void MedianFilterUpdate(const uint16_t* add, const uint16_t* sub, uint16_t* hist)
+        {
+            for (size_t i = 0; i < Base::MF_HIST; i += HA)
+            {
+                __m256i _add = _mm256_loadu_si256((__m256i*)(add + i));
+                __m256i _sub = _mm256_loadu_si256((__m256i*)(sub + i));
+                __m256i _hist = _mm256_loadu_si256((__m256i*)(hist + i));
+                _mm256_storeu_si256((__m256i*)(hist + i), _mm256_add_epi16(_hist, _mm256_sub_epi16(_add, _sub)));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        MedianFilterDefault::MedianFilterDefault(const MedianFilterParam& param)
+            : Sse41::MedianFilterDefault(param)
+        {
+            _update = MedianFilterUpdate;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, const uint8_t* borderValue)
+        {
+            MedianFilterParam param(width, height, channels, radius, border, borderValue);
+            if (!param.Valid())
+                return NULL;
+            return new MedianFilterDefault(param);
+        }
+    }
+#endif
+}
@@ -28,6 +28,7 @@
 #include "Simd/SimdSet.h"
 #include "Simd/SimdUpdate.h"
 #include "Simd/SimdEnable.h"
+#include "Simd/SimdBFloat16.h"
 
 namespace Simd
 {
@@ -243,7 +244,8 @@ namespace Simd
             const uint8_t * ax = _ax.data;
             const int32_t * ix = _ix.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm256_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm256_set1_epi16(int16_t(_ay[yDst]));
@@ -292,7 +294,8 @@ namespace Simd
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm256_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm256_set1_epi16(int16_t(_ay[yDst]));
@@ -329,6 +332,7 @@ namespace Simd
         {
             assert(_param.dstW >= A);
 
+            EstimateRows();
             EstimateParams();
             switch (_param.channels)
             {
@@ -440,7 +444,8 @@ namespace Simd
             size_t rs8 = AlignLo(rs, 8);
             size_t rs16 = AlignLo(rs, 16);
             __m256 _1 = _mm256_set1_ps(1.0f);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -591,7 +596,8 @@ namespace Simd
             size_t rs8 = AlignLo(rs, 8);
             size_t rs16 = AlignLo(rs, 16);
             __m256 _1 = _mm256_set1_ps(1.0f);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -811,7 +817,8 @@ namespace Simd
             int32_t prev = -2;
             size_t rsa = AlignLo(rs, F);
             size_t rsh = AlignLo(rs, Sse41::F);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -938,6 +945,90 @@ namespace Simd
                     dst[dx] = pbx[0][dx] * fy0 + pbx[1][dx] * fy1;
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerBf16Bilinear::ResizerBf16Bilinear(const ResParam& param)
+            : Sse41::ResizerBf16Bilinear(param)
+        {
+        }
+
+        SIMD_INLINE __m256i LoadBf16Pairs(const uint16_t* ps, const int32_t* ix)
+        {
+            if (Avx2::SlowGather)
+                return _mm256_setr_epi32(*(int32_t*)(ps + ix[0]), *(int32_t*)(ps + ix[1]), *(int32_t*)(ps + ix[2]), *(int32_t*)(ps + ix[3]),
+                    *(int32_t*)(ps + ix[4]), *(int32_t*)(ps + ix[5]), *(int32_t*)(ps + ix[6]), *(int32_t*)(ps + ix[7]));
+            else
+                return _mm256_i32gather_epi32((int32_t*)ps, _mm256_loadu_si256((__m256i*)ix), 2);
+        }
+
+        void ResizerBf16Bilinear::Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride)
+        {
+            size_t cn = _param.channels;
+            size_t rs = _param.dstW * cn;
+            float* pbx[2] = { _bx[0].data, _bx[1].data };
+            int32_t prev = -2;
+            size_t rsF = AlignLo(rs, F), rsDF = AlignLo(rs, DF);
+            __m256 _1 = _mm256_set1_ps(1.0f);
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                float fy1 = _ay[dy];
+                float fy0 = 1.0f - fy1;
+                int32_t sy = _iy[dy];
+                int32_t k = 0;
+
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+
+                prev = sy;
+
+                for (; k < 2; k++)
+                {
+                    float* pb = pbx[k];
+                    const uint16_t* ps0 = src + (sy + k) * srcStride;
+                    const uint16_t* ps1 = ps0 + cn - 1;
+                    size_t dx = 0;
+                    for (; dx < rsF; dx += F)
+                    {
+                        __m256i s0 = LoadBf16Pairs(ps0, _ix.data + dx);
+                        __m256i s1 = cn == 1 ? s0 : LoadBf16Pairs(ps1, _ix.data + dx);
+                        __m256 fx1 = _mm256_load_ps(_ax.data + dx);
+                        __m256 fx0 = _mm256_sub_ps(_1, fx1);
+                        __m256 m1 = _mm256_mul_ps(BFloat16ToFloat32Odd(s1), fx1);
+                        _mm256_store_ps(pb + dx, _mm256_fmadd_ps(BFloat16ToFloat32Even(s0), fx0, m1));
+                    }
+                    for (; dx < rs; dx++)
+                    {
+                        int32_t sx = _ix[dx];
+                        float fx = _ax[dx];
+                        pb[dx] = Base::BFloat16ToFloat32(ps0[sx]) * (1.0f - fx) + Base::BFloat16ToFloat32(ps0[sx + cn]) * fx;
+                    }
+                }
+
+                size_t dx = 0;
+                __m256 _fy0 = _mm256_set1_ps(fy0);
+                __m256 _fy1 = _mm256_set1_ps(fy1);
+                for (; dx < rsDF; dx += DF)
+                {
+                    __m256 d0 = _mm256_fmadd_ps(_mm256_load_ps(pbx[0] + dx + 0), _fy0, _mm256_mul_ps(_mm256_load_ps(pbx[1] + dx + 0), _fy1));
+                    __m256 d1 = _mm256_fmadd_ps(_mm256_load_ps(pbx[0] + dx + F), _fy0, _mm256_mul_ps(_mm256_load_ps(pbx[1] + dx + F), _fy1));
+                    _mm256_storeu_si256((__m256i*)(dst + dx), Float32ToBFloat16(d0, d1));
+                }
+                for (; dx < rsF; dx += F)
+                {
+                    __m256i d0 = Float32ToBFloat16(_mm256_fmadd_ps(_mm256_load_ps(pbx[0] + dx), _fy0, _mm256_mul_ps(_mm256_load_ps(pbx[1] + dx), _fy1)));
+                    _mm_storeu_si128((__m128i*)(dst + dx), _mm_packus_epi32(_mm256_castsi256_si128(d0), _mm256_extracti128_si256(d0, 1)));
+                }
+                for (; dx < rs; dx++)
+                    dst[dx] = Base::Float32ToBFloat16(pbx[0][dx] * fy0 + pbx[1][dx] * fy1);
+            }
+        }
     }
 #endif //SIMD_AVX2_ENABLE 
 }
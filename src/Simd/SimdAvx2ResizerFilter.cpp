@@ -0,0 +1,118 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdEnable.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        ResizerFilter::ResizerFilter(const ResParam& param)
+            : Sse41::ResizerFilter(param)
+        {
+        }
+
+        void ResizerFilter::ConvertRow(const uint8_t* src, float* dst)
+        {
+            size_t size = _param.srcW * _param.channels, sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + i)))));
+            for (; i < size; ++i)
+                dst[i] = src[i];
+        }
+
+        void ResizerFilter::FilterRow(const float* src, float* dst)
+        {
+            if (Avx2::SlowGather)
+            {
+                Sse41::ResizerFilter::FilterRow(src, dst);
+                return;
+            }
+            size_t cn = _param.channels, rsF = AlignLo(_rs, F), dx = 0;
+            for (; dx < rsF; dx += F)
+            {
+                __m256i idx = _mm256_loadu_si256((__m256i*)(_ix.data + dx));
+                const float* ps = src;
+                const float* ax = _ax.data + dx;
+                __m256 sum = _mm256_mul_ps(_mm256_i32gather_ps(ps, idx, 4), _mm256_loadu_ps(ax));
+                for (size_t k = 1; k < _nx; k++)
+                {
+                    ps += cn, ax += _rs;
+                    sum = _mm256_fmadd_ps(_mm256_i32gather_ps(ps, idx, 4), _mm256_loadu_ps(ax), sum);
+                }
+                _mm256_storeu_ps(dst + dx, sum);
+            }
+            for (; dx < _rs; dx++)
+            {
+                const float* ps = src + _ix[dx];
+                const float* ax = _ax.data + dx;
+                float sum = 0.0f;
+                for (size_t k = 0; k < _nx; k++, ps += cn, ax += _rs)
+                    sum += ps[0] * ax[0];
+                dst[dx] = sum;
+            }
+        }
+
+        SIMD_INLINE __m256 FilterCol(const float* const* src, const float* ay, size_t ny, size_t offset)
+        {
+            __m256 sum = _mm256_mul_ps(_mm256_loadu_ps(src[0] + offset), _mm256_set1_ps(ay[0]));
+            for (size_t k = 1; k < ny; k++)
+                sum = _mm256_fmadd_ps(_mm256_loadu_ps(src[k] + offset), _mm256_set1_ps(ay[k]), sum);
+            return sum;
+        }
+
+        void ResizerFilter::FilterCol(const float* const* src, const float* ay, uint8_t* dst)
+        {
+            size_t rsF = AlignLo(_rs, F), dx = 0;
+            if (_param.type == SimdResizeChannelByte)
+            {
+                for (; dx < rsF; dx += F)
+                {
+                    __m256i i32 = _mm256_cvtps_epi32(Avx2::FilterCol(src, ay, _ny, dx));
+                    __m128i i16 = _mm_packs_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1));
+                    _mm_storel_epi64((__m128i*)(dst + dx), _mm_packus_epi16(i16, Sse41::K_ZERO));
+                }
+            }
+            else
+            {
+                for (; dx < rsF; dx += F)
+                    _mm256_storeu_ps((float*)dst + dx, Avx2::FilterCol(src, ay, _ny, dx));
+            }
+            for (; dx < _rs; dx++)
+            {
+                float sum = 0.0f;
+                for (size_t k = 0; k < _ny; k++)
+                    sum += src[k][dx] * ay[k];
+                if (_param.type == SimdResizeChannelByte)
+                    dst[dx] = (uint8_t)Base::RestrictRange(Round(sum), 0, 255);
+                else
+                    ((float*)dst)[dx] = sum;
+            }
+        }
+    }
+#endif //SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,217 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSeparableFilter.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<SimdPixelFormatType type> void SepFilterLoad(const uint8_t* src, size_t size, float* dst);
+
+        template<> void SepFilterLoad<SimdPixelFormatGray8>(const uint8_t* src, size_t size, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + i)))));
+            for (; i < size; ++i)
+                dst[i] = float(src[i]);
+        }
+
+        template<> void SepFilterLoad<SimdPixelFormatInt16>(const uint8_t* src, size_t size, float* dst)
+        {
+            const int16_t* ps = (const int16_t*)src;
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((__m128i*)(ps + i)))));
+            for (; i < size; ++i)
+                dst[i] = float(ps[i]);
+        }
+
+        template<> void SepFilterLoad<SimdPixelFormatFloat>(const uint8_t* src, size_t size, float* dst)
+        {
+            memcpy(dst, src, size * sizeof(float));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void SepFilterRow(const float* src, size_t size, size_t channels, const float* kernel, size_t kernelSize, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), sizeF4 = AlignLo(size, 4 * F), i = 0;
+            for (; i < sizeF4; i += 4 * F)
+            {
+                __m256 sum0 = _mm256_setzero_ps();
+                __m256 sum1 = _mm256_setzero_ps();
+                __m256 sum2 = _mm256_setzero_ps();
+                __m256 sum3 = _mm256_setzero_ps();
+                for (size_t k = 0; k < kernelSize; ++k)
+                {
+                    __m256 w = _mm256_set1_ps(kernel[k]);
+                    const float* ps = src + i + k * channels;
+                    sum0 = _mm256_add_ps(_mm256_mul_ps(w, _mm256_loadu_ps(ps + 0 * F)), sum0);
+                    sum1 = _mm256_add_ps(_mm256_mul_ps(w, _mm256_loadu_ps(ps + 1 * F)), sum1);
+                    sum2 = _mm256_add_ps(_mm256_mul_ps(w, _mm256_loadu_ps(ps + 2 * F)), sum2);
+                    sum3 = _mm256_add_ps(_mm256_mul_ps(w, _mm256_loadu_ps(ps + 3 * F)), sum3);
+                }
+                _mm256_storeu_ps(dst + i + 0 * F, sum0);
+                _mm256_storeu_ps(dst + i + 1 * F, sum1);
+                _mm256_storeu_ps(dst + i + 2 * F, sum2);
+                _mm256_storeu_ps(dst + i + 3 * F, sum3);
+            }
+            for (; i < sizeF; i += F)
+            {
+                __m256 sum = _mm256_setzero_ps();
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(kernel[k]), _mm256_loadu_ps(src + i + k * channels)), sum);
+                _mm256_storeu_ps(dst + i, sum);
+            }
+            for (; i < size; ++i)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum += kernel[k] * src[i + k * channels];
+                dst[i] = sum;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdPixelFormatType type> SIMD_INLINE void SepFilterStore(const __m256& sum, uint8_t* dst, size_t index);
+
+        template<> SIMD_INLINE void SepFilterStore<SimdPixelFormatGray8>(const __m256& sum, uint8_t* dst, size_t index)
+        {
+            __m256i i32 = _mm256_cvtps_epi32(sum);
+            __m128i i16 = _mm_packs_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1));
+            _mm_storel_epi64((__m128i*)(dst + index), _mm_packus_epi16(i16, Sse41::K_ZERO));
+        }
+
+        template<> SIMD_INLINE void SepFilterStore<SimdPixelFormatInt16>(const __m256& sum, uint8_t* dst, size_t index)
+        {
+            __m256i i32 = _mm256_cvtps_epi32(sum);
+            _mm_storeu_si128((__m128i*)((int16_t*)dst + index), _mm_packs_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1)));
+        }
+
+        template<> SIMD_INLINE void SepFilterStore<SimdPixelFormatFloat>(const __m256& sum, uint8_t* dst, size_t index)
+        {
+            _mm256_storeu_ps((float*)dst + index, sum);
+        }
+
+        template<SimdPixelFormatType type> SIMD_INLINE void SepFilterStore(const __m256& sum0, const __m256& sum1, const __m256& sum2, const __m256& sum3, uint8_t* dst, size_t index);
+
+        template<> SIMD_INLINE void SepFilterStore<SimdPixelFormatGray8>(const __m256& sum0, const __m256& sum1, const __m256& sum2, const __m256& sum3, uint8_t* dst, size_t index)
+        {
+            __m256i lo = PackI32ToI16(_mm256_cvtps_epi32(sum0), _mm256_cvtps_epi32(sum1));
+            __m256i hi = PackI32ToI16(_mm256_cvtps_epi32(sum2), _mm256_cvtps_epi32(sum3));
+            _mm256_storeu_si256((__m256i*)(dst + index), PackI16ToU8(lo, hi));
+        }
+
+        template<> SIMD_INLINE void SepFilterStore<SimdPixelFormatInt16>(const __m256& sum0, const __m256& sum1, const __m256& sum2, const __m256& sum3, uint8_t* dst, size_t index)
+        {
+            int16_t* pd = (int16_t*)dst + index;
+            _mm256_storeu_si256((__m256i*)pd + 0, PackI32ToI16(_mm256_cvtps_epi32(sum0), _mm256_cvtps_epi32(sum1)));
+            _mm256_storeu_si256((__m256i*)pd + 1, PackI32ToI16(_mm256_cvtps_epi32(sum2), _mm256_cvtps_epi32(sum3)));
+        }
+
+        template<> SIMD_INLINE void SepFilterStore<SimdPixelFormatFloat>(const __m256& sum0, const __m256& sum1, const __m256& sum2, const __m256& sum3, uint8_t* dst, size_t index)
+        {
+            float* pd = (float*)dst + index;
+            _mm256_storeu_ps(pd + 0 * F, sum0);
+            _mm256_storeu_ps(pd + 1 * F, sum1);
+            _mm256_storeu_ps(pd + 2 * F, sum2);
+            _mm256_storeu_ps(pd + 3 * F, sum3);
+        }
+
+        template<SimdPixelFormatType type> void SepFilterCol(const float* src, size_t stride, size_t size, const float* kernel, size_t kernelSize, uint8_t* dst)
+        {
+            size_t sizeF = AlignLo(size, F), sizeF4 = AlignLo(size, 4 * F), i = 0;
+            for (; i < sizeF4; i += 4 * F)
+            {
+                __m256 sum0 = _mm256_setzero_ps();
+                __m256 sum1 = _mm256_setzero_ps();
+                __m256 sum2 = _mm256_setzero_ps();
+                __m256 sum3 = _mm256_setzero_ps();
+                for (size_t k = 0; k < kernelSize; ++k)
+                {
+                    __m256 w = _mm256_set1_ps(kernel[k]);
+                    const float* ps = src + i + k * stride;
+                    sum0 = _mm256_add_ps(_mm256_mul_ps(w, _mm256_loadu_ps(ps + 0 * F)), sum0);
+                    sum1 = _mm256_add_ps(_mm256_mul_ps(w, _mm256_loadu_ps(ps + 1 * F)), sum1);
+                    sum2 = _mm256_add_ps(_mm256_mul_ps(w, _mm256_loadu_ps(ps + 2 * F)), sum2);
+                    sum3 = _mm256_add_ps(_mm256_mul_ps(w, _mm256_loadu_ps(ps + 3 * F)), sum3);
+                }
+                SepFilterStore<type>(sum0, sum1, sum2, sum3, dst, i);
+            }
+            for (; i < sizeF; i += F)
+            {
+                __m256 sum = _mm256_setzero_ps();
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(kernel[k]), _mm256_loadu_ps(src + i + k * stride)), sum);
+                SepFilterStore<type>(sum, dst, i);
+            }
+            for (; i < size; ++i)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum += kernel[k] * src[i + k * stride];
+                Base::SepFilterStore<type>(sum, dst, i);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SeparableFilterDefault::SeparableFilterDefault(const SepFilterParam& param, const float* rowKernel, const float* colKernel)
+            : Sse41::SeparableFilterDefault(param, rowKernel, colKernel)
+        {
+            switch (_param.srcType)
+            {
+            case SimdPixelFormatGray8: _load = SepFilterLoad<SimdPixelFormatGray8>; break;
+            case SimdPixelFormatInt16: _load = SepFilterLoad<SimdPixelFormatInt16>; break;
+            case SimdPixelFormatFloat: _load = SepFilterLoad<SimdPixelFormatFloat>; break;
+            default: assert(0);
+            }
+            _row = SepFilterRow;
+            switch (_param.dstType)
+            {
+            case SimdPixelFormatGray8: _col = SepFilterCol<SimdPixelFormatGray8>; break;
+            case SimdPixelFormatInt16: _col = SepFilterCol<SimdPixelFormatInt16>; break;
+            case SimdPixelFormatFloat: _col = SepFilterCol<SimdPixelFormatFloat>; break;
+            default: assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType srcType, SimdPixelFormatType dstType,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize, SimdBorderType border, const float* borderValue)
+        {
+            SepFilterParam param(width, height, channels, srcType, dstType, rowSize, colSize, border, borderValue);
+            if (!param.Valid() || rowKernel == NULL || colKernel == NULL)
+                return NULL;
+            return new SeparableFilterDefault(param, rowKernel, colKernel);
+        }
+    }
+#endif
+}
@@ -0,0 +1,166 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetPreprocess.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)    
+    namespace Avx2
+    {
+        static void DeinterleaveUvRow(const uint8_t* uv, size_t width, uint8_t* u, uint8_t* v)
+        {
+            if (width >= A)
+                DeinterleaveUv(uv, width * 2, width, 1, u, width, v, width);
+            else
+                Base::SynetPreprocessDeinterleaveUvRow(uv, width, u, v);
+        }
+
+        static void YuvToBgrRow(const uint8_t* y, const uint8_t* u, const uint8_t* v, size_t width, SimdYuvType yuvType, uint8_t* bgr)
+        {
+            size_t width2 = AlignLo(width, 2);
+            if (width2 >= DA)
+            {
+                Yuv422pToBgrV2(y, width2, u, width2 / 2, v, width2 / 2, width2, 1, bgr, width2 * 3, yuvType);
+                if (width2 < width)
+                    Base::SynetPreprocessYuvToBgrRow(y + width2, u + width2 / 2, v + width2 / 2, width - width2, yuvType, bgr + width2 * 3);
+            }
+            else
+                Base::SynetPreprocessYuvToBgrRow(y, u, v, width, yuvType, bgr);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void ResizeRow(const uint8_t* src, size_t srcSize, const int32_t* idx0, const int32_t* idx1, const float* alpha, size_t size, float* buf, float* dst)
+        {
+            size_t srcSizeF = AlignLo(srcSize, F), i = 0;
+            for (; i < srcSizeF; i += F)
+                _mm256_storeu_ps(buf + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + i)))));
+            for (; i < srcSize; ++i)
+                buf[i] = src[i];
+            size_t sizeF = AlignLo(size, F);
+            for (i = 0; i < sizeF; i += F)
+            {
+                __m256 s0 = _mm256_i32gather_ps(buf, _mm256_loadu_si256((__m256i*)(idx0 + i)), 4);
+                __m256 s1 = _mm256_i32gather_ps(buf, _mm256_loadu_si256((__m256i*)(idx1 + i)), 4);
+                __m256 a1 = _mm256_loadu_ps(alpha + i), a0 = _mm256_sub_ps(_mm256_set1_ps(1.0f), a1);
+                _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(s0, a0), _mm256_mul_ps(s1, a1)));
+            }
+            for (; i < size; ++i)
+            {
+                float a1 = alpha[i], a0 = 1.0f - a1;
+                dst[i] = buf[idx0[i]] * a0 + buf[idx1[i]] * a1;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m256 SynetPreprocessNormalize(const float* src0, const float* src1, __m256 k0, __m256 k1, const float* scale, const float* shift)
+        {
+            __m256 value = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(src0), k0), _mm256_mul_ps(_mm256_loadu_ps(src1), k1));
+            return _mm256_add_ps(_mm256_mul_ps(value, _mm256_loadu_ps(scale)), _mm256_loadu_ps(shift));
+        }
+
+        static void NormalizeRow32f(const float* src0, const float* src1, float k0, float k1, const float* scale, const float* shift, size_t size, uint8_t* dst8)
+        {
+            float* dst = (float*)dst8;
+            __m256 _k0 = _mm256_set1_ps(k0), _k1 = _mm256_set1_ps(k1);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, SynetPreprocessNormalize(src0 + i, src1 + i, _k0, _k1, scale + i, shift + i));
+            for (; i < size; ++i)
+                dst[i] = Base::SynetPreprocessNormalize(src0[i], src1[i], k0, k1, scale[i], shift[i]);
+        }
+
+        static void NormalizeRow16b(const float* src0, const float* src1, float k0, float k1, const float* scale, const float* shift, size_t size, uint8_t* dst8)
+        {
+            uint16_t* dst = (uint16_t*)dst8;
+            __m256 _k0 = _mm256_set1_ps(k0), _k1 = _mm256_set1_ps(k1);
+            size_t sizeDF = AlignLo(size, DF), i = 0;
+            for (; i < sizeDF; i += DF)
+            {
+                __m256 lo = SynetPreprocessNormalize(src0 + i + 0, src1 + i + 0, _k0, _k1, scale + i + 0, shift + i + 0);
+                __m256 hi = SynetPreprocessNormalize(src0 + i + F, src1 + i + F, _k0, _k1, scale + i + F, shift + i + F);
+                _mm256_storeu_si256((__m256i*)(dst + i), Float32ToBFloat16(lo, hi));
+            }
+            for (; i < size; ++i)
+                dst[i] = Base::Float32ToBFloat16(Base::SynetPreprocessNormalize(src0[i], src1[i], k0, k1, scale[i], shift[i]));
+        }
+
+        static void NormalizeRow8u(const float* src0, const float* src1, float k0, float k1, const float* scale, const float* shift, size_t size, uint8_t* dst)
+        {
+            __m256 _k0 = _mm256_set1_ps(k0), _k1 = _mm256_set1_ps(k1);
+            size_t sizeQF = AlignLo(size, QF), sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                __m256i d0 = _mm256_cvtps_epi32(SynetPreprocessNormalize(src0 + i + 0 * F, src1 + i + 0 * F, _k0, _k1, scale + i + 0 * F, shift + i + 0 * F));
+                __m256i d1 = _mm256_cvtps_epi32(SynetPreprocessNormalize(src0 + i + 1 * F, src1 + i + 1 * F, _k0, _k1, scale + i + 1 * F, shift + i + 1 * F));
+                __m256i d2 = _mm256_cvtps_epi32(SynetPreprocessNormalize(src0 + i + 2 * F, src1 + i + 2 * F, _k0, _k1, scale + i + 2 * F, shift + i + 2 * F));
+                __m256i d3 = _mm256_cvtps_epi32(SynetPreprocessNormalize(src0 + i + 3 * F, src1 + i + 3 * F, _k0, _k1, scale + i + 3 * F, shift + i + 3 * F));
+                _mm256_storeu_si256((__m256i*)(dst + i), PackI16ToU8(PackI32ToI16(d0, d1), PackI32ToI16(d2, d3)));
+            }
+            for (; i < sizeF; i += F)
+            {
+                __m256i d0 = _mm256_cvtps_epi32(SynetPreprocessNormalize(src0 + i, src1 + i, _k0, _k1, scale + i, shift + i));
+                __m128i i16 = _mm_packs_epi32(_mm256_castsi256_si128(d0), _mm256_extracti128_si256(d0, 1));
+                _mm_storel_epi64((__m128i*)(dst + i), _mm_packus_epi16(i16, Sse41::K_ZERO));
+            }
+            for (; i < size; ++i)
+                dst[i] = (uint8_t)Base::RestrictRange(Round(Base::SynetPreprocessNormalize(src0[i], src1[i], k0, k1, scale[i], shift[i])), 0, 255);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetPreprocessFused::SynetPreprocessFused(const SynetPreprocessParam& param)
+            : Sse41::SynetPreprocessFused(param)
+        {
+            _buf.Resize(_param.srcW * _param.channels);
+            _deinterleaveUvRow = DeinterleaveUvRow;
+            _yuvToBgrRow = YuvToBgrRow;
+            _resizeRow = ResizeRow;
+            switch (_param.dstType)
+            {
+            case SimdTensorData32f: _normalizeRow = NormalizeRow32f; break;
+            case SimdTensorData16b: _normalizeRow = NormalizeRow16b; break;
+            case SimdTensorData8u: _normalizeRow = NormalizeRow8u; break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, SimdYuvType yuvType, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, uint8_t padding, const float* mean, const float* scale)
+        {
+            SynetPreprocessParam param(srcW, srcH, srcFormat, yuvType, dstW, dstH, channels, method, dstType, dstFormat, isRgb, letterbox, padding, mean, scale);
+            if (!param.Valid())
+                return NULL;
+            return new SynetPreprocessFused(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,146 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdTemplateMatch.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void TmAdd(const __m256i& sum, uint64_t* sums)
+        {
+            _mm256_storeu_si256((__m256i*)sums + 0, _mm256_add_epi64(_mm256_loadu_si256((__m256i*)sums + 0), _mm256_cvtepu32_epi64(_mm256_castsi256_si128(sum))));
+            _mm256_storeu_si256((__m256i*)sums + 1, _mm256_add_epi64(_mm256_loadu_si256((__m256i*)sums + 1), _mm256_cvtepu32_epi64(_mm256_extracti128_si256(sum, 1))));
+        }
+
+        void TmSad(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            size_t width32 = AlignLo(width, A), x = 0;
+            for (; x < width32; x += A)
+            {
+                __m256i sum0 = _mm256_setzero_si256(), sum1 = _mm256_setzero_si256(), sum2 = _mm256_setzero_si256(), sum3 = _mm256_setzero_si256();
+                for (size_t t = 0; t < size;)
+                {
+                    __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+                    for (size_t end = Min(size, t + 256); t < end; ++t)
+                    {
+                        __m256i s = _mm256_loadu_si256((__m256i*)(src + x + t));
+                        __m256i v = _mm256_set1_epi8(tmp[t]);
+                        __m256i d = _mm256_or_si256(_mm256_subs_epu8(s, v), _mm256_subs_epu8(v, s));
+                        lo = _mm256_add_epi16(lo, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(d)));
+                        hi = _mm256_add_epi16(hi, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(d, 1)));
+                    }
+                    sum0 = _mm256_add_epi32(sum0, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(lo)));
+                    sum1 = _mm256_add_epi32(sum1, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(lo, 1)));
+                    sum2 = _mm256_add_epi32(sum2, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(hi)));
+                    sum3 = _mm256_add_epi32(sum3, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(hi, 1)));
+                }
+                TmAdd(sum0, sums + x + 0);
+                TmAdd(sum1, sums + x + 8);
+                TmAdd(sum2, sums + x + 16);
+                TmAdd(sum3, sums + x + 24);
+            }
+            if (x < width)
+                Sse41::TmSad(src + x, tmp, size, width - x, sums + x);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<bool ssd> SIMD_INLINE void TmMadd(const __m256i& a, const __m256i& b, const __m256i& t, __m256i& lo, __m256i& hi)
+        {
+            if (ssd)
+            {
+                __m256i dlo = _mm256_sub_epi16(_mm256_unpacklo_epi16(a, b), t);
+                __m256i dhi = _mm256_sub_epi16(_mm256_unpackhi_epi16(a, b), t);
+                lo = _mm256_add_epi32(lo, _mm256_madd_epi16(dlo, dlo));
+                hi = _mm256_add_epi32(hi, _mm256_madd_epi16(dhi, dhi));
+            }
+            else
+            {
+                lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), t));
+                hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), t));
+            }
+        }
+
+        SIMD_INLINE __m256i TmLoad(const uint8_t* src)
+        {
+            return _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+        }
+
+        template<bool ssd> void TmMadd(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            size_t width16 = AlignLo(width, HA), size2 = AlignLo(size, 2), x = 0;
+            for (; x < width16; x += HA)
+            {
+                __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+                const uint8_t* s = src + x;
+                size_t t = 0;
+                for (; t < size2; t += 2)
+                    TmMadd<ssd>(TmLoad(s + t + 0), TmLoad(s + t + 1), _mm256_set1_epi32(tmp[t] | (tmp[t + 1] << 16)), lo, hi);
+                if (t < size)
+                    TmMadd<ssd>(TmLoad(s + t), K_ZERO, _mm256_set1_epi32(tmp[t]), lo, hi);
+                TmAdd(_mm256_permute2x128_si256(lo, hi, 0x20), sums + x + 0);
+                TmAdd(_mm256_permute2x128_si256(lo, hi, 0x31), sums + x + 8);
+            }
+            if (x < width)
+            {
+                if (ssd)
+                    Sse41::TmSsd(src + x, tmp, size, width - x, sums + x);
+                else
+                    Sse41::TmCorr(src + x, tmp, size, width - x, sums + x);
+            }
+        }
+
+        void TmSsd(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            TmMadd<true>(src, tmp, size, width, sums);
+        }
+
+        void TmCorr(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            TmMadd<false>(src, tmp, size, width, sums);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        TemplateMatchDefault::TemplateMatchDefault(const TemplateMatchParam& param, Base::PyramidBuilderInitPtr pyramidInit)
+            : Sse41::TemplateMatchDefault(param, pyramidInit)
+        {
+            SetRow(param.type, TmSad, TmSsd, TmCorr);
+            _integral = Avx2::Integral;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* TemplateMatchInit(size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels)
+        {
+            TemplateMatchParam param(srcWidth, srcHeight, tmpWidth, tmpHeight, type, levels);
+            if (!param.Valid())
+                return NULL;
+            return new TemplateMatchDefault(param, PyramidBuilderInit);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
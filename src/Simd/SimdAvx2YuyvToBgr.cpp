@@ -0,0 +1,195 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdInterleave.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template <class T> SIMD_INLINE __m256i UnpackYuyvY(__m256i yuyv)
+        {
+            static const __m256i Y_SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, -1, 0x2, -1, 0x4, -1, 0x6, -1, 0x8, -1, 0xA, -1, 0xC, -1, 0xE, -1,
+                0x0, -1, 0x2, -1, 0x4, -1, 0x6, -1, 0x8, -1, 0xA, -1, 0xC, -1, 0xE, -1);
+            static const __m256i Y_LO = SIMD_MM256_SET1_EPI16(T::Y_LO);
+            return _mm256_subs_epi16(_mm256_shuffle_epi8(yuyv, Y_SHUFFLE), Y_LO);
+        }
+
+        template <class T> SIMD_INLINE __m256i UnpackYuyvU(__m256i yuyv)
+        {
+            static const __m256i U_SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1,
+                0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1);
+            static const __m256i U_Z = SIMD_MM256_SET1_EPI16(T::UV_Z);
+            return _mm256_subs_epi16(_mm256_shuffle_epi8(yuyv, U_SHUFFLE), U_Z);
+        }
+
+        template <class T> SIMD_INLINE __m256i UnpackYuyvV(__m256i yuyv)
+        {
+            static const __m256i V_SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x3, -1, 0x3, -1, 0x7, -1, 0x7, -1, 0xB, -1, 0xB, -1, 0xF, -1, 0xF, -1,
+                0x3, -1, 0x3, -1, 0x7, -1, 0x7, -1, 0xB, -1, 0xB, -1, 0xF, -1, 0xF, -1);
+            static const __m256i V_Z = SIMD_MM256_SET1_EPI16(T::UV_Z);
+            return _mm256_subs_epi16(_mm256_shuffle_epi8(yuyv, V_SHUFFLE), V_Z);
+        }
+
+        template <bool align, class T> SIMD_INLINE void Yuyv422ToBgr(const uint8_t* yuyv, uint8_t* bgr)
+        {
+            __m256i yuyv0 = Load<align>((__m256i*)yuyv + 0);
+            __m256i y0 = UnpackYuyvY<T>(yuyv0);
+            __m256i u0 = UnpackYuyvU<T>(yuyv0);
+            __m256i v0 = UnpackYuyvV<T>(yuyv0);
+            __m256i blue0 = YuvToBlue16<T>(y0, u0);
+            __m256i green0 = YuvToGreen16<T>(y0, u0, v0);
+            __m256i red0 = YuvToRed16<T>(y0, v0);
+
+            __m256i yuyv1 = Load<align>((__m256i*)yuyv + 1);
+            __m256i y1 = UnpackYuyvY<T>(yuyv1);
+            __m256i u1 = UnpackYuyvU<T>(yuyv1);
+            __m256i v1 = UnpackYuyvV<T>(yuyv1);
+            __m256i blue1 = YuvToBlue16<T>(y1, u1);
+            __m256i green1 = YuvToGreen16<T>(y1, u1, v1);
+            __m256i red1 = YuvToRed16<T>(y1, v1);
+
+            __m256i blue = PackI16ToU8(blue0, blue1);
+            __m256i green = PackI16ToU8(green0, green1);
+            __m256i red = PackI16ToU8(red0, red1);
+            Store<align>((__m256i*)bgr + 0, InterleaveBgr<0>(blue, green, red));
+            Store<align>((__m256i*)bgr + 1, InterleaveBgr<1>(blue, green, red));
+            Store<align>((__m256i*)bgr + 2, InterleaveBgr<2>(blue, green, red));
+        }
+
+        template <bool align, class T> void Yuyv422ToBgr(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (width >= A));
+            if (align)
+                assert(Aligned(yuyv) && Aligned(yuyvStride) && Aligned(bgr) && Aligned(bgrStride));
+
+            size_t sizeS = width * 2, sizeD = width * 3;
+            size_t sizeS2A = AlignLo(sizeS, 2 * A);
+            size_t tailS = sizeS - 2 * A;
+            size_t tailD = sizeD - 3 * A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t colS = 0, colD = 0; colS < sizeS2A; colS += 2 * A, colD += 3 * A)
+                    Yuyv422ToBgr<align, T>(yuyv + colS, bgr + colD);
+                if (sizeS2A != sizeS)
+                    Yuyv422ToBgr<false, T>(yuyv + tailS, bgr + tailD);
+                yuyv += yuyvStride;
+                bgr += bgrStride;
+            }
+        }
+
+        template<bool align> void Yuyv422ToBgr(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuyv422ToBgr<align, Base::Bt601>(yuyv, yuyvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuyv422ToBgr<align, Base::Bt709>(yuyv, yuyvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuyv422ToBgr<align, Base::Bt2020>(yuyv, yuyvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Yuyv422ToBgr<align, Base::Trect871>(yuyv, yuyvStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuyv422ToBgr(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            if (Aligned(yuyv) && Aligned(yuyvStride) && Aligned(bgr) && Aligned(bgrStride))
+                Yuyv422ToBgr<true>(yuyv, yuyvStride, width, height, bgr, bgrStride, yuvType);
+            else
+                Yuyv422ToBgr<false>(yuyv, yuyvStride, width, height, bgr, bgrStride, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <bool align, class T> SIMD_INLINE void Yuyv422ToBgra(__m256i yuyv, const __m256i& a8, __m256i* bgra)
+        {
+            __m256i y = UnpackYuyvY<T>(yuyv);
+            __m256i u = UnpackYuyvU<T>(yuyv);
+            __m256i v = UnpackYuyvV<T>(yuyv);
+            __m256i bg8 = _mm256_or_si256(YuvToBlue16<T>(y, u), _mm256_slli_si256(YuvToGreen16<T>(y, u, v), 1));
+            __m256i ra8 = _mm256_or_si256(YuvToRed16<T>(y, v), a8);
+            __m256i lo = _mm256_unpacklo_epi16(bg8, ra8);
+            __m256i hi = _mm256_unpackhi_epi16(bg8, ra8);
+            Store<align>(bgra + 0, _mm256_permute2x128_si256(lo, hi, 0x20));
+            Store<align>(bgra + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+
+        template <bool align, class T> SIMD_INLINE void Yuyv422ToBgra(const uint8_t* yuyv, uint8_t* bgra, const __m256i& a8)
+        {
+            Yuyv422ToBgra<align, T>(Load<align>((__m256i*)yuyv + 0), a8, (__m256i*)bgra + 0);
+            Yuyv422ToBgra<align, T>(Load<align>((__m256i*)yuyv + 1), a8, (__m256i*)bgra + 2);
+        }
+
+        template <bool align, class T> void Yuyv422ToBgra(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (width >= A));
+            if (align)
+                assert(Aligned(yuyv) && Aligned(yuyvStride) && Aligned(bgra) && Aligned(bgraStride));
+
+            __m256i a8 = _mm256_slli_si256(_mm256_set1_epi16(alpha), 1);
+            size_t sizeS = width * 2, sizeD = width * 4;
+            size_t sizeS2A = AlignLo(sizeS, 2 * A);
+            size_t tailS = sizeS - 2 * A;
+            size_t tailD = sizeD - 4 * A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t colS = 0, colD = 0; colS < sizeS2A; colS += 2 * A, colD += 4 * A)
+                    Yuyv422ToBgra<align, T>(yuyv + colS, bgra + colD, a8);
+                if (sizeS2A != sizeS)
+                    Yuyv422ToBgra<false, T>(yuyv + tailS, bgra + tailD, a8);
+                yuyv += yuyvStride;
+                bgra += bgraStride;
+            }
+        }
+
+        template<bool align> void Yuyv422ToBgra(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuyv422ToBgra<align, Base::Bt601>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuyv422ToBgra<align, Base::Bt709>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuyv422ToBgra<align, Base::Bt2020>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvTrect871: Yuyv422ToBgra<align, Base::Trect871>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuyv422ToBgra(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(yuyv) && Aligned(yuyvStride) && Aligned(bgra) && Aligned(bgraStride))
+                Yuyv422ToBgra<true>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha, yuvType);
+            else
+                Yuyv422ToBgra<false>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+    }
+#endif
+}
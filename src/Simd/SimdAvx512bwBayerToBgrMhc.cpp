@@ -0,0 +1,215 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdUnpack.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512i LoadMhc(const uint8_t* p)
+        {
+            return _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)p));
+        }
+
+        template<bool greenOdd> SIMD_INLINE void BayerMhc32(const uint8_t* const* rows, size_t x, __m512i& own, __m512i& green, __m512i& other)
+        {
+            const __mmask32 mask = greenOdd ? 0xAAAAAAAA : 0x55555555;
+            const uint8_t* r0 = rows[0] + x, * r1 = rows[1] + x, * r2 = rows[2] + x, * r3 = rows[3] + x, * r4 = rows[4] + x;
+            __m512i c = LoadMhc(r2 + 2);
+            __m512i h1 = _mm512_add_epi16(LoadMhc(r2 + 1), LoadMhc(r2 + 3));
+            __m512i h2 = _mm512_add_epi16(LoadMhc(r2 + 0), LoadMhc(r2 + 4));
+            __m512i v1 = _mm512_add_epi16(LoadMhc(r1 + 2), LoadMhc(r3 + 2));
+            __m512i v2 = _mm512_add_epi16(LoadMhc(r0 + 2), LoadMhc(r4 + 2));
+            __m512i d = _mm512_add_epi16(_mm512_add_epi16(LoadMhc(r1 + 1), LoadMhc(r1 + 3)), _mm512_add_epi16(LoadMhc(r3 + 1), LoadMhc(r3 + 3)));
+            __m512i hv2 = _mm512_add_epi16(h2, v2);
+            __m512i c8 = _mm512_slli_epi16(c, 3);
+            __m512i c10 = _mm512_add_epi16(c8, _mm512_slli_epi16(c, 1));
+            __m512i c16 = _mm512_slli_epi16(c, 4);
+            __m512i gc = _mm512_sub_epi16(_mm512_add_epi16(c8, _mm512_slli_epi16(_mm512_add_epi16(h1, v1), 2)), _mm512_slli_epi16(hv2, 1));
+            __m512i xd = _mm512_add_epi16(_mm512_add_epi16(c8, _mm512_slli_epi16(c, 2)), _mm512_slli_epi16(d, 2));
+            xd = _mm512_sub_epi16(xd, _mm512_add_epi16(hv2, _mm512_slli_epi16(hv2, 1)));
+            __m512i hc = _mm512_add_epi16(_mm512_sub_epi16(_mm512_add_epi16(c10, _mm512_slli_epi16(h1, 3)), _mm512_slli_epi16(_mm512_add_epi16(h2, d), 1)), v2);
+            __m512i vc = _mm512_add_epi16(_mm512_sub_epi16(_mm512_add_epi16(c10, _mm512_slli_epi16(v1, 3)), _mm512_slli_epi16(_mm512_add_epi16(v2, d), 1)), h2);
+            own = _mm512_srai_epi16(_mm512_add_epi16(_mm512_mask_blend_epi16(mask, c16, hc), K16_0008), 4);
+            green = _mm512_srai_epi16(_mm512_add_epi16(_mm512_mask_blend_epi16(mask, gc, c16), K16_0008), 4);
+            other = _mm512_srai_epi16(_mm512_add_epi16(_mm512_mask_blend_epi16(mask, xd, vc), K16_0008), 4);
+        }
+
+        template<bool greenOdd> SIMD_INLINE void BayerMhc64(const uint8_t* const* rows, size_t x, bool redRow, __m512i bgr[3])
+        {
+            __m512i own0, green0, other0, own1, green1, other1;
+            BayerMhc32<greenOdd>(rows, x + 0, own0, green0, other0);
+            BayerMhc32<greenOdd>(rows, x + 32, own1, green1, other1);
+            bgr[redRow ? 2 : 0] = PackI16ToU8(own0, own1);
+            bgr[1] = PackI16ToU8(green0, green1);
+            bgr[redRow ? 0 : 2] = PackI16ToU8(other0, other1);
+        }
+
+        template<bool greenOdd> void BayerToBgrMhc(const uint8_t* const* rows, size_t width, bool redRow, uint8_t* bgr)
+        {
+            __m512i _bgr[3];
+            for (size_t col = 0; col < width;)
+            {
+                if (col + A > width)
+                    col = width - A;
+                BayerMhc64<greenOdd>(rows, col, redRow, _bgr);
+                uint8_t* dst = bgr + 3 * col;
+                _mm512_storeu_si512((__m512i*)dst + 0, InterleaveBgr<0>(_bgr[0], _bgr[1], _bgr[2]));
+                _mm512_storeu_si512((__m512i*)dst + 1, InterleaveBgr<1>(_bgr[0], _bgr[1], _bgr[2]));
+                _mm512_storeu_si512((__m512i*)dst + 2, InterleaveBgr<2>(_bgr[0], _bgr[1], _bgr[2]));
+                col += A;
+            }
+        }
+
+        void BayerToBgrMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            Base::BayerMhcRows buffer(bayer, bayerStride, width, height);
+            const uint8_t* rows[5];
+            bool redRow, greenOdd;
+            for (size_t row = 0; row < height; ++row)
+            {
+                buffer.Get(row, rows);
+                Base::BayerMhcRowType(bayerFormat, row, redRow, greenOdd);
+                if (greenOdd)
+                    BayerToBgrMhc<true>(rows, width, redRow, bgr);
+                else
+                    BayerToBgrMhc<false>(rows, width, redRow, bgr);
+                bgr += bgrStride;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void StoreMhcBgra(const __m512i bgr[3], const __m512i& alpha, uint8_t* bgra)
+        {
+            __m512i b = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, bgr[0]);
+            __m512i g = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, bgr[1]);
+            __m512i r = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, bgr[2]);
+            __m512i a = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, alpha);
+            __m512i bgLo = UnpackU8<0>(b, g);
+            __m512i bgHi = UnpackU8<1>(b, g);
+            __m512i raLo = UnpackU8<0>(r, a);
+            __m512i raHi = UnpackU8<1>(r, a);
+            _mm512_storeu_si512(bgra + 0 * A, UnpackU16<0>(bgLo, raLo));
+            _mm512_storeu_si512(bgra + 1 * A, UnpackU16<1>(bgLo, raLo));
+            _mm512_storeu_si512(bgra + 2 * A, UnpackU16<0>(bgHi, raHi));
+            _mm512_storeu_si512(bgra + 3 * A, UnpackU16<1>(bgHi, raHi));
+        }
+
+        template<bool greenOdd> void BayerToBgraMhc(const uint8_t* const* rows, size_t width, bool redRow, const __m512i& alpha, uint8_t* bgra)
+        {
+            __m512i bgr[3];
+            for (size_t col = 0; col < width;)
+            {
+                if (col + A > width)
+                    col = width - A;
+                BayerMhc64<greenOdd>(rows, col, redRow, bgr);
+                StoreMhcBgra(bgr, alpha, bgra + 4 * col);
+                col += A;
+            }
+        }
+
+        void BayerToBgraMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert(width >= A);
+
+            Base::BayerMhcRows buffer(bayer, bayerStride, width, height);
+            const uint8_t* rows[5];
+            bool redRow, greenOdd;
+            __m512i _alpha = _mm512_set1_epi8((char)alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                buffer.Get(row, rows);
+                Base::BayerMhcRowType(bayerFormat, row, redRow, greenOdd);
+                if (greenOdd)
+                    BayerToBgraMhc<true>(rows, width, redRow, _alpha, bgra);
+                else
+                    BayerToBgraMhc<false>(rows, width, redRow, _alpha, bgra);
+                bgra += bgraStride;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        const __m512i K16_MHC_BLUE_RED = SIMD_MM512_SET2_EPI16(Base::BLUE_TO_GRAY_WEIGHT, Base::RED_TO_GRAY_WEIGHT);
+        const __m512i K16_MHC_GREEN_ROUND = SIMD_MM512_SET2_EPI16(Base::GREEN_TO_GRAY_WEIGHT, Base::BGR_TO_GRAY_ROUND_TERM);
+
+        SIMD_INLINE __m512i MhcBgrToGray(__m512i blue, __m512i green, __m512i red)
+        {
+            blue = _mm512_max_epi16(_mm512_min_epi16(blue, K16_00FF), K_ZERO);
+            green = _mm512_max_epi16(_mm512_min_epi16(green, K16_00FF), K_ZERO);
+            red = _mm512_max_epi16(_mm512_min_epi16(red, K16_00FF), K_ZERO);
+            __m512i lo = _mm512_add_epi32(_mm512_madd_epi16(_mm512_unpacklo_epi16(blue, red), K16_MHC_BLUE_RED), _mm512_madd_epi16(_mm512_unpacklo_epi16(green, K16_0001), K16_MHC_GREEN_ROUND));
+            __m512i hi = _mm512_add_epi32(_mm512_madd_epi16(_mm512_unpackhi_epi16(blue, red), K16_MHC_BLUE_RED), _mm512_madd_epi16(_mm512_unpackhi_epi16(green, K16_0001), K16_MHC_GREEN_ROUND));
+            return _mm512_packs_epi32(_mm512_srai_epi32(lo, Base::BGR_TO_GRAY_AVERAGING_SHIFT), _mm512_srai_epi32(hi, Base::BGR_TO_GRAY_AVERAGING_SHIFT));
+        }
+
+        template<bool greenOdd> SIMD_INLINE __m512i BayerToGrayMhc32(const uint8_t* const* rows, size_t x, bool redRow)
+        {
+            __m512i own, green, other;
+            BayerMhc32<greenOdd>(rows, x, own, green, other);
+            return redRow ? MhcBgrToGray(other, green, own) : MhcBgrToGray(own, green, other);
+        }
+
+        template<bool greenOdd> void BayerToGrayMhc(const uint8_t* const* rows, size_t width, bool redRow, uint8_t* gray)
+        {
+            for (size_t col = 0; col < width;)
+            {
+                if (col + A > width)
+                    col = width - A;
+                __m512i lo = BayerToGrayMhc32<greenOdd>(rows, col + 0, redRow);
+                __m512i hi = BayerToGrayMhc32<greenOdd>(rows, col + 32, redRow);
+                _mm512_storeu_si512((__m512i*)(gray + col), PackI16ToU8(lo, hi));
+                col += A;
+            }
+        }
+
+        void BayerToGrayMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* gray, size_t grayStride)
+        {
+            assert(width >= A);
+
+            Base::BayerMhcRows buffer(bayer, bayerStride, width, height);
+            const uint8_t* rows[5];
+            bool redRow, greenOdd;
+            for (size_t row = 0; row < height; ++row)
+            {
+                buffer.Get(row, rows);
+                Base::BayerMhcRowType(bayerFormat, row, redRow, greenOdd);
+                if (greenOdd)
+                    BayerToGrayMhc<true>(rows, width, redRow, gray);
+                else
+                    BayerToGrayMhc<false>(rows, width, redRow, gray);
+                gray += grayStride;
+            }
+        }
+    }
+#endif
+}
@@ -245,6 +245,75 @@ namespace Simd
                 assert(0);
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool mask> SIMD_INLINE void BgrToNv12V2(const uint8_t* bgr0, size_t bgrStride, uint8_t* y0, size_t yStride, uint8_t* uv, const __mmask64* tails)
+        {
+            const uint8_t* bgr1 = bgr0 + bgrStride;
+            uint8_t* y1 = y0 + yStride;
+
+            __m512i _b16_r16[2][2][2], _g16_1[2][2][2];
+            Store<false, mask>(y0 + 0, LoadAndConvertBgrToY8V2<T, mask>(bgr0 + 0 * A, _b16_r16[0][0], _g16_1[0][0], tails + 0), tails[8]);
+            Store<false, mask>(y0 + A, LoadAndConvertBgrToY8V2<T, mask>(bgr0 + 3 * A, _b16_r16[0][1], _g16_1[0][1], tails + 4), tails[9]);
+            Store<false, mask>(y1 + 0, LoadAndConvertBgrToY8V2<T, mask>(bgr1 + 0 * A, _b16_r16[1][0], _g16_1[1][0], tails + 0), tails[8]);
+            Store<false, mask>(y1 + A, LoadAndConvertBgrToY8V2<T, mask>(bgr1 + 3 * A, _b16_r16[1][1], _g16_1[1][1], tails + 4), tails[9]);
+
+            Average16(_b16_r16[0][0][0], _b16_r16[1][0][0]);
+            Average16(_b16_r16[0][0][1], _b16_r16[1][0][1]);
+            Average16(_b16_r16[0][1][0], _b16_r16[1][1][0]);
+            Average16(_b16_r16[0][1][1], _b16_r16[1][1][1]);
+
+            Average16(_g16_1[0][0][0], _g16_1[1][0][0]);
+            Average16(_g16_1[0][0][1], _g16_1[1][0][1]);
+            Average16(_g16_1[0][1][0], _g16_1[1][1][0]);
+            Average16(_g16_1[0][1][1], _g16_1[1][1][1]);
+
+            __m512i _u = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, Permuted2Pack16iTo8u(BgrToU16<T>(_b16_r16[0][0], _g16_1[0][0]), BgrToU16<T>(_b16_r16[0][1], _g16_1[0][1])));
+            __m512i _v = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, Permuted2Pack16iTo8u(BgrToV16<T>(_b16_r16[0][0], _g16_1[0][0]), BgrToV16<T>(_b16_r16[0][1], _g16_1[0][1])));
+            Store<false, mask>(uv + 0, UnpackU8<0>(_u, _v), tails[8]);
+            Store<false, mask>(uv + A, UnpackU8<1>(_u, _v), tails[9]);
+        }
+
+        template <class T>  void BgrToNv12V2(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* y, size_t yStride,
+            uint8_t* uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            width /= 2;
+            size_t widthA = AlignLo(width - 1, A);
+            size_t tail = width - widthA;
+            __mmask64 tails[10];
+            for (size_t i = 0; i < 8; ++i)
+                tails[i] = TailMask64(tail * 6 - 48 * i) & 0x0000FFFFFFFFFFFF;
+            for (size_t i = 0; i < 2; ++i)
+                tails[8 + i] = TailMask64(tail * 2 - A * i);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < widthA; col += A)
+                    BgrToNv12V2<T, false>(bgr + col * 6, bgrStride, y + col * 2, yStride, uv + col * 2, tails);
+                if (tail)
+                    BgrToNv12V2<T, true>(bgr + col * 6, bgrStride, y + col * 2, yStride, uv + col * 2, tails);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        void BgrToNv12V2(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* y, size_t yStride,
+            uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToNv12V2<Base::Bt601>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgrToNv12V2<Base::Bt709>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgrToNv12V2<Base::Bt2020>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvTrect871: BgrToNv12V2<Base::Trect871>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            default:
+                assert(0);
+            }
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
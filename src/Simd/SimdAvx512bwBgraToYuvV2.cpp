@@ -333,6 +333,74 @@ namespace Simd
                 assert(0);
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool tail> SIMD_INLINE void BgraToNv12V2(const uint8_t* bgra0, size_t bgraStride, uint8_t* y0, size_t yStride, uint8_t* uv, const __mmask64* tails)
+        {
+            const uint8_t* bgra1 = bgra0 + bgraStride;
+            uint8_t* y1 = y0 + yStride;
+
+            __m512i _b16_r16[2][2][2], _g16_1[2][2][2];
+            Store<false, tail>(y0 + 0, LoadAndBgrToY8<T, tail>(bgra0 + 0 * A, _b16_r16[0][0], _g16_1[0][0], tails + 0), tails[8]);
+            Store<false, tail>(y0 + A, LoadAndBgrToY8<T, tail>(bgra0 + 4 * A, _b16_r16[0][1], _g16_1[0][1], tails + 4), tails[9]);
+            Store<false, tail>(y1 + 0, LoadAndBgrToY8<T, tail>(bgra1 + 0 * A, _b16_r16[1][0], _g16_1[1][0], tails + 0), tails[8]);
+            Store<false, tail>(y1 + A, LoadAndBgrToY8<T, tail>(bgra1 + 4 * A, _b16_r16[1][1], _g16_1[1][1], tails + 4), tails[9]);
+
+            Average16(_b16_r16[0][0][0], _b16_r16[1][0][0]);
+            Average16(_b16_r16[0][0][1], _b16_r16[1][0][1]);
+            Average16(_b16_r16[0][1][0], _b16_r16[1][1][0]);
+            Average16(_b16_r16[0][1][1], _b16_r16[1][1][1]);
+
+            Average16(_g16_1[0][0][0], _g16_1[1][0][0]);
+            Average16(_g16_1[0][0][1], _g16_1[1][0][1]);
+            Average16(_g16_1[0][1][0], _g16_1[1][1][0]);
+            Average16(_g16_1[0][1][1], _g16_1[1][1][1]);
+
+            __m512i _u = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, Permuted2Pack16iTo8u(BgrToU16<T>(_b16_r16[0][0], _g16_1[0][0]), BgrToU16<T>(_b16_r16[0][1], _g16_1[0][1])));
+            __m512i _v = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, Permuted2Pack16iTo8u(BgrToV16<T>(_b16_r16[0][0], _g16_1[0][0]), BgrToV16<T>(_b16_r16[0][1], _g16_1[0][1])));
+            Store<false, tail>(uv + 0, UnpackU8<0>(_u, _v), tails[8]);
+            Store<false, tail>(uv + A, UnpackU8<1>(_u, _v), tails[9]);
+        }
+
+        template <class T>  void BgraToNv12V2(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height, uint8_t* y, size_t yStride,
+            uint8_t* uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            size_t widthDA = AlignLo(width, DA);
+            size_t tail = width - widthDA;
+            __mmask64 tails[10];
+            for (size_t i = 0; i < 8; ++i)
+                tails[i] = TailMask64(tail * 4 - A * i);
+            for (size_t i = 0; i < 2; ++i)
+                tails[8 + i] = TailMask64(tail - A * i);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t colY = 0, colBgra = 0;
+                for (; colY < widthDA; colY += DA, colBgra += A * 8)
+                    BgraToNv12V2<T, false>(bgra + colBgra, bgraStride, y + colY, yStride, uv + colY, tails);
+                if (tail)
+                    BgraToNv12V2<T, true>(bgra + colBgra, bgraStride, y + colY, yStride, uv + colY, tails);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        void BgraToNv12V2(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height, uint8_t* y, size_t yStride,
+            uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToNv12V2<Base::Bt601>(bgra, bgraStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgraToNv12V2<Base::Bt709>(bgra, bgraStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgraToNv12V2<Base::Bt2020>(bgra, bgraStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvTrect871: BgraToNv12V2<Base::Trect871>(bgra, bgraStride, width, height, y, yStride, uv, uvStride); break;
+            default:
+                assert(0);
+            }
+        }
     }
 #endif
 }
@@ -0,0 +1,141 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE void BoxFilterCol8u(const uint8_t* add, const uint8_t* sub, uint32_t* sum, __mmask32 tail = -1)
+        {
+            __m512i d = _mm512_sub_epi16(_mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(tail, add)), _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(tail, sub)));
+            __mmask16 tail0 = __mmask16(tail), tail1 = __mmask16(tail >> 16);
+            _mm512_mask_storeu_epi32(sum + 0 * F, tail0, _mm512_add_epi32(_mm512_maskz_loadu_epi32(tail0, sum + 0 * F), _mm512_cvtepi16_epi32(_mm512_castsi512_si256(d))));
+            _mm512_mask_storeu_epi32(sum + 1 * F, tail1, _mm512_add_epi32(_mm512_maskz_loadu_epi32(tail1, sum + 1 * F), _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(d, 1))));
+        }
+
+        static void BoxFilterCol8u(const uint8_t* add, const uint8_t* sub, size_t size, uint8_t* sum)
+        {
+            uint32_t* ps = (uint32_t*)sum;
+            size_t sizeHA = AlignLo(size, HA), i = 0;
+            for (; i < sizeHA; i += HA)
+                BoxFilterCol8u(add + i, sub + i, ps + i);
+            if (i < size)
+                BoxFilterCol8u(add + i, sub + i, ps + i, TailMask32(size - i));
+        }
+
+        static void BoxFilterCol32f(const uint8_t* add, const uint8_t* sub, size_t size, uint8_t* sum)
+        {
+            const float* pa = (const float*)add, * pb = (const float*)sub;
+            float* ps = (float*)sum;
+            size_t sizeF = AlignLo(size, F), sizeF4 = AlignLo(size, 4 * F), i = 0;
+            for (; i < sizeF4; i += 4 * F)
+            {
+                _mm512_storeu_ps(ps + i + 0 * F, _mm512_add_ps(_mm512_loadu_ps(ps + i + 0 * F), _mm512_sub_ps(_mm512_loadu_ps(pa + i + 0 * F), _mm512_loadu_ps(pb + i + 0 * F))));
+                _mm512_storeu_ps(ps + i + 1 * F, _mm512_add_ps(_mm512_loadu_ps(ps + i + 1 * F), _mm512_sub_ps(_mm512_loadu_ps(pa + i + 1 * F), _mm512_loadu_ps(pb + i + 1 * F))));
+                _mm512_storeu_ps(ps + i + 2 * F, _mm512_add_ps(_mm512_loadu_ps(ps + i + 2 * F), _mm512_sub_ps(_mm512_loadu_ps(pa + i + 2 * F), _mm512_loadu_ps(pb + i + 2 * F))));
+                _mm512_storeu_ps(ps + i + 3 * F, _mm512_add_ps(_mm512_loadu_ps(ps + i + 3 * F), _mm512_sub_ps(_mm512_loadu_ps(pa + i + 3 * F), _mm512_loadu_ps(pb + i + 3 * F))));
+            }
+            for (; i < sizeF; i += F)
+                _mm512_storeu_ps(ps + i, _mm512_add_ps(_mm512_loadu_ps(ps + i), _mm512_sub_ps(_mm512_loadu_ps(pa + i), _mm512_loadu_ps(pb + i))));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                _mm512_mask_storeu_ps(ps + i, tail, _mm512_add_ps(_mm512_maskz_loadu_ps(tail, ps + i), 
+                    _mm512_sub_ps(_mm512_maskz_loadu_ps(tail, pa + i), _mm512_maskz_loadu_ps(tail, pb + i))));
+            }
+        }
+
+        SIMD_INLINE void BoxFilterStore8u(const uint32_t* sum, __m512 scale, uint8_t* dst, __mmask16 tail = -1)
+        {
+            __m512i value = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_maskz_loadu_epi32(tail, sum)), scale));
+            _mm_mask_storeu_epi8(dst, tail, _mm512_cvtusepi32_epi8(value));
+        }
+
+        static void BoxFilterStore8u(const uint8_t* sum, size_t size, float scale, uint8_t* dst)
+        {
+            const uint32_t* ps = (const uint32_t*)sum;
+            __m512 _scale = _mm512_set1_ps(scale);
+            size_t sizeF = AlignLo(size, F), sizeF4 = AlignLo(size, 4 * F), i = 0;
+            for (; i < sizeF4; i += 4 * F)
+            {
+                BoxFilterStore8u(ps + i + 0 * F, _scale, dst + i + 0 * F);
+                BoxFilterStore8u(ps + i + 1 * F, _scale, dst + i + 1 * F);
+                BoxFilterStore8u(ps + i + 2 * F, _scale, dst + i + 2 * F);
+                BoxFilterStore8u(ps + i + 3 * F, _scale, dst + i + 3 * F);
+            }
+            for (; i < sizeF; i += F)
+                BoxFilterStore8u(ps + i, _scale, dst + i);
+            if (i < size)
+                BoxFilterStore8u(ps + i, _scale, dst + i, TailMask16(size - i));
+        }
+
+        static void BoxFilterStore32f(const uint8_t* sum, size_t size, float scale, uint8_t* dst)
+        {
+            const float* ps = (const float*)sum;
+            float* pd = (float*)dst;
+            __m512 _scale = _mm512_set1_ps(scale);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm512_storeu_ps(pd + i, _mm512_mul_ps(_mm512_loadu_ps(ps + i), _scale));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                _mm512_mask_storeu_ps(pd + i, tail, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, ps + i), _scale));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        BoxFilterDefault::BoxFilterDefault(const BoxFilterParam& param)
+            : Avx2::BoxFilterDefault(param)
+        {
+            if (_param.type == SimdPixelFormatGray8)
+            {
+                _col = BoxFilterCol8u;
+                _store = BoxFilterStore8u;
+            }
+            else
+            {
+                _col = BoxFilterCol32f;
+                _store = BoxFilterStore32f;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type,
+            size_t radiusX, size_t radiusY, SimdBorderType border, const float* borderValue)
+        {
+            BoxFilterParam param(width, height, channels, type, radiusX, radiusY, border, borderValue);
+            if (!param.Valid())
+                return NULL;
+            return new BoxFilterDefault(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,153 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<bool l2> SIMD_INLINE __m512i CannyMagnitude(__m512i dx, __m512i dy)
+        {
+            return l2 ? _mm512_add_epi32(_mm512_mullo_epi32(dx, dx), _mm512_mullo_epi32(dy, dy)) : _mm512_add_epi32(_mm512_abs_epi32(dx), _mm512_abs_epi32(dy));
+        }
+
+        SIMD_INLINE __m128i CannyDirection(__m512i dx, __m512i dy)
+        {
+            __m512i ax = _mm512_abs_epi32(dx), ay = _mm512_slli_epi32(_mm512_abs_epi32(dy), 15);
+            __m512i tg22x = _mm512_mullo_epi32(ax, _mm512_set1_epi32(Base::CANNY_TG22));
+            __m512i tg67x = _mm512_add_epi32(tg22x, _mm512_slli_epi32(ax, 16));
+            __m512i dir = _mm512_sub_epi32(_mm512_set1_epi32(Base::CannyDirMainDiagonal), _mm512_srai_epi32(_mm512_xor_si512(dx, dy), 31));
+            dir = _mm512_mask_mov_epi32(dir, _mm512_cmpgt_epi32_mask(ay, tg67x), _mm512_set1_epi32(Base::CannyDirVertical));
+            dir = _mm512_mask_mov_epi32(dir, _mm512_cmplt_epi32_mask(ay, tg22x), _mm512_set1_epi32(Base::CannyDirHorizontal));
+            return _mm512_cvtepi32_epi8(dir);
+        }
+
+        SIMD_INLINE __m512i LoadU8(const uint8_t* src)
+        {
+            return _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)src));
+        }
+
+        template<bool l2> SIMD_INLINE void CannyGradient(const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, size_t x, int32_t* mag, uint8_t* dir)
+        {
+            __m512i a0 = LoadU8(s0 + x - 1), b0 = LoadU8(s0 + x), c0 = LoadU8(s0 + x + 1);
+            __m512i a1 = LoadU8(s1 + x - 1), c1 = LoadU8(s1 + x + 1);
+            __m512i a2 = LoadU8(s2 + x - 1), b2 = LoadU8(s2 + x), c2 = LoadU8(s2 + x + 1);
+            __m512i dx = _mm512_sub_epi16(_mm512_add_epi16(_mm512_add_epi16(c0, c2), _mm512_slli_epi16(c1, 1)), _mm512_add_epi16(_mm512_add_epi16(a0, a2), _mm512_slli_epi16(a1, 1)));
+            __m512i dy = _mm512_sub_epi16(_mm512_add_epi16(_mm512_add_epi16(a2, c2), _mm512_slli_epi16(b2, 1)), _mm512_add_epi16(_mm512_add_epi16(a0, c0), _mm512_slli_epi16(b0, 1)));
+            __m512i dx0 = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(dx)), dx1 = _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(dx, 1));
+            __m512i dy0 = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(dy)), dy1 = _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(dy, 1));
+            _mm512_storeu_si512(mag + x + 0 * F, CannyMagnitude<l2>(dx0, dy0));
+            _mm512_storeu_si512(mag + x + 1 * F, CannyMagnitude<l2>(dx1, dy1));
+            _mm_storeu_si128((__m128i*)(dir + x) + 0, CannyDirection(dx0, dy0));
+            _mm_storeu_si128((__m128i*)(dir + x) + 1, CannyDirection(dx1, dy1));
+        }
+
+        template<bool l2> void CannyGradientRow(const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, size_t width, int32_t* mag, uint8_t* dir)
+        {
+            if (width < HA + 2)
+            {
+                for (size_t x = 0; x < width; ++x)
+                    Base::CannyGradient<l2>(s0, s1, s2, x ? x - 1 : 0, x, Simd::Min(x + 1, width - 1), mag, dir);
+                return;
+            }
+            Base::CannyGradient<l2>(s0, s1, s2, 0, 0, 1, mag, dir);
+            size_t body = width - 1, x = 1;
+            for (; x + HA <= body; x += HA)
+                CannyGradient<l2>(s0, s1, s2, x, mag, dir);
+            if (x < body)
+                CannyGradient<l2>(s0, s1, s2, body - HA, mag, dir);
+            Base::CannyGradient<l2>(s0, s1, s2, width - 2, width - 1, width - 1, mag, dir);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void CannyNms(const int32_t* m0, const int32_t* m1, const int32_t* m2, const uint8_t* dir, size_t x, __m512i low, __m512i high, uint8_t* map, __mmask16 tail = -1)
+        {
+            __m512i m = _mm512_maskz_loadu_epi32(tail, m1 + x);
+            __m512i d = _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, dir + x));
+            __mmask16 isH = _mm512_cmpeq_epi32_mask(d, _mm512_set1_epi32(Base::CannyDirHorizontal));
+            __mmask16 isV = _mm512_cmpeq_epi32_mask(d, _mm512_set1_epi32(Base::CannyDirVertical));
+            __mmask16 isM = _mm512_cmpeq_epi32_mask(d, _mm512_set1_epi32(Base::CannyDirMainDiagonal));
+            __m512i prev = _mm512_mask_blend_epi32(isM, _mm512_maskz_loadu_epi32(tail, m0 + x + 1), _mm512_maskz_loadu_epi32(tail, m0 + x - 1));
+            prev = _mm512_mask_blend_epi32(isV, prev, _mm512_maskz_loadu_epi32(tail, m0 + x));
+            prev = _mm512_mask_blend_epi32(isH, prev, _mm512_maskz_loadu_epi32(tail, m1 + x - 1));
+            __m512i next = _mm512_mask_blend_epi32(isM, _mm512_maskz_loadu_epi32(tail, m2 + x - 1), _mm512_maskz_loadu_epi32(tail, m2 + x + 1));
+            next = _mm512_mask_blend_epi32(isV, next, _mm512_maskz_loadu_epi32(tail, m2 + x));
+            next = _mm512_mask_blend_epi32(isH, next, _mm512_maskz_loadu_epi32(tail, m1 + x + 1));
+            __mmask16 cand = _mm512_cmpgt_epi32_mask(m, low) & _mm512_cmpgt_epi32_mask(m, prev) & _mm512_cmpge_epi32_mask(m, next);
+            __mmask16 strong = cand & _mm512_cmpgt_epi32_mask(m, high);
+            __m512i codes = _mm512_mask_mov_epi32(_mm512_maskz_mov_epi32(cand, _mm512_set1_epi32(1)), strong, _mm512_set1_epi32(2));
+            _mm_mask_storeu_epi8(map + x, tail, _mm512_cvtepi32_epi8(codes));
+        }
+
+        static void CannyNmsRow(const int32_t* m0, const int32_t* m1, const int32_t* m2, const uint8_t* dir, size_t width, int32_t low, int32_t high, uint8_t* map)
+        {
+            __m512i _low = _mm512_set1_epi32(low), _high = _mm512_set1_epi32(high);
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+                CannyNms(m0, m1, m2, dir, x, _low, _high, map);
+            if (x < width)
+                CannyNms(m0, m1, m2, dir, x, _low, _high, map, TailMask16(width - x));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void CannyOutput(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            __m512i edge = _mm512_set1_epi8(2);
+            size_t widthA = AlignLo(width, A), x = 0;
+            for (; x < widthA; x += A)
+                _mm512_storeu_si512(dst + x, _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(_mm512_loadu_si512(map + x), edge)));
+            if (x < width)
+            {
+                __mmask64 tail = TailMask64(width - x);
+                _mm512_mask_storeu_epi8(dst + x, tail, _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(_mm512_maskz_loadu_epi8(tail, map + x), edge)));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        CannyDefault::CannyDefault(const CannyParam& param)
+            : Avx2::CannyDefault(param)
+        {
+            _gradient = _param.l2 ? CannyGradientRow<true> : CannyGradientRow<false>;
+            _nms = CannyNmsRow;
+            _output = CannyOutput;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CannyInit(size_t width, size_t height, float low, float high, SimdBool l2)
+        {
+            CannyParam param(width, height, low, high, l2);
+            if (!param.Valid())
+                return NULL;
+            return new CannyDefault(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,109 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdConnectedComponents.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        void CclRowRuns(const uint8_t* mask, size_t width, Base::CclRuns& runs)
+        {
+            size_t widthA = AlignLo(width, A), x = 0, beg = 0;
+            bool open = false;
+            __m512i zero = _mm512_setzero_si512();
+            for (; x < widthA; x += A)
+            {
+                uint64_t on = ~(uint64_t)_mm512_cmpeq_epi8_mask(_mm512_loadu_si512((__m512i*)(mask + x)), zero);
+                uint64_t edges = on ^ ((on << 1) | uint64_t(open));
+                for (; edges; edges &= edges - 1)
+                {
+                    size_t i = x + FirstNotZero64(edges);
+                    if (open)
+                        runs.push_back(Base::CclRun((uint32_t)beg, (uint32_t)i, (uint32_t)runs.size()));
+                    else
+                        beg = i;
+                    open = !open;
+                }
+            }
+            for (; x < width; ++x)
+            {
+                bool on = mask[x] != 0;
+                if (on != open)
+                {
+                    if (on)
+                        beg = x;
+                    else
+                        runs.push_back(Base::CclRun((uint32_t)beg, (uint32_t)x, (uint32_t)runs.size()));
+                    open = on;
+                }
+            }
+            if (open)
+                runs.push_back(Base::CclRun((uint32_t)beg, (uint32_t)width, (uint32_t)runs.size()));
+        }
+
+        SIMD_INLINE void CclFill(uint32_t* dst, size_t beg, size_t end, uint32_t value)
+        {
+            __m512i _value = _mm512_set1_epi32(value);
+            size_t x = beg;
+            for (; x + F <= end; x += F)
+                _mm512_storeu_si512((__m512i*)(dst + x), _value);
+            for (; x < end; ++x)
+                dst[x] = value;
+        }
+
+        void CclFillRow(const Base::CclRun* runs, size_t count, size_t width, const uint32_t* ids, uint32_t* dst)
+        {
+            size_t x = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                CclFill(dst, x, runs[i].beg, 0);
+                CclFill(dst, runs[i].beg, runs[i].end, ids[i]);
+                x = runs[i].end;
+            }
+            CclFill(dst, x, width, 0);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ConnectedComponentsDefault::ConnectedComponentsDefault(const ConnectedComponentsParam& param)
+            : Avx2::ConnectedComponentsDefault(param)
+        {
+            _rowRuns = CclRowRuns;
+            _fillRow = CclFillRow;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ConnectedComponentsInit(size_t width, size_t height, size_t connectivity)
+        {
+            ConnectedComponentsParam param(width, height, connectivity);
+            if (!param.Valid())
+                return NULL;
+            return new ConnectedComponentsDefault(param);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -130,6 +130,7 @@ namespace Simd
             case SimdImageFilePpmBin: return new ImagePpmBinLoader(param);
             case SimdImageFilePng: return new Sse41::ImagePngLoader(param);
             case SimdImageFileJpeg: return new Sse41::ImageJpegLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
             default:
                 return NULL;
             }
@@ -149,6 +150,11 @@ namespace Simd
             }
             return NULL;
         }
+
+        void* ImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            return Simd::ImageMapFromFile(CreateImageLoader, path, width, height, format);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
@@ -0,0 +1,69 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageLoad.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        ImageQoiLoader::ImageQoiLoader(const ImageLoaderParam& param)
+            : Avx2::ImageQoiLoader(param)
+        {
+        }
+
+        void ImageQoiLoader::SetConverters()
+        {
+            Avx2::ImageQoiLoader::SetConverters();
+            if (_image.width >= A)
+            {
+                if (_channels == 3)
+                {
+                    switch (_param.format)
+                    {
+                    case SimdPixelFormatGray8: _toAny = Avx512bw::RgbToGray; break;
+                    case SimdPixelFormatBgr24: _toAny = Avx512bw::BgrToRgb; break;
+                    case SimdPixelFormatBgra32: _toBgra = Avx512bw::RgbToBgra; break;
+                    case SimdPixelFormatRgba32: _toBgra = Avx512bw::BgrToBgra; break;
+                    default: break;
+                    }
+                }
+                else
+                {
+                    switch (_param.format)
+                    {
+                    case SimdPixelFormatGray8: _toAny = Avx512bw::RgbaToGray; break;
+                    case SimdPixelFormatBgr24: _toAny = Avx512bw::BgraToRgb; break;
+                    case SimdPixelFormatBgra32: _toAny = Avx512bw::BgraToRgba; break;
+                    case SimdPixelFormatRgb24: _toAny = Avx512bw::BgraToBgr; break;
+                    default: break;
+                    }
+                }
+            }
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -0,0 +1,83 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdPyramidBuilder.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        PyramidBuilder::PyramidBuilder(const PyramidBuilderParam& param, Base::ResizerInitPtr resizerInit)
+            : Avx2::PyramidBuilder(param, resizerInit)
+        {
+        }
+
+        void PyramidBuilder::Reduce(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t* dst, size_t dstWidth, size_t dstHeight, size_t dstStride) const
+        {
+            switch (_param.reduce)
+            {
+            case SimdReduce2x2:
+                ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                return;
+            case SimdReduce3x3:
+                if (srcWidth >= DA)
+                {
+                    ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, _param.compensation);
+                    return;
+                }
+                break;
+            case SimdReduce4x4:
+                if (srcWidth > DA)
+                {
+                    ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                    return;
+                }
+                break;
+            case SimdReduce5x5:
+                if (srcWidth >= DA)
+                {
+                    ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, _param.compensation);
+                    return;
+                }
+                break;
+            default:
+                break;
+            }
+            Avx2::PyramidBuilder::Reduce(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* PyramidBuilderInit(size_t width, size_t height, size_t levels, double scale, SimdReduceType reduce, SimdBool compensation)
+        {
+            PyramidBuilderParam param(width, height, levels, scale, reduce, compensation == SimdTrue);
+            if (!param.Valid())
+                return NULL;
+            return new PyramidBuilder(param, ResizerInit);
+        }
+    }
+#endif
+}
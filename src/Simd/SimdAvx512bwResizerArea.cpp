@@ -136,7 +136,9 @@ namespace Simd
             int32_t ay0 = ay[0], ax0 = ax[0];
             size_t rowSizeA = AlignLo(rowSize, A);
             __mmask64 tail = TailMask64(rowSize - rowSizeA);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            dst += _yBeg * dstStride;
+            src += iy[_yBeg] * srcStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += rowRest)
             {
                 int32_t * buf = _by.data;
                 size_t yn = iy[dy + 1] - iy[dy];
@@ -157,6 +159,7 @@ namespace Simd
 
         void ResizerByteArea1x1::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
         {
+            EstimateRows();
             switch (_param.channels)
             {
             case 1: Run<1>(src, srcStride, dst, dstStride); return;
@@ -302,7 +305,9 @@ namespace Simd
             size_t bodyW = _param.dstW - (N == 3 ? 1 : 0), rowSize = _param.srcW * N, rowRest = dstStride - _param.dstW * N;
             const int32_t* iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            dst += _yBeg * dstStride;
+            src += iy[_yBeg] * 2 * srcStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += rowRest)
             {
                 int32_t* buf = _by.data;
                 size_t yn = (iy[dy + 1] - iy[dy]) * 2;
@@ -324,6 +329,7 @@ namespace Simd
 
         void ResizerByteArea2x2::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
+            EstimateRows();
             switch (_param.channels)
             {
             case 1: Run<1>(src, srcStride, dst, dstStride); return;
@@ -27,6 +27,7 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdSet.h"
 #include "Simd/SimdUpdate.h"
+#include "Simd/SimdBFloat16.h"
 
 namespace Simd
 {
@@ -219,7 +220,8 @@ namespace Simd
             const int32_t * ix = _ix.data;
             size_t dstW = _param.dstW;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm512_set1_epi16(int16_t(_ay[yDst]));
@@ -265,7 +267,8 @@ namespace Simd
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm512_set1_epi16(int16_t(_ay[yDst]));
@@ -302,6 +305,7 @@ namespace Simd
         {
             assert(_param.dstW >= A);
 
+            EstimateRows();
             EstimateParams();
             switch (_param.channels)
             {
@@ -425,7 +429,8 @@ namespace Simd
             size_t rs32 = AlignLo(rs, 32);
             __mmask16 tail16 = TailMask16(rs - rs16);
             __m512 _1 = _mm512_set1_ps(1.0f);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -555,7 +560,8 @@ namespace Simd
             size_t rs32 = AlignLo(rs, 32);
             __mmask16 tail16 = TailMask16(rs - rs16);
             __m512 _1 = _mm512_set1_ps(1.0f);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -737,7 +743,8 @@ namespace Simd
             int32_t prev = -2;
             size_t rsa = AlignLo(rs, Avx512bw::F);
             __mmask16 tail = TailMask16(rs - rsa);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -856,6 +863,82 @@ namespace Simd
                 }
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerBf16Bilinear::ResizerBf16Bilinear(const ResParam& param)
+            : Avx2::ResizerBf16Bilinear(param)
+        {
+        }
+
+        void ResizerBf16Bilinear::Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride)
+        {
+            size_t cn = _param.channels;
+            size_t rs = _param.dstW * cn;
+            float* pbx[2] = { _bx[0].data, _bx[1].data };
+            int32_t prev = -2;
+            size_t rsF = AlignLo(rs, F);
+            __mmask16 tail = TailMask16(rs - rsF);
+            __m512 _1 = _mm512_set1_ps(1.0f);
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                __m512 fy1 = _mm512_set1_ps(_ay[dy]);
+                __m512 fy0 = _mm512_sub_ps(_1, fy1);
+                int32_t sy = _iy[dy];
+                int32_t k = 0;
+
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+
+                prev = sy;
+
+                for (; k < 2; k++)
+                {
+                    float* pb = pbx[k];
+                    const uint16_t* ps0 = src + (sy + k) * srcStride;
+                    const uint16_t* ps1 = ps0 + cn - 1;
+                    size_t dx = 0;
+                    for (; dx < rsF; dx += F)
+                    {
+                        __m512i idx = _mm512_loadu_si512(_ix.data + dx);
+                        __m512i s0 = _mm512_i32gather_epi32(idx, ps0, 2);
+                        __m512i s1 = cn == 1 ? s0 : _mm512_i32gather_epi32(idx, ps1, 2);
+                        __m512 fx1 = _mm512_loadu_ps(_ax.data + dx);
+                        __m512 fx0 = _mm512_sub_ps(_1, fx1);
+                        __m512 m1 = _mm512_mul_ps(BFloat16ToFloat32Odd(s1), fx1);
+                        _mm512_storeu_ps(pb + dx, _mm512_fmadd_ps(BFloat16ToFloat32Even(s0), fx0, m1));
+                    }
+                    if (tail)
+                    {
+                        __m512i idx = _mm512_maskz_loadu_epi32(tail, _ix.data + dx);
+                        __m512i s0 = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail, idx, ps0, 2);
+                        __m512i s1 = cn == 1 ? s0 : _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail, idx, ps1, 2);
+                        __m512 fx1 = _mm512_maskz_loadu_ps(tail, _ax.data + dx);
+                        __m512 fx0 = _mm512_sub_ps(_1, fx1);
+                        __m512 m1 = _mm512_mul_ps(BFloat16ToFloat32Odd(s1), fx1);
+                        _mm512_mask_storeu_ps(pb + dx, tail, _mm512_fmadd_ps(BFloat16ToFloat32Even(s0), fx0, m1));
+                    }
+                }
+
+                size_t dx = 0;
+                for (; dx < rsF; dx += F)
+                {
+                    __m512 d = _mm512_fmadd_ps(_mm512_loadu_ps(pbx[0] + dx), fy0, _mm512_mul_ps(_mm512_loadu_ps(pbx[1] + dx), fy1));
+                    _mm256_storeu_si256((__m256i*)(dst + dx), _mm512_cvtepi32_epi16(Float32ToBFloat16(d)));
+                }
+                if (tail)
+                {
+                    __m512 d = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail, pbx[0] + dx), fy0, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, pbx[1] + dx), fy1));
+                    _mm256_mask_storeu_epi16(dst + dx, tail, _mm512_cvtepi32_epi16(Float32ToBFloat16(d)));
+                }
+            }
+        }
     }
 #endif //SIMD_AVX512BW_ENABLE 
 }
@@ -0,0 +1,113 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        ResizerFilter::ResizerFilter(const ResParam& param)
+            : Avx2::ResizerFilter(param)
+        {
+        }
+
+        void ResizerFilter::ConvertRow(const uint8_t* src, float* dst)
+        {
+            size_t size = _param.srcW * _param.channels, sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)(src + i)))));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                _mm512_mask_storeu_ps(dst + i, tail, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, src + i))));
+            }
+        }
+
+        SIMD_INLINE __m512 FilterRow(const float* src, const float* ax, __m512i idx, size_t cn, size_t nx, size_t rs, __mmask16 tail = -1)
+        {
+            __m512 sum = _mm512_mul_ps(_mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, idx, src, 4), _mm512_maskz_loadu_ps(tail, ax));
+            for (size_t k = 1; k < nx; k++)
+            {
+                src += cn, ax += rs;
+                sum = _mm512_fmadd_ps(_mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, idx, src, 4), _mm512_maskz_loadu_ps(tail, ax), sum);
+            }
+            return sum;
+        }
+
+        void ResizerFilter::FilterRow(const float* src, float* dst)
+        {
+            size_t cn = _param.channels, rsF = AlignLo(_rs, F), dx = 0;
+            for (; dx < rsF; dx += F)
+            {
+                __m512i idx = _mm512_loadu_si512(_ix.data + dx);
+                _mm512_storeu_ps(dst + dx, Avx512bw::FilterRow(src, _ax.data + dx, idx, cn, _nx, _rs));
+            }
+            if (dx < _rs)
+            {
+                __mmask16 tail = TailMask16(_rs - dx);
+                __m512i idx = _mm512_maskz_loadu_epi32(tail, _ix.data + dx);
+                _mm512_mask_storeu_ps(dst + dx, tail, Avx512bw::FilterRow(src, _ax.data + dx, idx, cn, _nx, _rs, tail));
+            }
+        }
+
+        SIMD_INLINE __m512 FilterCol(const float* const* src, const float* ay, size_t ny, size_t offset, __mmask16 tail = -1)
+        {
+            __m512 sum = _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, src[0] + offset), _mm512_set1_ps(ay[0]));
+            for (size_t k = 1; k < ny; k++)
+                sum = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail, src[k] + offset), _mm512_set1_ps(ay[k]), sum);
+            return sum;
+        }
+
+        SIMD_INLINE void StoreByte(uint8_t* dst, __m512 value, __mmask16 tail = -1)
+        {
+            __m512i i32 = _mm512_max_epi32(_mm512_cvtps_epi32(value), _mm512_setzero_si512());
+            _mm_mask_storeu_epi8(dst, tail, _mm512_cvtusepi32_epi8(i32));
+        }
+
+        void ResizerFilter::FilterCol(const float* const* src, const float* ay, uint8_t* dst)
+        {
+            size_t rsF = AlignLo(_rs, F), dx = 0;
+            __mmask16 tail = TailMask16(_rs - rsF);
+            if (_param.type == SimdResizeChannelByte)
+            {
+                for (; dx < rsF; dx += F)
+                    StoreByte(dst + dx, Avx512bw::FilterCol(src, ay, _ny, dx));
+                if (tail)
+                    StoreByte(dst + dx, Avx512bw::FilterCol(src, ay, _ny, dx, tail), tail);
+            }
+            else
+            {
+                float* pd = (float*)dst;
+                for (; dx < rsF; dx += F)
+                    _mm512_storeu_ps(pd + dx, Avx512bw::FilterCol(src, ay, _ny, dx));
+                if (tail)
+                    _mm512_mask_storeu_ps(pd + dx, tail, Avx512bw::FilterCol(src, ay, _ny, dx, tail));
+            }
+        }
+    }
+#endif //SIMD_AVX512BW_ENABLE
+}
@@ -0,0 +1,201 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSeparableFilter.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<SimdPixelFormatType type> void SepFilterLoad(const uint8_t* src, size_t size, float* dst);
+
+        template<> void SepFilterLoad<SimdPixelFormatGray8>(const uint8_t* src, size_t size, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)(src + i)))));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                _mm512_mask_storeu_ps(dst + i, tail, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, src + i))));
+            }
+        }
+
+        template<> void SepFilterLoad<SimdPixelFormatInt16>(const uint8_t* src, size_t size, float* dst)
+        {
+            const int16_t* ps = (const int16_t*)src;
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm512_storeu_ps(dst + i, _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm256_loadu_si256((__m256i*)(ps + i)))));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                _mm512_mask_storeu_ps(dst + i, tail, _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm256_maskz_loadu_epi16(tail, ps + i))));
+            }
+        }
+
+        template<> void SepFilterLoad<SimdPixelFormatFloat>(const uint8_t* src, size_t size, float* dst)
+        {
+            memcpy(dst, src, size * sizeof(float));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void SepFilterRow(const float* src, size_t size, size_t channels, const float* kernel, size_t kernelSize, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), sizeF4 = AlignLo(size, 4 * F), i = 0;
+            for (; i < sizeF4; i += 4 * F)
+            {
+                __m512 sum0 = _mm512_setzero_ps();
+                __m512 sum1 = _mm512_setzero_ps();
+                __m512 sum2 = _mm512_setzero_ps();
+                __m512 sum3 = _mm512_setzero_ps();
+                for (size_t k = 0; k < kernelSize; ++k)
+                {
+                    __m512 w = _mm512_set1_ps(kernel[k]);
+                    const float* ps = src + i + k * channels;
+                    sum0 = _mm512_add_ps(_mm512_mul_ps(w, _mm512_loadu_ps(ps + 0 * F)), sum0);
+                    sum1 = _mm512_add_ps(_mm512_mul_ps(w, _mm512_loadu_ps(ps + 1 * F)), sum1);
+                    sum2 = _mm512_add_ps(_mm512_mul_ps(w, _mm512_loadu_ps(ps + 2 * F)), sum2);
+                    sum3 = _mm512_add_ps(_mm512_mul_ps(w, _mm512_loadu_ps(ps + 3 * F)), sum3);
+                }
+                _mm512_storeu_ps(dst + i + 0 * F, sum0);
+                _mm512_storeu_ps(dst + i + 1 * F, sum1);
+                _mm512_storeu_ps(dst + i + 2 * F, sum2);
+                _mm512_storeu_ps(dst + i + 3 * F, sum3);
+            }
+            for (; i < sizeF; i += F)
+            {
+                __m512 sum = _mm512_setzero_ps();
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum = _mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps(kernel[k]), _mm512_loadu_ps(src + i + k * channels)), sum);
+                _mm512_storeu_ps(dst + i, sum);
+            }
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512 sum = _mm512_setzero_ps();
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum = _mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps(kernel[k]), _mm512_maskz_loadu_ps(tail, src + i + k * channels)), sum);
+                _mm512_mask_storeu_ps(dst + i, tail, sum);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdPixelFormatType type> SIMD_INLINE void SepFilterStore(const __m512& sum, uint8_t* dst, size_t index, __mmask16 tail = -1);
+
+        template<> SIMD_INLINE void SepFilterStore<SimdPixelFormatGray8>(const __m512& sum, uint8_t* dst, size_t index, __mmask16 tail)
+        {
+            __m512i i32 = _mm512_max_epi32(_mm512_cvtps_epi32(sum), K_ZERO);
+            _mm_mask_storeu_epi8(dst + index, tail, _mm512_cvtusepi32_epi8(i32));
+        }
+
+        template<> SIMD_INLINE void SepFilterStore<SimdPixelFormatInt16>(const __m512& sum, uint8_t* dst, size_t index, __mmask16 tail)
+        {
+            _mm256_mask_storeu_epi16((int16_t*)dst + index, tail, _mm512_cvtsepi32_epi16(_mm512_cvtps_epi32(sum)));
+        }
+
+        template<> SIMD_INLINE void SepFilterStore<SimdPixelFormatFloat>(const __m512& sum, uint8_t* dst, size_t index, __mmask16 tail)
+        {
+            _mm512_mask_storeu_ps((float*)dst + index, tail, sum);
+        }
+
+        template<SimdPixelFormatType type> void SepFilterCol(const float* src, size_t stride, size_t size, const float* kernel, size_t kernelSize, uint8_t* dst)
+        {
+            size_t sizeF = AlignLo(size, F), sizeF4 = AlignLo(size, 4 * F), i = 0;
+            for (; i < sizeF4; i += 4 * F)
+            {
+                __m512 sum0 = _mm512_setzero_ps();
+                __m512 sum1 = _mm512_setzero_ps();
+                __m512 sum2 = _mm512_setzero_ps();
+                __m512 sum3 = _mm512_setzero_ps();
+                for (size_t k = 0; k < kernelSize; ++k)
+                {
+                    __m512 w = _mm512_set1_ps(kernel[k]);
+                    const float* ps = src + i + k * stride;
+                    sum0 = _mm512_add_ps(_mm512_mul_ps(w, _mm512_loadu_ps(ps + 0 * F)), sum0);
+                    sum1 = _mm512_add_ps(_mm512_mul_ps(w, _mm512_loadu_ps(ps + 1 * F)), sum1);
+                    sum2 = _mm512_add_ps(_mm512_mul_ps(w, _mm512_loadu_ps(ps + 2 * F)), sum2);
+                    sum3 = _mm512_add_ps(_mm512_mul_ps(w, _mm512_loadu_ps(ps + 3 * F)), sum3);
+                }
+                SepFilterStore<type>(sum0, dst, i + 0 * F);
+                SepFilterStore<type>(sum1, dst, i + 1 * F);
+                SepFilterStore<type>(sum2, dst, i + 2 * F);
+                SepFilterStore<type>(sum3, dst, i + 3 * F);
+            }
+            for (; i < sizeF; i += F)
+            {
+                __m512 sum = _mm512_setzero_ps();
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum = _mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps(kernel[k]), _mm512_loadu_ps(src + i + k * stride)), sum);
+                SepFilterStore<type>(sum, dst, i);
+            }
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512 sum = _mm512_setzero_ps();
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum = _mm512_add_ps(_mm512_mul_ps(_mm512_set1_ps(kernel[k]), _mm512_maskz_loadu_ps(tail, src + i + k * stride)), sum);
+                SepFilterStore<type>(sum, dst, i, tail);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SeparableFilterDefault::SeparableFilterDefault(const SepFilterParam& param, const float* rowKernel, const float* colKernel)
+            : Avx2::SeparableFilterDefault(param, rowKernel, colKernel)
+        {
+            switch (_param.srcType)
+            {
+            case SimdPixelFormatGray8: _load = SepFilterLoad<SimdPixelFormatGray8>; break;
+            case SimdPixelFormatInt16: _load = SepFilterLoad<SimdPixelFormatInt16>; break;
+            case SimdPixelFormatFloat: _load = SepFilterLoad<SimdPixelFormatFloat>; break;
+            default: assert(0);
+            }
+            _row = SepFilterRow;
+            switch (_param.dstType)
+            {
+            case SimdPixelFormatGray8: _col = SepFilterCol<SimdPixelFormatGray8>; break;
+            case SimdPixelFormatInt16: _col = SepFilterCol<SimdPixelFormatInt16>; break;
+            case SimdPixelFormatFloat: _col = SepFilterCol<SimdPixelFormatFloat>; break;
+            default: assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType srcType, SimdPixelFormatType dstType,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize, SimdBorderType border, const float* borderValue)
+        {
+            SepFilterParam param(width, height, channels, srcType, dstType, rowSize, colSize, border, borderValue);
+            if (!param.Valid() || rowKernel == NULL || colKernel == NULL)
+                return NULL;
+            return new SeparableFilterDefault(param, rowKernel, colKernel);
+        }
+    }
+#endif
+}
@@ -0,0 +1,154 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetPreprocess.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)    
+    namespace Avx512bw
+    {
+        static void DeinterleaveUvRow(const uint8_t* uv, size_t width, uint8_t* u, uint8_t* v)
+        {
+            DeinterleaveUv(uv, width * 2, width, 1, u, width, v, width);
+        }
+
+        static void YuvToBgrRow(const uint8_t* y, const uint8_t* u, const uint8_t* v, size_t width, SimdYuvType yuvType, uint8_t* bgr)
+        {
+            size_t width2 = AlignLo(width, 2);
+            if (width2)
+                Yuv422pToBgrV2(y, width2, u, width2 / 2, v, width2 / 2, width2, 1, bgr, width2 * 3, yuvType);
+            if (width2 < width)
+                Base::SynetPreprocessYuvToBgrRow(y + width2, u + width2 / 2, v + width2 / 2, width - width2, yuvType, bgr + width2 * 3);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void ResizeRow(const uint8_t* src, size_t srcSize, const int32_t* idx0, const int32_t* idx1, const float* alpha, size_t size, float* buf, float* dst)
+        {
+            size_t srcSizeF = AlignLo(srcSize, F), i = 0;
+            for (; i < srcSizeF; i += F)
+                _mm512_storeu_ps(buf + i, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)(src + i)))));
+            if (i < srcSize)
+            {
+                __mmask16 tail = TailMask16(srcSize - i);
+                _mm512_mask_storeu_ps(buf + i, tail, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, src + i))));
+            }
+            __m512 _1 = _mm512_set1_ps(1.0f);
+            for (i = 0; i < size; i += F)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512 s0 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, _mm512_maskz_loadu_epi32(tail, idx0 + i), buf, 4);
+                __m512 s1 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, _mm512_maskz_loadu_epi32(tail, idx1 + i), buf, 4);
+                __m512 a1 = _mm512_maskz_loadu_ps(tail, alpha + i), a0 = _mm512_sub_ps(_1, a1);
+                _mm512_mask_storeu_ps(dst + i, tail, _mm512_add_ps(_mm512_mul_ps(s0, a0), _mm512_mul_ps(s1, a1)));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m512 SynetPreprocessNormalize(const float* src0, const float* src1, __m512 k0, __m512 k1, const float* scale, const float* shift, __mmask16 tail = -1)
+        {
+            __m512 value = _mm512_add_ps(_mm512_mul_ps(_mm512_maskz_loadu_ps(tail, src0), k0), _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, src1), k1));
+            return _mm512_add_ps(_mm512_mul_ps(value, _mm512_maskz_loadu_ps(tail, scale)), _mm512_maskz_loadu_ps(tail, shift));
+        }
+
+        static void NormalizeRow32f(const float* src0, const float* src1, float k0, float k1, const float* scale, const float* shift, size_t size, uint8_t* dst8)
+        {
+            float* dst = (float*)dst8;
+            __m512 _k0 = _mm512_set1_ps(k0), _k1 = _mm512_set1_ps(k1);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm512_storeu_ps(dst + i, SynetPreprocessNormalize(src0 + i, src1 + i, _k0, _k1, scale + i, shift + i));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                _mm512_mask_storeu_ps(dst + i, tail, SynetPreprocessNormalize(src0 + i, src1 + i, _k0, _k1, scale + i, shift + i, tail));
+            }
+        }
+
+        static void NormalizeRow16b(const float* src0, const float* src1, float k0, float k1, const float* scale, const float* shift, size_t size, uint8_t* dst8)
+        {
+            uint16_t* dst = (uint16_t*)dst8;
+            __m512 _k0 = _mm512_set1_ps(k0), _k1 = _mm512_set1_ps(k1);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm256_storeu_si256((__m256i*)(dst + i), _mm512_cvtepi32_epi16(Float32ToBFloat16(SynetPreprocessNormalize(src0 + i, src1 + i, _k0, _k1, scale + i, shift + i))));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                _mm512_mask_cvtepi32_storeu_epi16(dst + i, tail, Float32ToBFloat16(SynetPreprocessNormalize(src0 + i, src1 + i, _k0, _k1, scale + i, shift + i, tail)));
+            }
+        }
+
+        static void NormalizeRow8u(const float* src0, const float* src1, float k0, float k1, const float* scale, const float* shift, size_t size, uint8_t* dst)
+        {
+            __m512 _k0 = _mm512_set1_ps(k0), _k1 = _mm512_set1_ps(k1);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+            {
+                __m512i d0 = _mm512_max_epi32(_mm512_cvtps_epi32(SynetPreprocessNormalize(src0 + i, src1 + i, _k0, _k1, scale + i, shift + i)), K_ZERO);
+                _mm_storeu_si128((__m128i*)(dst + i), _mm512_cvtusepi32_epi8(d0));
+            }
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512i d0 = _mm512_max_epi32(_mm512_cvtps_epi32(SynetPreprocessNormalize(src0 + i, src1 + i, _k0, _k1, scale + i, shift + i, tail)), K_ZERO);
+                _mm512_mask_cvtusepi32_storeu_epi8(dst + i, tail, d0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetPreprocessFused::SynetPreprocessFused(const SynetPreprocessParam& param)
+            : Avx2::SynetPreprocessFused(param)
+        {
+            _deinterleaveUvRow = DeinterleaveUvRow;
+            _yuvToBgrRow = YuvToBgrRow;
+            _resizeRow = ResizeRow;
+            switch (_param.dstType)
+            {
+            case SimdTensorData32f: _normalizeRow = NormalizeRow32f; break;
+            case SimdTensorData16b: _normalizeRow = NormalizeRow16b; break;
+            case SimdTensorData8u: _normalizeRow = NormalizeRow8u; break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, SimdYuvType yuvType, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, uint8_t padding, const float* mean, const float* scale)
+        {
+            SynetPreprocessParam param(srcW, srcH, srcFormat, yuvType, dstW, dstH, channels, method, dstType, dstFormat, isRgb, letterbox, padding, mean, scale);
+            if (!param.Valid())
+                return NULL;
+            return new SynetPreprocessFused(param);
+        }
+    }
+#endif
+}
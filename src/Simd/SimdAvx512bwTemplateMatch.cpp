@@ -0,0 +1,148 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdTemplateMatch.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE void TmAdd(const __m512i& sum, uint64_t* sums)
+        {
+            _mm512_storeu_si512(sums + 0, _mm512_add_epi64(_mm512_loadu_si512(sums + 0), _mm512_cvtepu32_epi64(_mm512_castsi512_si256(sum))));
+            _mm512_storeu_si512(sums + 8, _mm512_add_epi64(_mm512_loadu_si512(sums + 8), _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(sum, 1))));
+        }
+
+        void TmSad(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            size_t width64 = AlignLo(width, A), x = 0;
+            for (; x < width64; x += A)
+            {
+                __m512i sum0 = _mm512_setzero_si512(), sum1 = _mm512_setzero_si512(), sum2 = _mm512_setzero_si512(), sum3 = _mm512_setzero_si512();
+                for (size_t t = 0; t < size;)
+                {
+                    __m512i lo = _mm512_setzero_si512(), hi = _mm512_setzero_si512();
+                    for (size_t end = Min(size, t + 256); t < end; ++t)
+                    {
+                        __m512i s = _mm512_loadu_si512(src + x + t);
+                        __m512i v = _mm512_set1_epi8(tmp[t]);
+                        __m512i d = _mm512_or_si512(_mm512_subs_epu8(s, v), _mm512_subs_epu8(v, s));
+                        lo = _mm512_add_epi16(lo, _mm512_cvtepu8_epi16(_mm512_castsi512_si256(d)));
+                        hi = _mm512_add_epi16(hi, _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(d, 1)));
+                    }
+                    sum0 = _mm512_add_epi32(sum0, _mm512_cvtepu16_epi32(_mm512_castsi512_si256(lo)));
+                    sum1 = _mm512_add_epi32(sum1, _mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(lo, 1)));
+                    sum2 = _mm512_add_epi32(sum2, _mm512_cvtepu16_epi32(_mm512_castsi512_si256(hi)));
+                    sum3 = _mm512_add_epi32(sum3, _mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(hi, 1)));
+                }
+                TmAdd(sum0, sums + x + 0);
+                TmAdd(sum1, sums + x + 16);
+                TmAdd(sum2, sums + x + 32);
+                TmAdd(sum3, sums + x + 48);
+            }
+            if (x < width)
+                Avx2::TmSad(src + x, tmp, size, width - x, sums + x);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<bool ssd> SIMD_INLINE void TmMadd(const __m512i& a, const __m512i& b, const __m512i& t, __m512i& lo, __m512i& hi)
+        {
+            if (ssd)
+            {
+                __m512i dlo = _mm512_sub_epi16(_mm512_unpacklo_epi16(a, b), t);
+                __m512i dhi = _mm512_sub_epi16(_mm512_unpackhi_epi16(a, b), t);
+                lo = _mm512_add_epi32(lo, _mm512_madd_epi16(dlo, dlo));
+                hi = _mm512_add_epi32(hi, _mm512_madd_epi16(dhi, dhi));
+            }
+            else
+            {
+                lo = _mm512_add_epi32(lo, _mm512_madd_epi16(_mm512_unpacklo_epi16(a, b), t));
+                hi = _mm512_add_epi32(hi, _mm512_madd_epi16(_mm512_unpackhi_epi16(a, b), t));
+            }
+        }
+
+        SIMD_INLINE __m512i TmLoad(const uint8_t* src)
+        {
+            return _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)src));
+        }
+
+        template<bool ssd> void TmMadd(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            const __m512i order0 = _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11);
+            const __m512i order1 = _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15);
+            size_t width32 = AlignLo(width, HA), size2 = AlignLo(size, 2), x = 0;
+            for (; x < width32; x += HA)
+            {
+                __m512i lo = _mm512_setzero_si512(), hi = _mm512_setzero_si512();
+                const uint8_t* s = src + x;
+                size_t t = 0;
+                for (; t < size2; t += 2)
+                    TmMadd<ssd>(TmLoad(s + t + 0), TmLoad(s + t + 1), _mm512_set1_epi32(tmp[t] | (tmp[t + 1] << 16)), lo, hi);
+                if (t < size)
+                    TmMadd<ssd>(TmLoad(s + t), K_ZERO, _mm512_set1_epi32(tmp[t]), lo, hi);
+                TmAdd(_mm512_permutex2var_epi64(lo, order0, hi), sums + x + 0);
+                TmAdd(_mm512_permutex2var_epi64(lo, order1, hi), sums + x + 16);
+            }
+            if (x < width)
+            {
+                if (ssd)
+                    Avx2::TmSsd(src + x, tmp, size, width - x, sums + x);
+                else
+                    Avx2::TmCorr(src + x, tmp, size, width - x, sums + x);
+            }
+        }
+
+        void TmSsd(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            TmMadd<true>(src, tmp, size, width, sums);
+        }
+
+        void TmCorr(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            TmMadd<false>(src, tmp, size, width, sums);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        TemplateMatchDefault::TemplateMatchDefault(const TemplateMatchParam& param, Base::PyramidBuilderInitPtr pyramidInit)
+            : Avx2::TemplateMatchDefault(param, pyramidInit)
+        {
+            SetRow(param.type, TmSad, TmSsd, TmCorr);
+            _integral = Avx512bw::Integral;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* TemplateMatchInit(size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels)
+        {
+            TemplateMatchParam param(srcWidth, srcHeight, tmpWidth, tmpHeight, type, levels);
+            if (!param.Valid())
+                return NULL;
+            return new TemplateMatchDefault(param, PyramidBuilderInit);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
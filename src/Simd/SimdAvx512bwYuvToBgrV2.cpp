@@ -468,6 +468,125 @@ namespace Simd
             else
                 Yuv444pToRgbV2<false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <bool mask, class T, bool nv21> SIMD_INLINE void Nv12ToBgrV2(const uint8_t* y0, size_t yStride, const uint8_t* uv, uint8_t* bgr0, size_t bgrStride, const __mmask64* tails)
+        {
+            __m512i u, v;
+            UnpackNv12<nv21>(Load<false, mask>(uv, tails[0]), u, v);
+            YuvToBgr<false, mask, T>(Load<false, mask>(y0, tails[0]), u, v, bgr0, tails + 1);
+            YuvToBgr<false, mask, T>(Load<false, mask>(y0 + yStride, tails[0]), u, v, bgr0 + bgrStride, tails + 1);
+        }
+
+        template <class T, bool nv21> void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            size_t widthA = AlignLo(width, A);
+            size_t tail = width - widthA;
+            __mmask64 tails[4];
+            tails[0] = TailMask64(tail);
+            for (size_t i = 0; i < 3; ++i)
+                tails[1 + i] = TailMask64(tail * 3 - A * i);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < widthA; col += A)
+                    Nv12ToBgrV2<false, T, nv21>(y + col, yStride, uv + col, bgr + 3 * col, bgrStride, tails);
+                if (col < width)
+                    Nv12ToBgrV2<true, T, nv21>(y + col, yStride, uv + col, bgr + 3 * col, bgrStride, tails);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <bool nv21> void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgrV2<Base::Bt601, nv21>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Nv12ToBgrV2<Base::Bt709, nv21>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Nv12ToBgrV2<Base::Bt2020, nv21>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Nv12ToBgrV2<Base::Trect871, nv21>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToBgrV2<false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+        }
+
+        void Nv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToBgrV2<true>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+        }
+        //-------------------------------------------------------------------------------------------------
+
+        template <bool mask, class T, bool nv21> SIMD_INLINE void Nv12ToRgbV2(const uint8_t* y0, size_t yStride, const uint8_t* uv, uint8_t* rgb0, size_t rgbStride, const __mmask64* tails)
+        {
+            __m512i u, v;
+            UnpackNv12<nv21>(Load<false, mask>(uv, tails[0]), u, v);
+            YuvToRgb<false, mask, T>(Load<false, mask>(y0, tails[0]), u, v, rgb0, tails + 1);
+            YuvToRgb<false, mask, T>(Load<false, mask>(y0 + yStride, tails[0]), u, v, rgb0 + rgbStride, tails + 1);
+        }
+
+        template <class T, bool nv21> void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            size_t widthA = AlignLo(width, A);
+            size_t tail = width - widthA;
+            __mmask64 tails[4];
+            tails[0] = TailMask64(tail);
+            for (size_t i = 0; i < 3; ++i)
+                tails[1 + i] = TailMask64(tail * 3 - A * i);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < widthA; col += A)
+                    Nv12ToRgbV2<false, T, nv21>(y + col, yStride, uv + col, rgb + 3 * col, rgbStride, tails);
+                if (col < width)
+                    Nv12ToRgbV2<true, T, nv21>(y + col, yStride, uv + col, rgb + 3 * col, rgbStride, tails);
+                y += 2 * yStride;
+                uv += uvStride;
+                rgb += 2 * rgbStride;
+            }
+        }
+
+        template <bool nv21> void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToRgbV2<Base::Bt601, nv21>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Nv12ToRgbV2<Base::Bt709, nv21>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Nv12ToRgbV2<Base::Bt2020, nv21>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvTrect871: Nv12ToRgbV2<Base::Trect871, nv21>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToRgbV2<false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+        }
+
+        void Nv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToRgbV2<true>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+        }
     }
 #endif
 }
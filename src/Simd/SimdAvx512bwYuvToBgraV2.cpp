@@ -194,6 +194,67 @@ namespace Simd
                 assert(0);
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <bool mask, class T, bool nv21> SIMD_INLINE void Nv12ToBgraV2(const uint8_t* y0, size_t yStride, const uint8_t* uv, const __m512i& a, uint8_t* bgra0, size_t bgraStride, const __mmask64* tails)
+        {
+            __m512i u, v;
+            UnpackNv12<nv21>(Load<false, mask>(uv, tails[0]), u, v);
+            YuvToBgra<false, mask, T>(Load<false, mask>(y0, tails[0]), u, v, a, bgra0, tails + 1);
+            YuvToBgra<false, mask, T>(Load<false, mask>(y0 + yStride, tails[0]), u, v, a, bgra0 + bgraStride, tails + 1);
+        }
+
+        template <class T, bool nv21> void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            __m512i a = _mm512_set1_epi8(alpha);
+            size_t widthA = AlignLo(width, A);
+            size_t tail = width - widthA;
+            __mmask64 tails[5];
+            tails[0] = TailMask64(tail);
+            for (size_t i = 0; i < 4; ++i)
+                tails[1 + i] = TailMask64(tail * 4 - A * i);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < widthA; col += A)
+                    Nv12ToBgraV2<false, T, nv21>(y + col, yStride, uv + col, a, bgra + 4 * col, bgraStride, tails);
+                if (col < width)
+                    Nv12ToBgraV2<true, T, nv21>(y + col, yStride, uv + col, a, bgra + 4 * col, bgraStride, tails);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        template <bool nv21> void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgraV2<Base::Bt601, nv21>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Nv12ToBgraV2<Base::Bt709, nv21>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToBgraV2<Base::Bt2020, nv21>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToBgraV2<Base::Trect871, nv21>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToBgraV2<false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToBgraV2<true>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
     }
 #endif
 }
@@ -0,0 +1,214 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdInterleave.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template <class T> SIMD_INLINE __m512i UnpackYuyvY(__m512i yuyv)
+        {
+            static const __m512i Y_SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, -1, 0x2, -1, 0x4, -1, 0x6, -1, 0x8, -1, 0xA, -1, 0xC, -1, 0xE, -1,
+                0x0, -1, 0x2, -1, 0x4, -1, 0x6, -1, 0x8, -1, 0xA, -1, 0xC, -1, 0xE, -1,
+                0x0, -1, 0x2, -1, 0x4, -1, 0x6, -1, 0x8, -1, 0xA, -1, 0xC, -1, 0xE, -1,
+                0x0, -1, 0x2, -1, 0x4, -1, 0x6, -1, 0x8, -1, 0xA, -1, 0xC, -1, 0xE, -1);
+            static const __m512i Y_LO = SIMD_MM512_SET1_EPI16(T::Y_LO);
+            return _mm512_subs_epi16(_mm512_shuffle_epi8(yuyv, Y_SHUFFLE), Y_LO);
+        }
+
+        template <class T> SIMD_INLINE __m512i UnpackYuyvU(__m512i yuyv)
+        {
+            static const __m512i U_SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1,
+                0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1,
+                0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1,
+                0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1);
+            static const __m512i U_Z = SIMD_MM512_SET1_EPI16(T::UV_Z);
+            return _mm512_subs_epi16(_mm512_shuffle_epi8(yuyv, U_SHUFFLE), U_Z);
+        }
+
+        template <class T> SIMD_INLINE __m512i UnpackYuyvV(__m512i yuyv)
+        {
+            static const __m512i V_SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x3, -1, 0x3, -1, 0x7, -1, 0x7, -1, 0xB, -1, 0xB, -1, 0xF, -1, 0xF, -1,
+                0x3, -1, 0x3, -1, 0x7, -1, 0x7, -1, 0xB, -1, 0xB, -1, 0xF, -1, 0xF, -1,
+                0x3, -1, 0x3, -1, 0x7, -1, 0x7, -1, 0xB, -1, 0xB, -1, 0xF, -1, 0xF, -1,
+                0x3, -1, 0x3, -1, 0x7, -1, 0x7, -1, 0xB, -1, 0xB, -1, 0xF, -1, 0xF, -1);
+            static const __m512i V_Z = SIMD_MM512_SET1_EPI16(T::UV_Z);
+            return _mm512_subs_epi16(_mm512_shuffle_epi8(yuyv, V_SHUFFLE), V_Z);
+        }
+
+        template <bool align, bool mask, class T> SIMD_INLINE void Yuyv422ToBgr(const uint8_t* yuyv, uint8_t* bgr, __mmask64 tails[5])
+        {
+            __m512i yuyv0 = Load<align, mask>(yuyv + 0 * A, tails[0]);
+            __m512i y0 = UnpackYuyvY<T>(yuyv0);
+            __m512i u0 = UnpackYuyvU<T>(yuyv0);
+            __m512i v0 = UnpackYuyvV<T>(yuyv0);
+            __m512i b0 = YuvToBlue16<T>(y0, u0);
+            __m512i g0 = YuvToGreen16<T>(y0, u0, v0);
+            __m512i r0 = YuvToRed16<T>(y0, v0);
+
+            __m512i yuyv1 = Load<align, mask>(yuyv + 1 * A, tails[1]);
+            __m512i y1 = UnpackYuyvY<T>(yuyv1);
+            __m512i u1 = UnpackYuyvU<T>(yuyv1);
+            __m512i v1 = UnpackYuyvV<T>(yuyv1);
+            __m512i b1 = YuvToBlue16<T>(y1, u1);
+            __m512i g1 = YuvToGreen16<T>(y1, u1, v1);
+            __m512i r1 = YuvToRed16<T>(y1, v1);
+
+            __m512i b = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(b0, b1));
+            __m512i g = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(g0, g1));
+            __m512i r = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(r0, r1));
+            Store<align, mask>(bgr + 0 * A, InterleaveBgr<0>(b, g, r), tails[2]);
+            Store<align, mask>(bgr + 1 * A, InterleaveBgr<1>(b, g, r), tails[3]);
+            Store<align, mask>(bgr + 2 * A, InterleaveBgr<2>(b, g, r), tails[4]);
+        }
+
+        template <bool align, class T> void Yuyv422ToBgr(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride)
+        {
+            assert(width % 2 == 0);
+            if (align)
+                assert(Aligned(yuyv) && Aligned(yuyvStride) && Aligned(bgr) && Aligned(bgrStride));
+
+            size_t widthA = AlignLo(width, A);
+            size_t sizeS = width * 2, sizeD = width * 3;
+            size_t sizeSA = widthA * 2, sizeDA = widthA * 3;
+            __mmask64 tails[5];
+            if (widthA < width)
+            {
+                tails[0] = TailMask64(sizeS - sizeSA - A * 0);
+                tails[1] = TailMask64(sizeS - sizeSA - A * 1);
+                tails[2] = TailMask64(sizeD - sizeDA - A * 0);
+                tails[3] = TailMask64(sizeD - sizeDA - A * 1);
+                tails[4] = TailMask64(sizeD - sizeDA - A * 2);
+            }
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t colS = 0, colD = 0;
+                for (; colS < sizeSA; colS += 2 * A, colD += 3 * A)
+                    Yuyv422ToBgr<align, false, T>(yuyv + colS, bgr + colD, tails);
+                if (widthA < width)
+                    Yuyv422ToBgr<align, true, T>(yuyv + colS, bgr + colD, tails);
+                yuyv += yuyvStride;
+                bgr += bgrStride;
+            }
+        }
+
+        template<bool align> void Yuyv422ToBgr(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuyv422ToBgr<align, Base::Bt601>(yuyv, yuyvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuyv422ToBgr<align, Base::Bt709>(yuyv, yuyvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuyv422ToBgr<align, Base::Bt2020>(yuyv, yuyvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Yuyv422ToBgr<align, Base::Trect871>(yuyv, yuyvStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuyv422ToBgr(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            if (Aligned(yuyv) && Aligned(yuyvStride) && Aligned(bgr) && Aligned(bgrStride))
+                Yuyv422ToBgr<true>(yuyv, yuyvStride, width, height, bgr, bgrStride, yuvType);
+            else
+                Yuyv422ToBgr<false>(yuyv, yuyvStride, width, height, bgr, bgrStride, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <bool align, bool mask, class T> SIMD_INLINE void Yuyv422ToBgra(const uint8_t* yuyv, uint8_t* bgra, const __m512i& a8, const __mmask64* tails)
+        {
+            __m512i _yuyv = Load<align, mask>(yuyv, tails[0]);
+            __m512i y = UnpackYuyvY<T>(_yuyv);
+            __m512i u = UnpackYuyvU<T>(_yuyv);
+            __m512i v = UnpackYuyvV<T>(_yuyv);
+            __m512i bg8 = _mm512_or_si512(YuvToBlue16<T>(y, u), _mm512_slli_epi16(YuvToGreen16<T>(y, u, v), 8));
+            __m512i ra8 = _mm512_or_si512(YuvToRed16<T>(y, v), a8);
+            __m512i lo = _mm512_unpacklo_epi16(bg8, ra8);
+            __m512i hi = _mm512_unpackhi_epi16(bg8, ra8);
+            __m512i bgra0 = _mm512_shuffle_i64x2(_mm512_shuffle_i64x2(lo, hi, 0x44), _mm512_shuffle_i64x2(lo, hi, 0x44), 0xD8);
+            __m512i bgra1 = _mm512_shuffle_i64x2(_mm512_shuffle_i64x2(lo, hi, 0xEE), _mm512_shuffle_i64x2(lo, hi, 0xEE), 0xD8);
+            Store<align, mask>(bgra + 0 * A, bgra0, tails[1]);
+            Store<align, mask>(bgra + 1 * A, bgra1, tails[2]);
+        }
+
+        template <bool align, class T> void Yuyv422ToBgra(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert(width % 2 == 0);
+            if (align)
+                assert(Aligned(yuyv) && Aligned(yuyvStride) && Aligned(bgra) && Aligned(bgraStride));
+
+            __m512i a8 = _mm512_set1_epi16(int16_t(alpha) << 8);
+            size_t widthH = AlignLo(width, HA);
+            size_t sizeS = width * 2, sizeD = width * 4;
+            size_t sizeSH = widthH * 2, sizeDH = widthH * 4;
+            __mmask64 tails[3];
+            if (widthH < width)
+            {
+                tails[0] = TailMask64(sizeS - sizeSH);
+                tails[1] = TailMask64(sizeD - sizeDH - A * 0);
+                tails[2] = TailMask64(sizeD - sizeDH - A * 1);
+            }
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t colS = 0, colD = 0;
+                for (; colS < sizeSH; colS += A, colD += 2 * A)
+                    Yuyv422ToBgra<align, false, T>(yuyv + colS, bgra + colD, a8, tails);
+                if (widthH < width)
+                    Yuyv422ToBgra<align, true, T>(yuyv + colS, bgra + colD, a8, tails);
+                yuyv += yuyvStride;
+                bgra += bgraStride;
+            }
+        }
+
+        template<bool align> void Yuyv422ToBgra(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuyv422ToBgra<align, Base::Bt601>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuyv422ToBgra<align, Base::Bt709>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuyv422ToBgra<align, Base::Bt2020>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvTrect871: Yuyv422ToBgra<align, Base::Trect871>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuyv422ToBgra(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(yuyv) && Aligned(yuyvStride) && Aligned(bgra) && Aligned(bgraStride))
+                Yuyv422ToBgra<true>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha, yuvType);
+            else
+                Yuyv422ToBgra<false>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+    }
+#endif
+}
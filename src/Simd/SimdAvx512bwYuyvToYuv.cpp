@@ -0,0 +1,120 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdDeinterleave.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<bool mask> SIMD_INLINE void Yuyv422ToGray(const uint8_t* yuyv, uint8_t* gray, const __mmask64* tails)
+        {
+            __m512i lo = _mm512_and_si512(Load<false, mask>(yuyv + 0 * A, tails[0]), K16_00FF);
+            __m512i hi = _mm512_and_si512(Load<false, mask>(yuyv + 1 * A, tails[1]), K16_00FF);
+            Store<false, mask>(gray, _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(lo, hi)), tails[2]);
+        }
+
+        void Yuyv422ToGray(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* gray, size_t grayStride)
+        {
+            assert(width % 2 == 0);
+
+            size_t widthA = AlignLo(width, A);
+            __mmask64 tails[3];
+            if (widthA < width)
+            {
+                size_t tail = width - widthA;
+                tails[0] = TailMask64(tail * 2 - A * 0);
+                tails[1] = TailMask64(tail * 2 - A * 1);
+                tails[2] = TailMask64(tail);
+            }
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < widthA; col += A)
+                    Yuyv422ToGray<false>(yuyv + 2 * col, gray + col, tails);
+                if (widthA < width)
+                    Yuyv422ToGray<true>(yuyv + 2 * col, gray + col, tails);
+                yuyv += yuyvStride;
+                gray += grayStride;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void Yuyv422ToYuv420p(const uint8_t* yuyv0, size_t yuyvStride, uint8_t* y0, size_t yStride,
+            uint8_t* u, uint8_t* v, __mmask32 yuyvMask0, __mmask32 yuyvMask1, __mmask32 yuvMask)
+        {
+            static const __m512i SHFL = SIMD_MM512_SETR_EPI8(
+                0x1, 0x5, 0x9, 0xD, 0x3, 0x7, 0xB, 0xF, 0x0, 0x2, 0x4, 0x6, 0x8, 0xA, 0xC, 0xE,
+                0x1, 0x5, 0x9, 0xD, 0x3, 0x7, 0xB, 0xF, 0x0, 0x2, 0x4, 0x6, 0x8, 0xA, 0xC, 0xE,
+                0x1, 0x5, 0x9, 0xD, 0x3, 0x7, 0xB, 0xF, 0x0, 0x2, 0x4, 0x6, 0x8, 0xA, 0xC, 0xE,
+                0x1, 0x5, 0x9, 0xD, 0x3, 0x7, 0xB, 0xF, 0x0, 0x2, 0x4, 0x6, 0x8, 0xA, 0xC, 0xE);
+            static const __m512i PRMYY = SIMD_MM512_SETR_EPI32(0x02, 0x03, 0x06, 0x07, 0x0A, 0x0B, 0x0E, 0x0F, 0x12, 0x13, 0x16, 0x17, 0x1A, 0x1B, 0x1E, 0x1F);
+            static const __m512i PRMUV = SIMD_MM512_SETR_EPI32(0x00, 0x04, 0x08, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x01, 0x05, 0x09, 0x0D, 0x11, 0x15, 0x19, 0x1D);
+
+            __m512i yuyv00 = _mm512_shuffle_epi8(_mm512_maskz_loadu_epi16(yuyvMask0, yuyv0 + 0 * 64), SHFL);
+            __m512i yuyv01 = _mm512_shuffle_epi8(_mm512_maskz_loadu_epi16(yuyvMask1, yuyv0 + 1 * 64), SHFL);
+
+            const uint8_t* yuyv1 = yuyv0 + yuyvStride;
+            __m512i yuyv10 = _mm512_shuffle_epi8(_mm512_maskz_loadu_epi16(yuyvMask0, yuyv1 + 0 * 64), SHFL);
+            __m512i yuyv11 = _mm512_shuffle_epi8(_mm512_maskz_loadu_epi16(yuyvMask1, yuyv1 + 1 * 64), SHFL);
+
+            uint8_t* y1 = y0 + yStride;
+            _mm512_mask_storeu_epi16(y0, yuvMask, _mm512_permutex2var_epi32(yuyv00, PRMYY, yuyv01));
+            _mm512_mask_storeu_epi16(y1, yuvMask, _mm512_permutex2var_epi32(yuyv10, PRMYY, yuyv11));
+
+            __m512i uv = _mm512_avg_epu8(_mm512_permutex2var_epi32(yuyv00, PRMUV, yuyv01), _mm512_permutex2var_epi32(yuyv10, PRMUV, yuyv11));
+            _mm256_mask_storeu_epi8(u, yuvMask, _mm512_extracti64x4_epi64(uv, 0));
+            _mm256_mask_storeu_epi8(v, yuvMask, _mm512_extracti64x4_epi64(uv, 1));
+        }
+
+        void Yuyv422ToYuv420p(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* u, size_t uStride, uint8_t* v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            size_t size = width / 2;
+            size_t size32 = AlignLo(size, 32);
+            size_t tail = size - size32;
+            __mmask32 yuvMask = TailMask32(tail);
+            __mmask32 yuyvMask0 = TailMask32(tail * 2 - 32 * 0);
+            __mmask32 yuyvMask1 = TailMask32(tail * 2 - 32 * 1);
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t colYuyv = 0, colY = 0, colUV = 0;
+                for (; colUV < size32; colY += 64, colUV += 32, colYuyv += 128)
+                    Yuyv422ToYuv420p(yuyv + colYuyv, yuyvStride, y + colY, yStride, u + colUV, v + colUV, __mmask32(-1), __mmask32(-1), __mmask32(-1));
+                if (tail)
+                    Yuyv422ToYuv420p(yuyv + colYuyv, yuyvStride, y + colY, yStride, u + colUV, v + colUV, yuyvMask0, yuyvMask1, yuvMask);
+                yuyv += 2 * yuyvStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,95 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void BayerToBgrMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgr, size_t bgrStride)
+        {
+            BayerMhcRows buffer(bayer, bayerStride, width, height);
+            const uint8_t* rows[5];
+            bool redRow, greenOdd;
+            int own, green, other;
+            for (size_t row = 0; row < height; ++row)
+            {
+                buffer.Get(row, rows);
+                BayerMhcRowType(bayerFormat, row, redRow, greenOdd);
+                for (size_t col = 0; col < width; ++col)
+                {
+                    BayerMhc(rows, col, (col & 1) == (greenOdd ? 1 : 0), own, green, other);
+                    uint8_t* dst = bgr + col * 3;
+                    dst[0] = uint8_t(redRow ? other : own);
+                    dst[1] = uint8_t(green);
+                    dst[2] = uint8_t(redRow ? own : other);
+                }
+                bgr += bgrStride;
+            }
+        }
+
+        void BayerToBgraMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+        {
+            BayerMhcRows buffer(bayer, bayerStride, width, height);
+            const uint8_t* rows[5];
+            bool redRow, greenOdd;
+            int own, green, other;
+            for (size_t row = 0; row < height; ++row)
+            {
+                buffer.Get(row, rows);
+                BayerMhcRowType(bayerFormat, row, redRow, greenOdd);
+                for (size_t col = 0; col < width; ++col)
+                {
+                    BayerMhc(rows, col, (col & 1) == (greenOdd ? 1 : 0), own, green, other);
+                    uint8_t* dst = bgra + col * 4;
+                    dst[0] = uint8_t(redRow ? other : own);
+                    dst[1] = uint8_t(green);
+                    dst[2] = uint8_t(redRow ? own : other);
+                    dst[3] = alpha;
+                }
+                bgra += bgraStride;
+            }
+        }
+
+        void BayerToGrayMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* gray, size_t grayStride)
+        {
+            BayerMhcRows buffer(bayer, bayerStride, width, height);
+            const uint8_t* rows[5];
+            bool redRow, greenOdd;
+            int own, green, other;
+            for (size_t row = 0; row < height; ++row)
+            {
+                buffer.Get(row, rows);
+                BayerMhcRowType(bayerFormat, row, redRow, greenOdd);
+                for (size_t col = 0; col < width; ++col)
+                {
+                    BayerMhc(rows, col, (col & 1) == (greenOdd ? 1 : 0), own, green, other);
+                    gray[col] = uint8_t(redRow ? BgrToGray(other, green, own) : BgrToGray(own, green, other));
+                }
+                gray += grayStride;
+            }
+        }
+    }
+}
@@ -161,6 +161,37 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        template <class YuvType> void BgraToNv12V2(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgra = 0; colY < width; colY += 2, colBgra += 8)
+                    BgraToYuv420pV2<YuvType>(bgra + colBgra, bgraStride, y + colY, yStride, uv + colY, uv + colY + 1);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        void BgraToNv12V2(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToNv12V2<Bt601>(bgra, bgraStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgraToNv12V2<Bt709>(bgra, bgraStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgraToNv12V2<Bt2020>(bgra, bgraStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvTrect871: BgraToNv12V2<Trect871>(bgra, bgraStride, width, height, y, yStride, uv, uvStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         template <class YuvType> SIMD_INLINE void BgraToYuva420pV2(const uint8_t* bgra0, size_t bgraStride, uint8_t* y0, size_t yStride, 
             uint8_t* u, uint8_t* v, uint8_t* a0, size_t aStride)
         {
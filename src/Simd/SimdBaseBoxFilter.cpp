@@ -0,0 +1,176 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        static void BoxFilterCol8u(const uint8_t* add, const uint8_t* sub, size_t size, uint8_t* sum)
+        {
+            uint32_t* ps = (uint32_t*)sum;
+            for (size_t i = 0; i < size; ++i)
+                ps[i] += add[i] - sub[i];
+        }
+
+        static void BoxFilterCol32f(const uint8_t* add, const uint8_t* sub, size_t size, uint8_t* sum)
+        {
+            const float* pa = (const float*)add, * pb = (const float*)sub;
+            float* ps = (float*)sum;
+            for (size_t i = 0; i < size; ++i)
+                ps[i] += pa[i] - pb[i];
+        }
+
+        template<class T> void BoxFilterRow(const uint8_t* src, size_t width, size_t channels, size_t kernel, uint8_t* dst)
+        {
+            const T* ps = (const T*)src;
+            T* pd = (T*)dst;
+            for (size_t c = 0; c < channels; ++c)
+            {
+                T sum = 0;
+                for (size_t k = 0; k < kernel; ++k)
+                    sum += ps[k * channels + c];
+                pd[c] = sum;
+            }
+            for (size_t i = channels, size = width * channels, tail = (kernel - 1) * channels; i < size; ++i)
+                pd[i] = pd[i - channels] + ps[i + tail] - ps[i - channels];
+        }
+
+        static void BoxFilterStore8u(const uint8_t* sum, size_t size, float scale, uint8_t* dst)
+        {
+            const uint32_t* ps = (const uint32_t*)sum;
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (uint8_t)Simd::Min(Round(float(ps[i]) * scale), 255);
+        }
+
+        static void BoxFilterStore32f(const uint8_t* sum, size_t size, float scale, uint8_t* dst)
+        {
+            const float* ps = (const float*)sum;
+            float* pd = (float*)dst;
+            for (size_t i = 0; i < size; ++i)
+                pd[i] = ps[i] * scale;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        BoxFilterDefault::BoxFilterDefault(const BoxFilterParam& param)
+            : Simd::BoxFilter(param)
+            , _threads(Base::GetThreadNumber())
+        {
+            size_t channels = _param.channels, width = _param.width, rx = _param.radiusX;
+            _size = width * channels;
+            _extSize = (width + 2 * rx) * channels;
+            _bufSize = (AlignHi(_extSize, SIMD_ALIGN) + AlignHi(_size, SIMD_ALIGN)) * 4;
+            _buffers.Resize(_bufSize * _threads);
+            _scale = 1.0f / float(_param.KernelX() * _param.KernelY());
+            _index.Resize(2 * rx);
+            for (size_t x = 0; x < rx; ++x)
+            {
+                _index[x] = (int32_t)BorderIndex(ptrdiff_t(x) - ptrdiff_t(rx), width, _param.border);
+                _index[rx + x] = (int32_t)BorderIndex(ptrdiff_t(width + x), width, _param.border);
+            }
+            if (_param.type == SimdPixelFormatGray8)
+            {
+                uint8_t value = (uint8_t)Simd::RestrictRange(Round(_param.borderValue), 0, 255);
+                _zero.Resize(_size, true);
+                _border.Resize(_size);
+                memset(_border.data, value, _size);
+                uint32_t sum = uint32_t(value * _param.KernelY());
+                memcpy(&_borderSum, &sum, 4);
+                _col = BoxFilterCol8u;
+                _row = BoxFilterRow<uint32_t>;
+                _store = BoxFilterStore8u;
+            }
+            else
+            {
+                _zero.Resize(_size * 4, true);
+                _border.Resize(_size * 4);
+                float* border = (float*)_border.data;
+                for (size_t i = 0; i < _size; ++i)
+                    border[i] = _param.borderValue;
+                float sum = _param.borderValue * float(_param.KernelY());
+                memcpy(&_borderSum, &sum, 4);
+                _col = BoxFilterCol32f;
+                _row = BoxFilterRow<float>;
+                _store = BoxFilterStore32f;
+            }
+        }
+
+        void BoxFilterDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                RunBand(src, srcStride, begin, end, _buffers.data + thread * _bufSize, dst, dstStride);
+            }, _threads, 4 * _param.KernelY());
+        }
+
+        const uint8_t* BoxFilterDefault::Row(const uint8_t* src, size_t srcStride, ptrdiff_t row) const
+        {
+            ptrdiff_t y = BorderIndex(row, _param.height, _param.border);
+            return y < 0 ? _border.data : src + y * srcStride;
+        }
+
+        void BoxFilterDefault::RunBand(const uint8_t* src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t channels = _param.channels, width = _param.width, rx = _param.radiusX;
+            ptrdiff_t ry = _param.radiusY;
+            uint32_t* ext = (uint32_t*)buf;
+            uint8_t* sum = buf + rx * channels * 4;
+            uint8_t* row = buf + AlignHi(_extSize, SIMD_ALIGN) * 4;
+            memset(sum, 0, _size * 4);
+            for (ptrdiff_t y = ptrdiff_t(yBeg) - ry; y <= ptrdiff_t(yBeg) + ry; ++y)
+                _col(Row(src, srcStride, y), _zero.data, _size, sum);
+            for (size_t y = yBeg; y < yEnd; ++y)
+            {
+                if (y > yBeg)
+                    _col(Row(src, srcStride, y + ry), Row(src, srcStride, ptrdiff_t(y) - ry - 1), _size, sum);
+                for (size_t x = 0; x < 2 * rx; ++x)
+                {
+                    uint32_t* pe = ext + (x < rx ? x : width + x) * channels;
+                    if (_index[x] < 0)
+                        for (size_t c = 0; c < channels; ++c)
+                            pe[c] = _borderSum;
+                    else
+                        for (size_t c = 0; c < channels; ++c)
+                            pe[c] = ext[(rx + _index[x]) * channels + c];
+                }
+                _row(buf, width, channels, _param.KernelX(), row);
+                _store(row, _size, _scale, dst + y * dstStride);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type,
+            size_t radiusX, size_t radiusY, SimdBorderType border, const float* borderValue)
+        {
+            BoxFilterParam param(width, height, channels, type, radiusX, radiusY, border, borderValue);
+            if (!param.Valid())
+                return NULL;
+            return new BoxFilterDefault(param);
+        }
+    }
+}
@@ -0,0 +1,136 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCanny.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<bool l2> void CannyGradientRow(const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, size_t width, int32_t* mag, uint8_t* dir)
+        {
+            if (width == 1)
+            {
+                CannyGradient<l2>(s0, s1, s2, 0, 0, 0, mag, dir);
+                return;
+            }
+            CannyGradient<l2>(s0, s1, s2, 0, 0, 1, mag, dir);
+            for (size_t x = 1; x < width - 1; ++x)
+                CannyGradient<l2>(s0, s1, s2, x - 1, x, x + 1, mag, dir);
+            CannyGradient<l2>(s0, s1, s2, width - 2, width - 1, width - 1, mag, dir);
+        }
+
+        static void CannyNmsRow(const int32_t* m0, const int32_t* m1, const int32_t* m2, const uint8_t* dir, size_t width, int32_t low, int32_t high, uint8_t* map)
+        {
+            for (size_t x = 0; x < width; ++x)
+                map[x] = CannyNms(m0, m1, m2, dir, x, low, high);
+        }
+
+        static void CannyOutput(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+                dst[x] = map[x] == 2 ? 0xFF : 0x00;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        CannyDefault::CannyDefault(const CannyParam& param)
+            : Simd::Canny(param)
+        {
+            _magStride = AlignHi(_param.width + 2, SIMD_ALIGN / sizeof(int32_t));
+            _mapStride = _param.width + 2;
+            _low = _param.Threshold(_param.low);
+            _high = _param.Threshold(_param.high);
+            _mag.Resize(3 * _magStride, true);
+            _dir.Resize(3 * AlignHi(_param.width, SIMD_ALIGN));
+            _map.Resize(_mapStride * (_param.height + 2), true);
+            _gradient = _param.l2 ? CannyGradientRow<true> : CannyGradientRow<false>;
+            _nms = CannyNmsRow;
+            _output = CannyOutput;
+        }
+
+        void CannyDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            size_t width = _param.width, height = _param.height, dirStride = AlignHi(width, SIMD_ALIGN);
+            int32_t* mag[3];
+            uint8_t* dir[3];
+            for (size_t i = 0; i < 3; ++i)
+                mag[i] = _mag.data + i * _magStride + 1, dir[i] = _dir.data + i * dirStride;
+            const uint8_t* s0 = src, * s1 = src, * s2 = height > 1 ? src + srcStride : src;
+            _gradient(s0, s1, s2, width, mag[0], dir[0]);
+            memset(mag[2], 0, width * sizeof(int32_t));
+            _stack.clear();
+            for (size_t y = 0; y < height; ++y)
+            {
+                size_t curr = y % 3, next = (y + 1) % 3, prev = (y + 2) % 3;
+                if (y + 1 < height)
+                {
+                    s0 = src + y * srcStride;
+                    s1 = s0 + srcStride;
+                    s2 = y + 2 < height ? s1 + srcStride : s1;
+                    _gradient(s0, s1, s2, width, mag[next], dir[next]);
+                }
+                else
+                    memset(mag[next], 0, width * sizeof(int32_t));
+                uint8_t* map = _map.data + (y + 1) * _mapStride + 1;
+                _nms(mag[prev], mag[curr], mag[next], dir[curr], width, _low, _high, map);
+                for (size_t x = 0; x < width; ++x)
+                    if (map[x] == 2)
+                        _stack.push_back(map + x);
+            }
+            Hysteresis();
+            for (size_t y = 0; y < height; ++y)
+                _output(_map.data + (y + 1) * _mapStride + 1, width, dst + y * dstStride);
+        }
+
+        void CannyDefault::Hysteresis()
+        {
+            const ptrdiff_t stride = _mapStride;
+            const ptrdiff_t offsets[8] = { -stride - 1, -stride, -stride + 1, -1, 1, stride - 1, stride, stride + 1 };
+            while (!_stack.empty())
+            {
+                uint8_t* p = _stack.back();
+                _stack.pop_back();
+                for (size_t i = 0; i < 8; ++i)
+                {
+                    uint8_t* n = p + offsets[i];
+                    if (*n == 1)
+                    {
+                        *n = 2;
+                        _stack.push_back(n);
+                    }
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CannyInit(size_t width, size_t height, float low, float high, SimdBool l2)
+        {
+            CannyParam param(width, height, low, high, l2);
+            if (!param.Valid())
+                return NULL;
+            return new CannyDefault(param);
+        }
+    }
+}
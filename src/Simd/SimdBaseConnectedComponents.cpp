@@ -0,0 +1,255 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdConnectedComponents.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void CclRowRuns(const uint8_t* mask, size_t width, CclRuns& runs)
+        {
+            for (size_t x = 0; x < width;)
+            {
+                while (x < width && mask[x] == 0)
+                    x++;
+                if (x == width)
+                    break;
+                size_t beg = x;
+                while (x < width && mask[x] != 0)
+                    x++;
+                runs.push_back(CclRun((uint32_t)beg, (uint32_t)x, (uint32_t)runs.size()));
+            }
+        }
+
+        void CclFillRow(const CclRun* runs, size_t count, size_t width, const uint32_t* ids, uint32_t* dst)
+        {
+            size_t x = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                for (; x < runs[i].beg; ++x)
+                    dst[x] = 0;
+                for (; x < runs[i].end; ++x)
+                    dst[x] = ids[i];
+            }
+            for (; x < width; ++x)
+                dst[x] = 0;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE uint32_t CclFind(CclRun* runs, uint32_t i)
+        {
+            while (runs[i].label != i)
+            {
+                runs[i].label = runs[runs[i].label].label;
+                i = runs[i].label;
+            }
+            return i;
+        }
+
+        SIMD_INLINE void CclUnion(CclRun* runs, uint32_t a, uint32_t b)
+        {
+            a = CclFind(runs, a);
+            b = CclFind(runs, b);
+            if (a < b)
+                runs[b].label = a;
+            else if (b < a)
+                runs[a].label = b;
+        }
+
+        SIMD_INLINE uint32_t CclFind(uint32_t* parent, uint32_t i)
+        {
+            while (parent[i] != i)
+            {
+                parent[i] = parent[parent[i]];
+                i = parent[i];
+            }
+            return i;
+        }
+
+        SIMD_INLINE void CclUnion(uint32_t* parent, uint32_t a, uint32_t b)
+        {
+            a = CclFind(parent, a);
+            b = CclFind(parent, b);
+            if (a < b)
+                parent[b] = a;
+            else if (b < a)
+                parent[a] = b;
+        }
+
+        template<class Join> SIMD_INLINE void CclConnect(const CclRun* cur, size_t curSize, const CclRun* prev, size_t prevSize, uint32_t ext, Join join)
+        {
+            for (size_t i = 0, j = 0; i < curSize && j < prevSize;)
+            {
+                if (cur[i].beg < prev[j].end + ext && prev[j].beg < cur[i].end + ext)
+                    join(i, j);
+                if (prev[j].end <= cur[i].end)
+                    j++;
+                else
+                    i++;
+            }
+        }
+
+        SIMD_INLINE uint64_t CclSumSq(uint64_t k)
+        {
+            return k ? (k - 1) * k * (2 * k - 1) / 6 : 0;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ConnectedComponentsDefault::ConnectedComponentsDefault(const ConnectedComponentsParam& param)
+            : Simd::ConnectedComponents(param)
+            , _threads(Base::GetThreadNumber())
+        {
+            _strips.resize(_threads);
+            _rowBeg.Resize(_param.height);
+            _rowEnd.Resize(_param.height);
+            _rowRuns = CclRowRuns;
+            _fillRow = CclFillRow;
+        }
+
+        size_t ConnectedComponentsDefault::Run(const uint8_t* mask, size_t maskStride, uint32_t* labels, size_t labelsStride)
+        {
+            for (size_t s = 0; s < _strips.size(); ++s)
+                _strips[s].begin = 0, _strips[s].end = 0;
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Strip& strip = _strips[thread];
+                strip.begin = begin;
+                strip.end = end;
+                FindRuns(mask, maskStride, strip);
+            }, _threads, 1);
+            size_t count = Merge();
+            Statistics(count);
+            if (labels)
+            {
+                Simd::Parallel(0, _strips.size(), [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t s = begin; s < end; ++s)
+                    {
+                        const Strip& strip = _strips[s];
+                        for (size_t y = strip.begin; y < strip.end; ++y)
+                            _fillRow(strip.runs.data() + _rowBeg[y], _rowEnd[y] - _rowBeg[y], _param.width,
+                                _parent.data() + strip.offset + _rowBeg[y], (uint32_t*)((uint8_t*)labels + y * labelsStride));
+                    }
+                }, _threads, 1);
+            }
+            return count;
+        }
+
+        void ConnectedComponentsDefault::FindRuns(const uint8_t* mask, size_t maskStride, Strip& strip)
+        {
+            uint32_t ext = _param.connectivity == 8 ? 1 : 0;
+            CclRuns& runs = strip.runs;
+            runs.clear();
+            for (size_t y = strip.begin; y < strip.end; ++y)
+            {
+                _rowBeg[y] = (uint32_t)runs.size();
+                _rowRuns(mask + y * maskStride, _param.width, runs);
+                _rowEnd[y] = (uint32_t)runs.size();
+                if (y > strip.begin)
+                {
+                    uint32_t cur = _rowBeg[y], prev = _rowBeg[y - 1];
+                    CclConnect(runs.data() + cur, _rowEnd[y] - cur, runs.data() + prev, _rowEnd[y - 1] - prev, ext,
+                        [&](size_t i, size_t j) { CclUnion(runs.data(), uint32_t(cur + i), uint32_t(prev + j)); });
+                }
+            }
+        }
+
+        size_t ConnectedComponentsDefault::Merge()
+        {
+            uint32_t ext = _param.connectivity == 8 ? 1 : 0;
+            size_t total = 0;
+            for (size_t s = 0; s < _strips.size(); ++s)
+            {
+                _strips[s].offset = total;
+                total += _strips[s].begin < _strips[s].end ? _strips[s].runs.size() : 0;
+            }
+            _parent.resize(total);
+            uint32_t* parent = _parent.data();
+            for (size_t s = 0; s < _strips.size(); ++s)
+            {
+                const Strip& strip = _strips[s];
+                if (strip.begin == strip.end)
+                    continue;
+                for (size_t i = 0; i < strip.runs.size(); ++i)
+                    parent[strip.offset + i] = uint32_t(strip.offset + strip.runs[i].label);
+                if (strip.begin == 0)
+                    continue;
+                const Strip& above = _strips[s - 1];
+                size_t y = strip.begin;
+                uint32_t cur = uint32_t(strip.offset + _rowBeg[y]), prev = uint32_t(above.offset + _rowBeg[y - 1]);
+                CclConnect(strip.runs.data() + _rowBeg[y], _rowEnd[y] - _rowBeg[y], above.runs.data() + _rowBeg[y - 1], _rowEnd[y - 1] - _rowBeg[y - 1], ext,
+                    [&](size_t i, size_t j) { CclUnion(parent, uint32_t(cur + i), uint32_t(prev + j)); });
+            }
+            uint32_t count = 0;
+            for (size_t i = 0; i < total; ++i)
+                parent[i] = parent[i] == i ? ++count : parent[parent[i]];
+            return count;
+        }
+
+        void ConnectedComponentsDefault::Statistics(size_t count)
+        {
+            SimdConnectedComponent empty;
+            empty.left = (uint32_t)_param.width, empty.top = (uint32_t)_param.height, empty.right = 0, empty.bottom = 0;
+            empty.area = 0, empty.x = 0, empty.y = 0, empty.xx = 0, empty.xy = 0, empty.yy = 0;
+            _components.assign(count, empty);
+            for (size_t s = 0; s < _strips.size(); ++s)
+            {
+                const Strip& strip = _strips[s];
+                for (size_t y = strip.begin; y < strip.end; ++y)
+                {
+                    for (size_t i = _rowBeg[y]; i < _rowEnd[y]; ++i)
+                    {
+                        const CclRun& run = strip.runs[i];
+                        SimdConnectedComponent& c = _components[_parent[strip.offset + i] - 1];
+                        uint64_t n = run.end - run.beg, sx = (uint64_t(run.beg) + run.end - 1) * n / 2;
+                        c.left = Simd::Min(c.left, run.beg);
+                        c.right = Simd::Max(c.right, run.end);
+                        c.top = Simd::Min(c.top, (uint32_t)y);
+                        c.bottom = (uint32_t)y + 1;
+                        c.area += n;
+                        c.x += sx;
+                        c.y += n * y;
+                        c.xx += CclSumSq(run.end) - CclSumSq(run.beg);
+                        c.xy += sx * y;
+                        c.yy += n * y * y;
+                    }
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ConnectedComponentsInit(size_t width, size_t height, size_t connectivity)
+        {
+            ConnectedComponentsParam param(width, height, connectivity);
+            if (!param.Valid())
+                return NULL;
+            return new ConnectedComponentsDefault(param);
+        }
+    }
+}
@@ -0,0 +1,237 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistanceTransform.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void DistanceCols(const uint8_t* src, size_t srcStride, size_t size, size_t height, int32_t* dst, size_t dstStride)
+        {
+            for (size_t x = 0; x < size; ++x)
+                dst[x] = src[x] ? DISTANCE_INF : 0;
+            for (size_t y = 1; y < height; ++y)
+            {
+                const uint8_t* s = src + y * srcStride;
+                const int32_t* p = dst + (y - 1) * dstStride;
+                int32_t* d = dst + y * dstStride;
+                for (size_t x = 0; x < size; ++x)
+                    d[x] = s[x] ? Simd::Min(p[x] + 1, DISTANCE_INF) : 0;
+            }
+            for (size_t y = height - 2; y < height; --y)
+            {
+                const int32_t* n = dst + (y + 1) * dstStride;
+                int32_t* d = dst + y * dstStride;
+                for (size_t x = 0; x < size; ++x)
+                    d[x] = Simd::Min(d[x], n[x] + 1);
+            }
+        }
+
+        SIMD_INLINE int64_t DistanceSq(const int32_t* g, ptrdiff_t p)
+        {
+            return int64_t(g[p]) * g[p] + int64_t(p) * p;
+        }
+
+        void DistanceEuclideanRow(const int32_t* g, size_t width, int32_t* v, float* dst)
+        {
+            ptrdiff_t k = -1;
+            for (ptrdiff_t q = 0; q < (ptrdiff_t)width; ++q)
+            {
+                if (g[q] >= DISTANCE_INF)
+                    continue;
+                int64_t fq = DistanceSq(g, q);
+                while (k > 0)
+                {
+                    int64_t f0 = DistanceSq(g, v[k - 1]), f1 = DistanceSq(g, v[k]);
+                    if ((fq - f1) * (v[k] - v[k - 1]) <= (f1 - f0) * (q - v[k]))
+                        k--;
+                    else
+                        break;
+                }
+                v[++k] = (int32_t)q;
+            }
+            for (ptrdiff_t x = 0, j = 0; x < (ptrdiff_t)width; ++x)
+            {
+                while (j < k && DistanceSq(g, v[j + 1]) - DistanceSq(g, v[j]) < 2 * x * (v[j + 1] - v[j]))
+                    j++;
+                int64_t dx = x - v[j], dy = g[v[j]];
+                dst[x] = float(dx * dx + dy * dy);
+            }
+        }
+
+        void DistanceStoreSq(const float* src, size_t size, uint8_t* dst)
+        {
+            float* d = (float*)dst;
+            for (size_t i = 0; i < size; ++i)
+                d[i] = ::sqrt(src[i]);
+        }
+
+        void DistanceStoreSq16u(const float* src, size_t size, uint8_t* dst)
+        {
+            uint16_t* d = (uint16_t*)dst;
+            for (size_t i = 0; i < size; ++i)
+                d[i] = (uint16_t)Simd::Min(Round(::sqrt(src[i])), 0xFFFF);
+        }
+
+        void DistanceStoreInt(const int32_t* src, size_t size, float scale, uint8_t* dst)
+        {
+            float* d = (float*)dst;
+            for (size_t i = 0; i < size; ++i)
+                d[i] = float(src[i]) * scale;
+        }
+
+        void DistanceStoreInt16u(const int32_t* src, size_t size, float scale, uint8_t* dst)
+        {
+            uint16_t* d = (uint16_t*)dst;
+            for (size_t i = 0; i < size; ++i)
+                d[i] = (uint16_t)Simd::Min(Round(float(src[i]) * scale), 0xFFFF);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        DistanceTransformDefault::DistanceTransformDefault(const DistanceTransformParam& param)
+            : Simd::DistanceTransform(param)
+            , _threads(Base::GetThreadNumber())
+        {
+            size_t width = _param.width, height = _param.height;
+            bool f32 = _param.format == SimdPixelFormatFloat;
+            if (_param.type == SimdDistanceEuclidean)
+            {
+                _stride = AlignHi(width, SIMD_ALIGN);
+                _buf.Resize(_stride * height);
+                _v.Resize(width * _threads);
+                _row.Resize(width * _threads);
+                _cols = DistanceCols;
+                _storeSq = f32 ? DistanceStoreSq : DistanceStoreSq16u;
+            }
+            else
+            {
+                _stride = AlignHi(width + 4, SIMD_ALIGN);
+                _buf.Resize(_stride * (height + 4));
+                for (size_t i = 0; i < _buf.size; ++i)
+                    _buf[i] = DISTANCE_INF;
+                bool five = _param.type == SimdDistanceChamfer5x5;
+                _weight[0] = five ? 5 : 3;
+                _weight[1] = five ? 7 : 4;
+                _weight[2] = five ? 11 : 0;
+                _forward = five ? DistanceChamferForward<true> : DistanceChamferForward<false>;
+                _backward = five ? DistanceChamferBackward<true> : DistanceChamferBackward<false>;
+                _storeInt = f32 ? DistanceStoreInt : DistanceStoreInt16u;
+            }
+        }
+
+        void DistanceTransformDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            if (_param.type == SimdDistanceEuclidean)
+                RunEuclidean(src, srcStride, dst, dstStride);
+            else
+                RunChamfer(src, srcStride, dst, dstStride);
+        }
+
+        void DistanceTransformDefault::RunEuclidean(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            size_t width = _param.width, height = _param.height, stride = _stride;
+            Simd::Parallel(0, width, [&](size_t thread, size_t begin, size_t end)
+            {
+                _cols(src + begin, srcStride, end - begin, height, _buf.data + begin, stride);
+            }, _threads, SIMD_ALIGN);
+            size_t i = 0;
+            while (i < width && _buf[i] >= DISTANCE_INF)
+                i++;
+            if (i == width)
+            {
+                FillMax(dst, dstStride);
+                return;
+            }
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                int32_t* v = _v.data + thread * width;
+                float* row = _row.data + thread * width;
+                for (size_t y = begin; y < end; ++y)
+                {
+                    DistanceEuclideanRow(_buf.data + y * stride, width, v, row);
+                    _storeSq(row, width, dst + y * dstStride);
+                }
+            }, _threads, 1);
+        }
+
+        void DistanceTransformDefault::RunChamfer(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            size_t width = _param.width, height = _param.height, stride = _stride;
+            int32_t a = _weight[0], * buf = _buf.data + 2 * stride + 2;
+            for (size_t y = 0; y < height; ++y)
+            {
+                int32_t* row = buf + y * stride;
+                _forward(src + y * srcStride, row - stride, row - 2 * stride, width, _weight, row);
+                for (size_t x = 1; x < width; ++x)
+                    row[x] = Simd::Min(row[x], row[x - 1] + a);
+            }
+            const int32_t* last = buf + (height - 1) * stride;
+            size_t i = 0;
+            while (i < width && last[i] >= DISTANCE_INF)
+                i++;
+            if (i == width)
+            {
+                FillMax(dst, dstStride);
+                return;
+            }
+            float scale = 1.0f / float(a);
+            for (size_t y = height - 1; y < height; --y)
+            {
+                int32_t* row = buf + y * stride;
+                _backward(NULL, row + stride, row + 2 * stride, width, _weight, row);
+                for (size_t x = width - 2; x < width; --x)
+                    row[x] = Simd::Min(row[x], row[x + 1] + a);
+                _storeInt(row, width, scale, dst + y * dstStride);
+            }
+        }
+
+        void DistanceTransformDefault::FillMax(uint8_t* dst, size_t dstStride)
+        {
+            for (size_t y = 0; y < _param.height; ++y, dst += dstStride)
+            {
+                if (_param.format == SimdPixelFormatFloat)
+                {
+                    float* d = (float*)dst;
+                    for (size_t x = 0; x < _param.width; ++x)
+                        d[x] = FLT_MAX;
+                }
+                else
+                    memset(dst, 0xFF, _param.width * sizeof(uint16_t));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceType type, SimdPixelFormatType format)
+        {
+            DistanceTransformParam param(width, height, type, format);
+            if (!param.Valid())
+                return NULL;
+            return new DistanceTransformDefault(param);
+        }
+    }
+}
@@ -0,0 +1,176 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void AlgIir::Init(float sigma)
+        {
+            double q = sigma >= 2.5f ? 0.98711 * sigma - 0.96330 : 3.97156 - 4.14554 * ::sqrt(1.0 - 0.26891 * sigma);
+            double b0 = 1.57825 + 2.44413 * q + 1.42810 * q * q + 0.422205 * q * q * q;
+            double _a1 = (2.44413 * q + 2.85619 * q * q + 1.26661 * q * q * q) / b0;
+            double _a2 = -(1.42810 * q * q + 1.26661 * q * q * q) / b0;
+            double _a3 = (0.422205 * q * q * q) / b0;
+            double _b = 1.0 - (_a1 + _a2 + _a3);
+            b = float(_b), a1 = float(_a1), a2 = float(_a2), a3 = float(_a3);
+
+            size_t size = size_t(sigma * 20.0f) + 100;
+            std::vector<double> w(size + 6), y(size + 6);
+            for (size_t i = 0; i < 3; ++i)
+            {
+                std::fill(w.begin(), w.end(), 0.0);
+                std::fill(y.begin(), y.end(), 0.0);
+                w[2 - i] = 1.0;
+                for (size_t n = 3; n < size + 3; ++n)
+                    w[n] = _a1 * w[n - 1] + _a2 * w[n - 2] + _a3 * w[n - 3];
+                for (size_t n = size + 2; n >= 3; --n)
+                    y[n] = _b * w[n] + _a1 * y[n + 1] + _a2 * y[n + 2] + _a3 * y[n + 3];
+                for (size_t k = 0; k < 3; ++k)
+                    m[k][i] = float(y[3 + k]);
+            }
+        }
+
+        void GaussianBlurIirTail(float* buf, size_t step, size_t count, size_t lag, size_t size, const AlgIir& a)
+        {
+            for (size_t j = 0; j < lag; ++j)
+            {
+                const float* w[3];
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    ptrdiff_t n = ptrdiff_t(count - lag + j) - ptrdiff_t(i * lag);
+                    w[i] = buf + (n < ptrdiff_t(j) ? j : n) * step;
+                }
+                float* y0 = buf + (count + j) * step;
+                float* y1 = buf + (count + lag + j) * step;
+                float* y2 = buf + (count + 2 * lag + j) * step;
+                for (size_t x = 0; x < size; ++x)
+                {
+                    float u = y0[x], d0 = w[0][x] - u, d1 = w[1][x] - u, d2 = w[2][x] - u;
+                    y2[x] = u + a.m[2][0] * d0 + a.m[2][1] * d1 + a.m[2][2] * d2;
+                    y1[x] = u + a.m[1][0] * d0 + a.m[1][1] * d1 + a.m[1][2] * d2;
+                    y0[x] = u + a.m[0][0] * d0 + a.m[0][1] * d1 + a.m[0][2] * d2;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        struct IirRow
+        {
+            static SIMD_INLINE void Run(const float* p1, const float* p2, const float* p3, size_t size, const AlgIir& a, float* dst)
+            {
+                for (size_t x = 0; x < size; ++x)
+                    dst[x] = a.b * dst[x] + a.a1 * p1[x] + a.a2 * p2[x] + a.a3 * p3[x];
+            }
+        };
+
+        template<class T> void BlurIirHor(const BlurParam& p, const AlgIir& a, const uint8_t* src, size_t srcStride, size_t rows, float* buf, float* dst, size_t dstStride)
+        {
+            size_t size = p.width * p.channels;
+            for (size_t row = 0; row < rows; ++row)
+            {
+                const T* s = (const T*)(src + row * srcStride);
+                float* d = dst + row * dstStride;
+                for (size_t i = 0; i < size; ++i)
+                    d[i] = float(s[i]);
+                GaussianBlurIirPass<IirRow>(d, 1, size, p.channels, 1, a, [](size_t, const float*) {});
+            }
+        }
+
+        SIMD_INLINE void StoreIir(const float* src, size_t size, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (uint8_t)RestrictRange(Round(src[i]), 0, 255);
+        }
+
+        SIMD_INLINE void StoreIir(const float* src, size_t size, float* dst)
+        {
+            memcpy(dst, src, size * sizeof(float));
+        }
+
+        template<class T> void BlurIirVer(const BlurParam& p, const AlgIir& a, float* buf, size_t stride, size_t size, uint8_t* dst, size_t dstStride)
+        {
+            GaussianBlurIirPass<IirRow>(buf, stride, p.height, 1, size, a, [&](size_t y, const float* row) { StoreIir(row, size, (T*)(dst + y * dstStride)); });
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianBlurIir::GaussianBlurIir(const BlurParam& param, SimdPixelFormatType type)
+            : Simd::GaussianBlur(param)
+            , _type(type)
+            , _threads(Base::GetThreadNumber())
+        {
+            _alg.Init(_param.sigma);
+            _hor = _type == SimdPixelFormatGray8 ? BlurIirHor<uint8_t> : BlurIirHor<float>;
+            _ver = _type == SimdPixelFormatGray8 ? BlurIirVer<uint8_t> : BlurIirVer<float>;
+            InitBuffers(1);
+        }
+
+        void GaussianBlurIir::InitBuffers(size_t group)
+        {
+            const BlurParam& p = _param;
+            _group = group;
+            _stride = AlignHi((p.width + 3) * p.channels, p.align / sizeof(float));
+            _stripe = Simd::Max<size_t>(AlignLo(Base::AlgCacheL2() / ((p.height + 3) * sizeof(float)), 16), 16);
+            _buf.Resize(_stride * (p.height + 3));
+            if (_group > 1)
+                _rows.Resize((p.width + 3) * p.channels * _group * _threads);
+        }
+
+        void GaussianBlurIir::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            const BlurParam& p = _param;
+            size_t group = _group, stride = _stride, stripe = _stripe, rows = (p.width + 3) * p.channels * _group;
+            size_t size = p.width * p.channels, pixel = _type == SimdPixelFormatGray8 ? 1 : sizeof(float);
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                float* buf = _group > 1 ? _rows.data + thread * rows : NULL;
+                for (size_t y = begin; y < end; y += group)
+                    _hor(p, _alg, src + y * srcStride, srcStride, Simd::Min(group, end - y), buf, _buf.data + y * stride, stride);
+            }, _threads, group);
+            Simd::Parallel(0, size, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t x = begin; x < end; x += stripe)
+                    _ver(p, _alg, _buf.data + x, stride, Simd::Min(stripe, end - x), dst + x * pixel, dstStride);
+            }, _threads, 16);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* GaussianBlurIirInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type, const float* sigma)
+        {
+            BlurParam param(width, height, channels, sigma, NULL, sizeof(void*));
+            if (!param.Valid() || param.sigma < 0.5f || (type != SimdPixelFormatGray8 && type != SimdPixelFormatFloat))
+                return NULL;
+            return new GaussianBlurIir(param, type);
+        }
+    }
+}
@@ -28,6 +28,18 @@
 
 #include <stdio.h>
 
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #if defined(_MSC_VER)
 #pragma warning (push)
 #pragma warning (disable: 4996)
@@ -53,6 +65,115 @@ namespace Simd
 
     //-------------------------------------------------------------------------
 
+    ImageMap::ImageMap()
+        : _data(NULL)
+        , _size(0)
+#if defined(_WIN32)
+        , _file(INVALID_HANDLE_VALUE)
+        , _mapping(NULL)
+#else
+        , _file(-1)
+#endif
+        , _loader(NULL)
+    {
+    }
+
+    ImageMap::~ImageMap()
+    {
+        if (_loader)
+            delete _loader;
+#if defined(_WIN32)
+        if (_data)
+            ::UnmapViewOfFile(_data);
+        if (_mapping)
+            ::CloseHandle(_mapping);
+        if (_file != INVALID_HANDLE_VALUE)
+            ::CloseHandle(_file);
+#else
+        if (_data)
+            ::munmap((void*)_data, _size);
+        if (_file != -1)
+            ::close(_file);
+#endif
+    }
+
+    bool ImageMap::Open(const char* path, SimdPixelFormatType format, CreateLoaderPtr create)
+    {
+#if defined(_WIN32)
+        _file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (_file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(_file, &size) || size.QuadPart == 0)
+            return false;
+        _size = (size_t)size.QuadPart;
+        _mapping = ::CreateFileMappingA(_file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (_mapping == NULL)
+            return false;
+        _data = (const uint8_t*)::MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+        if (_data == NULL)
+            return false;
+#else
+        _file = ::open(path, O_RDONLY);
+        if (_file == -1)
+            return false;
+        struct stat st;
+        if (::fstat(_file, &st) != 0 || st.st_size == 0)
+            return false;
+        _size = (size_t)st.st_size;
+        void* data = ::mmap(NULL, _size, PROT_READ, MAP_PRIVATE, _file, 0);
+        if (data == MAP_FAILED)
+            return false;
+        _data = (const uint8_t*)data;
+#endif
+        ImageLoaderParam param(_data, _size, format);
+        if (!(param.Validate() && (param.file == SimdImageFilePgmBin || param.file == SimdImageFilePpmBin)))
+            return false;
+        _loader = create(param);
+        return _loader && ((Base::ImagePxmLoader*)_loader)->FromMap();
+    }
+
+    size_t ImageMap::Width() const
+    {
+        return ((Base::ImagePxmLoader*)_loader)->Native().width;
+    }
+
+    size_t ImageMap::Height() const
+    {
+        return ((Base::ImagePxmLoader*)_loader)->Native().height;
+    }
+
+    SimdPixelFormatType ImageMap::Format() const
+    {
+        return ((Base::ImagePxmLoader*)_loader)->Format();
+    }
+
+    const uint8_t* ImageMap::Data(size_t* stride) const
+    {
+        return ((Base::ImagePxmLoader*)_loader)->MapData(stride);
+    }
+
+    bool ImageMap::Rows(size_t row, size_t count, uint8_t* dst, size_t dstStride) const
+    {
+        return ((Base::ImagePxmLoader*)_loader)->MapRows(row, count, dst, dstStride);
+    }
+
+    void* ImageMapFromFile(ImageMap::CreateLoaderPtr create, const char* path, size_t* width, size_t* height, SimdPixelFormatType* format)
+    {
+        ImageMap* map = new ImageMap();
+        if (map->Open(path, *format, create))
+        {
+            *width = map->Width();
+            *height = map->Height();
+            *format = map->Format();
+            return map;
+        }
+        delete map;
+        return NULL;
+    }
+
+    //-------------------------------------------------------------------------
+
     ImageLoaderParam::ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f)
         : data(d)
         , size(s)
@@ -88,6 +209,11 @@ namespace Simd
             if (data[0] == 0xFF && data[1] == 0xD8)
                 file = SimdImageFileJpeg;
         }
+        if (size >= 4)
+        {
+            if (data[0] == 'q' && data[1] == 'o' && data[2] == 'i' && data[3] == 'f')
+                file = SimdImageFileQoi;
+        }
         return
             file != SimdImageFileUndefined && 
                 (format == SimdPixelFormatNone || format == SimdPixelFormatGray8 || 
@@ -104,7 +230,39 @@ namespace Simd
         {
         }
 
-        bool ImagePxmLoader::ReadHeader(size_t version)
+        bool ImagePxmLoader::FromMap()
+        {
+            return false;
+        }
+
+        const uint8_t* ImagePxmLoader::MapData(size_t* stride) const
+        {
+            if (_param.format != (SimdPixelFormatType)_image.format)
+                return NULL;
+            *stride = _image.stride;
+            return _image.data;
+        }
+
+        bool ImagePxmLoader::MapRows(size_t row, size_t count, uint8_t* dst, size_t dstStride) const
+        {
+            if (row + count > _image.height)
+                return false;
+            const uint8_t* src = _image.data + row * _image.stride;
+            if (_param.format == (SimdPixelFormatType)_image.format)
+            {
+                for (size_t i = 0; i < count; ++i, src += _image.stride, dst += dstStride)
+                    memcpy(dst, src, _size);
+            }
+            else if (_toAny)
+                _toAny(src, _image.width, count, _image.stride, dst, dstStride);
+            else if (_toBgra)
+                _toBgra(src, _image.width, count, _image.stride, dst, dstStride, 0xFF);
+            else
+                return false;
+            return true;
+        }
+
+        bool ImagePxmLoader::ReadHeader(size_t version, bool map)
         {
             if (_stream.Size() < 3 ||
                 _stream.Data()[0] != 'P' ||
@@ -120,28 +278,35 @@ namespace Simd
             uint8_t byte;
             if (!(_stream.Read(byte) && byte == '\n'))
                 return false;
-            _image.Recreate(width, height, (Image::Format)_param.format);
-            _block = height;
+            SimdPixelFormatType native;
             if (_param.file == SimdImageFilePgmTxt || _param.file == SimdImageFilePgmBin)
             {
                 _size = width * 1;
-                if (_param.format != SimdPixelFormatGray8)
-                {
-                    _block = Simd::RestrictRange<size_t>(Base::AlgCacheL1() / _size, 1, height);
-                    _buffer.Resize(_block * _size);
-                }
+                native = SimdPixelFormatGray8;
             }
             else if (_param.file == SimdImageFilePpmTxt || _param.file == SimdImageFilePpmBin)
             {
                 _size = width * 3;
-                if (_param.format != SimdPixelFormatRgb24)
+                native = SimdPixelFormatRgb24;
+            }
+            else
+                return false;
+            if (map)
+            {
+                if (!_stream.CanRead(_size * height))
+                    return false;
+                _image = Image(width, height, _size, (Image::Format)native, (uint8_t*)_stream.Current());
+            }
+            else
+            {
+                _image.Recreate(width, height, (Image::Format)_param.format);
+                _block = height;
+                if (_param.format != native)
                 {
                     _block = Simd::RestrictRange<size_t>(Base::AlgCacheL1() / _size, 1, height);
                     _buffer.Resize(_block * _size);
                 }
             }
-            else
-                return false;
             SetConverters();
             return true;
         }
@@ -227,6 +392,11 @@ namespace Simd
             return true;
         }
 
+        bool ImagePgmBinLoader::FromMap()
+        {
+            return ReadHeader(5, true);
+        }
+
         void ImagePgmBinLoader::SetConverters()
         {
             switch (_param.format)
@@ -320,6 +490,11 @@ namespace Simd
             return true;
         }
 
+        bool ImagePpmBinLoader::FromMap()
+        {
+            return ReadHeader(6, true);
+        }
+
         void ImagePpmBinLoader::SetConverters()
         {
             switch (_param.format)
@@ -344,6 +519,7 @@ namespace Simd
             case SimdImageFilePpmBin: return new ImagePpmBinLoader(param);
             case SimdImageFilePng: return new ImagePngLoader(param);
             case SimdImageFileJpeg: return new ImageJpegLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
             default:
                 return NULL;
             }
@@ -363,6 +539,11 @@ namespace Simd
             }
             return NULL;
         }
+
+        void* ImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            return Simd::ImageMapFromFile(CreateImageLoader, path, width, height, format);
+        }
     }
 }
 
@@ -0,0 +1,181 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<int channels> const uint8_t* QoiDecodeRow(const uint8_t* src, const uint8_t* end, size_t width, uint32_t* index, uint32_t& px, int& run, uint8_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x, dst += channels)
+            {
+                if (run > 0)
+                    run--;
+                else
+                {
+                    if (src >= end)
+                        return NULL;
+                    uint8_t b1 = *src++;
+                    if (b1 == QOI_OP_RGB)
+                    {
+                        if (src + 3 > end)
+                            return NULL;
+                        px = (px & 0xFF000000) | (QoiGet<3>(src) & 0x00FFFFFF);
+                        src += 3;
+                    }
+                    else if (b1 == QOI_OP_RGBA)
+                    {
+                        if (src + 4 > end)
+                            return NULL;
+                        px = QoiGet<4>(src);
+                        src += 4;
+                    }
+                    else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX)
+                        px = index[b1];
+                    else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF)
+                    {
+                        uint8_t r = uint8_t(px) + ((b1 >> 4) & 3) - 2;
+                        uint8_t g = uint8_t(px >> 8) + ((b1 >> 2) & 3) - 2;
+                        uint8_t b = uint8_t(px >> 16) + (b1 & 3) - 2;
+                        px = (px & 0xFF000000) | uint32_t(b) << 16 | uint32_t(g) << 8 | r;
+                    }
+                    else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA)
+                    {
+                        if (src >= end)
+                            return NULL;
+                        int b2 = *src++;
+                        int vg = (b1 & 0x3F) - 32;
+                        uint8_t r = uint8_t(px) + vg - 8 + ((b2 >> 4) & 0x0F);
+                        uint8_t g = uint8_t(px >> 8) + vg;
+                        uint8_t b = uint8_t(px >> 16) + vg - 8 + (b2 & 0x0F);
+                        px = (px & 0xFF000000) | uint32_t(b) << 16 | uint32_t(g) << 8 | r;
+                    }
+                    else
+                        run = b1 & 0x3F;
+                    index[QoiHash(px)] = px;
+                }
+                QoiSet<channels>(px, dst);
+            }
+            return src;
+        }
+
+        //---------------------------------------------------------------------
+
+        ImageQoiLoader::ImageQoiLoader(const ImageLoaderParam& param)
+            : ImageLoader(param)
+            , _toAny(NULL)
+            , _toBgra(NULL)
+            , _decodeRow(NULL)
+        {
+        }
+
+        bool ImageQoiLoader::ReadHeader()
+        {
+            if (_stream.Size() < QOI_HEADER_SIZE + QOI_PADDING_SIZE || memcmp(_stream.Data(), QOI_MAGIC, 4) != 0)
+                return false;
+            _stream.Seek(4);
+            uint32_t width, height;
+            uint8_t channels, colorspace;
+            if (!(_stream.ReadBe32u(width) && _stream.ReadBe32u(height) && _stream.Read8u(channels) && _stream.Read8u(colorspace)))
+                return false;
+            if (width == 0 || height == 0 || (channels != 3 && channels != 4) || colorspace > 1)
+                return false;
+            _channels = channels;
+            if (_param.format == SimdPixelFormatNone)
+                _param.format = _channels == 4 ? SimdPixelFormatRgba32 : SimdPixelFormatRgb24;
+            _image.Recreate(width, height, (Image::Format)_param.format);
+            _size = width * _channels;
+            _block = height;
+            SetConverters();
+            if (_toAny || _toBgra)
+            {
+                _block = Simd::RestrictRange<size_t>(Base::AlgCacheL1() / _size, 1, height);
+                _buffer.Resize(_block * _size);
+            }
+            _decodeRow = _channels == 4 ? QoiDecodeRow<4> : QoiDecodeRow<3>;
+            return true;
+        }
+
+        bool ImageQoiLoader::FromStream()
+        {
+            if (!ReadHeader())
+                return false;
+            const uint8_t* src = _stream.Current();
+            const uint8_t* end = _stream.Data() + _stream.Size() - QOI_PADDING_SIZE;
+            uint32_t index[64], px = QOI_PIXEL_INIT;
+            memset(index, 0, sizeof(index));
+            int run = 0;
+            bool direct = _toAny == NULL && _toBgra == NULL;
+            size_t dstStride = direct ? _image.stride : _size;
+            for (size_t row = 0; row < _image.height;)
+            {
+                size_t block = Simd::Min(row + _block, _image.height) - row;
+                uint8_t* dst = direct ? _image.Row<uint8_t>(row) : _buffer.data;
+                for (size_t b = 0; b < block; ++b)
+                {
+                    src = _decodeRow(src, end, _image.width, index, px, run, dst);
+                    if (src == NULL)
+                        return false;
+                    dst += dstStride;
+                }
+                if (_toAny)
+                    _toAny(_buffer.data, _image.width, block, _size, _image.Row<uint8_t>(row), _image.stride);
+                if (_toBgra)
+                    _toBgra(_buffer.data, _image.width, block, _size, _image.Row<uint8_t>(row), _image.stride, 0xFF);
+                row += block;
+            }
+            return true;
+        }
+
+        void ImageQoiLoader::SetConverters()
+        {
+            if (_channels == 3)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toAny = Base::RgbToGray; break;
+                case SimdPixelFormatBgr24: _toAny = Base::BgrToRgb; break;
+                case SimdPixelFormatBgra32: _toBgra = Base::RgbToBgra; break;
+                case SimdPixelFormatRgba32: _toBgra = Base::BgrToBgra; break;
+                default: break;
+                }
+            }
+            else
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toAny = Base::RgbaToGray; break;
+                case SimdPixelFormatBgr24: _toAny = Base::BgraToRgb; break;
+                case SimdPixelFormatBgra32: _toAny = Base::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _toAny = Base::BgraToBgr; break;
+                default: break;
+                }
+            }
+        }
+    }
+}
@@ -65,6 +65,8 @@ namespace Simd
                     file = SimdImageFilePpmBin;
                 else if (ext == "png")
                     file = SimdImageFilePng;
+                else if (ext == "qoi")
+                    file = SimdImageFileQoi;
                 else if (ext == "jpg" || ext == "jpeg")
                 {
                     file = SimdImageFileJpeg;
@@ -345,6 +347,7 @@ namespace Simd
             case SimdImageFilePpmBin: return new ImagePpmBinSaver(param);
             case SimdImageFilePng:    return new ImagePngSaver(param);
             case SimdImageFileJpeg:   return new ImageJpegSaver(param);
+            case SimdImageFileQoi:    return new ImageQoiSaver(param);
             default:
                 return NULL;
             }
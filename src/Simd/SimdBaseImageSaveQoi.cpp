@@ -0,0 +1,112 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const uint8_t QOI_MAGIC[4] = { 'q', 'o', 'i', 'f' };
+        const uint8_t QOI_PADDING[QOI_PADDING_SIZE] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+        template<int channels> uint8_t* QoiEncodeRow(const uint8_t* src, size_t width, uint32_t* index, uint32_t& prev, int& run, uint8_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x, src += channels)
+                dst = QoiEncodePixel<channels>(src, index, prev, run, dst);
+            return dst;
+        }
+
+        //---------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : ImageSaver(param)
+            , _convert(NULL)
+        {
+            switch (_param.format)
+            {
+            case SimdPixelFormatGray8: _convert = Base::GrayToBgr; _channels = 3; break;
+            case SimdPixelFormatBgr24: _convert = Base::BgrToRgb; _channels = 3; break;
+            case SimdPixelFormatBgra32: _convert = Base::BgraToRgba; _channels = 4; break;
+            case SimdPixelFormatRgb24: _channels = 3; break;
+            case SimdPixelFormatRgba32: _channels = 4; break;
+            default: assert(0);
+            }
+            _size = _param.width * _channels;
+            _block = _param.height;
+            if (_convert)
+            {
+                _block = Simd::RestrictRange<size_t>(Base::AlgCacheL1() / _size, 1, _param.height);
+                _buffer.Resize(_block * _size);
+            }
+            _encodeRow = _channels == 4 ? QoiEncodeRow<4> : QoiEncodeRow<3>;
+        }
+
+        void ImageQoiSaver::WriteHeader()
+        {
+            _stream.Write(QOI_MAGIC, 4);
+            _stream.WriteBe32u((uint32_t)_param.width);
+            _stream.WriteBe32u((uint32_t)_param.height);
+            _stream.Write8u((uint8_t)_channels);
+            _stream.Write8u(0);
+        }
+
+        bool ImageQoiSaver::ToStream(const uint8_t* src, size_t stride)
+        {
+            const size_t rowMax = _param.width * (_channels + 1) + QOI_PADDING_SIZE;
+            _stream.Reserve(QOI_HEADER_SIZE + _param.height * _size + QOI_PADDING_SIZE);
+            WriteHeader();
+            uint32_t index[64], prev = QOI_PIXEL_INIT;
+            memset(index, 0, sizeof(index));
+            int run = 0;
+            size_t pixelStride = _convert ? _size : stride;
+            for (size_t row = 0; row < _param.height;)
+            {
+                size_t block = Simd::Min(row + _block, _param.height) - row;
+                const uint8_t* pixels = src;
+                if (_convert)
+                {
+                    _convert(src, _param.width, block, stride, _buffer.data, _size);
+                    pixels = _buffer.data;
+                }
+                for (size_t b = 0; b < block; ++b)
+                {
+                    _stream.Reserve(_stream.Pos() + rowMax);
+                    uint8_t* end = _encodeRow(pixels, _param.width, index, prev, run, _stream.Current());
+                    _stream.Seek(end - _stream.Data());
+                    pixels += pixelStride;
+                }
+                src += stride * block;
+                row += block;
+            }
+            if (run)
+                _stream.Write8u(QOI_OP_RUN | (run - 1));
+            _stream.Write(QOI_PADDING, QOI_PADDING_SIZE);
+            return true;
+        }
+    }
+}
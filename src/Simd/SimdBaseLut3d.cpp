@@ -0,0 +1,122 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdLut3d.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<bool tetrahedral, size_t channels, bool rgb> void Lut3dRow(const Lut3dIndex& index, const int16_t* nodes, const uint8_t* src, size_t width, uint8_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x, src += channels, dst += channels)
+                Lut3dPixel<tetrahedral, channels, rgb>(index, nodes, src, dst);
+        }
+
+        template<bool tetrahedral> void SetRows(Lut3dInt::RowPtr rows[4])
+        {
+            rows[0] = Lut3dRow<tetrahedral, 3, false>;
+            rows[1] = Lut3dRow<tetrahedral, 4, false>;
+            rows[2] = Lut3dRow<tetrahedral, 3, true>;
+            rows[3] = Lut3dRow<tetrahedral, 4, true>;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        Lut3dInt::Lut3dInt(const Lut3dParam& param, const float* table)
+            : Simd::Lut3d(param)
+            , _threads(Base::GetThreadNumber())
+        {
+            int N = (int)param.size;
+            _nodes.Resize(N * N * N * 4);
+            const float scale = float(255 << LUT3D_NODE_SHIFT);
+            for (int i = 0, n = N * N * N; i < n; ++i)
+            {
+                _nodes[i * 4 + 0] = (int16_t)Round(Simd::RestrictRange(table[i * 3 + 2], 0.0f, 1.0f) * scale);
+                _nodes[i * 4 + 1] = (int16_t)Round(Simd::RestrictRange(table[i * 3 + 1], 0.0f, 1.0f) * scale);
+                _nodes[i * 4 + 2] = (int16_t)Round(Simd::RestrictRange(table[i * 3 + 0], 0.0f, 1.0f) * scale);
+                _nodes[i * 4 + 3] = 0;
+            }
+            _index.step[0] = N * N * 4;
+            _index.step[1] = N * 4;
+            _index.step[2] = 4;
+            for (int v = 0; v < 256; ++v)
+            {
+                int pos = v * (N - 1), i = pos / 255, w = ((pos % 255) * LUT3D_WEIGHT_ONE + 127) / 255;
+                if (i == N - 1)
+                    i = N - 2, w = LUT3D_WEIGHT_ONE;
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    _index.offset[c][v] = i * _index.step[c];
+                    _index.weight[c][v] = w;
+                }
+            }
+            if (param.interpolation == SimdLut3dInterpolationTetrahedral)
+                SetRows<true>(_rows);
+            else
+                SetRows<false>(_rows);
+        }
+
+        int Lut3dInt::FormatIndex(SimdPixelFormatType format)
+        {
+            switch (format)
+            {
+            case SimdPixelFormatBgr24: return 0;
+            case SimdPixelFormatBgra32: return 1;
+            case SimdPixelFormatRgb24: return 2;
+            case SimdPixelFormatRgba32: return 3;
+            default:
+                return -1;
+            }
+        }
+
+        void Lut3dInt::Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t dstStride) const
+        {
+            int index = FormatIndex(format);
+            if (index < 0)
+            {
+                assert(0);
+                return;
+            }
+            RowPtr row = _rows[index];
+            size_t threads = width * height >= 0x10000 ? _threads : 1;
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t y = begin; y < end; ++y)
+                    row(_index, _nodes.data, src + y * srcStride, width, dst + y * dstStride);
+            }, threads, 1);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* Lut3dInit(size_t size, const float* table, SimdLut3dInterpolationType interpolation)
+        {
+            Lut3dParam param(size, interpolation);
+            if (!param.Valid() || table == NULL)
+                return NULL;
+            return new Lut3dInt(param, table);
+        }
+    }
+}
@@ -0,0 +1,157 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMedianFilter.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        static void MedianFilterUpdate(const uint16_t* add, const uint16_t* sub, uint16_t* hist)
+        {
+            for (size_t i = 0; i < MF_HIST; ++i)
+                hist[i] += add[i] - sub[i];
+        }
+
+        SIMD_INLINE uint8_t MedianFilterFind(const uint16_t* hist, size_t half)
+        {
+            size_t sum = 0, i = 0, j = 0;
+            for (; sum + hist[MF_FINE + i] < half; ++i)
+                sum += hist[MF_FINE + i];
+            for (j = i * MF_COARSE; sum + hist[j] < half; ++j)
+                sum += hist[j];
+            return (uint8_t)j;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        MedianFilterDefault::MedianFilterDefault(const MedianFilterParam& param)
+            : Simd::MedianFilter(param)
+            , _threads(Base::GetThreadNumber())
+        {
+            size_t channels = _param.channels, width = _param.width, radius = _param.radius;
+            _size = width * channels;
+            _bufSize = (_size + channels) * MF_HIST;
+            _buffers.Resize(_bufSize * _threads);
+            _border.Resize(_size);
+            for (size_t i = 0; i < _size; ++i)
+                _border[i] = _param.borderValue[i % channels];
+            _zero.Resize(MF_HIST, true);
+            _const.Resize(MF_HIST * channels, true);
+            for (size_t c = 0; c < channels; ++c)
+            {
+                uint16_t* hist = _const.data + c * MF_HIST;
+                hist[_param.borderValue[c]] = uint16_t(_param.Kernel());
+                hist[MF_FINE + _param.borderValue[c] / MF_COARSE] = uint16_t(_param.Kernel());
+            }
+            _index.Resize(width + 2 * radius);
+            for (size_t x = 0; x < _index.size; ++x)
+                _index[x] = (int32_t)BorderIndex(ptrdiff_t(x) - ptrdiff_t(radius), width, _param.border);
+            _update = MedianFilterUpdate;
+        }
+
+        void MedianFilterDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                RunBand(src, srcStride, begin, end, _buffers.data + thread * _bufSize, dst, dstStride);
+            }, _threads, 4 * _param.Kernel());
+        }
+
+        const uint8_t* MedianFilterDefault::Row(const uint8_t* src, size_t srcStride, ptrdiff_t row) const
+        {
+            ptrdiff_t y = BorderIndex(row, _param.height, _param.border);
+            return y < 0 ? _border.data : src + y * srcStride;
+        }
+
+        SIMD_INLINE const uint16_t* MedianFilterDefault::Col(const uint16_t* cols, size_t x, size_t c) const
+        {
+            return _index[x] < 0 ? _const.data + c * MF_HIST : cols + (_index[x] * _param.channels + c) * MF_HIST;
+        }
+
+        void MedianFilterDefault::RunBand(const uint8_t* src, size_t srcStride, size_t yBeg, size_t yEnd, uint16_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t channels = _param.channels, width = _param.width, kernel = _param.Kernel();
+            size_t half = kernel * kernel / 2 + 1;
+            ptrdiff_t radius = _param.radius;
+            uint16_t* cols = buf, * hists = buf + _size * MF_HIST;
+            memset(cols, 0, _size * MF_HIST * sizeof(uint16_t));
+            for (ptrdiff_t y = ptrdiff_t(yBeg) - radius; y <= ptrdiff_t(yBeg) + radius; ++y)
+            {
+                const uint8_t* add = Row(src, srcStride, y);
+                for (size_t i = 0; i < _size; ++i)
+                {
+                    uint16_t* col = cols + i * MF_HIST;
+                    col[add[i]]++;
+                    col[MF_FINE + add[i] / MF_COARSE]++;
+                }
+            }
+            for (size_t y = yBeg; y < yEnd; ++y)
+            {
+                if (y > yBeg)
+                {
+                    const uint8_t* add = Row(src, srcStride, y + radius);
+                    const uint8_t* sub = Row(src, srcStride, ptrdiff_t(y) - radius - 1);
+                    for (size_t i = 0; i < _size; ++i)
+                    {
+                        uint16_t* col = cols + i * MF_HIST;
+                        col[add[i]]++;
+                        col[MF_FINE + add[i] / MF_COARSE]++;
+                        col[sub[i]]--;
+                        col[MF_FINE + sub[i] / MF_COARSE]--;
+                    }
+                }
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    uint16_t* hist = hists + c * MF_HIST;
+                    memset(hist, 0, MF_HIST * sizeof(uint16_t));
+                    for (size_t x = 0; x < kernel; ++x)
+                        _update(Col(cols, x, c), _zero.data, hist);
+                }
+                uint8_t* pd = dst + y * dstStride;
+                for (size_t x = 0; x < width; ++x)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        uint16_t* hist = hists + c * MF_HIST;
+                        pd[x * channels + c] = MedianFilterFind(hist, half);
+                        if (x + 1 < width)
+                            _update(Col(cols, x + kernel, c), Col(cols, x, c), hist);
+                    }
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, const uint8_t* borderValue)
+        {
+            MedianFilterParam param(width, height, channels, radius, border, borderValue);
+            if (!param.Valid())
+                return NULL;
+            return new MedianFilterDefault(param);
+        }
+    }
+}
@@ -0,0 +1,171 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMorphology.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<bool dilate> SIMD_INLINE uint8_t MorphologyOp(uint8_t a, uint8_t b)
+        {
+            return dilate ? Simd::Max(a, b) : Simd::Min(a, b);
+        }
+
+        template<bool dilate> void MorphologyOp(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = MorphologyOp<dilate>(a[i], b[i]);
+        }
+
+        template<bool dilate> void MorphologyRow(const uint8_t* src, size_t size, size_t kernel, uint8_t* g, uint8_t* h)
+        {
+            for (size_t b = 0; b < size; b += kernel)
+            {
+                g[b] = src[b];
+                for (size_t i = b + 1, e = b + kernel; i < e; ++i)
+                    g[i] = MorphologyOp<dilate>(g[i - 1], src[i]);
+                h[b + kernel - 1] = src[b + kernel - 1];
+                for (size_t i = b + kernel - 1; i > b; --i)
+                    h[i - 1] = MorphologyOp<dilate>(h[i], src[i - 1]);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        MorphologyDefault::MorphologyDefault(const MorphologyParam& param)
+            : Simd::Morphology(param)
+        {
+            size_t width = _param.width, kx = _param.kernelX, ky = _param.kernelY;
+            size_t row = DivHi(width + kx - 1, kx) * kx;
+            _stride = AlignHi(width, SIMD_ALIGN);
+            _fill[0].Resize(width);
+            memset(_fill[0].data, 0xFF, width);
+            _fill[1].Resize(width, true);
+            _row.Resize(row);
+            _g.Resize(Simd::Max(ky * _stride, row));
+            _h.Resize(Simd::Max(ky * _stride, row));
+            if (_param.type == SimdMorphologyOpen || _param.type == SimdMorphologyClose)
+                _image.Resize(_stride * _param.height);
+            _op[0] = MorphologyOp<false>;
+            _op[1] = MorphologyOp<true>;
+        }
+
+        void MorphologyDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            switch (_param.type)
+            {
+            case SimdMorphologyErode:
+                Apply(false, src, srcStride, dst, dstStride);
+                break;
+            case SimdMorphologyDilate:
+                Apply(true, src, srcStride, dst, dstStride);
+                break;
+            case SimdMorphologyOpen:
+                Apply(false, src, srcStride, _image.data, _stride);
+                Apply(true, _image.data, _stride, dst, dstStride);
+                break;
+            case SimdMorphologyClose:
+                Apply(true, src, srcStride, _image.data, _stride);
+                Apply(false, _image.data, _stride, dst, dstStride);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        void MorphologyDefault::Apply(bool dilate, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            ApplyVertical(dilate, src, srcStride, dst, dstStride);
+            if (_param.kernelX > 1)
+                ApplyHorizontal(dilate, dst, dstStride);
+        }
+
+        void MorphologyDefault::ApplyVertical(bool dilate, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            size_t width = _param.width, height = _param.height, kernel = _param.kernelY;
+            ptrdiff_t anchor = kernel / 2;
+            MorphologyOpPtr op = _op[dilate];
+            const uint8_t* fill = _fill[dilate].data;
+            uint8_t* g = _g.data, * h = _h.data;
+            for (size_t b = 0; b < height; b += kernel)
+            {
+                ptrdiff_t row = ptrdiff_t(b) - anchor;
+                for (size_t i = kernel; i > 0; --i)
+                {
+                    ptrdiff_t y = row + i - 1;
+                    const uint8_t* ps = y >= 0 && y < (ptrdiff_t)height ? src + y * srcStride : fill;
+                    uint8_t* ph = h + (i - 1) * _stride;
+                    if (i == kernel)
+                        memcpy(ph, ps, width);
+                    else
+                        op(ps, ph + _stride, width, ph);
+                }
+                row += kernel;
+                size_t n = Simd::Min(kernel, height - b);
+                for (size_t i = 0; i + 1 < n; ++i)
+                {
+                    ptrdiff_t y = row + i;
+                    const uint8_t* ps = y >= 0 && y < (ptrdiff_t)height ? src + y * srcStride : fill;
+                    uint8_t* pg = g + i * _stride;
+                    if (i == 0)
+                        memcpy(pg, ps, width);
+                    else
+                        op(pg - _stride, ps, width, pg);
+                }
+                memcpy(dst + b * dstStride, h, width);
+                for (size_t i = 1; i < n; ++i)
+                    op(h + i * _stride, g + (i - 1) * _stride, width, dst + (b + i) * dstStride);
+            }
+        }
+
+        void MorphologyDefault::ApplyHorizontal(bool dilate, uint8_t* dst, size_t dstStride)
+        {
+            size_t width = _param.width, height = _param.height, kernel = _param.kernelX, anchor = kernel / 2;
+            size_t size = DivHi(width + kernel - 1, kernel) * kernel;
+            MorphologyOpPtr op = _op[dilate];
+            uint8_t* buf = _row.data, * g = _g.data, * h = _h.data;
+            memset(buf, dilate ? 0x00 : 0xFF, size);
+            for (size_t y = 0; y < height; ++y)
+            {
+                uint8_t* pd = dst + y * dstStride;
+                memcpy(buf + anchor, pd, width);
+                if (dilate)
+                    MorphologyRow<true>(buf, size, kernel, g, h);
+                else
+                    MorphologyRow<false>(buf, size, kernel, g, h);
+                op(h, g + kernel - 1, width, pd);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY)
+        {
+            MorphologyParam param(width, height, type, kernelX, kernelY);
+            if (!param.Valid())
+                return NULL;
+            return new MorphologyDefault(param);
+        }
+    }
+}
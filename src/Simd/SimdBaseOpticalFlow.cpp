@@ -0,0 +1,326 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdOpticalFlow.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <float.h>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void LkGradient(const uint8_t* src, size_t srcStride, size_t width, size_t height, int16_t* dx, int16_t* dy, size_t dStride)
+        {
+            for (size_t y = 0; y < height; ++y)
+            {
+                const uint8_t* s0 = src - srcStride;
+                const uint8_t* s1 = src;
+                const uint8_t* s2 = src + srcStride;
+                for (size_t x = 0; x < width; ++x)
+                {
+                    dx[x] = int16_t(3 * (s0[x + 1] - s0[x - 1] + s2[x + 1] - s2[x - 1]) + 10 * (s1[x + 1] - s1[x - 1]));
+                    dy[x] = int16_t(3 * (s2[x - 1] - s0[x - 1] + s2[x + 1] - s0[x + 1]) + 10 * (s2[x] - s0[x]));
+                }
+                src += srcStride;
+                dx += dStride;
+                dy += dStride;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE int LkValue(const uint8_t* s0, const uint8_t* s1, const int* w)
+        {
+            const int shift = LK_WEIGHT_BITS - LK_VALUE_BITS;
+            return (w[0] * s0[0] + w[1] * s0[1] + w[2] * s1[0] + w[3] * s1[1] + (1 << (shift - 1))) >> shift;
+        }
+
+        SIMD_INLINE int LkValue(const int16_t* d0, const int16_t* d1, const int* w)
+        {
+            return (w[0] * d0[0] + w[1] * d0[1] + w[2] * d1[0] + w[3] * d1[1] + (1 << (LK_WEIGHT_BITS - 1))) >> LK_WEIGHT_BITS;
+        }
+
+        void LkPatch(const uint8_t* src, size_t srcStride, const int16_t* dx, const int16_t* dy, size_t dStride,
+            size_t size, const int* weights, int16_t* patch, int64_t* sums)
+        {
+            const size_t plane = LK_PATCH_STRIDE * LK_PATCH_STRIDE;
+            int64_t xx = 0, xy = 0, yy = 0;
+            for (size_t y = 0; y < size; ++y)
+            {
+                int16_t* pI = patch + y * LK_PATCH_STRIDE, * pX = pI + plane, * pY = pX + plane;
+                for (size_t x = 0; x < size; ++x)
+                {
+                    int ix = LkValue(dx + x, dx + dStride + x, weights);
+                    int iy = LkValue(dy + x, dy + dStride + x, weights);
+                    pI[x] = (int16_t)LkValue(src + x, src + srcStride + x, weights);
+                    pX[x] = (int16_t)ix;
+                    pY[x] = (int16_t)iy;
+                    xx += ix * ix;
+                    xy += ix * iy;
+                    yy += iy * iy;
+                }
+                src += srcStride;
+                dx += dStride;
+                dy += dStride;
+            }
+            sums[0] = xx;
+            sums[1] = xy;
+            sums[2] = yy;
+        }
+
+        void LkMismatch(const uint8_t* src, size_t srcStride, size_t size, const int* weights, const int16_t* patch, int64_t* sums)
+        {
+            const size_t plane = LK_PATCH_STRIDE * LK_PATCH_STRIDE;
+            int64_t bx = 0, by = 0;
+            for (size_t y = 0; y < size; ++y)
+            {
+                const int16_t* pI = patch + y * LK_PATCH_STRIDE, * pX = pI + plane, * pY = pX + plane;
+                for (size_t x = 0; x < size; ++x)
+                {
+                    int diff = LkValue(src + x, src + srcStride + x, weights) - pI[x];
+                    bx += diff * pX[x];
+                    by += diff * pY[x];
+                }
+                src += srcStride;
+            }
+            sums[0] = bx;
+            sums[1] = by;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static size_t LkLevels(const OpticalFlowLkParam& param)
+        {
+            size_t levels = 1, width = param.width, height = param.height;
+            for (; levels < param.levels; ++levels)
+            {
+                width = (width + 1) / 2, height = (height + 1) / 2;
+                if (width <= param.window || height <= param.window)
+                    break;
+            }
+            return levels;
+        }
+
+        OpticalFlowLkDefault::OpticalFlowLkDefault(const OpticalFlowLkParam& param, PyramidBuilderInitPtr pyramidInit)
+            : Simd::OpticalFlowLk(param)
+            , _threads(Base::GetThreadNumber())
+            , _levels(LkLevels(param))
+            , _border(param.window / 2 + 2)
+            , _width(_levels)
+            , _height(_levels)
+            , _stride(_levels)
+            , _prev(_levels)
+            , _next(_levels)
+            , _dx(_levels)
+            , _dy(_levels)
+            , _patches(_threads)
+            , _pyramid(NULL)
+            , _gradient(LkGradient)
+            , _patch(LkPatch)
+            , _mismatch(LkMismatch)
+        {
+            _pyramid = (PyramidBuilder*)pyramidInit(param.width, param.height, _levels, 2.0, SimdReduce5x5, SimdTrue);
+            for (size_t level = 0; level < _levels; ++level)
+            {
+                _pyramid->LevelSize(level, &_width[level], &_height[level]);
+                _stride[level] = AlignHi(_width[level] + 2 * _border, 64) + 64;
+                size_t size = _stride[level] * (_height[level] + 2 * _border);
+                _prev[level].Resize(size, true);
+                _next[level].Resize(size, true);
+                _dx[level].Resize(size, true);
+                _dy[level].Resize(size, true);
+            }
+            for (size_t thread = 0; thread < _threads; ++thread)
+                _patches[thread].Resize(LK_PATCH_STRIDE * LK_PATCH_STRIDE * 3, true);
+        }
+
+        OpticalFlowLkDefault::~OpticalFlowLkDefault()
+        {
+            if (_pyramid)
+                delete _pyramid;
+        }
+
+        void OpticalFlowLkDefault::Run(const uint8_t* prev, size_t prevStride, const uint8_t* next, size_t nextStride,
+            const float* prevPoints, size_t count, float* nextPoints, uint8_t* status)
+        {
+            Build(prev, prevStride, _prev);
+            Build(next, nextStride, _next);
+            Gradient();
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    bool tracked = Track(thread, prevPoints[2 * i + 0], prevPoints[2 * i + 1], nextPoints + 2 * i);
+                    if (status)
+                        status[i] = tracked ? 1 : 0;
+                }
+            }, _threads, 1);
+        }
+
+        void OpticalFlowLkDefault::Build(const uint8_t* src, size_t srcStride, std::vector<Array8u>& pyramid)
+        {
+            const size_t levels = _levels, border = _border;
+            std::vector<uint8_t*> data(levels);
+            for (size_t level = 0; level < levels; ++level)
+                data[level] = pyramid[level].data + border * _stride[level] + border;
+            for (size_t row = 0; row < _height[0]; ++row)
+                memcpy(data[0] + row * _stride[0], src + row * srcStride, _width[0]);
+            _pyramid->Run(data[0], _stride[0], data.data() + 1, _stride.data() + 1);
+            for (size_t level = 0; level < levels; ++level)
+            {
+                size_t width = _width[level], height = _height[level], stride = _stride[level];
+                for (size_t row = 0; row < height; ++row)
+                {
+                    uint8_t* dst = data[level] + row * stride;
+                    memset(dst - border, dst[0], border);
+                    memset(dst + width, dst[width - 1], border);
+                }
+                uint8_t* first = data[level] - border, * last = first + (height - 1) * stride;
+                for (size_t row = 1; row <= border; ++row)
+                {
+                    memcpy(first - row * stride, first, width + 2 * border);
+                    memcpy(last + row * stride, last, width + 2 * border);
+                }
+            }
+        }
+
+        void OpticalFlowLkDefault::Gradient()
+        {
+            for (size_t level = 0; level < _levels; ++level)
+            {
+                size_t width = _width[level] + 2 * _border - 2, height = _height[level] + 2 * _border - 2, stride = _stride[level];
+                const uint8_t* src = _prev[level].data + stride + 1;
+                int16_t* dx = _dx[level].data + stride + 1;
+                int16_t* dy = _dy[level].data + stride + 1;
+                Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+                {
+                    _gradient(src + begin * stride, stride, width, end - begin, dx + begin * stride, dy + begin * stride, stride);
+                }, _threads, 8);
+            }
+        }
+
+        SIMD_INLINE bool LkInside(ptrdiff_t x, ptrdiff_t y, ptrdiff_t window, ptrdiff_t width, ptrdiff_t height)
+        {
+            ptrdiff_t half = window / 2;
+            return x >= -half - 1 && x <= width - half - 1 && y >= -half - 1 && y <= height - half - 1;
+        }
+
+        SIMD_INLINE void LkWeights(float x, float y, int* weights)
+        {
+            const float scale = float(1 << LK_WEIGHT_BITS);
+            float a = x - ::floor(x), b = y - ::floor(y);
+            weights[0] = Round((1.0f - a) * (1.0f - b) * scale);
+            weights[1] = Round(a * (1.0f - b) * scale);
+            weights[2] = Round((1.0f - a) * b * scale);
+            weights[3] = (1 << LK_WEIGHT_BITS) - weights[0] - weights[1] - weights[2];
+        }
+
+        bool OpticalFlowLkDefault::Track(size_t thread, float x, float y, float* point)
+        {
+            const double scale = 1.0 / double(1 << 20), minEigen = 1.0e-4;
+            const ptrdiff_t window = _param.window, half = window / 2, levels = _levels;
+            const float epsilon = _param.epsilon * _param.epsilon;
+            int16_t* patch = _patches[thread].data;
+            float nx = 0, ny = 0;
+            for (ptrdiff_t level = levels - 1; level >= 0; --level)
+            {
+                const ptrdiff_t width = _width[level], height = _height[level], stride = _stride[level], offset = _border * (stride + 1);
+                float px = x / float(1 << level), py = y / float(1 << level);
+                if (level == levels - 1)
+                    nx = px, ny = py;
+                else
+                    nx *= 2.0f, ny *= 2.0f;
+                ptrdiff_t ix = (ptrdiff_t)::floor(px - half), iy = (ptrdiff_t)::floor(py - half);
+                if (!LkInside(ix, iy, window, width, height))
+                {
+                    if (level == 0)
+                        break;
+                    continue;
+                }
+                int weights[4];
+                int64_t sums[3];
+                LkWeights(px - half, py - half, weights);
+                ptrdiff_t shift = offset + iy * stride + ix;
+                _patch(_prev[level].data + shift, stride, _dx[level].data + shift, _dy[level].data + shift, stride, window, weights, patch, sums);
+                double a11 = double(sums[0]) * scale, a12 = double(sums[1]) * scale, a22 = double(sums[2]) * scale;
+                double det = a11 * a22 - a12 * a12;
+                double eigen = (a22 + a11 - ::sqrt((a11 - a22) * (a11 - a22) + 4.0 * a12 * a12)) / double(2 * window * window);
+                if (eigen < minEigen || det < FLT_EPSILON)
+                {
+                    if (level == 0)
+                        break;
+                    continue;
+                }
+                det = 1.0 / det;
+                float prevDx = 0, prevDy = 0;
+                for (size_t iteration = 0; iteration < _param.iterations; ++iteration)
+                {
+                    ix = (ptrdiff_t)::floor(nx - half), iy = (ptrdiff_t)::floor(ny - half);
+                    if (!LkInside(ix, iy, window, width, height))
+                    {
+                        if (level == 0)
+                        {
+                            point[0] = nx, point[1] = ny;
+                            return false;
+                        }
+                        break;
+                    }
+                    int64_t b[2];
+                    LkWeights(nx - half, ny - half, weights);
+                    _mismatch(_next[level].data + offset + iy * stride + ix, stride, window, weights, patch, b);
+                    double b1 = double(b[0]) * scale, b2 = double(b[1]) * scale;
+                    float dx = float((a12 * b2 - a22 * b1) * det);
+                    float dy = float((a12 * b1 - a11 * b2) * det);
+                    nx += dx, ny += dy;
+                    if (dx * dx + dy * dy <= epsilon)
+                        break;
+                    if (iteration > 0 && ::fabs(dx + prevDx) < 0.01f && ::fabs(dy + prevDy) < 0.01f)
+                    {
+                        nx -= dx * 0.5f, ny -= dy * 0.5f;
+                        break;
+                    }
+                    prevDx = dx, prevDy = dy;
+                }
+                if (level == 0)
+                {
+                    point[0] = nx, point[1] = ny;
+                    return true;
+                }
+            }
+            point[0] = nx, point[1] = ny;
+            return false;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t window, size_t levels, size_t iterations, float epsilon)
+        {
+            OpticalFlowLkParam param(width, height, window, levels, iterations, epsilon);
+            if (!param.Valid())
+                return NULL;
+            return new OpticalFlowLkDefault(param, PyramidBuilderInit);
+        }
+    }
+}
@@ -0,0 +1,252 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdPyramidBuilder.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        PyramidBuilder::PyramidBuilder(const PyramidBuilderParam& param, ResizerInitPtr resizerInit)
+            : _param(param)
+            , _threads(Base::GetThreadNumber())
+            , _strip(32)
+        {
+            _width.resize(_param.levels);
+            _height.resize(_param.levels);
+            _lo.resize(_param.levels);
+            _hi.resize(_param.levels);
+            _width[0] = _param.width;
+            _height[0] = _param.height;
+            for (size_t level = 1; level < _param.levels; ++level)
+            {
+                if (_param.Reduce())
+                {
+                    _width[level] = DivHi(_width[level - 1], 2);
+                    _height[level] = DivHi(_height[level - 1], 2);
+                }
+                else
+                {
+                    double scale = ::pow(_param.scale, double(level));
+                    _width[level] = Simd::Max<size_t>(Round(double(_param.width) / scale), 1);
+                    _height[level] = Simd::Max<size_t>(Round(double(_param.height) / scale), 1);
+                }
+                size_t srcH = _height[level - 1], dstH = _height[level];
+                _lo[level].resize(dstH);
+                _hi[level].resize(dstH);
+                for (size_t y = 0; y < dstH; ++y)
+                {
+                    if (_param.Reduce())
+                    {
+                        size_t margin = _param.reduce == SimdReduce2x2 ? 0 : 2;
+                        _lo[level][y] = 2 * y > margin ? 2 * y - margin : 0;
+                        _hi[level][y] = Simd::Min(2 * y + 2 + margin, srcH);
+                    }
+                    else
+                    {
+                        ptrdiff_t index = (ptrdiff_t)::floor((double(y) + 0.5) * double(srcH) / double(dstH) - 0.5);
+                        _lo[level][y] = Simd::RestrictRange<ptrdiff_t>(index - 1, 0, srcH - 1);
+                        _hi[level][y] = Simd::RestrictRange<ptrdiff_t>(index + 3, 1, srcH);
+                    }
+                }
+            }
+            if (_param.levels > 1 && _param.width * _param.height < 0x10000)
+                _threads = 1;
+            if (_param.Reduce())
+            {
+                if (_param.levels > 1)
+                {
+                    _buffers.resize(_threads);
+                    for (size_t t = 0; t < _threads; ++t)
+                        _buffers[t].Resize((_strip + 2) * _width[1]);
+                }
+            }
+            else
+            {
+                _resizers.resize(_threads * _param.levels, NULL);
+                for (size_t t = 0; t < _threads; ++t)
+                    for (size_t level = 1; level < _param.levels; ++level)
+                        _resizers[t * _param.levels + level] = (Resizer*)resizerInit(_width[level - 1], _height[level - 1], 
+                            _width[level], _height[level], 1, SimdResizeChannelByte, SimdResizeMethodBilinear);
+            }
+        }
+
+        PyramidBuilder::~PyramidBuilder()
+        {
+            for (size_t i = 0; i < _resizers.size(); ++i)
+                if (_resizers[i])
+                    delete _resizers[i];
+        }
+
+        void PyramidBuilder::LevelSize(size_t level, size_t* width, size_t* height) const
+        {
+            assert(level < _param.levels);
+            *width = _width[level];
+            *height = _height[level];
+        }
+
+        void PyramidBuilder::Run(const uint8_t* src, size_t srcStride, uint8_t* const* dst, const size_t* dstStride)
+        {
+            if (_param.levels < 2)
+                return;
+            std::vector<uint8_t*> data(_param.levels);
+            std::vector<size_t> stride(_param.levels);
+            data[0] = (uint8_t*)src, stride[0] = srcStride;
+            for (size_t level = 1; level < _param.levels; ++level)
+                data[level] = dst[level - 1], stride[level] = dstStride[level - 1];
+
+            size_t bands = Simd::Min(_threads, Simd::Max<size_t>(_height[1] / _strip, 1));
+            SetBands(bands);
+            Simd::Parallel(0, bands, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t band = begin; band < end; ++band)
+                    RunBand(thread, band, data.data(), stride.data());
+            }, bands, 1);
+            if (bands > 1)
+            {
+                for (size_t level = 1; level < _param.levels; ++level)
+                {
+                    for (size_t band = 0; band < bands; ++band)
+                    {
+                        const Band& b = _bands[band * _param.levels + level];
+                        Produce(0, level, b.beg, b.validBeg, data.data(), stride.data());
+                        Produce(0, level, b.validEnd, b.end, data.data(), stride.data());
+                    }
+                }
+            }
+        }
+
+        void PyramidBuilder::Reduce(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t* dst, size_t dstWidth, size_t dstHeight, size_t dstStride) const
+        {
+            switch (_param.reduce)
+            {
+            case SimdReduce2x2: Base::ReduceGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); break;
+            case SimdReduce3x3: Base::ReduceGray3x3(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, _param.compensation); break;
+            case SimdReduce4x4: Base::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride); break;
+            case SimdReduce5x5: Base::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, _param.compensation); break;
+            default: assert(0);
+            }
+        }
+
+        void PyramidBuilder::SetBands(size_t count)
+        {
+            _bands.resize(count * _param.levels);
+            for (size_t band = 0; band < count; ++band)
+            {
+                Band* b = _bands.data() + band * _param.levels;
+                b[0].beg = 0, b[0].end = _height[0];
+                b[0].validBeg = 0, b[0].validEnd = _height[0];
+                for (size_t level = 1; level < _param.levels; ++level)
+                {
+                    const std::vector<size_t>& lo = _lo[level], & hi = _hi[level];
+                    size_t height = _height[level];
+                    b[level].beg = height * band / count;
+                    b[level].end = height * (band + 1) / count;
+                    size_t y = b[level].beg;
+                    while (y < b[level].end && lo[y] < b[level - 1].validBeg)
+                        y++;
+                    b[level].validBeg = y;
+                    while (y < b[level].end && hi[y] <= b[level - 1].validEnd)
+                        y++;
+                    b[level].validEnd = y;
+                }
+            }
+        }
+
+        void PyramidBuilder::RunBand(size_t thread, size_t band, uint8_t* const* data, const size_t* stride)
+        {
+            const Band* b = _bands.data() + band * _param.levels;
+            std::vector<size_t> done(_param.levels);
+            for (size_t level = 0; level < _param.levels; ++level)
+                done[level] = level ? b[level].validBeg : b[level].validEnd;
+            for (bool progress = true; progress;)
+            {
+                progress = false;
+                for (size_t level = 1; level < _param.levels; ++level)
+                {
+                    const std::vector<size_t>& hi = _hi[level];
+                    size_t beg = done[level], end = beg, last = Simd::Min(beg + _strip, b[level].validEnd);
+                    while (end < last && hi[end] <= done[level - 1])
+                        end++;
+                    if (end > beg)
+                    {
+                        Produce(thread, level, beg, end, data, stride);
+                        done[level] = end;
+                        progress = true;
+                    }
+                }
+            }
+        }
+
+        void PyramidBuilder::Produce(size_t thread, size_t level, size_t beg, size_t end, uint8_t* const* data, const size_t* stride)
+        {
+            const uint8_t* src = data[level - 1];
+            uint8_t* dst = data[level];
+            size_t srcW = _width[level - 1], srcH = _height[level - 1], srcS = stride[level - 1];
+            size_t dstW = _width[level], dstH = _height[level], dstS = stride[level];
+            if (!_param.Reduce())
+            {
+                if (end > beg)
+                {
+                    Resizer* resizer = _resizers[thread * _param.levels + level];
+                    resizer->SetRows(beg, end);
+                    resizer->Run(src, srcS, dst, dstS);
+                }
+                return;
+            }
+            for (size_t yBeg = beg; yBeg < end; yBeg += _strip)
+            {
+                size_t yEnd = Simd::Min(yBeg + _strip, end);
+                if (_param.reduce == SimdReduce2x2)
+                {
+                    size_t sBeg = 2 * yBeg, sEnd = Simd::Min(2 * yEnd, srcH);
+                    Reduce(src + sBeg * srcS, srcW, sEnd - sBeg, srcS, dst + yBeg * dstS, dstW, yEnd - yBeg, dstS);
+                }
+                else if (yBeg == 0 && yEnd == dstH)
+                    Reduce(src, srcW, srcH, srcS, dst, dstW, dstH, dstS);
+                else
+                {
+                    size_t sBeg = yBeg ? 2 * yBeg - 2 : 0, sEnd = Simd::Min(2 * yEnd + 2, srcH);
+                    size_t rows = (sEnd - sBeg + 1) / 2, offset = yBeg - sBeg / 2;
+                    uint8_t* buf = _buffers[thread].data;
+                    Reduce(src + sBeg * srcS, srcW, sEnd - sBeg, srcS, buf, dstW, rows, dstW);
+                    for (size_t y = yBeg; y < yEnd; ++y)
+                        memcpy(dst + y * dstS, buf + (y - yBeg + offset) * dstW, dstW);
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* PyramidBuilderInit(size_t width, size_t height, size_t levels, double scale, SimdReduceType reduce, SimdBool compensation)
+        {
+            PyramidBuilderParam param(width, height, levels, scale, reduce, compensation == SimdTrue);
+            if (!param.Valid())
+                return NULL;
+            return new PyramidBuilder(param, ResizerInit);
+        }
+    }
+}
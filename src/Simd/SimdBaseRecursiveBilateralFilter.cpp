@@ -23,6 +23,9 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -62,10 +65,20 @@ namespace Simd
         : _param(param)
         , _hFilter(NULL)
         , _vFilter(NULL)
+        , _threads(Base::GetThreadNumber())
+        , _stripe(param.width)
+        , _size(0)
     {
         _param.Init();
     }
 
+    void RecursiveBilateralFilter::InitStripes(size_t columnSize)
+    {
+        const size_t stripeMin = 64;
+        size_t stripe = Base::AlgCacheL2() / (columnSize * _param.height);
+        _stripe = Simd::Min(Simd::Max(AlignLo(stripe, 16), stripeMin), _param.width);
+    }
+
     //---------------------------------------------------------------------------------------------
 
     namespace Base
@@ -231,26 +244,42 @@ namespace Simd
             : Simd::RecursiveBilateralFilter(param)
         {
             Prec::Set(_param, _hFilter, _vFilter);
+            InitStripes((_param.channels + 1) * sizeof(float) + _param.channels);
         }
 
-        float* RecursiveBilateralFilterPrecize::GetBuffer()
+        uint8_t* RecursiveBilateralFilterPrecize::GetBuffer()
         {
             if (_buffer.Empty())
             {
                 const RbfParam& p = _param;
-                size_t size = 0;
-                size += p.height * p.width * (p.channels + 1);
-                size += p.width * (p.channels * 2 + 3);
-                _buffer.Resize(size * sizeof(float));
+                size_t hor = p.width * (p.channels * 2 + 3);
+                size_t ver = StripeWidthMax() * (p.height * (p.channels + 1) + p.channels * 2 + 3);
+                _size = AlignHi(Simd::Max(hor, ver) * sizeof(float), SIMD_ALIGN);
+                _buffer.Resize(_size * _threads);
             }
-            return (float*)_buffer.data;
+            return _buffer.data;
         }
 
         void RecursiveBilateralFilterPrecize::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
-            float* buf = GetBuffer();
-            _hFilter(_param, buf, src, srcStride, dst, dstStride);
-            _vFilter(_param, buf, src, srcStride, dst, dstStride);
+            uint8_t* buf = GetBuffer();
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                RbfParam band = _param;
+                band.height = end - begin;
+                _hFilter(band, (float*)(buf + thread * _size), src + begin * srcStride, srcStride, dst + begin * dstStride, dstStride);
+            }, _threads);
+            size_t stripes = StripeNumber();
+            Simd::Parallel(0, stripes, [&](size_t thread, size_t begin, size_t end)
+            {
+                RbfParam stripe = _param;
+                for (size_t s = begin; s < end; ++s)
+                {
+                    size_t offset = s * _stripe * _param.channels;
+                    stripe.width = s + 1 < stripes ? _stripe : StripeWidthMax();
+                    _vFilter(stripe, (float*)(buf + thread * _size), src + offset, srcStride, dst + offset, dstStride);
+                }
+            }, _threads);
         }
 
         //-----------------------------------------------------------------------------------------
@@ -392,29 +421,66 @@ namespace Simd
             : Simd::RecursiveBilateralFilter(param)
         {
             Fast::Set(_param, _hFilter, _vFilter);
+            InitStripes(_param.channels * 2);
+            _stride = AlignHi(StripeWidthMax() * _param.channels, _param.align);
         }
 
-        uint8_t* RecursiveBilateralFilterFast::GetBuffer()
+        const size_t RBF_COPY_ROWS = 8;
+
+        uint8_t* RecursiveBilateralFilterFast::GetBuffer(size_t dstStride)
         {
-            if (_buffer.Empty())
+            const RbfParam& p = _param;
+            size_t hor = AlignHi(dstStride * 2 * sizeof(float) + 4 * dstStride, SIMD_ALIGN) + RBF_COPY_ROWS * p.width * p.channels;
+            size_t ver = _stride * p.height + _stride * 2 * sizeof(float) + 4 * _stride;
+            size_t size = AlignHi(Simd::Max(hor, ver), SIMD_ALIGN);
+            if (size > _size)
             {
-                const RbfParam& p = _param;
-                _stride = AlignHi(p.width * p.channels, p.align);
-                _size = _stride * p.height;
-                size_t size = 0;
-                size += _size;
-                size += _stride * 2 * sizeof(float);
-                size += 4 * _stride;
-                _buffer.Resize(size);
+                _size = size;
+                _buffer.Resize(_size * _threads);
             }
             return _buffer.data;
         }
 
         void RecursiveBilateralFilterFast::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
-            uint8_t* buf = GetBuffer();
-            _hFilter(_param, (float*)(buf + _size), src, srcStride, buf, _stride);
-            _vFilter(_param, (float*)(buf + _size), buf, _stride, dst, dstStride);
+            uint8_t* buf = GetBuffer(dstStride);
+            size_t rowSize = _param.width * _param.channels, copy = AlignHi(dstStride * 2 * sizeof(float) + 4 * dstStride, SIMD_ALIGN);
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                RbfParam band = _param;
+                float* tmp = (float*)(buf + thread * _size);
+                if (src == dst)
+                {
+                    // The horizontal pass writes output rows before it reads them again, so in-place source rows are copied first.
+                    uint8_t* rows = buf + thread * _size + copy;
+                    for (size_t y = begin; y < end; y += band.height)
+                    {
+                        band.height = Simd::Min(RBF_COPY_ROWS, end - y);
+                        for (size_t r = 0; r < band.height; ++r)
+                            memcpy(rows + r * rowSize, src + (y + r) * srcStride, rowSize);
+                        _hFilter(band, tmp, rows, rowSize, dst + y * dstStride, dstStride);
+                    }
+                }
+                else
+                {
+                    band.height = end - begin;
+                    _hFilter(band, tmp, src + begin * srcStride, srcStride, dst + begin * dstStride, dstStride);
+                }
+            }, _threads);
+            size_t stripes = StripeNumber();
+            Simd::Parallel(0, stripes, [&](size_t thread, size_t begin, size_t end)
+            {
+                RbfParam stripe = _param;
+                uint8_t* hor = buf + thread * _size;
+                for (size_t s = begin; s < end; ++s)
+                {
+                    size_t offset = s * _stripe * _param.channels;
+                    stripe.width = s + 1 < stripes ? _stripe : StripeWidthMax();
+                    for (size_t y = 0, size = stripe.width * _param.channels; y < _param.height; ++y)
+                        memcpy(hor + y * _stride, dst + y * dstStride + offset, size);
+                    _vFilter(stripe, (float*)(hor + _stride * _param.height), hor, _stride, dst + offset, dstStride);
+                }
+            }, _threads);
         }
 
         //-----------------------------------------------------------------------------------------
@@ -23,6 +23,8 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -39,6 +41,10 @@ namespace Simd
                 return new ResizerShortBilinear(param);
             else if (param.IsFloatBilinear())
                 return new ResizerFloatBilinear(param);
+            else if (param.IsBf16Bilinear())
+                return new ResizerBf16Bilinear(param);
+            else if (param.IsFilter())
+                return new ResizerFilter(param);
             else if (param.IsByteBicubic())
                 return new ResizerByteBicubic(param);
             else if (param.IsByteArea2x2())
@@ -48,6 +54,136 @@ namespace Simd
             else
                 return NULL;
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerParallel::ResizerParallel(const ResParam& param, ResizerInitPtr init, size_t bands)
+            : Resizer(param)
+        {
+            for (size_t b = 0; b < bands; ++b)
+            {
+                Resizer* band = (Resizer*)init(param.srcW, param.srcH, param.dstW, param.dstH, param.channels, param.type, param.method);
+                if (band == NULL)
+                    break;
+                band->SetBand(param.dstH * b / bands, param.dstH * (b + 1) / bands);
+                _bands.push_back(band);
+            }
+            if (_bands.size() < bands)
+            {
+                for (size_t b = 0; b < _bands.size(); ++b)
+                    delete _bands[b];
+                _bands.clear();
+            }
+        }
+
+        ResizerParallel::~ResizerParallel()
+        {
+            for (size_t b = 0; b < _bands.size(); ++b)
+                delete _bands[b];
+        }
+
+        void ResizerParallel::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            Simd::Parallel(0, _bands.size(), [&](size_t, size_t begin, size_t end)
+            {
+                for (size_t b = begin; b < end; ++b)
+                    _bands[b]->Run(src, srcStride, dst, dstStride);
+            }, _bands.size(), 1);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerParallelInit(ResizerInitPtr init, size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            size_t threads = dstX * dstY >= 0x10000 ? GetThreadNumber() : 1;
+            size_t bands = Simd::Min(threads, dstY / 16);
+            if (bands < 2)
+                return init(srcX, srcY, dstX, dstY, channels, type, method);
+            ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(void*));
+            ResizerParallel* resizer = new ResizerParallel(param, init, bands);
+            if (resizer->Ok())
+                return resizer;
+            delete resizer;
+            return NULL;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const size_t CROP_RESIZER_CACHE_MAX = 64;
+
+        CropResizer::CropResizer(const ResParam& param, ResizerInitPtr init)
+            : _param(param)
+            , _init(init)
+            , _threads(GetThreadNumber())
+        {
+            _caches.resize(_threads);
+        }
+
+        CropResizer::~CropResizer()
+        {
+            for (size_t t = 0; t < _caches.size(); ++t)
+                for (Resizers::iterator it = _caches[t].resizers.begin(); it != _caches[t].resizers.end(); ++it)
+                    delete it->second.resizer;
+        }
+
+        Resizer* CropResizer::Get(size_t thread, size_t srcW, size_t srcH)
+        {
+            Cache& cache = _caches[thread];
+            Resizers& resizers = cache.resizers;
+            uint64_t key = uint64_t(srcW) << 32 | uint64_t(srcH);
+            cache.time++;
+            Resizers::iterator it = resizers.find(key);
+            if (it != resizers.end())
+            {
+                it->second.used = cache.time;
+                return it->second.resizer;
+            }
+            if (resizers.size() >= CROP_RESIZER_CACHE_MAX)
+            {
+                Resizers::iterator lru = resizers.begin();
+                for (it = resizers.begin(); it != resizers.end(); ++it)
+                    if (it->second.used < lru->second.used)
+                        lru = it;
+                delete lru->second.resizer;
+                resizers.erase(lru);
+            }
+            Resizer* resizer = (Resizer*)_init(srcW, srcH, _param.dstW, _param.dstH, _param.channels, _param.type, _param.method);
+            if (resizer)
+            {
+                Cached& cached = resizers[key];
+                cached.resizer = resizer;
+                cached.used = cache.time;
+            }
+            return resizer;
+        }
+
+        void CropResizer::Run(const uint8_t* src, size_t srcStride, const size_t* rects, size_t count, uint8_t* dst, size_t dstStride)
+        {
+            size_t pixelSize = _param.PixelSize(), dstSize = _param.dstH * dstStride;
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const size_t* rect = rects + i * 4;
+                    assert(rect[0] < rect[2] && rect[1] < rect[3]);
+                    Resizer* resizer = Get(thread, rect[2] - rect[0], rect[3] - rect[1]);
+                    if (resizer)
+                        resizer->Run(src + rect[1] * srcStride + rect[0] * pixelSize, srcStride, dst + i * dstSize, dstStride);
+                }
+            }, _threads, 1);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CropResizerInit(ResizerInitPtr init, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            Resizer* resizer = (Resizer*)init(dstX, dstY, dstX, dstY, channels, type, method);
+            if (resizer == NULL)
+                return NULL;
+            delete resizer;
+            ResParam param(dstX, dstY, dstX, dstY, channels, type, method, sizeof(void*));
+            return new CropResizer(param, init);
+        }
     }
 }
 
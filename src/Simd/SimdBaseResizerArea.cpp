@@ -34,17 +34,15 @@ namespace Simd
         ResizerByteArea::ResizerByteArea(const ResParam& param)
             : Resizer(param)
         {
-            _ay.Resize(_param.dstH + 1);
-            _iy.Resize(_param.dstH + 1);
             _ax.Resize(_param.dstW + 1);
             _ix.Resize(_param.dstW + 1);
         }
 
-        void ResizerByteArea::EstimateParams(size_t srcSize, size_t dstSize, size_t range, int32_t* alpha, int32_t* index)
+        void ResizerByteArea::EstimateParams(size_t srcSize, size_t dstSize, size_t beg, size_t end, size_t range, int32_t* alpha, int32_t* index)
         {
             float scale = (float)srcSize / dstSize;
 
-            for (size_t ds = 0; ds <= dstSize; ++ds)
+            for (size_t ds = beg; ds < end; ++ds)
             {
                 float a = (float)ds * scale;
                 size_t i = (size_t)::floor(a);
@@ -64,11 +62,20 @@ namespace Simd
         ResizerByteArea1x1::ResizerByteArea1x1(const ResParam & param)
             : ResizerByteArea(param)
         {
-            EstimateParams(_param.srcH, _param.dstH, Base::AREA_RANGE, _ay.data, _iy.data);
-            EstimateParams(_param.srcW, _param.dstW, Base::AREA_RANGE, _ax.data, _ix.data);
+            EstimateParams(_param.srcW, _param.dstW, 0, _param.dstW + 1, Base::AREA_RANGE, _ax.data, _ix.data);
             _by.Resize(AlignHi(_param.srcW * _param.channels, _param.align), false, _param.align);
         }
 
+        void ResizerByteArea1x1::EstimateRows()
+        {
+            if (_iy.data)
+                return;
+            _ay.Resize(_param.dstH + 1);
+            _iy.Resize(_param.dstH + 1);
+            EstimateParams(_param.srcH, _param.dstH, 0, 1, Base::AREA_RANGE, _ay.data, _iy.data);
+            EstimateParams(_param.srcH, _param.dstH, _bandBeg, _bandEnd + 1, Base::AREA_RANGE, _ay.data, _iy.data);
+        }
+
         template<size_t N, UpdateType update> SIMD_INLINE void ResizerByteArea1x1RowUpdate(const uint8_t* src, int32_t val, int32_t* dst)
         {
             for (size_t c = 0; c < N; ++c)
@@ -102,7 +109,9 @@ namespace Simd
             size_t dstW = _param.dstW, rowSize = _param.srcW * N, rowRest = dstStride - dstW * N;
             const int32_t* iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            dst += _yBeg * dstStride;
+            src += iy[_yBeg] * srcStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += rowRest)
             {
                 int32_t* buf = _by.data;
                 size_t yn = iy[dy + 1] - iy[dy];
@@ -117,6 +126,7 @@ namespace Simd
 
         void ResizerByteArea1x1::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
         {
+            EstimateRows();
             switch (_param.channels)
             {
             case 1: Run<1>(src, srcStride, dst, dstStride); return;
@@ -133,11 +143,20 @@ namespace Simd
         ResizerByteArea2x2::ResizerByteArea2x2(const ResParam& param)
             : ResizerByteArea(param)
         {
-            EstimateParams(DivHi(_param.srcH, 2), _param.dstH, Base::AREA_RANGE / 2, _ay.data, _iy.data);
-            EstimateParams(DivHi(_param.srcW, 2), _param.dstW, Base::AREA_RANGE / 2, _ax.data, _ix.data);
+            EstimateParams(DivHi(_param.srcW, 2), _param.dstW, 0, _param.dstW + 1, Base::AREA_RANGE / 2, _ax.data, _ix.data);
             _by.Resize(AlignHi(DivHi(_param.srcW, 2) * _param.channels, _param.align) + _param.align, false, _param.align);
         }
 
+        void ResizerByteArea2x2::EstimateRows()
+        {
+            if (_iy.data)
+                return;
+            _ay.Resize(_param.dstH + 1);
+            _iy.Resize(_param.dstH + 1);
+            EstimateParams(DivHi(_param.srcH, 2), _param.dstH, 0, 1, Base::AREA_RANGE / 2, _ay.data, _iy.data);
+            EstimateParams(DivHi(_param.srcH, 2), _param.dstH, _bandBeg, _bandEnd + 1, Base::AREA_RANGE / 2, _ay.data, _iy.data);
+        }
+
         template<size_t N, UpdateType update> SIMD_INLINE void ResizerByteArea2x2RowUpdate(const uint8_t* src0, const uint8_t* src1, size_t size, int32_t val, int32_t* dst)
         {
             if (update == UpdateAdd && val == 0)
@@ -169,7 +188,9 @@ namespace Simd
             size_t dstW = _param.dstW, rowSize = _param.srcW * N, rowRest = dstStride - dstW * N;
             const int32_t* iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            dst += _yBeg * dstStride;
+            src += iy[_yBeg] * 2 * srcStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += rowRest)
             {
                 int32_t* buf = _by.data;
                 size_t yn = (iy[dy + 1] - iy[dy]) * 2;
@@ -185,6 +206,7 @@ namespace Simd
 
         void ResizerByteArea2x2::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
+            EstimateRows();
             switch (_param.channels)
             {
             case 1: Run<1>(src, srcStride, dst, dstStride); return;
@@ -34,12 +34,12 @@ namespace Simd
         {
         }
         
-        void ResizerByteBicubic::EstimateIndexAlpha(size_t sizeS, size_t sizeD, size_t N, Array32i& index, Array32i& alpha)
+        void ResizerByteBicubic::EstimateIndexAlpha(size_t sizeS, size_t sizeD, size_t beg, size_t end, size_t N, Array32i& index, Array32i& alpha)
         {
             index.Resize(sizeD);
             alpha.Resize(sizeD * 4);
             float scale = float(sizeS) / float(sizeD);
-            for (size_t i = 0; i < sizeD; ++i)
+            for (size_t i = beg; i < end; ++i)
             {
                 float pos = (float)((i + 0.5f) * scale - 0.5f);
                 int idx = (int)::floor(pos);
@@ -66,8 +66,8 @@ namespace Simd
         {
             if (_iy.data)
                 return;
-            EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy, _ay);
-            EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix, _ax);
+            EstimateIndexAlpha(_param.srcH, _param.dstH, _bandBeg, _bandEnd, 1, _iy, _ay);
+            EstimateIndexAlpha(_param.srcW, _param.dstW, 0, _param.dstW, _param.channels, _ix, _ax);
             if (!sparse)
             {
                 for (int i = 0; i < 4; ++i)
@@ -99,7 +99,8 @@ namespace Simd
 
         template<int N> void ResizerByteBicubic::RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
                 const uint8_t* src1 = src + sy * srcStride;
@@ -146,7 +147,8 @@ namespace Simd
         template<int N> void ResizerByteBicubic::RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
             int32_t prev = -1;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 int32_t sy = _iy[dy], next = prev;
                 for (int32_t curr = sy - 1, end = sy + 3; curr < end; ++curr)
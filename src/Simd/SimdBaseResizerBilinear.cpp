@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdCopy.h"
+#include "Simd/SimdBFloat16.h"
 
 namespace Simd
 {
@@ -32,16 +33,22 @@ namespace Simd
         ResizerByteBilinear::ResizerByteBilinear(const ResParam & param)
             : Resizer(param)
         {
+        }        
+
+        void ResizerByteBilinear::EstimateRows()
+        {
+            if (_iy.data)
+                return;
             _ay.Resize(_param.dstH);
             _iy.Resize(_param.dstH);
-            EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy.data, _ay.data);
-        }        
+            EstimateIndexAlpha(_param.srcH, _param.dstH, _bandBeg, _bandEnd, 1, _iy.data, _ay.data);
+        }
         
-        void ResizerByteBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, int32_t * alphas)
+        void ResizerByteBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t beg, size_t end, size_t channels, int32_t * indices, int32_t * alphas)
         {
             float scale = (float)srcSize / dstSize;
 
-            for (size_t i = 0; i < dstSize; ++i)
+            for (size_t i = beg; i < end; ++i)
             {
                 float alpha = (float)((i + 0.5f)*scale - 0.5f);
                 ptrdiff_t index = (ptrdiff_t)::floor(alpha);
@@ -70,19 +77,21 @@ namespace Simd
 
         void ResizerByteBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
         {
+            EstimateRows();
             size_t cn =  _param.channels;
             size_t rs = _param.dstW * cn;
             if (_ax.data == 0)
             {
                 _ax.Resize(rs);
                 _ix.Resize(rs);
-                EstimateIndexAlpha(_param.srcW, _param.dstW, cn, _ix.data, _ax.data);
+                EstimateIndexAlpha(_param.srcW, _param.dstW, 0, _param.dstW, cn, _ix.data, _ax.data);
                 _bx[0].Resize(rs);
                 _bx[1].Resize(rs);
             }
             int32_t * pbx[2] = { _bx[0].data, _bx[1].data };
             int32_t prev = -2;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 int32_t fy = _ay[dy];
                 int32_t sy = _iy[dy];
@@ -133,21 +142,27 @@ namespace Simd
         ResizerShortBilinear::ResizerShortBilinear(const ResParam& param)
             : Resizer(param)
         {
-            _ay.Resize(_param.dstH, false, _param.align);
-            _iy.Resize(_param.dstH, false, _param.align);
-            EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy.data, _ay.data);
             size_t rs = _param.dstW * _param.channels + _param.align;
             _ax.Resize(rs, false, _param.align);
             _ix.Resize(rs, false, _param.align);
-            EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
+            EstimateIndexAlpha(_param.srcW, _param.dstW, 0, _param.dstW, _param.channels, _ix.data, _ax.data);
             _bx[0].Resize(rs, false, _param.align);
             _bx[1].Resize(rs, false, _param.align);
         }
 
-        void ResizerShortBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t* indices, float* alphas)
+        void ResizerShortBilinear::EstimateRows()
+        {
+            if (_iy.data)
+                return;
+            _ay.Resize(_param.dstH, false, _param.align);
+            _iy.Resize(_param.dstH, false, _param.align);
+            EstimateIndexAlpha(_param.srcH, _param.dstH, _bandBeg, _bandEnd, 1, _iy.data, _ay.data);
+        }
+
+        void ResizerShortBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t beg, size_t end, size_t channels, int32_t* indices, float* alphas)
         {
             float scale = (float)srcSize / dstSize;
-            for (size_t i = 0; i < dstSize; ++i)
+            for (size_t i = beg; i < end; ++i)
             {
                 float alpha = (float)((i + 0.5f) * scale - 0.5f);
                 ptrdiff_t index = (ptrdiff_t)::floor(alpha);
@@ -173,6 +188,7 @@ namespace Simd
 
         void ResizerShortBilinear::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
+            EstimateRows();
             Run((const uint16_t*)src, srcStride / sizeof(uint16_t), (uint16_t*)dst, dstStride / sizeof(uint16_t));
         }
 
@@ -181,7 +197,8 @@ namespace Simd
             size_t rs = _param.dstW * N;
             float* pbx[2] = { _bx[0].data, _bx[1].data };
             int32_t prev = -2;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -214,7 +231,8 @@ namespace Simd
         template<size_t N> void ResizerShortBilinear::RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride)
         {
             size_t rs = _param.dstW * N;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -252,23 +270,29 @@ namespace Simd
         ResizerFloatBilinear::ResizerFloatBilinear(const ResParam & param)
             : Resizer(param)
         {
-            _ay.Resize(_param.dstH, false, _param.align);
-            _iy.Resize(_param.dstH, false, _param.align);
-            EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy.data, _ay.data);
             size_t rs = _param.dstW * _param.channels;
             _ax.Resize(rs, false, _param.align);
             _ix.Resize(rs, false, _param.align);
-            EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
+            EstimateIndexAlpha(_param.srcW, _param.dstW, 0, _param.dstW, _param.channels, _ix.data, _ax.data);
             _bx[0].Resize(rs, false, _param.align);
             _bx[1].Resize(rs, false, _param.align);
         }
 
-        void ResizerFloatBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas)
+        void ResizerFloatBilinear::EstimateRows()
+        {
+            if (_iy.data)
+                return;
+            _ay.Resize(_param.dstH, false, _param.align);
+            _iy.Resize(_param.dstH, false, _param.align);
+            EstimateIndexAlpha(_param.srcH, _param.dstH, _bandBeg, _bandEnd, 1, _iy.data, _ay.data);
+        }
+
+        void ResizerFloatBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t beg, size_t end, size_t channels, int32_t * indices, float * alphas)
         {
             if (_param.method == SimdResizeMethodBilinear)
             {
                 float scale = (float)srcSize / dstSize;
-                for (size_t i = 0; i < dstSize; ++i)
+                for (size_t i = beg; i < end; ++i)
                 {
                     float alpha = (float)((i + 0.5f) * scale - 0.5f);
                     ptrdiff_t index = (ptrdiff_t)::floor(alpha);
@@ -294,7 +318,7 @@ namespace Simd
             else if (_param.method == SimdResizeMethodBilinearCaffe)
             {
                 float scale = dstSize > 1 ? float(srcSize - 1) / float(dstSize - 1) : 0.0f;
-                for (size_t i = 0; i < dstSize; ++i)
+                for (size_t i = beg; i < end; ++i)
                 {
                     float alpha = float(i) * scale;
                     ptrdiff_t index = (ptrdiff_t)::floor(alpha);
@@ -315,7 +339,7 @@ namespace Simd
             else if (_param.method == SimdResizeMethodBilinearPytorch)
             {
                 float scale = (float)srcSize / dstSize;
-                for (size_t i = 0; i < dstSize; ++i)
+                for (size_t i = beg; i < end; ++i)
                 {
                     float alpha = float(i) * scale;
                     ptrdiff_t index = (ptrdiff_t)::floor(alpha);
@@ -344,6 +368,7 @@ namespace Simd
 
         void ResizerFloatBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
         {
+            EstimateRows();
             Run((const float*)src, srcStride / sizeof(float), (float*)dst, dstStride / sizeof(float));
         }
 
@@ -353,7 +378,8 @@ namespace Simd
             size_t rs = _param.dstW * cn;
             float * pbx[2] = { _bx[0].data, _bx[1].data };
             int32_t prev = -2;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -386,6 +412,104 @@ namespace Simd
                     dst[dx] = pbx[0][dx]*fy0 + pbx[1][dx]*fy1;
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerBf16Bilinear::ResizerBf16Bilinear(const ResParam& param)
+            : Resizer(param)
+        {
+            size_t rs = _param.dstW * _param.channels;
+            _ax.Resize(rs, false, _param.align);
+            _ix.Resize(rs, false, _param.align);
+            EstimateIndexAlpha(_param.srcW, _param.dstW, 0, _param.dstW, _param.channels, _ix.data, _ax.data);
+            _bx[0].Resize(rs, false, _param.align);
+            _bx[1].Resize(rs, false, _param.align);
+        }
+
+        void ResizerBf16Bilinear::EstimateRows()
+        {
+            if (_iy.data)
+                return;
+            _ay.Resize(_param.dstH, false, _param.align);
+            _iy.Resize(_param.dstH, false, _param.align);
+            EstimateIndexAlpha(_param.srcH, _param.dstH, _bandBeg, _bandEnd, 1, _iy.data, _ay.data);
+        }
+
+        void ResizerBf16Bilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t beg, size_t end, size_t channels, int32_t* indices, float* alphas)
+        {
+            float scale = (float)srcSize / dstSize;
+            if (_param.method == SimdResizeMethodBilinearCaffe)
+                scale = dstSize > 1 ? float(srcSize - 1) / float(dstSize - 1) : 0.0f;
+            for (size_t i = beg; i < end; ++i)
+            {
+                float alpha = _param.method == SimdResizeMethodBilinear ? (i + 0.5f) * scale - 0.5f : float(i) * scale;
+                ptrdiff_t index = (ptrdiff_t)::floor(alpha);
+                alpha -= index;
+                if (index < 0)
+                {
+                    index = 0;
+                    alpha = 0;
+                }
+                if (index > (ptrdiff_t)srcSize - 2)
+                {
+                    index = srcSize - 2;
+                    alpha = 1;
+                }
+                for (size_t c = 0; c < channels; c++)
+                {
+                    size_t offset = i * channels + c;
+                    indices[offset] = (int32_t)(channels * index + c);
+                    alphas[offset] = alpha;
+                }
+            }
+        }
+
+        void ResizerBf16Bilinear::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            EstimateRows();
+            Run((const uint16_t*)src, srcStride / sizeof(uint16_t), (uint16_t*)dst, dstStride / sizeof(uint16_t));
+        }
+
+        void ResizerBf16Bilinear::Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride)
+        {
+            size_t cn = _param.channels;
+            size_t rs = _param.dstW * cn;
+            float* pbx[2] = { _bx[0].data, _bx[1].data };
+            int32_t prev = -2;
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                float fy1 = _ay[dy];
+                float fy0 = 1.0f - fy1;
+                int32_t sy = _iy[dy];
+                int32_t k = 0;
+
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+
+                prev = sy;
+
+                for (; k < 2; k++)
+                {
+                    float* pb = pbx[k];
+                    const uint16_t* ps = src + (sy + k) * srcStride;
+                    for (size_t dx = 0; dx < rs; dx++)
+                    {
+                        int32_t sx = _ix[dx];
+                        float fx = _ax[dx];
+                        pb[dx] = BFloat16ToFloat32(ps[sx]) * (1.0f - fx) + BFloat16ToFloat32(ps[sx + cn]) * fx;
+                    }
+                }
+
+                for (size_t dx = 0; dx < rs; dx++)
+                    dst[dx] = Float32ToBFloat16(pbx[0][dx] * fy0 + pbx[1][dx] * fy1);
+            }
+        }
     }
 }
 
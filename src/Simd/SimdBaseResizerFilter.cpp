@@ -0,0 +1,210 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE float LanczosWeight(float x)
+        {
+            const float a = 3.0f;
+            if (x == 0.0f)
+                return 1.0f;
+            if (x <= -a || x >= a)
+                return 0.0f;
+            float px = float(M_PI) * x;
+            return a * ::sin(px) * ::sin(px / a) / (px * px);
+        }
+
+        ResizerFilter::ResizerFilter(const ResParam& param)
+            : Resizer(param)
+        {
+            Array32i ix;
+            Array32f ax;
+            EstimateIndexAlpha(_param.srcW, _param.dstW, _nx, ix, ax);
+            EstimateIndexAlpha(_param.srcH, _param.dstH, _ny, _iy, _ay);
+            size_t cn = _param.channels;
+            _rs = _param.dstW * cn;
+            _ix.Resize(_rs, false, _param.align);
+            _ax.Resize(_rs * _nx, false, _param.align);
+            for (size_t dx = 0; dx < _param.dstW; dx++)
+            {
+                for (size_t c = 0; c < cn; c++)
+                {
+                    size_t e = dx * cn + c;
+                    _ix[e] = ix[dx] * (int32_t)cn + (int32_t)c;
+                    for (size_t k = 0; k < _nx; k++)
+                        _ax[k * _rs + e] = ax[dx * _nx + k];
+                }
+            }
+            _bs = AlignHi(_rs, _param.align / sizeof(float));
+            _bx.Resize(_bs * _ny, false, _param.align);
+            _by.Resize(_ny);
+            if (_param.type == SimdResizeChannelByte)
+                _sx.Resize(_param.srcW * cn, false, _param.align);
+        }
+
+        void ResizerFilter::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t& support, Array32i& index, Array32f& alpha)
+        {
+            float scale = float(srcSize) / float(dstSize);
+            std::vector<int> first(dstSize);
+            std::vector<std::vector<float>> weights(dstSize);
+            size_t size = 1;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                std::vector<float>& w = weights[i];
+                if (_param.method == SimdResizeMethodBicubic)
+                {
+                    float pos = (float)((i + 0.5f) * scale - 0.5f);
+                    int idx = (int)::floor(pos);
+                    float d = pos - idx;
+                    if (idx < 0)
+                    {
+                        idx = 0;
+                        d = 0.0f;
+                    }
+                    if (idx > (int)srcSize - 2)
+                    {
+                        idx = (int)srcSize - 2;
+                        d = 1.0f;
+                    }
+                    first[i] = idx - 1;
+                    w.push_back(-(2.0f - d) * (1.0f - d) * d / 6.0f);
+                    w.push_back((2.0f - d) * (1.0f + d) * (1.0f - d) / 2.0f);
+                    w.push_back((2.0f - d) * (1.0f + d) * d / 2.0f);
+                    w.push_back(-(1.0f + d) * (1.0f - d) * d / 6.0f);
+                }
+                else if (_param.method == SimdResizeMethodLanczos)
+                {
+                    float factor = Simd::Max(scale, 1.0f);
+                    float center = (i + 0.5f) * scale - 0.5f;
+                    int beg = (int)::ceil(center - 3.0f * factor);
+                    int end = (int)::floor(center + 3.0f * factor);
+                    float sum = 0.0f;
+                    first[i] = beg;
+                    for (int j = beg; j <= end; ++j)
+                    {
+                        w.push_back(LanczosWeight((j - center) / factor));
+                        sum += w.back();
+                    }
+                    for (size_t k = 0; k < w.size(); ++k)
+                        w[k] /= sum;
+                }
+                else
+                {
+                    float beg = float(i) * scale, end = float(i + 1) * scale;
+                    int jb = (int)::floor(beg), je = Min((int)::ceil(end), (int)srcSize);
+                    first[i] = jb;
+                    for (int j = jb; j < je; ++j)
+                        w.push_back((Simd::Min(end, float(j + 1)) - Simd::Max(beg, float(j))) / scale);
+                }
+                size = Simd::Max(size, w.size());
+            }
+            support = Simd::Min(size, srcSize);
+            index.Resize(dstSize);
+            alpha.Resize(dstSize * support, true);
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                int start = RestrictRange(first[i], 0, int(srcSize - support));
+                index[i] = start;
+                for (size_t k = 0; k < weights[i].size(); ++k)
+                {
+                    int j = RestrictRange(first[i] + int(k), 0, int(srcSize) - 1);
+                    alpha[i * support + j - start] += weights[i][k];
+                }
+            }
+        }
+
+        void ResizerFilter::ConvertRow(const uint8_t* src, float* dst)
+        {
+            for (size_t i = 0, n = _param.srcW * _param.channels; i < n; ++i)
+                dst[i] = src[i];
+        }
+
+        void ResizerFilter::FilterRow(const float* src, float* dst)
+        {
+            size_t cn = _param.channels;
+            for (size_t dx = 0; dx < _rs; dx++)
+            {
+                const float* ps = src + _ix[dx];
+                const float* ax = _ax.data + dx;
+                float sum = 0.0f;
+                for (size_t k = 0; k < _nx; k++, ps += cn, ax += _rs)
+                    sum += ps[0] * ax[0];
+                dst[dx] = sum;
+            }
+        }
+
+        void ResizerFilter::FilterCol(const float* const* src, const float* ay, uint8_t* dst)
+        {
+            for (size_t dx = 0; dx < _rs; dx++)
+            {
+                float sum = 0.0f;
+                for (size_t k = 0; k < _ny; k++)
+                    sum += src[k][dx] * ay[k];
+                if (_param.type == SimdResizeChannelByte)
+                    dst[dx] = (uint8_t)RestrictRange(Round(sum), 0, 255);
+                else
+                    ((float*)dst)[dx] = sum;
+            }
+        }
+
+        void ResizerFilter::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            std::vector<const float*> rows(_ny);
+            for (size_t k = 0; k < _ny; k++)
+                _by[k] = -1;
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                int32_t sy = _iy[dy];
+                for (size_t k = 0; k < _ny; k++)
+                {
+                    int32_t row = sy + (int32_t)k;
+                    size_t slot = row % _ny;
+                    float* pb = _bx.data + slot * _bs;
+                    if (_by[slot] != row)
+                    {
+                        const uint8_t* ps = src + row * srcStride;
+                        if (_param.type == SimdResizeChannelByte)
+                        {
+                            ConvertRow(ps, _sx.data);
+                            FilterRow(_sx.data, pb);
+                        }
+                        else
+                            FilterRow((const float*)ps, pb);
+                        _by[slot] = row;
+                    }
+                    rows[k] = pb;
+                }
+                FilterCol(rows.data(), _ay.data + dy * _ny, dst);
+            }
+        }
+    }
+}
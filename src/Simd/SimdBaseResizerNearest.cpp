@@ -35,12 +35,12 @@ namespace Simd
         {
         }
 
-        void ResizerNearest::EstimateIndex(size_t srcSize, size_t dstSize, size_t channelSize, size_t channels, int32_t* indices)
+        void ResizerNearest::EstimateIndex(size_t srcSize, size_t dstSize, size_t beg, size_t end, size_t channelSize, size_t channels, int32_t* indices)
         {
             if (_param.method == SimdResizeMethodNearest || _param.method == SimdResizeMethodBilinear || _param.method == SimdResizeMethodBicubic)
             {
                 float scale = (float)srcSize / dstSize;
-                for (size_t i = 0; i < dstSize; ++i)
+                for (size_t i = beg; i < end; ++i)
                 {
                     float alpha = (i + 0.5f) * scale;
                     int index = RestrictRange((int)::floor(alpha), 0, (int)srcSize - 1);
@@ -53,7 +53,7 @@ namespace Simd
             }
             else if (_param.method == SimdResizeMethodNearestPytorch || _param.method == SimdResizeMethodBilinearPytorch)
             {
-                for (size_t i = 0; i < dstSize; ++i)
+                for (size_t i = beg; i < end; ++i)
                 {
                     int index = RestrictRange((int)(i * srcSize / dstSize), 0, (int)srcSize - 1);
                     for (size_t c = 0; c < channels; c++)
@@ -73,14 +73,15 @@ namespace Simd
                 return;
             _pixelSize = _param.PixelSize();
             _iy.Resize(_param.dstH, false, _param.align);
-            EstimateIndex(_param.srcH, _param.dstH, 1, 1, _iy.data);
+            EstimateIndex(_param.srcH, _param.dstH, _bandBeg, _bandEnd, 1, 1, _iy.data);
             _ix.Resize(_param.dstW, false, _param.align);
-            EstimateIndex(_param.srcW, _param.dstW, _pixelSize, 1, _ix.data);
+            EstimateIndex(_param.srcW, _param.dstW, 0, _param.dstW, _pixelSize, 1, _ix.data);
         }
 
         void ResizerNearest::Resize(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++)
             {
                 const uint8_t* srcRow = src + _iy[dy] * srcStride;
                 for (size_t dx = 0, offset = 0; dx < _param.dstW; dx++, offset += _pixelSize)
@@ -91,7 +92,8 @@ namespace Simd
 
         template<size_t N> void ResizerNearest::Resize(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++)
             {
                 const uint8_t * srcRow = src + _iy[dy] * srcStride;
                 for (size_t dx = 0, offset = 0; dx < _param.dstW; dx++, offset += N)
@@ -0,0 +1,153 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSeparableFilter.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<SimdPixelFormatType type> void SepFilterLoad(const uint8_t* src, size_t size, float* dst);
+
+        template<> void SepFilterLoad<SimdPixelFormatGray8>(const uint8_t* src, size_t size, float* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = float(src[i]);
+        }
+
+        template<> void SepFilterLoad<SimdPixelFormatInt16>(const uint8_t* src, size_t size, float* dst)
+        {
+            const int16_t* ps = (const int16_t*)src;
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = float(ps[i]);
+        }
+
+        template<> void SepFilterLoad<SimdPixelFormatFloat>(const uint8_t* src, size_t size, float* dst)
+        {
+            memcpy(dst, src, size * sizeof(float));
+        }
+
+        static void SepFilterRow(const float* src, size_t size, size_t channels, const float* kernel, size_t kernelSize, float* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum += kernel[k] * src[i + k * channels];
+                dst[i] = sum;
+            }
+        }
+
+        template<SimdPixelFormatType type> void SepFilterCol(const float* src, size_t stride, size_t size, const float* kernel, size_t kernelSize, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum += kernel[k] * src[i + k * stride];
+                SepFilterStore<type>(sum, dst, i);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SeparableFilterDefault::SeparableFilterDefault(const SepFilterParam& param, const float* rowKernel, const float* colKernel)
+            : Simd::SeparableFilter(param)
+        {
+            _size = _param.width * _param.channels;
+            _stride = AlignHi(_size, SIMD_ALIGN / sizeof(float));
+            _rowAnchor = _param.rowSize / 2;
+            _colAnchor = _param.colSize / 2;
+            _rowKernel.Assign(rowKernel, _param.rowSize);
+            _colKernel.Resize(2 * _param.colSize);
+            for (size_t i = 0; i < _param.colSize; ++i)
+                _colKernel[i] = colKernel[i], _colKernel[_param.colSize + i] = colKernel[i];
+            _buf.Resize(_size + (_param.rowSize - 1) * _param.channels);
+            _rows.Resize(_param.colSize * _stride);
+            switch (_param.srcType)
+            {
+            case SimdPixelFormatGray8: _load = SepFilterLoad<SimdPixelFormatGray8>; break;
+            case SimdPixelFormatInt16: _load = SepFilterLoad<SimdPixelFormatInt16>; break;
+            case SimdPixelFormatFloat: _load = SepFilterLoad<SimdPixelFormatFloat>; break;
+            default: assert(0);
+            }
+            _row = SepFilterRow;
+            switch (_param.dstType)
+            {
+            case SimdPixelFormatGray8: _col = SepFilterCol<SimdPixelFormatGray8>; break;
+            case SimdPixelFormatInt16: _col = SepFilterCol<SimdPixelFormatInt16>; break;
+            case SimdPixelFormatFloat: _col = SepFilterCol<SimdPixelFormatFloat>; break;
+            default: assert(0);
+            }
+        }
+
+        void SeparableFilterDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            size_t kernel = _param.colSize;
+            for (size_t row = 0; row + 1 < kernel; ++row)
+                SetRow(src, srcStride, ptrdiff_t(row - _colAnchor), _rows.data + row * _stride);
+            for (size_t y = 0; y < _param.height; ++y)
+            {
+                size_t row = y + kernel - 1;
+                SetRow(src, srcStride, ptrdiff_t(row - _colAnchor), _rows.data + row % kernel * _stride);
+                _col(_rows.data, _stride, _size, _colKernel.data + kernel - y % kernel, kernel, dst + y * dstStride);
+            }
+        }
+
+        void SeparableFilterDefault::SetRow(const uint8_t* src, size_t srcStride, ptrdiff_t row, float* dst)
+        {
+            size_t channels = _param.channels, width = _param.width;
+            size_t left = _rowAnchor, right = _param.rowSize - 1 - _rowAnchor;
+            float* buf = _buf.data, * body = buf + left * channels;
+            ptrdiff_t y = BorderIndex(row, _param.height, _param.border);
+            if (y < 0)
+            {
+                for (size_t i = 0, n = _buf.size; i < n; ++i)
+                    buf[i] = _param.borderValue;
+            }
+            else
+            {
+                _load(src + y * srcStride, _size, body);
+                for (size_t x = 0; x < left + right; ++x)
+                {
+                    ptrdiff_t xd = x < left ? ptrdiff_t(x) - ptrdiff_t(left) : ptrdiff_t(width + x - left);
+                    ptrdiff_t xs = BorderIndex(xd, width, _param.border);
+                    for (size_t c = 0; c < channels; ++c)
+                        body[xd * ptrdiff_t(channels) + c] = xs < 0 ? _param.borderValue : body[xs * channels + c];
+                }
+            }
+            _row(buf, _size, channels, _rowKernel.data, _param.rowSize, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType srcType, SimdPixelFormatType dstType,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize, SimdBorderType border, const float* borderValue)
+        {
+            SepFilterParam param(width, height, channels, srcType, dstType, rowSize, colSize, border, borderValue);
+            if (!param.Valid() || rowKernel == NULL || colKernel == NULL)
+                return NULL;
+            return new SeparableFilterDefault(param, rowKernel, colKernel);
+        }
+    }
+}
@@ -0,0 +1,340 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetPreprocess.h"
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdBFloat16.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        void SynetPreprocessDeinterleaveUvRow(const uint8_t* uv, size_t width, uint8_t* u, uint8_t* v)
+        {
+            for (size_t x = 0; x < width; ++x, uv += 2)
+            {
+                u[x] = uv[0];
+                v[x] = uv[1];
+            }
+        }
+
+        template<class T> void YuvToBgrRow(const uint8_t* y, const uint8_t* u, const uint8_t* v, size_t width, uint8_t* bgr)
+        {
+            for (size_t x = 0; x < width; ++x, bgr += 3)
+                YuvToBgr<T>(y[x], u[x >> 1], v[x >> 1], bgr);
+        }
+
+        void SynetPreprocessYuvToBgrRow(const uint8_t* y, const uint8_t* u, const uint8_t* v, size_t width, SimdYuvType yuvType, uint8_t* bgr)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: YuvToBgrRow<Bt601>(y, u, v, width, bgr); break;
+            case SimdYuvBt709: YuvToBgrRow<Bt709>(y, u, v, width, bgr); break;
+            case SimdYuvBt2020: YuvToBgrRow<Bt2020>(y, u, v, width, bgr); break;
+            case SimdYuvTrect871: YuvToBgrRow<Trect871>(y, u, v, width, bgr); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetPreprocessResizeRow(const uint8_t* src, size_t srcSize, const int32_t* idx0, const int32_t* idx1, const float* alpha, size_t size, float* buf, float* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float a1 = alpha[i], a0 = 1.0f - a1;
+                dst[i] = float(src[idx0[i]]) * a0 + float(src[idx1[i]]) * a1;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void NormalizeRow32f(const float* src0, const float* src1, float k0, float k1, const float* scale, const float* shift, size_t size, uint8_t* dst8)
+        {
+            float* dst = (float*)dst8;
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = SynetPreprocessNormalize(src0[i], src1[i], k0, k1, scale[i], shift[i]);
+        }
+
+        static void NormalizeRow16b(const float* src0, const float* src1, float k0, float k1, const float* scale, const float* shift, size_t size, uint8_t* dst8)
+        {
+            uint16_t* dst = (uint16_t*)dst8;
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = Float32ToBFloat16(SynetPreprocessNormalize(src0[i], src1[i], k0, k1, scale[i], shift[i]));
+        }
+
+        static void NormalizeRow8u(const float* src0, const float* src1, float k0, float k1, const float* scale, const float* shift, size_t size, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (uint8_t)RestrictRange(Round(SynetPreprocessNormalize(src0[i], src1[i], k0, k1, scale[i], shift[i])), 0, 255);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void EstimateIndexAlpha(size_t srcSize, size_t dstSize, SimdResizeMethodType method, int32_t* index, float* alpha)
+        {
+            float scale = (float)srcSize / dstSize;
+            int32_t last = (int32_t)srcSize - 1;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                if (method == SimdResizeMethodNearest)
+                {
+                    int32_t idx = Simd::Min((int32_t)::floor((i + 0.5f) * scale), last);
+                    index[2 * i + 0] = idx;
+                    index[2 * i + 1] = idx;
+                    alpha[i] = 0.0f;
+                }
+                else
+                {
+                    float a = (i + 0.5f) * scale - 0.5f;
+                    int32_t idx = (int32_t)::floor(a);
+                    a -= idx;
+                    if (idx < 0)
+                    {
+                        idx = 0;
+                        a = 0.0f;
+                    }
+                    if (idx >= last)
+                    {
+                        idx = last;
+                        a = 0.0f;
+                    }
+                    index[2 * i + 0] = idx;
+                    index[2 * i + 1] = Simd::Min(idx + 1, last);
+                    alpha[i] = a;
+                }
+            }
+        }
+
+        SynetPreprocessFused::SynetPreprocessFused(const SynetPreprocessParam& param)
+            : SynetPreprocess(param)
+        {
+            const SynetPreprocessParam& p = _param;
+            size_t C = p.channels;
+            if (p.letterbox)
+            {
+                float k = Simd::Min(float(p.dstW) / float(p.srcW), float(p.dstH) / float(p.srcH));
+                _rW = Simd::Max<size_t>(1, Simd::Min<size_t>(p.dstW, Round(float(p.srcW) * k)));
+                _rH = Simd::Max<size_t>(1, Simd::Min<size_t>(p.dstH, Round(float(p.srcH) * k)));
+            }
+            else
+            {
+                _rW = p.dstW;
+                _rH = p.dstH;
+            }
+            _rX = (p.dstW - _rW) / 2;
+            _rY = (p.dstH - _rH) / 2;
+
+            Array32i ix(2 * _rW);
+            Array32f ax(_rW);
+            EstimateIndexAlpha(p.srcW, _rW, p.method, ix.data, ax.data);
+            _iy.Resize(2 * _rH);
+            _ay.Resize(_rH);
+            EstimateIndexAlpha(p.srcH, _rH, p.method, _iy.data, _ay.data);
+
+            size_t size = _rW * C;
+            _ix.Resize(2 * size);
+            _ax.Resize(size);
+            _scale.Resize(size);
+            _shift.Resize(size);
+            for (size_t x = 0; x < _rW; ++x)
+            {
+                for (size_t c = 0; c < C; ++c)
+                {
+                    size_t i = p.dstFormat == SimdTensorFormatNhwc ? x * C + c : c * _rW + x;
+                    _ix[i] = ix[2 * x + 0] * (int32_t)C + (int32_t)c;
+                    _ix[size + i] = ix[2 * x + 1] * (int32_t)C + (int32_t)c;
+                    _ax[i] = ax[x];
+                    _scale[i] = p.scale[c];
+                    _shift[i] = -p.mean[c] * p.scale[c];
+                }
+            }
+            _rows[0].Resize(_rW * C);
+            _rows[1].Resize(_rW * C);
+
+            _cvt.Resize(p.srcW * C);
+            if (p.IsYuv())
+                _bgr.Resize(p.srcW * 3);
+            if (p.srcFormat == SimdSynetPreprocessNv12)
+                _uv.Resize(DivHi(p.srcW, 2) * 2);
+            _deinterleaveUvRow = SynetPreprocessDeinterleaveUvRow;
+            _yuvToBgrRow = SynetPreprocessYuvToBgrRow;
+            _resizeRow = SynetPreprocessResizeRow;
+
+            switch (p.dstType)
+            {
+            case SimdTensorData32f: _elem = 4, _normalizeRow = NormalizeRow32f; break;
+            case SimdTensorData16b: _elem = 2, _normalizeRow = NormalizeRow16b; break;
+            case SimdTensorData8u: _elem = 1, _normalizeRow = NormalizeRow8u; break;
+            default:
+                assert(0);
+            }
+
+            float value[3], shift[3];
+            for (size_t c = 0; c < C; ++c)
+            {
+                value[c] = p.padding;
+                shift[c] = -p.mean[c] * p.scale[c];
+            }
+            _pad.Resize(C * _elem);
+            _normalizeRow(value, value, 1.0f, 0.0f, p.scale, shift, C, _pad.data);
+        }
+
+        size_t SynetPreprocessFused::InternalBufferSize() const
+        {
+            return _ix.RawSize() + _iy.RawSize() + _ax.RawSize() + _ay.RawSize() + _scale.RawSize() + _shift.RawSize() +
+                _rows[0].RawSize() + _rows[1].RawSize() + _buf.RawSize() + _bgr.RawSize() + _cvt.RawSize() + _uv.RawSize() + _pad.RawSize();
+        }
+
+        void SynetPreprocessFused::Run(const uint8_t* const* src, const size_t* srcStride, uint8_t* dst)
+        {
+            const SynetPreprocessParam& p = _param;
+            size_t C = p.channels;
+            _rowIdx[0] = -1;
+            _rowIdx[1] = -1;
+            if (_rW < p.dstW || _rH < p.dstH)
+            {
+                SetPadding(dst, 0, 0, p.dstW, _rY);
+                SetPadding(dst, 0, _rY, _rX, _rH);
+                SetPadding(dst, _rX + _rW, _rY, p.dstW - _rX - _rW, _rH);
+                SetPadding(dst, 0, _rY + _rH, p.dstW, p.dstH - _rY - _rH);
+            }
+            for (size_t y = 0; y < _rH; ++y)
+            {
+                int32_t y0 = _iy[2 * y + 0], y1 = _iy[2 * y + 1];
+                const float* row0 = ResizedRow(src, srcStride, y0, y1);
+                const float* row1 = ResizedRow(src, srcStride, y1, y0);
+                float k1 = _ay[y], k0 = 1.0f - k1;
+                size_t dy = _rY + y;
+                if (p.dstFormat == SimdTensorFormatNhwc)
+                    _normalizeRow(row0, row1, k0, k1, _scale.data, _shift.data, _rW * C, dst + (dy * p.dstW + _rX) * C * _elem);
+                else
+                {
+                    for (size_t c = 0, o = 0; c < C; ++c, o += _rW)
+                        _normalizeRow(row0 + o, row1 + o, k0, k1, _scale.data + o, _shift.data + o, _rW, dst + ((c * p.dstH + dy) * p.dstW + _rX) * _elem);
+                }
+            }
+        }
+
+        const uint8_t* SynetPreprocessFused::ConvertRow(const uint8_t* const* src, const size_t* srcStride, size_t row)
+        {
+            const SynetPreprocessParam& p = _param;
+            const uint8_t* bgr = NULL;
+            size_t step = 3;
+            bool isRgb = false;
+            switch (p.srcFormat)
+            {
+            case SimdSynetPreprocessGray8:
+            {
+                const uint8_t* gray = src[0] + row * srcStride[0];
+                if (p.channels == 1)
+                    return gray;
+                for (size_t x = 0, o = 0; x < p.srcW; x += 1, o += 3)
+                    _cvt[o + 0] = _cvt[o + 1] = _cvt[o + 2] = gray[x];
+                return _cvt.data;
+            }
+            case SimdSynetPreprocessBgr24: bgr = src[0] + row * srcStride[0], step = 3, isRgb = false; break;
+            case SimdSynetPreprocessBgra32: bgr = src[0] + row * srcStride[0], step = 4, isRgb = false; break;
+            case SimdSynetPreprocessRgb24: bgr = src[0] + row * srcStride[0], step = 3, isRgb = true; break;
+            case SimdSynetPreprocessRgba32: bgr = src[0] + row * srcStride[0], step = 4, isRgb = true; break;
+            case SimdSynetPreprocessNv12:
+            {
+                size_t uvW = _uv.size / 2;
+                _deinterleaveUvRow(src[1] + (row >> 1) * srcStride[1], uvW, _uv.data, _uv.data + uvW);
+                _yuvToBgrRow(src[0] + row * srcStride[0], _uv.data, _uv.data + uvW, p.srcW, p.yuvType, _bgr.data);
+                bgr = _bgr.data;
+                break;
+            }
+            case SimdSynetPreprocessYuv420p:
+                _yuvToBgrRow(src[0] + row * srcStride[0], src[1] + (row >> 1) * srcStride[1], src[2] + (row >> 1) * srcStride[2], p.srcW, p.yuvType, _bgr.data);
+                bgr = _bgr.data;
+                break;
+            default:
+                assert(0);
+            }
+            size_t b = isRgb ? 2 : 0, r = isRgb ? 0 : 2;
+            if (p.channels == 1)
+            {
+                for (size_t x = 0; x < p.srcW; x += 1, bgr += step)
+                    _cvt[x] = BgrToGray(bgr[b], bgr[1], bgr[r]);
+                return _cvt.data;
+            }
+            if (step == 3 && isRgb == (p.isRgb != SimdFalse))
+                return bgr;
+            if (p.isRgb)
+                Swap(b, r);
+            for (size_t o = 0, end = p.srcW * 3; o < end; o += 3, bgr += step)
+            {
+                _cvt[o + 0] = bgr[b];
+                _cvt[o + 1] = bgr[1];
+                _cvt[o + 2] = bgr[r];
+            }
+            return _cvt.data;
+        }
+
+        const float* SynetPreprocessFused::ResizedRow(const uint8_t* const* src, const size_t* srcStride, int32_t row, int32_t keep)
+        {
+            for (size_t i = 0; i < 2; ++i)
+                if (_rowIdx[i] == row)
+                    return _rows[i].data;
+            size_t i = _rowIdx[0] == keep ? 1 : 0;
+            const uint8_t* s = ConvertRow(src, srcStride, row);
+            size_t size = _ax.size;
+            _resizeRow(s, _param.srcW * _param.channels, _ix.data, _ix.data + size, _ax.data, size, _buf.data, _rows[i].data);
+            _rowIdx[i] = row;
+            return _rows[i].data;
+        }
+
+        void SynetPreprocessFused::SetPadding(uint8_t* dst, size_t x, size_t y, size_t w, size_t h)
+        {
+            const SynetPreprocessParam& p = _param;
+            size_t C = p.channels;
+            for (size_t row = y; row < y + h; ++row)
+            {
+                for (size_t col = x; col < x + w; ++col)
+                {
+                    for (size_t c = 0; c < C; ++c)
+                    {
+                        size_t offset = p.dstFormat == SimdTensorFormatNhwc ? (row * p.dstW + col) * C + c : (c * p.dstH + row) * p.dstW + col;
+                        memcpy(dst + offset * _elem, _pad.data + c * _elem, _elem);
+                    }
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, SimdYuvType yuvType, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, uint8_t padding, const float* mean, const float* scale)
+        {
+            SynetPreprocessParam param(srcW, srcH, srcFormat, yuvType, dstW, dstH, channels, method, dstType, dstFormat, isRgb, letterbox, padding, mean, scale);
+            if (!param.Valid())
+                return NULL;
+            return new SynetPreprocessFused(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,312 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdTemplateMatch.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void TmSad(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                uint32_t sum = 0;
+                for (size_t t = 0; t < size; ++t)
+                    sum += AbsDifference(src[x + t], tmp[t]);
+                sums[x] += sum;
+            }
+        }
+
+        void TmSsd(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                uint32_t sum = 0;
+                for (size_t t = 0; t < size; ++t)
+                    sum += Square(src[x + t] - tmp[t]);
+                sums[x] += sum;
+            }
+        }
+
+        void TmCorr(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                uint32_t sum = 0;
+                for (size_t t = 0; t < size; ++t)
+                    sum += src[x + t] * tmp[t];
+                sums[x] += sum;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static size_t TmLevels(const TemplateMatchParam& param)
+        {
+            size_t levels = 1, width = param.tmpWidth, height = param.tmpHeight;
+            for (; levels < param.levels; ++levels)
+            {
+                width = (width + 1) / 2, height = (height + 1) / 2;
+                if (width < TM_MIN_SIZE || height < TM_MIN_SIZE)
+                    break;
+            }
+            return levels;
+        }
+
+        TemplateMatchDefault::TemplateMatchDefault(const TemplateMatchParam& param, PyramidBuilderInitPtr pyramidInit)
+            : Simd::TemplateMatch(param)
+            , _threads(Base::GetThreadNumber())
+            , _levels(TmLevels(param))
+            , _pyramid(_levels)
+            , _srcBuilder(NULL)
+            , _tmpBuilder(NULL)
+            , _sums(_threads)
+            , _integral(Base::Integral)
+        {
+            SetRow(param.type, TmSad, TmSsd, TmCorr);
+            if (_levels > 1)
+            {
+                _srcBuilder = (PyramidBuilder*)pyramidInit(param.srcWidth, param.srcHeight, _levels, 2.0, SimdReduce2x2, SimdFalse);
+                _tmpBuilder = (PyramidBuilder*)pyramidInit(param.tmpWidth, param.tmpHeight, _levels, 2.0, SimdReduce2x2, SimdFalse);
+            }
+            for (size_t l = 0; l < _levels; ++l)
+            {
+                Level& level = _pyramid[l];
+                if (l)
+                {
+                    _srcBuilder->LevelSize(l, &level.srcWidth, &level.srcHeight);
+                    _tmpBuilder->LevelSize(l, &level.tmpWidth, &level.tmpHeight);
+                    level.srcStride = level.srcWidth;
+                    level.tmpStride = level.tmpWidth;
+                    level.srcBuf.Resize(level.srcWidth * level.srcHeight);
+                    level.tmpBuf.Resize(level.tmpWidth * level.tmpHeight);
+                }
+                else
+                {
+                    level.srcWidth = param.srcWidth, level.srcHeight = param.srcHeight;
+                    level.tmpWidth = param.tmpWidth, level.tmpHeight = param.tmpHeight;
+                }
+                if (param.type == SimdTemplateMatchNcc)
+                {
+                    level.sum.Resize((level.srcWidth + 1) * (level.srcHeight + 1));
+                    level.sqsum.Resize((level.srcWidth + 1) * (level.srcHeight + 1));
+                }
+            }
+            for (size_t thread = 0; thread < _threads; ++thread)
+                _sums[thread].resize(param.DstWidth());
+            const Level& top = _pyramid[_levels - 1];
+            _map.Resize((top.srcWidth - top.tmpWidth + 1) * (top.srcHeight - top.tmpHeight + 1));
+        }
+
+        TemplateMatchDefault::~TemplateMatchDefault()
+        {
+            if (_srcBuilder)
+                delete _srcBuilder;
+            if (_tmpBuilder)
+                delete _tmpBuilder;
+        }
+
+        void TemplateMatchDefault::SetRow(SimdTemplateMatchType type, TmRowPtr sad, TmRowPtr ssd, TmRowPtr corr)
+        {
+            switch (type)
+            {
+            case SimdTemplateMatchSad: _row = sad; break;
+            case SimdTemplateMatchSsd: _row = ssd; break;
+            case SimdTemplateMatchNcc: _row = corr; break;
+            default:
+                assert(0);
+            }
+        }
+
+        void TemplateMatchDefault::Run(const uint8_t* src, size_t srcStride, const uint8_t* tmp, size_t tmpStride, float* dst, size_t dstStride)
+        {
+            Level& level = _pyramid[0];
+            Prepare(level, src, srcStride, tmp, tmpStride);
+            Map(level, dst, dstStride);
+        }
+
+        float TemplateMatchDefault::Search(const uint8_t* src, size_t srcStride, const uint8_t* tmp, size_t tmpStride, size_t* x, size_t* y)
+        {
+            if (_levels > 1)
+            {
+                std::vector<uint8_t*> srcDst(_levels - 1), tmpDst(_levels - 1);
+                std::vector<size_t> srcStrides(_levels - 1), tmpStrides(_levels - 1);
+                for (size_t l = 1; l < _levels; ++l)
+                {
+                    srcDst[l - 1] = _pyramid[l].srcBuf.data, srcStrides[l - 1] = _pyramid[l].srcStride;
+                    tmpDst[l - 1] = _pyramid[l].tmpBuf.data, tmpStrides[l - 1] = _pyramid[l].tmpStride;
+                }
+                _srcBuilder->Run(src, srcStride, srcDst.data(), srcStrides.data());
+                _tmpBuilder->Run(tmp, tmpStride, tmpDst.data(), tmpStrides.data());
+            }
+            for (size_t l = 0; l < _levels; ++l)
+            {
+                Level& level = _pyramid[l];
+                if (l)
+                    Prepare(level, level.srcBuf.data, level.srcStride, level.tmpBuf.data, level.tmpStride);
+                else
+                    Prepare(level, src, srcStride, tmp, tmpStride);
+            }
+
+            const Level& top = _pyramid[_levels - 1];
+            ptrdiff_t width = top.srcWidth - top.tmpWidth + 1, height = top.srcHeight - top.tmpHeight + 1;
+            Map(top, _map.data, width);
+
+            std::vector<std::pair<float, ptrdiff_t>> candidates;
+            for (ptrdiff_t r = 0; r < height; ++r)
+            {
+                for (ptrdiff_t c = 0; c < width; ++c)
+                {
+                    float value = _map[r * width + c];
+                    bool extremum = true;
+                    for (ptrdiff_t dr = -1; dr <= 1 && extremum; ++dr)
+                    {
+                        for (ptrdiff_t dc = -1; dc <= 1 && extremum; ++dc)
+                        {
+                            ptrdiff_t nr = r + dr, nc = c + dc;
+                            if (nr >= 0 && nr < height && nc >= 0 && nc < width && Better(_map[nr * width + nc], value))
+                                extremum = false;
+                        }
+                    }
+                    if (extremum)
+                        candidates.push_back(std::make_pair(value, r * width + c));
+                }
+            }
+            std::stable_sort(candidates.begin(), candidates.end(), [this](const std::pair<float, ptrdiff_t>& a, const std::pair<float, ptrdiff_t>& b) { return Better(a.first, b.first); });
+            candidates.resize(Min(candidates.size(), _levels > 1 ? TM_CANDIDATES : 1));
+
+            const ptrdiff_t R = TM_RADIUS, S = 2 * R + 1;
+            float best = 0, block[S * S];
+            for (size_t i = 0; i < candidates.size(); ++i)
+            {
+                ptrdiff_t px = candidates[i].second % width, py = candidates[i].second / width;
+                float value = candidates[i].first;
+                for (ptrdiff_t l = _levels - 2; l >= 0; --l)
+                {
+                    const Level& level = _pyramid[l];
+                    ptrdiff_t w = level.srcWidth - level.tmpWidth + 1, h = level.srcHeight - level.tmpHeight + 1;
+                    ptrdiff_t bx = std::max<ptrdiff_t>(std::min<ptrdiff_t>(2 * px - R, w - 1), 0);
+                    ptrdiff_t by = std::max<ptrdiff_t>(std::min<ptrdiff_t>(2 * py - R, h - 1), 0);
+                    ptrdiff_t bw = std::max<ptrdiff_t>(std::min<ptrdiff_t>(2 * px + R + 1, w) - bx, 1);
+                    ptrdiff_t bh = std::max<ptrdiff_t>(std::min<ptrdiff_t>(2 * py + R + 1, h) - by, 1);
+                    Score(0, level, bx, by, bw, bh, block, bw);
+                    value = block[0], px = bx, py = by;
+                    for (ptrdiff_t r = 0; r < bh; ++r)
+                    {
+                        for (ptrdiff_t c = 0; c < bw; ++c)
+                        {
+                            if (Better(block[r * bw + c], value))
+                                value = block[r * bw + c], px = bx + c, py = by + r;
+                        }
+                    }
+                }
+                if (i == 0 || Better(value, best))
+                {
+                    best = value;
+                    *x = px;
+                    *y = py;
+                }
+            }
+            return best;
+        }
+
+        void TemplateMatchDefault::Prepare(Level& level, const uint8_t* src, size_t srcStride, const uint8_t* tmp, size_t tmpStride)
+        {
+            level.src = src, level.srcStride = srcStride;
+            level.tmp = tmp, level.tmpStride = tmpStride;
+            if (_param.type == SimdTemplateMatchNcc)
+            {
+                level.tmpSum = 0, level.tmpSqsum = 0;
+                for (size_t row = 0; row < level.tmpHeight; ++row)
+                {
+                    const uint8_t* t = tmp + row * tmpStride;
+                    for (size_t col = 0; col < level.tmpWidth; ++col)
+                    {
+                        level.tmpSum += t[col];
+                        level.tmpSqsum += Square(t[col]);
+                    }
+                }
+                _integral(src, srcStride, level.srcWidth, level.srcHeight, (uint8_t*)level.sum.data, (level.srcWidth + 1) * sizeof(uint32_t),
+                    (uint8_t*)level.sqsum.data, (level.srcWidth + 1) * sizeof(double), NULL, 0, SimdPixelFormatInt32, SimdPixelFormatDouble);
+            }
+        }
+
+        void TemplateMatchDefault::Score(size_t thread, const Level& level, size_t x, size_t y, size_t width, size_t height, float* dst, size_t dstStride)
+        {
+            uint64_t* sums = _sums[thread].data();
+            const int64_t n = level.tmpWidth * level.tmpHeight, ts = level.tmpSum;
+            const int64_t tv = n * (int64_t)level.tmpSqsum - ts * ts;
+            const size_t iStride = level.srcWidth + 1, tw = level.tmpWidth;
+            for (size_t row = 0; row < height; ++row)
+            {
+                memset(sums, 0, width * sizeof(uint64_t));
+                const uint8_t* src = level.src + (y + row) * level.srcStride + x;
+                for (size_t t = 0; t < level.tmpHeight; ++t)
+                    _row(src + t * level.srcStride, level.tmp + t * level.tmpStride, tw, width, sums);
+                if (_param.type == SimdTemplateMatchNcc)
+                {
+                    const uint32_t* s0 = level.sum.data + (y + row) * iStride + x, * s1 = s0 + level.tmpHeight * iStride;
+                    const double* q0 = level.sqsum.data + (y + row) * iStride + x, * q1 = q0 + level.tmpHeight * iStride;
+                    for (size_t col = 0; col < width; ++col)
+                    {
+                        int64_t si = uint32_t(s1[col + tw] - s1[col] - s0[col + tw] + s0[col]);
+                        int64_t sq = int64_t(q1[col + tw] - q1[col] - q0[col + tw] + q0[col]);
+                        int64_t sv = n * sq - si * si;
+                        int64_t cv = n * (int64_t)sums[col] - si * ts;
+                        dst[col] = sv > 0 && tv > 0 ? float(Simd::RestrictRange(double(cv) / ::sqrt(double(sv) * double(tv)), -1.0, 1.0)) : 0.0f;
+                    }
+                }
+                else
+                {
+                    for (size_t col = 0; col < width; ++col)
+                        dst[col] = float(sums[col]);
+                }
+                dst += dstStride;
+            }
+        }
+
+        void TemplateMatchDefault::Map(const Level& level, float* dst, size_t dstStride)
+        {
+            size_t width = level.srcWidth - level.tmpWidth + 1, height = level.srcHeight - level.tmpHeight + 1;
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Score(thread, level, 0, begin, width, end - begin, dst + begin * dstStride, dstStride);
+            }, _threads, 1);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* TemplateMatchInit(size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels)
+        {
+            TemplateMatchParam param(srcWidth, srcHeight, tmpWidth, tmpHeight, type, levels);
+            if (!param.Valid())
+                return NULL;
+            return new TemplateMatchDefault(param, PyramidBuilderInit);
+        }
+    }
+}
@@ -0,0 +1,257 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template <bool p010> SIMD_INLINE int Yuv10(uint16_t value)
+        {
+            return p010 ? value >> 6 : value & 0x3FF;
+        }
+
+        template<class T, int shift> SIMD_INLINE int Yuv10ToBlue(int y, int u)
+        {
+            return (T::Y_2_A * (y - 4 * T::Y_LO) + T::U_2_B * (u - 4 * T::UV_Z) + (1 << (shift - 1))) >> shift;
+        }
+
+        template<class T, int shift> SIMD_INLINE int Yuv10ToGreen(int y, int u, int v)
+        {
+            return (T::Y_2_A * (y - 4 * T::Y_LO) + T::U_2_G * (u - 4 * T::UV_Z) + T::V_2_G * (v - 4 * T::UV_Z) + (1 << (shift - 1))) >> shift;
+        }
+
+        template<class T, int shift> SIMD_INLINE int Yuv10ToRed(int y, int v)
+        {
+            return (T::Y_2_A * (y - 4 * T::Y_LO) + T::V_2_R * (v - 4 * T::UV_Z) + (1 << (shift - 1))) >> shift;
+        }
+
+        SIMD_INLINE uint16_t Expand16(int value)
+        {
+            value = RestrictRange(value, 0, 0xFF00);
+            value += value >> 8;
+#ifdef SIMD_BIG_ENDIAN
+            return uint16_t(value);
+#else
+            return uint16_t((value >> 8) | (value << 8));
+#endif
+        }
+
+        template<class T> SIMD_INLINE void Yuv10ToBgr(int y, int u, int v, uint8_t* bgr)
+        {
+            const int S = T::F_SHIFT + 2;
+            bgr[0] = RestrictRange(Yuv10ToBlue<T, S>(y, u));
+            bgr[1] = RestrictRange(Yuv10ToGreen<T, S>(y, u, v));
+            bgr[2] = RestrictRange(Yuv10ToRed<T, S>(y, v));
+        }
+
+        template<class T> SIMD_INLINE void Yuv10ToBgra(int y, int u, int v, int alpha, uint8_t* bgra)
+        {
+            const int S = T::F_SHIFT + 2;
+            bgra[0] = RestrictRange(Yuv10ToBlue<T, S>(y, u));
+            bgra[1] = RestrictRange(Yuv10ToGreen<T, S>(y, u, v));
+            bgra[2] = RestrictRange(Yuv10ToRed<T, S>(y, v));
+            bgra[3] = alpha;
+        }
+
+        template<class T> SIMD_INLINE void Yuv10ToBgr48p(int y, int u, int v, uint16_t* blue, uint16_t* green, uint16_t* red)
+        {
+            const int S = T::F_SHIFT - 6;
+            blue[0] = Expand16(Yuv10ToBlue<T, S>(y, u));
+            green[0] = Expand16(Yuv10ToGreen<T, S>(y, u, v));
+            red[0] = Expand16(Yuv10ToRed<T, S>(y, v));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool p010> void Yuv10ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            const size_t uvStep = p010 ? 2 : 1;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                const uint16_t* y0 = (uint16_t*)y, * y1 = (uint16_t*)(y + yStride);
+                const uint16_t* pu = (uint16_t*)u, * pv = (uint16_t*)v;
+                uint8_t* bgr0 = bgr, * bgr1 = bgr + bgrStride;
+                for (size_t colY = 0, colUV = 0; colY < width; colY += 2, colUV += uvStep)
+                {
+                    int _u = Yuv10<p010>(pu[colUV]);
+                    int _v = Yuv10<p010>(pv[colUV]);
+                    Yuv10ToBgr<T>(Yuv10<p010>(y0[colY + 0]), _u, _v, bgr0 + 3 * colY + 0);
+                    Yuv10ToBgr<T>(Yuv10<p010>(y0[colY + 1]), _u, _v, bgr0 + 3 * colY + 3);
+                    Yuv10ToBgr<T>(Yuv10<p010>(y1[colY + 0]), _u, _v, bgr1 + 3 * colY + 0);
+                    Yuv10ToBgr<T>(Yuv10<p010>(y1[colY + 1]), _u, _v, bgr1 + 3 * colY + 3);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <bool p010> void Yuv10ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv10ToBgrV2<Bt601, p010>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv10ToBgrV2<Bt709, p010>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv10ToBgrV2<Bt2020, p010>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Yuv10ToBgrV2<Trect871, p010>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuv420p10ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv10ToBgrV2<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+        }
+
+        void P010ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv10ToBgrV2<true>(y, yStride, uv, uvStride, uv + 2, uvStride, width, height, bgr, bgrStride, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool p010> void Yuv10ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            const size_t uvStep = p010 ? 2 : 1;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                const uint16_t* y0 = (uint16_t*)y, * y1 = (uint16_t*)(y + yStride);
+                const uint16_t* pu = (uint16_t*)u, * pv = (uint16_t*)v;
+                uint8_t* bgra0 = bgra, * bgra1 = bgra + bgraStride;
+                for (size_t colY = 0, colUV = 0; colY < width; colY += 2, colUV += uvStep)
+                {
+                    int _u = Yuv10<p010>(pu[colUV]);
+                    int _v = Yuv10<p010>(pv[colUV]);
+                    Yuv10ToBgra<T>(Yuv10<p010>(y0[colY + 0]), _u, _v, alpha, bgra0 + 4 * colY + 0);
+                    Yuv10ToBgra<T>(Yuv10<p010>(y0[colY + 1]), _u, _v, alpha, bgra0 + 4 * colY + 4);
+                    Yuv10ToBgra<T>(Yuv10<p010>(y1[colY + 0]), _u, _v, alpha, bgra1 + 4 * colY + 0);
+                    Yuv10ToBgra<T>(Yuv10<p010>(y1[colY + 1]), _u, _v, alpha, bgra1 + 4 * colY + 4);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        template <bool p010> void Yuv10ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv10ToBgraV2<Bt601, p010>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv10ToBgraV2<Bt709, p010>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv10ToBgraV2<Bt2020, p010>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvTrect871: Yuv10ToBgraV2<Trect871, p010>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuv420p10ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv10ToBgraV2<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void P010ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv10ToBgraV2<true>(y, yStride, uv, uvStride, uv + 2, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool p010> void Yuv10ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* blue, size_t blueStride,
+            uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            const size_t uvStep = p010 ? 2 : 1;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                const uint16_t* y0 = (uint16_t*)y, * y1 = (uint16_t*)(y + yStride);
+                const uint16_t* pu = (uint16_t*)u, * pv = (uint16_t*)v;
+                uint16_t* b0 = (uint16_t*)blue, * b1 = (uint16_t*)(blue + blueStride);
+                uint16_t* g0 = (uint16_t*)green, * g1 = (uint16_t*)(green + greenStride);
+                uint16_t* r0 = (uint16_t*)red, * r1 = (uint16_t*)(red + redStride);
+                for (size_t colY = 0, colUV = 0; colY < width; colY += 2, colUV += uvStep)
+                {
+                    int _u = Yuv10<p010>(pu[colUV]);
+                    int _v = Yuv10<p010>(pv[colUV]);
+                    Yuv10ToBgr48p<T>(Yuv10<p010>(y0[colY + 0]), _u, _v, b0 + colY + 0, g0 + colY + 0, r0 + colY + 0);
+                    Yuv10ToBgr48p<T>(Yuv10<p010>(y0[colY + 1]), _u, _v, b0 + colY + 1, g0 + colY + 1, r0 + colY + 1);
+                    Yuv10ToBgr48p<T>(Yuv10<p010>(y1[colY + 0]), _u, _v, b1 + colY + 0, g1 + colY + 0, r1 + colY + 0);
+                    Yuv10ToBgr48p<T>(Yuv10<p010>(y1[colY + 1]), _u, _v, b1 + colY + 1, g1 + colY + 1, r1 + colY + 1);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                blue += 2 * blueStride;
+                green += 2 * greenStride;
+                red += 2 * redStride;
+            }
+        }
+
+        template <bool p010> void Yuv10ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* blue, size_t blueStride,
+            uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv10ToBgr48pV2<Bt601, p010>(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride); break;
+            case SimdYuvBt709: Yuv10ToBgr48pV2<Bt709, p010>(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride); break;
+            case SimdYuvBt2020: Yuv10ToBgr48pV2<Bt2020, p010>(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride); break;
+            case SimdYuvTrect871: Yuv10ToBgr48pV2<Trect871, p010>(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuv420p10ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* blue, size_t blueStride, uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride, SimdYuvType yuvType)
+        {
+            Yuv10ToBgr48pV2<false>(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride, yuvType);
+        }
+
+        void P010ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* blue, size_t blueStride, uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride, SimdYuvType yuvType)
+        {
+            Yuv10ToBgr48pV2<true>(y, yStride, uv, uvStride, uv + 2, uvStride, width, height, blue, blueStride, green, greenStride, red, redStride, yuvType);
+        }
+    }
+}
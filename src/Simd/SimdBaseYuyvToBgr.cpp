@@ -0,0 +1,100 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template <class YuvType> SIMD_INLINE void Yuyv422ToBgr(const uint8_t* yuyv, uint8_t* bgr)
+        {
+            uint8_t u = yuyv[1], v = yuyv[3];
+            YuvToBgr<YuvType>(yuyv[0], u, v, bgr + 0);
+            YuvToBgr<YuvType>(yuyv[2], u, v, bgr + 3);
+        }
+
+        template <class YuvType> void Yuyv422ToBgr(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (width >= 2));
+
+            size_t sizeYuyv = width * 2;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t colYuyv = 0, colBgr = 0; colYuyv < sizeYuyv; colYuyv += 4, colBgr += 6)
+                    Yuyv422ToBgr<YuvType>(yuyv + colYuyv, bgr + colBgr);
+                yuyv += yuyvStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void Yuyv422ToBgr(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuyv422ToBgr<Base::Bt601>(yuyv, yuyvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuyv422ToBgr<Base::Bt709>(yuyv, yuyvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuyv422ToBgr<Base::Bt2020>(yuyv, yuyvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Yuyv422ToBgr<Base::Trect871>(yuyv, yuyvStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class YuvType> SIMD_INLINE void Yuyv422ToBgra(const uint8_t* yuyv, uint8_t* bgra, int alpha)
+        {
+            uint8_t u = yuyv[1], v = yuyv[3];
+            YuvToBgra<YuvType>(yuyv[0], u, v, alpha, bgra + 0);
+            YuvToBgra<YuvType>(yuyv[2], u, v, alpha, bgra + 4);
+        }
+
+        template <class YuvType> void Yuyv422ToBgra(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (width >= 2));
+
+            size_t sizeYuyv = width * 2;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t colYuyv = 0, colBgra = 0; colYuyv < sizeYuyv; colYuyv += 4, colBgra += 8)
+                    Yuyv422ToBgra<YuvType>(yuyv + colYuyv, bgra + colBgra, alpha);
+                yuyv += yuyvStride;
+                bgra += bgraStride;
+            }
+        }
+
+        void Yuyv422ToBgra(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuyv422ToBgra<Base::Bt601>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuyv422ToBgra<Base::Bt709>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuyv422ToBgra<Base::Bt2020>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvTrect871: Yuyv422ToBgra<Base::Trect871>(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDefs.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void Yuyv422ToGray(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* gray, size_t grayStride)
+        {
+            assert(width % 2 == 0);
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < width; ++col)
+                    gray[col] = yuyv[col * 2];
+                yuyv += yuyvStride;
+                gray += grayStride;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void Yuyv422ToYuv420p(const uint8_t* yuyv0, size_t yuyvStride, uint8_t* y0, size_t yStride, uint8_t* u, uint8_t* v)
+        {
+            const uint8_t* yuyv1 = yuyv0 + yuyvStride;
+            uint8_t* y1 = y0 + yStride;
+            y0[0] = yuyv0[0];
+            y0[1] = yuyv0[2];
+            y1[0] = yuyv1[0];
+            y1[1] = yuyv1[2];
+            u[0] = (yuyv0[1] + yuyv1[1] + 1) / 2;
+            v[0] = (yuyv0[3] + yuyv1[3] + 1) / 2;
+        }
+
+        void Yuyv422ToYuv420p(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* u, size_t uStride, uint8_t* v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colYuyv = 0, colY = 0, colUV = 0; colY < width; colYuyv += 4, colY += 2, colUV += 1)
+                    Yuyv422ToYuv420p(yuyv + colYuyv, yuyvStride, y + colY, yStride, u + colUV, v + colUV);
+                yuyv += 2 * yuyvStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+    }
+}
@@ -28,6 +28,7 @@
 #include "Simd/SimdConst.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdLoadBlock.h"
+#include "Simd/SimdArray.h"
 
 namespace Simd
 {
@@ -133,6 +134,89 @@ namespace Simd
             dst11[1] = BayerToGreen(src[3][col2], src[2][col3], src[3][col4], src[4][col3], src[3][col1], src[1][col3], src[3][col5], src[5][col3]);
             dst11[2] = src[3][col3];
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void BayerMhcRowType(SimdPixelFormatType bayerFormat, size_t row, bool& redRow, bool& greenOdd)
+        {
+            bool even = (row & 1) == 0;
+            switch (bayerFormat)
+            {
+            case SimdPixelFormatBayerGrbg: redRow = even; greenOdd = !even; break;
+            case SimdPixelFormatBayerGbrg: redRow = !even; greenOdd = !even; break;
+            case SimdPixelFormatBayerRggb: redRow = even; greenOdd = even; break;
+            case SimdPixelFormatBayerBggr: redRow = !even; greenOdd = even; break;
+            default: assert(0);
+            }
+        }
+
+        class BayerMhcRows
+        {
+        public:
+            BayerMhcRows(const uint8_t* bayer, size_t bayerStride, size_t width, size_t height)
+                : _bayer(bayer)
+                , _bayerStride(bayerStride)
+                , _width(width)
+                , _height(height)
+                , _stride(AlignHi(width + 4, SIMD_ALIGN))
+                , _loaded(0)
+            {
+                assert(width >= 4 && height >= 4 && width % 2 == 0 && height % 2 == 0);
+                _buffer.Resize(_stride * 5);
+            }
+
+            void Get(size_t row, const uint8_t* rows[5])
+            {
+                for (size_t last = Min(row + 2, _height - 1); _loaded <= last; ++_loaded)
+                    Load(_loaded);
+                for (ptrdiff_t i = 0; i < 5; ++i)
+                    rows[i] = _buffer.data + Reflect((ptrdiff_t)row + i - 2) % 5 * _stride;
+            }
+
+        private:
+            const uint8_t* _bayer;
+            size_t _bayerStride, _width, _height, _stride, _loaded;
+            Array8u _buffer;
+
+            SIMD_INLINE size_t Reflect(ptrdiff_t row) const
+            {
+                ptrdiff_t height = (ptrdiff_t)_height;
+                return row < 0 ? -row : (row >= height ? 2 * height - 2 - row : row);
+            }
+
+            void Load(size_t row)
+            {
+                const uint8_t* src = _bayer + row * _bayerStride;
+                uint8_t* dst = _buffer.data + row % 5 * _stride + 2;
+                dst[-2] = src[2];
+                dst[-1] = src[1];
+                memcpy(dst, src, _width);
+                dst[_width + 0] = src[_width - 2];
+                dst[_width + 1] = src[_width - 3];
+            }
+        };
+
+        SIMD_INLINE void BayerMhc(const uint8_t* const* rows, size_t x, bool green, int& own, int& g, int& other)
+        {
+            const uint8_t* r0 = rows[0] + x, * r1 = rows[1] + x, * r2 = rows[2] + x, * r3 = rows[3] + x, * r4 = rows[4] + x;
+            int c = r2[2], h1 = r2[1] + r2[3], h2 = r2[0] + r2[4], v1 = r1[2] + r3[2], v2 = r0[2] + r4[2];
+            int d = r1[1] + r1[3] + r3[1] + r3[3];
+            if (green)
+            {
+                own = 10 * c + 8 * h1 - 2 * (h2 + d) + v2;
+                g = 16 * c;
+                other = 10 * c + 8 * v1 - 2 * (v2 + d) + h2;
+            }
+            else
+            {
+                own = 16 * c;
+                g = 8 * c + 4 * (h1 + v1) - 2 * (h2 + v2);
+                other = 12 * c + 4 * d - 3 * (h2 + v2);
+            }
+            own = RestrictRange((own + 8) >> 4);
+            g = RestrictRange((g + 8) >> 4);
+            other = RestrictRange((other + 8) >> 4);
+        }
     }
 
 #ifdef SIMD_SSE41_ENABLE
@@ -0,0 +1,175 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBoxFilter_h__
+#define __SimdBoxFilter_h__
+
+#include "Simd/SimdSeparableFilter.h"
+
+namespace Simd
+{
+    struct BoxFilterParam
+    {
+        size_t width, height, channels;
+        SimdPixelFormatType type;
+        size_t radiusX, radiusY;
+        SimdBorderType border;
+        float borderValue;
+
+        BoxFilterParam(size_t w, size_t h, size_t c, SimdPixelFormatType t, size_t rx, size_t ry, SimdBorderType b, const float* bv)
+            : width(w)
+            , height(h)
+            , channels(c)
+            , type(t)
+            , radiusX(rx)
+            , radiusY(ry)
+            , border(b)
+            , borderValue(bv ? *bv : 0.0f)
+        {
+        }
+
+        bool Valid() const
+        {
+            if (width == 0 || height == 0 || channels == 0 || channels > 4)
+                return false;
+            if (type != SimdPixelFormatGray8 && type != SimdPixelFormatFloat)
+                return false;
+            if (border < SimdBorderReplicate || border > SimdBorderConstant)
+                return false;
+            if (KernelX() * KernelY() > 0x1000000)
+                return false;
+            return true;
+        }
+
+        SIMD_INLINE size_t KernelX() const
+        {
+            return 2 * radiusX + 1;
+        }
+
+        SIMD_INLINE size_t KernelY() const
+        {
+            return 2 * radiusY + 1;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class BoxFilter : Deletable
+    {
+    public:
+        BoxFilter(const BoxFilterParam& param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        BoxFilterParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        typedef void (*BoxFilterColPtr)(const uint8_t* add, const uint8_t* sub, size_t size, uint8_t* sum);
+        typedef void (*BoxFilterRowPtr)(const uint8_t* src, size_t width, size_t channels, size_t kernel, uint8_t* dst);
+        typedef void (*BoxFilterStorePtr)(const uint8_t* sum, size_t size, float scale, uint8_t* dst);
+
+        class BoxFilterDefault : public Simd::BoxFilter
+        {
+        public:
+            BoxFilterDefault(const BoxFilterParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            const uint8_t* Row(const uint8_t* src, size_t srcStride, ptrdiff_t row) const;
+            void RunBand(const uint8_t* src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t* buf, uint8_t* dst, size_t dstStride);
+
+            size_t _size, _extSize, _bufSize, _threads;
+            float _scale;
+            uint32_t _borderSum;
+            Array8u _zero, _border, _buffers;
+            Array32i _index;
+            BoxFilterColPtr _col;
+            BoxFilterRowPtr _row;
+            BoxFilterStorePtr _store;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type, 
+            size_t radiusX, size_t radiusY, SimdBorderType border, const float* borderValue);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class BoxFilterDefault : public Base::BoxFilterDefault
+        {
+        public:
+            BoxFilterDefault(const BoxFilterParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type,
+            size_t radiusX, size_t radiusY, SimdBorderType border, const float* borderValue);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class BoxFilterDefault : public Sse41::BoxFilterDefault
+        {
+        public:
+            BoxFilterDefault(const BoxFilterParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type,
+            size_t radiusX, size_t radiusY, SimdBorderType border, const float* borderValue);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class BoxFilterDefault : public Avx2::BoxFilterDefault
+        {
+        public:
+            BoxFilterDefault(const BoxFilterParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type,
+            size_t radiusX, size_t radiusY, SimdBorderType border, const float* borderValue);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,212 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdCanny_h__
+#define __SimdCanny_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct CannyParam
+    {
+        size_t width, height;
+        float low, high;
+        SimdBool l2;
+
+        CannyParam(size_t w, size_t h, float lo, float hi, SimdBool l)
+            : width(w)
+            , height(h)
+            , low(lo)
+            , high(hi)
+            , l2(l)
+        {
+        }
+
+        bool Valid() const
+        {
+            return width > 0 && height > 0 && low >= 0.0f && high >= low;
+        }
+
+        int32_t Threshold(float value) const
+        {
+            return l2 ? (int32_t)::floor(double(value) * double(value)) : (int32_t)::floor(value);
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class Canny : Deletable
+    {
+    public:
+        Canny(const CannyParam& param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        CannyParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        const int32_t CANNY_TG22 = 13573; // tan(22.5) * (1 << 15)
+
+        enum CannyDirType
+        {
+            CannyDirHorizontal = 0,
+            CannyDirVertical,
+            CannyDirMainDiagonal,
+            CannyDirAntiDiagonal,
+        };
+
+        SIMD_INLINE void CannyGradient(const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, size_t x0, size_t x1, size_t x2, int& dx, int& dy)
+        {
+            dx = (s0[x2] + 2 * s1[x2] + s2[x2]) - (s0[x0] + 2 * s1[x0] + s2[x0]);
+            dy = (s2[x0] + 2 * s2[x1] + s2[x2]) - (s0[x0] + 2 * s0[x1] + s0[x2]);
+        }
+
+        template<bool l2> SIMD_INLINE int32_t CannyMagnitude(int dx, int dy)
+        {
+            return l2 ? dx * dx + dy * dy : Simd::Abs(dx) + Simd::Abs(dy);
+        }
+
+        SIMD_INLINE uint8_t CannyDirection(int dx, int dy)
+        {
+            int32_t ax = Simd::Abs(dx), ay = Simd::Abs(dy) << 15;
+            int32_t tg22x = ax * CANNY_TG22, tg67x = tg22x + (ax << 16);
+            if (ay < tg22x)
+                return CannyDirHorizontal;
+            if (ay > tg67x)
+                return CannyDirVertical;
+            return (dx ^ dy) < 0 ? CannyDirAntiDiagonal : CannyDirMainDiagonal;
+        }
+
+        template<bool l2> SIMD_INLINE void CannyGradient(const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, size_t x0, size_t x1, size_t x2, int32_t* mag, uint8_t* dir)
+        {
+            int dx, dy;
+            CannyGradient(s0, s1, s2, x0, x1, x2, dx, dy);
+            mag[x1] = CannyMagnitude<l2>(dx, dy);
+            dir[x1] = CannyDirection(dx, dy);
+        }
+
+        SIMD_INLINE uint8_t CannyNms(const int32_t* m0, const int32_t* m1, const int32_t* m2, const uint8_t* dir, size_t x, int32_t low, int32_t high)
+        {
+            int32_t m = m1[x], prev, next;
+            if (m <= low)
+                return 0;
+            switch (dir[x])
+            {
+            case CannyDirHorizontal: prev = m1[x - 1], next = m1[x + 1]; break;
+            case CannyDirVertical: prev = m0[x], next = m2[x]; break;
+            case CannyDirMainDiagonal: prev = m0[x - 1], next = m2[x + 1]; break;
+            default: prev = m0[x + 1], next = m2[x - 1]; break;
+            }
+            return m > prev && m >= next ? (m > high ? 2 : 1) : 0;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        typedef void (*CannyGradientPtr)(const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, size_t width, int32_t* mag, uint8_t* dir);
+        typedef void (*CannyNmsPtr)(const int32_t* m0, const int32_t* m1, const int32_t* m2, const uint8_t* dir, size_t width, int32_t low, int32_t high, uint8_t* map);
+        typedef void (*CannyOutputPtr)(const uint8_t* map, size_t width, uint8_t* dst);
+
+        class CannyDefault : public Simd::Canny
+        {
+        public:
+            CannyDefault(const CannyParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void Hysteresis();
+
+            size_t _magStride, _mapStride;
+            int32_t _low, _high;
+            Array32i _mag;
+            Array8u _dir, _map;
+            std::vector<uint8_t*> _stack;
+            CannyGradientPtr _gradient;
+            CannyNmsPtr _nms;
+            CannyOutputPtr _output;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CannyInit(size_t width, size_t height, float low, float high, SimdBool l2);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class CannyDefault : public Base::CannyDefault
+        {
+        public:
+            CannyDefault(const CannyParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CannyInit(size_t width, size_t height, float low, float high, SimdBool l2);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class CannyDefault : public Sse41::CannyDefault
+        {
+        public:
+            CannyDefault(const CannyParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CannyInit(size_t width, size_t height, float low, float high, SimdBool l2);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class CannyDefault : public Avx2::CannyDefault
+        {
+        public:
+            CannyDefault(const CannyParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CannyInit(size_t width, size_t height, float low, float high, SimdBool l2);
+    }
+#endif
+}
+
+#endif
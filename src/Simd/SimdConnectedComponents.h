@@ -0,0 +1,173 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdConnectedComponents_h__
+#define __SimdConnectedComponents_h__
+
+#include "Simd/SimdArray.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct ConnectedComponentsParam
+    {
+        size_t width, height, connectivity;
+
+        ConnectedComponentsParam(size_t w, size_t h, size_t c)
+            : width(w)
+            , height(h)
+            , connectivity(c)
+        {
+        }
+
+        bool Valid() const
+        {
+            if (width == 0 || height == 0 || width >= 0x80000000 || height >= 0x80000000)
+                return false;
+            if (connectivity != 4 && connectivity != 8)
+                return false;
+            return true;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class ConnectedComponents : Deletable
+    {
+    public:
+        ConnectedComponents(const ConnectedComponentsParam& param)
+            : _param(param)
+        {
+        }
+
+        virtual size_t Run(const uint8_t* mask, size_t maskStride, uint32_t* labels, size_t labelsStride) = 0;
+
+        const SimdConnectedComponent* Components() const
+        {
+            return _components.empty() ? NULL : _components.data();
+        }
+
+    protected:
+        ConnectedComponentsParam _param;
+        std::vector<SimdConnectedComponent> _components;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        struct CclRun
+        {
+            uint32_t beg, end, label;
+
+            CclRun(uint32_t b, uint32_t e, uint32_t l) : beg(b), end(e), label(l) {}
+        };
+
+        typedef std::vector<CclRun> CclRuns;
+
+        void CclRowRuns(const uint8_t* mask, size_t width, CclRuns& runs);
+
+        void CclFillRow(const CclRun* runs, size_t count, size_t width, const uint32_t* ids, uint32_t* dst);
+
+        typedef void (*CclRowRunsPtr)(const uint8_t* mask, size_t width, CclRuns& runs);
+        typedef void (*CclFillRowPtr)(const CclRun* runs, size_t count, size_t width, const uint32_t* ids, uint32_t* dst);
+
+        class ConnectedComponentsDefault : public Simd::ConnectedComponents
+        {
+        public:
+            ConnectedComponentsDefault(const ConnectedComponentsParam& param);
+
+            virtual size_t Run(const uint8_t* mask, size_t maskStride, uint32_t* labels, size_t labelsStride);
+
+        protected:
+            struct Strip
+            {
+                size_t begin, end, offset;
+                CclRuns runs;
+            };
+
+            void FindRuns(const uint8_t* mask, size_t maskStride, Strip& strip);
+            size_t Merge();
+            void Statistics(size_t count);
+
+            size_t _threads;
+            std::vector<Strip> _strips;
+            Array32u _rowBeg, _rowEnd;
+            std::vector<uint32_t> _parent;
+            CclRowRunsPtr _rowRuns;
+            CclFillRowPtr _fillRow;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ConnectedComponentsInit(size_t width, size_t height, size_t connectivity);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class ConnectedComponentsDefault : public Base::ConnectedComponentsDefault
+        {
+        public:
+            ConnectedComponentsDefault(const ConnectedComponentsParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ConnectedComponentsInit(size_t width, size_t height, size_t connectivity);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class ConnectedComponentsDefault : public Sse41::ConnectedComponentsDefault
+        {
+        public:
+            ConnectedComponentsDefault(const ConnectedComponentsParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ConnectedComponentsInit(size_t width, size_t height, size_t connectivity);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class ConnectedComponentsDefault : public Avx2::ConnectedComponentsDefault
+        {
+        public:
+            ConnectedComponentsDefault(const ConnectedComponentsParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ConnectedComponentsInit(size_t width, size_t height, size_t connectivity);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,179 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdDistanceTransform_h__
+#define __SimdDistanceTransform_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct DistanceTransformParam
+    {
+        size_t width, height;
+        SimdDistanceType type;
+        SimdPixelFormatType format;
+
+        DistanceTransformParam(size_t w, size_t h, SimdDistanceType t, SimdPixelFormatType f)
+            : width(w)
+            , height(h)
+            , type(t)
+            , format(f)
+        {
+        }
+
+        bool Valid() const
+        {
+            if (width == 0 || height == 0)
+                return false;
+            if (type < SimdDistanceEuclidean || type > SimdDistanceChamfer5x5)
+                return false;
+            if (format != SimdPixelFormatInt16 && format != SimdPixelFormatFloat)
+                return false;
+            return true;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class DistanceTransform : Deletable
+    {
+    public:
+        DistanceTransform(const DistanceTransformParam& param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        DistanceTransformParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        const int32_t DISTANCE_INF = 1 << 28;
+
+        void DistanceCols(const uint8_t* src, size_t srcStride, size_t size, size_t height, int32_t* dst, size_t dstStride);
+
+        template<bool five> SIMD_INLINE int32_t DistanceChamfer(const int32_t* r1, const int32_t* r2, ptrdiff_t x, const int32_t* w)
+        {
+            int32_t d = Simd::Min(r1[x] + w[0], Simd::Min(r1[x - 1], r1[x + 1]) + w[1]);
+            if (five)
+                d = Simd::Min(d, Simd::Min(Simd::Min(r1[x - 2], r1[x + 2]), Simd::Min(r2[x - 1], r2[x + 1])) + w[2]);
+            return d;
+        }
+
+        template<bool five> SIMD_INLINE void DistanceChamferForward(const uint8_t* src, const int32_t* r1, const int32_t* r2, size_t width, const int32_t* weight, int32_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+                dst[x] = src[x] ? Simd::Min(DistanceChamfer<five>(r1, r2, x, weight), DISTANCE_INF) : 0;
+        }
+
+        template<bool five> SIMD_INLINE void DistanceChamferBackward(const uint8_t* src, const int32_t* r1, const int32_t* r2, size_t width, const int32_t* weight, int32_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+                dst[x] = Simd::Min(dst[x], DistanceChamfer<five>(r1, r2, x, weight));
+        }
+
+        typedef void (*DistanceColsPtr)(const uint8_t* src, size_t srcStride, size_t size, size_t height, int32_t* dst, size_t dstStride);
+        typedef void (*DistanceChamferPtr)(const uint8_t* src, const int32_t* r1, const int32_t* r2, size_t width, const int32_t* weight, int32_t* dst);
+        typedef void (*DistanceStoreSqPtr)(const float* src, size_t size, uint8_t* dst);
+        typedef void (*DistanceStoreIntPtr)(const int32_t* src, size_t size, float scale, uint8_t* dst);
+
+        class DistanceTransformDefault : public Simd::DistanceTransform
+        {
+        public:
+            DistanceTransformDefault(const DistanceTransformParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void RunEuclidean(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            void RunChamfer(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            void FillMax(uint8_t* dst, size_t dstStride);
+
+            size_t _threads, _stride;
+            int32_t _weight[3];
+            Array32i _buf, _v;
+            Array32f _row;
+            DistanceColsPtr _cols;
+            DistanceChamferPtr _forward, _backward;
+            DistanceStoreSqPtr _storeSq;
+            DistanceStoreIntPtr _storeInt;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceType type, SimdPixelFormatType format);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class DistanceTransformDefault : public Base::DistanceTransformDefault
+        {
+        public:
+            DistanceTransformDefault(const DistanceTransformParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceType type, SimdPixelFormatType format);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class DistanceTransformDefault : public Sse41::DistanceTransformDefault
+        {
+        public:
+            DistanceTransformDefault(const DistanceTransformParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceType type, SimdPixelFormatType format);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class DistanceTransformDefault : public Avx2::DistanceTransformDefault
+        {
+        public:
+            DistanceTransformDefault(const DistanceTransformParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceType type, SimdPixelFormatType format);
+    }
+#endif
+}
+
+#endif
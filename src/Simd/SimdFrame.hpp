@@ -69,6 +69,8 @@ namespace Simd
             Rgba32,
             /*! Three planes (8-bit full size Y, U, V planes) YUV444P pixel format. */
             Yuv444p,
+            /*! One plane 16-bit (2 8-bit channels) YUYV422 pixel format. */
+            Yuyv16,
         };
 
         const size_t width; /*!< \brief A width of the frame. */
@@ -469,6 +471,7 @@ namespace Simd
         case View<A>::Bgra32: (Format&)format = Bgra32; break;
         case View<A>::Rgb24: (Format&)format = Rgb24; break;
         case View<A>::Rgba32: (Format&)format = Rgba32; break;
+        case View<A>::Yuyv16: (Format&)format = Yuyv16; *(SimdYuvType*)&yuvType = SimdYuvBt601; break;
         default:
             assert(0);
         }
@@ -491,6 +494,7 @@ namespace Simd
         case View<A>::Bgra32: (Format&)format = Bgra32; break;
         case View<A>::Rgb24: (Format&)format = Rgb24; break;
         case View<A>::Rgba32: (Format&)format = Rgba32; break;
+        case View<A>::Yuyv16: (Format&)format = Yuyv16; *(SimdYuvType*)&yuvType = SimdYuvBt601; break;
         default:
             assert(0);
         }
@@ -580,6 +584,12 @@ namespace Simd
             if (yuvType == SimdYuvUnknown)
                 *(SimdYuvType*)&yuvType = SimdYuvBt601;
             break;
+        case Yuyv16:
+            assert((width & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Yuyv16, data0);
+            if (yuvType == SimdYuvUnknown)
+                *(SimdYuvType*)&yuvType = SimdYuvBt601;
+            break;
         default:
             assert(0);
         }
@@ -713,6 +723,12 @@ namespace Simd
             if (yuvType == SimdYuvUnknown)
                 *(SimdYuvType*)&yuvType = SimdYuvBt601;
             break;
+        case Yuyv16:
+            assert((width & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Yuyv16);
+            if (yuvType == SimdYuvUnknown)
+                *(SimdYuvType*)&yuvType = SimdYuvBt601;
+            break;
         default:
             assert(0);
         }
@@ -746,6 +762,12 @@ namespace Simd
                 bottom = (bottom + 1) & ~1;
             }
 
+            if (format == Yuyv16)
+            {
+                left = left & ~1;
+                right = (right + 1) & ~1;
+            }
+
             Frame frame;
             *(size_t*)&frame.width = right - left;
             *(size_t*)&frame.height = bottom - top;
@@ -839,6 +861,7 @@ namespace Simd
         case Rgb24:   return 1;
         case Rgba32:  return 1;
         case Yuv444p: return 3;
+        case Yuyv16:  return 1;
         default: assert(0); return 0;
         }
     }
@@ -1264,6 +1287,70 @@ namespace Simd
             }
             break;
 
+        case Frame<A>::Yuyv16:
+            switch (dst.format)
+            {
+            case Frame<A>::Nv12:
+            {
+                assert(src.yuvType == dst.yuvType);
+                View<A> u(src.Size() / 2, View<A>::Gray8), v(src.Size() / 2, View<A>::Gray8);
+                Yuyv422ToYuv420p(src.planes[0], dst.planes[0], u, v);
+                InterleaveUv(u, v, dst.planes[1]);
+                break;
+            }
+            case Frame<A>::Yuv420p:
+                assert(src.yuvType == dst.yuvType);
+                Yuyv422ToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2]);
+                break;
+            case Frame<A>::Bgra32:
+                Yuyv422ToBgra(src.planes[0], dst.planes[0], 0xFF, src.yuvType);
+                break;
+            case Frame<A>::Bgr24:
+                Yuyv422ToBgr(src.planes[0], dst.planes[0], src.yuvType);
+                break;
+            case Frame<A>::Gray8:
+                Yuyv422ToGray(src.planes[0], dst.planes[0]);
+                if (src.yuvType != SimdYuvTrect871)
+                    YToGray(dst.planes[0], dst.planes[0]);
+                break;
+            case Frame<A>::Rgb24:
+            {
+                View<A> bgr(src.Size(), View<A>::Bgr24);
+                Yuyv422ToBgr(src.planes[0], bgr, src.yuvType);
+                BgrToRgb(bgr, dst.planes[0]);
+                break;
+            }
+            case Frame<A>::Rgba32:
+            {
+                View<A> bgra(src.Size(), View<A>::Bgra32);
+                Yuyv422ToBgra(src.planes[0], bgra, 0xFF, src.yuvType);
+                BgraToRgba(bgra, dst.planes[0]);
+                break;
+            }
+            case Frame<A>::Yuv444p:
+            {
+                assert(src.yuvType == dst.yuvType);
+                for (size_t row = 0; row < src.height; ++row)
+                {
+                    const uint8_t* yuyv = src.planes[0].template Row<uint8_t>(row);
+                    uint8_t* y = dst.planes[0].template Row<uint8_t>(row);
+                    uint8_t* u = dst.planes[1].template Row<uint8_t>(row);
+                    uint8_t* v = dst.planes[2].template Row<uint8_t>(row);
+                    for (size_t col = 0; col < src.width; col += 2, yuyv += 4)
+                    {
+                        y[col + 0] = yuyv[0];
+                        y[col + 1] = yuyv[2];
+                        u[col + 0] = u[col + 1] = yuyv[1];
+                        v[col + 0] = v[col + 1] = yuyv[3];
+                    }
+                }
+                break;
+            }
+            default:
+                assert(0);
+            }
+            break;
+
         default:
             assert(0);
         }
@@ -91,6 +91,57 @@ namespace Simd
         };
 
         void * GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+
+        //---------------------------------------------------------------------
+
+        struct AlgIir
+        {
+            float b, a1, a2, a3, m[3][3];
+
+            void Init(float sigma);
+        };
+
+        void GaussianBlurIirTail(float* buf, size_t step, size_t count, size_t lag, size_t size, const AlgIir& a);
+
+        template<class Row, class Out> SIMD_INLINE void GaussianBlurIirPass(float* buf, size_t step, size_t count, size_t lag, size_t size, const AlgIir& a, Out out)
+        {
+            for (size_t j = 0; j < lag; ++j)
+                memcpy(buf + (count + j) * step, buf + (count - lag + j) * step, size * sizeof(float));
+            for (size_t n = lag; n < count; ++n)
+            {
+                size_t n2 = n >= 2 * lag ? n - 2 * lag : n % lag, n3 = n >= 3 * lag ? n - 3 * lag : n % lag;
+                Row::Run(buf + (n - lag) * step, buf + n2 * step, buf + n3 * step, size, a, buf + n * step);
+            }
+            GaussianBlurIirTail(buf, step, count, lag, size, a);
+            for (size_t n = count - 1; n < count; --n)
+            {
+                Row::Run(buf + (n + lag) * step, buf + (n + 2 * lag) * step, buf + (n + 3 * lag) * step, size, a, buf + n * step);
+                out(n, buf + n * step);
+            }
+        }
+
+        typedef void (*BlurIirHorPtr)(const BlurParam& p, const AlgIir& a, const uint8_t* src, size_t srcStride, size_t rows, float* buf, float* dst, size_t dstStride);
+        typedef void (*BlurIirVerPtr)(const BlurParam& p, const AlgIir& a, float* buf, size_t stride, size_t size, uint8_t* dst, size_t dstStride);
+
+        class GaussianBlurIir : public Simd::GaussianBlur
+        {
+        public:
+            GaussianBlurIir(const BlurParam& param, SimdPixelFormatType type);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void InitBuffers(size_t group);
+
+            SimdPixelFormatType _type;
+            AlgIir _alg;
+            size_t _group, _stride, _stripe, _threads;
+            Array32f _buf, _rows;
+            BlurIirHorPtr _hor;
+            BlurIirVerPtr _ver;
+        };
+
+        void* GaussianBlurIirInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type, const float* sigma);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -103,6 +154,16 @@ namespace Simd
         };
 
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+
+        //---------------------------------------------------------------------
+
+        class GaussianBlurIir : public Base::GaussianBlurIir
+        {
+        public:
+            GaussianBlurIir(const BlurParam& param, SimdPixelFormatType type);
+        };
+
+        void* GaussianBlurIirInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type, const float* sigma);
     }
 #endif //SIMD_SSE41_ENABLE
 
@@ -116,6 +177,16 @@ namespace Simd
         };
 
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+
+        //---------------------------------------------------------------------
+
+        class GaussianBlurIir : public Sse41::GaussianBlurIir
+        {
+        public:
+            GaussianBlurIir(const BlurParam& param, SimdPixelFormatType type);
+        };
+
+        void* GaussianBlurIirInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type, const float* sigma);
     }
 #endif //SIMD_AVX2_ENABLE
 
@@ -129,6 +200,16 @@ namespace Simd
         };
 
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+
+        //---------------------------------------------------------------------
+
+        class GaussianBlurIir : public Avx2::GaussianBlurIir
+        {
+        public:
+            GaussianBlurIir(const BlurParam& param, SimdPixelFormatType type);
+        };
+
+        void* GaussianBlurIirInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type, const float* sigma);
     }
 #endif //SIMD_AVX512BW_ENABLE
 
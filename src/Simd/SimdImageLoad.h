@@ -84,6 +84,38 @@ namespace Simd
         }
     };
 
+    //-------------------------------------------------------------------------
+
+    class ImageMap : public Deletable
+    {
+    public:
+        typedef ImageLoader* (*CreateLoaderPtr)(const ImageLoaderParam& param);
+
+        ImageMap();
+        virtual ~ImageMap();
+
+        bool Open(const char* path, SimdPixelFormatType format, CreateLoaderPtr create);
+
+        size_t Width() const;
+        size_t Height() const;
+        SimdPixelFormatType Format() const;
+
+        const uint8_t* Data(size_t* stride) const;
+        bool Rows(size_t row, size_t count, uint8_t* dst, size_t dstStride) const;
+
+    private:
+        const uint8_t* _data;
+        size_t _size;
+#if defined(_WIN32)
+        void* _file, * _mapping;
+#else
+        int _file;
+#endif
+        ImageLoader* _loader;
+    };
+
+    void* ImageMapFromFile(ImageMap::CreateLoaderPtr create, const char* path, size_t* width, size_t* height, SimdPixelFormatType* format);
+
     namespace Base
     {
         class ImagePxmLoader : public ImageLoader
@@ -91,6 +123,21 @@ namespace Simd
         public:
             ImagePxmLoader(const ImageLoaderParam& param);
 
+            virtual bool FromMap();
+
+            const uint8_t* MapData(size_t* stride) const;
+            bool MapRows(size_t row, size_t count, uint8_t* dst, size_t dstStride) const;
+
+            SIMD_INLINE const Image& Native() const
+            {
+                return _image;
+            }
+
+            SIMD_INLINE SimdPixelFormatType Format() const
+            {
+                return _param.format;
+            }
+
         protected:
             typedef void (*ToAnyPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
             typedef void (*ToBgraPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha);
@@ -99,7 +146,7 @@ namespace Simd
             Array8u _buffer;
             size_t _block, _size;
 
-            bool ReadHeader(size_t version);
+            bool ReadHeader(size_t version, bool map = false);
             virtual void SetConverters() = 0;
         };
 
@@ -120,6 +167,7 @@ namespace Simd
             ImagePgmBinLoader(const ImageLoaderParam& param);
 
             virtual bool FromStream();
+            virtual bool FromMap();
 
         protected:
             virtual void SetConverters();
@@ -142,6 +190,7 @@ namespace Simd
             ImagePpmBinLoader(const ImageLoaderParam& param);
 
             virtual bool FromStream();
+            virtual bool FromMap();
 
         protected:
             virtual void SetConverters();
@@ -208,9 +257,32 @@ namespace Simd
             struct JpegContext* _context;
         };
 
+        class ImageQoiLoader : public ImageLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+            virtual bool FromStream();
+
+        protected:
+            typedef void (*ToAnyPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
+            typedef void (*ToBgraPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha);
+            typedef const uint8_t* (*DecodeRowPtr)(const uint8_t* src, const uint8_t* end, size_t width, uint32_t* index, uint32_t& px, int& run, uint8_t* dst);
+            ToAnyPtr _toAny;
+            ToBgraPtr _toBgra;
+            DecodeRowPtr _decodeRow;
+            Array8u _buffer;
+            size_t _channels, _block, _size;
+
+            bool ReadHeader();
+            virtual void SetConverters();
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        void* ImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType* format);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -266,9 +338,20 @@ namespace Simd
             ImageJpegLoader(const ImageLoaderParam& param);
         };
 
+        class ImageQoiLoader : public Base::ImageQoiLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+        protected:
+            virtual void SetConverters();
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        void* ImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType* format);
     }
 #endif// SIMD_SSE41_ENABLE
 
@@ -319,9 +402,20 @@ namespace Simd
             virtual bool FromStream();
         };
 
+        class ImageQoiLoader : public Sse41::ImageQoiLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+        protected:
+            virtual void SetConverters();
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        void* ImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType* format);
     }
 #endif// SIMD_AVX2_ENABLE
 
@@ -364,9 +458,20 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImageQoiLoader : public Avx2::ImageQoiLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+        protected:
+            virtual void SetConverters();
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        void* ImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType* format);
     }
 #endif// SIMD_AVX512BW_ENABLE
 
@@ -412,6 +517,8 @@ namespace Simd
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        void* ImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType* format);
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -0,0 +1,144 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdImageQoi_h__
+#define __SimdImageQoi_h__
+
+#include "Simd/SimdDefs.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const uint8_t QOI_OP_INDEX = 0x00;
+        const uint8_t QOI_OP_DIFF = 0x40;
+        const uint8_t QOI_OP_LUMA = 0x80;
+        const uint8_t QOI_OP_RUN = 0xC0;
+        const uint8_t QOI_OP_RGB = 0xFE;
+        const uint8_t QOI_OP_RGBA = 0xFF;
+        const uint8_t QOI_MASK_2 = 0xC0;
+
+        const size_t QOI_HEADER_SIZE = 14;
+        const size_t QOI_PADDING_SIZE = 8;
+        const int QOI_RUN_MAX = 62;
+        const uint32_t QOI_PIXEL_INIT = 0xFF000000;
+
+        extern const uint8_t QOI_MAGIC[4];
+        extern const uint8_t QOI_PADDING[QOI_PADDING_SIZE];
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE int QoiHash(uint32_t px)
+        {
+            return ((px & 0xFF) * 3 + ((px >> 8) & 0xFF) * 5 + ((px >> 16) & 0xFF) * 7 + (px >> 24) * 11) & 63;
+        }
+
+        template<int channels> SIMD_INLINE uint32_t QoiGet(const uint8_t* src);
+
+        template<> SIMD_INLINE uint32_t QoiGet<3>(const uint8_t* src)
+        {
+            return uint32_t(src[0]) | uint32_t(src[1]) << 8 | uint32_t(src[2]) << 16 | QOI_PIXEL_INIT;
+        }
+
+        template<> SIMD_INLINE uint32_t QoiGet<4>(const uint8_t* src)
+        {
+            return *(uint32_t*)src;
+        }
+
+        template<int channels> SIMD_INLINE void QoiSet(uint32_t px, uint8_t* dst);
+
+        template<> SIMD_INLINE void QoiSet<3>(uint32_t px, uint8_t* dst)
+        {
+            dst[0] = uint8_t(px);
+            dst[1] = uint8_t(px >> 8);
+            dst[2] = uint8_t(px >> 16);
+        }
+
+        template<> SIMD_INLINE void QoiSet<4>(uint32_t px, uint8_t* dst)
+        {
+            *(uint32_t*)dst = px;
+        }
+
+        SIMD_INLINE uint8_t* QoiEncodeDiff(uint32_t px, uint32_t prev, uint8_t* dst)
+        {
+            if ((px ^ prev) >> 24 == 0)
+            {
+                int vr = int8_t(px - prev);
+                int vg = int8_t((px >> 8) - (prev >> 8));
+                int vb = int8_t((px >> 16) - (prev >> 16));
+                int vgr = vr - vg, vgb = vb - vg;
+                if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2)
+                    *dst++ = QOI_OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2);
+                else if (vgr > -9 && vgr < 8 && vg > -33 && vg < 32 && vgb > -9 && vgb < 8)
+                {
+                    *dst++ = QOI_OP_LUMA | (vg + 32);
+                    *dst++ = (vgr + 8) << 4 | (vgb + 8);
+                }
+                else
+                {
+                    *dst++ = QOI_OP_RGB;
+                    QoiSet<3>(px, dst);
+                    dst += 3;
+                }
+            }
+            else
+            {
+                *dst++ = QOI_OP_RGBA;
+                QoiSet<4>(px, dst);
+                dst += 4;
+            }
+            return dst;
+        }
+
+        template<int channels> SIMD_INLINE uint8_t* QoiEncodePixel(const uint8_t* src, uint32_t* index, uint32_t& prev, int& run, uint8_t* dst)
+        {
+            uint32_t px = QoiGet<channels>(src);
+            if (px == prev)
+            {
+                if (++run == QOI_RUN_MAX)
+                {
+                    *dst++ = QOI_OP_RUN | (run - 1);
+                    run = 0;
+                }
+                return dst;
+            }
+            if (run)
+            {
+                *dst++ = QOI_OP_RUN | (run - 1);
+                run = 0;
+            }
+            int hash = QoiHash(px);
+            if (index[hash] == px)
+                *dst++ = QOI_OP_INDEX | hash;
+            else
+            {
+                index[hash] = px;
+                dst = QoiEncodeDiff(px, prev, dst);
+            }
+            prev = px;
+            return dst;
+        }
+    }
+}
+
+#endif//__SimdImageQoi_h__
@@ -87,7 +87,7 @@ namespace Simd
                 if (width % 2 != 0 || height % 2 != 0)
                     return false;
             }
-            if (file <= SimdImageFileUndefined || file > SimdImageFileJpeg)
+            if (file <= SimdImageFileUndefined || file > SimdImageFileQoi)
                 return false;
             return true;
         }
@@ -226,6 +226,23 @@ namespace Simd
             void WriteHeader();
         };
 
+        class ImageQoiSaver : public ImageSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+
+            virtual bool ToStream(const uint8_t* src, size_t stride);
+        protected:
+            typedef void (*ConvertPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
+            typedef uint8_t* (*EncodeRowPtr)(const uint8_t* src, size_t width, uint32_t* index, uint32_t& prev, int& run, uint8_t* dst);
+            ConvertPtr _convert;
+            EncodeRowPtr _encodeRow;
+            Array8u _buffer;
+            size_t _channels, _block, _size;
+
+            void WriteHeader();
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
@@ -277,6 +294,12 @@ namespace Simd
             virtual void Init();
         };
 
+        class ImageQoiSaver : public Base::ImageQoiSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
@@ -329,6 +352,12 @@ namespace Simd
             virtual void Init();
         };
 
+        class ImageQoiSaver : public Sse41::ImageQoiSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
@@ -381,6 +410,12 @@ namespace Simd
             virtual void Init();
         };
 
+        class ImageQoiSaver : public Avx2::ImageQoiSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
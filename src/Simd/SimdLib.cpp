@@ -63,12 +63,22 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdEmpty.h"
 
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdConnectedComponents.h"
 #include "Simd/SimdDescrInt.h"
+#include "Simd/SimdDistanceTransform.h"
 #include "Simd/SimdGaussianBlur.h"
 #include "Simd/SimdImageLoad.h"
 #include "Simd/SimdImageSave.h"
+#include "Simd/SimdLut3d.h"
+#include "Simd/SimdMedianFilter.h"
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdOpticalFlow.h"
+#include "Simd/SimdPyramidBuilder.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdSeparableFilter.h"
 #include "Simd/SimdSynetAdd16b.h"
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetConvolution16b.h"
@@ -82,7 +92,9 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdSynetMergedConvolution16b.h"
 #include "Simd/SimdSynetMergedConvolution8i.h"
 #include "Simd/SimdSynetPermute.h"
+#include "Simd/SimdSynetPreprocess.h"
 #include "Simd/SimdSynetScale8i.h"
+#include "Simd/SimdTemplateMatch.h"
 #include "Simd/SimdWarpAffine.h"
 
 #include "Simd/SimdBase.h"
@@ -953,6 +965,69 @@ SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height
         Base::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdBayerToBgrMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgr, size_t bgrStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::BayerToBgrMhc(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BayerToBgrMhc(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BayerToBgrMhc(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+    else
+#endif
+        Base::BayerToBgrMhc(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+}
+
+SIMD_API void SimdBayerToBgraMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::BayerToBgraMhc(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BayerToBgraMhc(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BayerToBgraMhc(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::BayerToBgraMhc(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+}
+
+SIMD_API void SimdBayerToGrayMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* gray, size_t grayStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::BayerToGrayMhc(bayer, width, height, bayerStride, bayerFormat, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BayerToGrayMhc(bayer, width, height, bayerStride, bayerFormat, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BayerToGrayMhc(bayer, width, height, bayerStride, bayerFormat, gray, grayStride);
+    else
+#endif
+        Base::BayerToGrayMhc(bayer, width, height, bayerStride, bayerFormat, gray, grayStride);
+}
+
 SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
     SIMD_EMPTY();
@@ -1078,6 +1153,28 @@ SIMD_API void SimdBgraToRgba(const uint8_t* bgra, size_t width, size_t height, s
         Base::BgraToRgba(bgra, width, height, bgraStride, rgba, rgbaStride);
 }
 
+SIMD_API void SimdBgraToNv12V2(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height,
+    uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgraToNv12V2(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToNv12V2(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::BgraToNv12V2(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+        Base::BgraToNv12V2(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+}
+
 SIMD_API void SimdBgraToYuv420pV2(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height,
     uint8_t* y, size_t yStride, uint8_t* u, size_t uStride, uint8_t* v, size_t vStride, SimdYuvType yuvType)
 {
@@ -1324,6 +1421,28 @@ SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t width, size_t height, size
         Base::BgrToRgb(bgr, width, height, bgrStride, rgb, rgbStride);
 }
 
+SIMD_API void SimdBgrToNv12V2(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+    uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgrToNv12V2(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToNv12V2(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::BgrToNv12V2(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+        Base::BgrToNv12V2(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+}
+
 SIMD_API void SimdBgrToYuv420pV2(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
     uint8_t* y, size_t yStride, uint8_t* u, size_t uStride, uint8_t* v, size_t vStride, SimdYuvType yuvType)
 {
@@ -1467,6 +1586,38 @@ SIMD_API void SimdAveragingBinarizationV2(const uint8_t* src, size_t srcStride,
     Base::AveragingBinarizationV2(src, srcStride, width, height, neighborhood, shift, positive, negative, dst, dstStride);
 }
 
+SIMD_API void* SimdBoxFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type,
+    size_t radiusX, size_t radiusY, SimdBorderType border, const float* borderValue)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdBoxFilterInitPtr) (size_t width, size_t height, size_t channels, SimdPixelFormatType type,
+        size_t radiusX, size_t radiusY, SimdBorderType border, const float* borderValue);
+    const static SimdBoxFilterInitPtr simdBoxFilterInit = SIMD_FUNC3(BoxFilterInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdBoxFilterInit(width, height, channels, type, radiusX, radiusY, border, borderValue);
+}
+
+SIMD_API void SimdBoxFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((BoxFilter*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void* SimdCannyInit(size_t width, size_t height, float low, float high, SimdBool l2)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdCannyInitPtr) (size_t width, size_t height, float low, float high, SimdBool l2);
+    const static SimdCannyInitPtr simdCannyInit = SIMD_FUNC3(CannyInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdCannyInit(width, height, low, high, l2);
+}
+
+SIMD_API void SimdCannyRun(const void* context, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((Canny*)context)->Run(src, srcStride, dst, dstStride);
+}
+
 SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
                                    uint8_t value, SimdCompareType compareType, uint32_t * count)
 {
@@ -1628,6 +1779,27 @@ SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t
         Base::ConditionalFill(src, srcStride, width, height, threshold, compareType, value, dst, dstStride);
 }
 
+SIMD_API void* SimdConnectedComponentsInit(size_t width, size_t height, size_t connectivity)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdConnectedComponentsInitPtr) (size_t width, size_t height, size_t connectivity);
+    const static SimdConnectedComponentsInitPtr simdConnectedComponentsInit = SIMD_FUNC3(ConnectedComponentsInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdConnectedComponentsInit(width, height, connectivity);
+}
+
+SIMD_API size_t SimdConnectedComponentsRun(const void* context, const uint8_t* mask, size_t maskStride, uint32_t* labels, size_t labelsStride)
+{
+    SIMD_EMPTY();
+    return ((ConnectedComponents*)context)->Run(mask, maskStride, labels, labelsStride);
+}
+
+SIMD_API const SimdConnectedComponent* SimdConnectedComponentsStatistics(const void* context)
+{
+    SIMD_EMPTY();
+    return ((ConnectedComponents*)context)->Components();
+}
+
 SIMD_API void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
@@ -2005,6 +2177,21 @@ SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask,
         Base::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
+SIMD_API void* SimdDistanceTransformInit(size_t width, size_t height, SimdDistanceType type, SimdPixelFormatType format)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdDistanceTransformInitPtr) (size_t width, size_t height, SimdDistanceType type, SimdPixelFormatType format);
+    const static SimdDistanceTransformInitPtr simdDistanceTransformInit = SIMD_FUNC3(DistanceTransformInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdDistanceTransformInit(width, height, type, format);
+}
+
+SIMD_API void SimdDistanceTransformRun(const void* context, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((DistanceTransform*)context)->Run(src, srcStride, dst, dstStride);
+}
+
 SIMD_API void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value)
 {
     SIMD_EMPTY();
@@ -2404,6 +2591,15 @@ SIMD_API void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t
     ((GaussianBlur*)filter)->Run(src, srcStride, dst, dstStride);
 }
 
+SIMD_API void* SimdGaussianBlurIirInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type, const float* sigma)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdGaussianBlurIirInitPtr) (size_t width, size_t height, size_t channels, SimdPixelFormatType type, const float* sigma);
+    const static SimdGaussianBlurIirInitPtr simdGaussianBlurIirInit = SIMD_FUNC3(GaussianBlurIirInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdGaussianBlurIirInit(width, height, channels, type, sigma);
+}
+
 typedef void(*SimdGemm32fPtr) (size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
 SIMD_API void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
@@ -2782,6 +2978,27 @@ SIMD_API uint8_t* SimdImageLoadFromFile(const char* path, size_t* stride, size_t
     return ImageLoadFromFile(imageLoadFromMemory, path, stride, width, height, format);
 }
 
+SIMD_API void* SimdImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdImageMapFromFilePtr) (const char* path, size_t* width, size_t* height, SimdPixelFormatType* format);
+    const static SimdImageMapFromFilePtr simdImageMapFromFile = SIMD_FUNC4(ImageMapFromFile, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdImageMapFromFile(path, width, height, format);
+}
+
+SIMD_API const uint8_t* SimdImageMapData(const void* context, size_t* stride)
+{
+    SIMD_EMPTY();
+    return ((ImageMap*)context)->Data(stride);
+}
+
+SIMD_API SimdBool SimdImageMapRows(const void* context, size_t row, size_t count, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    return ((ImageMap*)context)->Rows(row, count, dst, dstStride) ? SimdTrue : SimdFalse;
+}
+
 SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
@@ -3010,6 +3227,21 @@ SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t widt
         Base::LbpEstimate(src, srcStride, width, height, dst, dstStride);
 }
 
+SIMD_API void* SimdLut3dInit(size_t size, const float* table, SimdLut3dInterpolationType interpolation)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdLut3dInitPtr) (size_t size, const float* table, SimdLut3dInterpolationType interpolation);
+    const static SimdLut3dInitPtr simdLut3dInit = SIMD_FUNC2(Lut3dInit, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdLut3dInit(size, table, interpolation);
+}
+
+SIMD_API void SimdLut3dRun(const void* context, const uint8_t* src, size_t srcStride, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((Lut3d*)context)->Run(src, srcStride, width, height, format, dst, dstStride);
+}
+
 SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
@@ -3036,6 +3268,21 @@ SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t wi
         Base::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+SIMD_API void* SimdMedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, const uint8_t* borderValue)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdMedianFilterInitPtr) (size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, const uint8_t* borderValue);
+    const static SimdMedianFilterInitPtr simdMedianFilterInit = SIMD_FUNC3(MedianFilterInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdMedianFilterInit(width, height, channels, radius, border, borderValue);
+}
+
+SIMD_API void SimdMedianFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((MedianFilter*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
 SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
@@ -3140,6 +3387,21 @@ SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, s
         Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+SIMD_API void* SimdMorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdMorphologyInitPtr) (size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+    const static SimdMorphologyInitPtr simdMorphologyInit = SIMD_FUNC3(MorphologyInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdMorphologyInit(width, height, type, kernelX, kernelY);
+}
+
+SIMD_API void SimdMorphologyRun(const void* context, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((Morphology*)context)->Run(src, srcStride, dst, dstStride);
+}
+
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
 {
     SIMD_EMPTY();
@@ -3591,6 +3853,270 @@ SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, s
     simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
+SIMD_API void SimdNv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+    size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+    size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Nv12ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdNv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+    size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Nv21ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Nv21ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Nv21ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+    size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Nv21ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Nv21ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv21ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+    size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv21ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Nv21ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Nv21ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Nv21ToRgbV2(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdYuv420p10ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::Yuv420p10ToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv420p10ToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv420p10ToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv420p10ToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv420p10ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::Yuv420p10ToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv420p10ToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv420p10ToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuv420p10ToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv420p10ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, uint8_t* blue, size_t blueStride, uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::Yuv420p10ToBgr48pV2(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv420p10ToBgr48pV2(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv420p10ToBgr48pV2(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride, yuvType);
+    else
+#endif
+        Base::Yuv420p10ToBgr48pV2(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride, yuvType);
+}
+
+SIMD_API void SimdP010ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+    size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::P010ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::P010ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::P010ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::P010ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdP010ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+    size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::P010ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::P010ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::P010ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::P010ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdP010ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+    size_t width, size_t height, uint8_t* blue, size_t blueStride, uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::P010ToBgr48pV2(y, yStride, uv, uvStride, width, height, blue, blueStride, green, greenStride, red, redStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::P010ToBgr48pV2(y, yStride, uv, uvStride, width, height, blue, blueStride, green, greenStride, red, redStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::P010ToBgr48pV2(y, yStride, uv, uvStride, width, height, blue, blueStride, green, greenStride, red, redStride, yuvType);
+    else
+#endif
+        Base::P010ToBgr48pV2(y, yStride, uv, uvStride, width, height, blue, blueStride, green, greenStride, red, redStride, yuvType);
+}
+
 SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
 {
@@ -3645,6 +4171,22 @@ SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const ui
         Base::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
 }
 
+SIMD_API void* SimdOpticalFlowLkInit(size_t width, size_t height, size_t window, size_t levels, size_t iterations, float epsilon)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdOpticalFlowLkInitPtr) (size_t width, size_t height, size_t window, size_t levels, size_t iterations, float epsilon);
+    const static SimdOpticalFlowLkInitPtr simdOpticalFlowLkInit = SIMD_FUNC3(OpticalFlowLkInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdOpticalFlowLkInit(width, height, window, levels, iterations, epsilon);
+}
+
+SIMD_API void SimdOpticalFlowLkRun(const void* context, const uint8_t* prev, size_t prevStride, const uint8_t* next, size_t nextStride,
+    const float* prevPoints, size_t count, float* nextPoints, uint8_t* status)
+{
+    SIMD_EMPTY();
+    ((OpticalFlowLk*)context)->Run(prev, prevStride, next, nextStride, prevPoints, count, nextPoints, status);
+}
+
 SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height)
 {
     SIMD_EMPTY();
@@ -3671,6 +4213,25 @@ SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizo
         Base::VectorProduct(vertical, horizontal, dst, stride, width, height);
 }
 
+SIMD_API void* SimdPyramidBuilderInit(size_t width, size_t height, size_t levels, double scale, SimdReduceType reduce, SimdBool compensation)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdPyramidBuilderInitPtr) (size_t width, size_t height, size_t levels, double scale, SimdReduceType reduce, SimdBool compensation);
+    const static SimdPyramidBuilderInitPtr simdPyramidBuilderInit = SIMD_FUNC4(PyramidBuilderInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    return simdPyramidBuilderInit(width, height, levels, scale, reduce, compensation);
+}
+
+SIMD_API void SimdPyramidBuilderLevelSize(const void* builder, size_t level, size_t* width, size_t* height)
+{
+    ((Base::PyramidBuilder*)builder)->LevelSize(level, width, height);
+}
+
+SIMD_API void SimdPyramidBuilderRun(const void* builder, const uint8_t* src, size_t srcStride, uint8_t* const* dst, const size_t* dstStride)
+{
+    SIMD_EMPTY();
+    ((Base::PyramidBuilder*)builder)->Run(src, srcStride, dst, dstStride);
+}
+
 SIMD_API void* SimdRecursiveBilateralFilterInit(size_t width, size_t height, size_t channels, 
     const float* sigmaSpatial, const float* sigmaRange, SimdRecursiveBilateralFilterFlags flags)
 {
@@ -3905,7 +4466,7 @@ SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t ds
     typedef void*(*SimdResizerInitPtr) (size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     const static SimdResizerInitPtr simdResizerInit = SIMD_FUNC4(ResizerInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
 
-    return simdResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+    return Base::ResizerParallelInit(simdResizerInit, srcX, srcY, dstX, dstY, channels, type, method);
 }
 
 SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
@@ -3914,6 +4475,21 @@ SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t s
     ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
 }
 
+SIMD_API void * SimdCropResizerInit(size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+{
+    SIMD_EMPTY();
+    typedef void*(*SimdResizerInitPtr) (size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+    const static SimdResizerInitPtr simdResizerInit = SIMD_FUNC4(ResizerInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return Base::CropResizerInit(simdResizerInit, dstX, dstY, channels, type, method);
+}
+
+SIMD_API void SimdCropResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, const size_t * rects, size_t count, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((Base::CropResizer*)resizer)->Run(src, srcStride, rects, count, dst, dstStride);
+}
+
 SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
 {
     SIMD_EMPTY();
@@ -4104,6 +4680,23 @@ SIMD_API void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride,
         Base::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
 }
 
+SIMD_API void* SimdSeparableFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType srcType, SimdPixelFormatType dstType,
+    const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize, SimdBorderType border, const float* borderValue)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdSeparableFilterInitPtr) (size_t width, size_t height, size_t channels, SimdPixelFormatType srcType, SimdPixelFormatType dstType,
+        const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize, SimdBorderType border, const float* borderValue);
+    const static SimdSeparableFilterInitPtr simdSeparableFilterInit = SIMD_FUNC3(SeparableFilterInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSeparableFilterInit(width, height, channels, srcType, dstType, rowKernel, rowSize, colKernel, colSize, border, borderValue);
+}
+
+SIMD_API void SimdSeparableFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((SeparableFilter*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
 SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
     const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY,
     size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride)
@@ -4444,6 +5037,27 @@ SIMD_API void SimdSquaredDifferenceKahanSum32f(const float * a, const float * b,
     simdSquaredDifferenceKahanSum32f(a, b, size, sum);
 }
 
+SIMD_API void* SimdTemplateMatchInit(size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdTemplateMatchInitPtr) (size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels);
+    const static SimdTemplateMatchInitPtr simdTemplateMatchInit = SIMD_FUNC3(TemplateMatchInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdTemplateMatchInit(srcWidth, srcHeight, tmpWidth, tmpHeight, type, levels);
+}
+
+SIMD_API void SimdTemplateMatchRun(const void* context, const uint8_t* src, size_t srcStride, const uint8_t* tmp, size_t tmpStride, float* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((TemplateMatch*)context)->Run(src, srcStride, tmp, tmpStride, dst, dstStride);
+}
+
+SIMD_API float SimdTemplateMatchSearch(const void* context, const uint8_t* src, size_t srcStride, const uint8_t* tmp, size_t tmpStride, size_t* x, size_t* y)
+{
+    SIMD_EMPTY();
+    return ((TemplateMatch*)context)->Search(src, srcStride, tmp, tmpStride, x, y);
+}
+
 SIMD_API void SimdGetStatistic(const uint8_t * src, size_t stride, size_t width, size_t height,
                   uint8_t * min, uint8_t * max, uint8_t * average)
 {
@@ -5830,6 +6444,43 @@ SIMD_API void SimdSynetPoolingMax8u(const uint8_t* src, size_t srcC, size_t srcH
 #endif
 }
 
+SIMD_API void* SimdSynetPreprocessInit(size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, SimdYuvType yuvType, size_t dstW, size_t dstH, size_t channels,
+    SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, uint8_t padding, const float* mean, const float* scale)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetPreprocessInitPtr) (size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, SimdYuvType yuvType, size_t dstW, size_t dstH, size_t channels,
+        SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, uint8_t padding, const float* mean, const float* scale);
+    const static SimdSynetPreprocessInitPtr simdSynetPreprocessInit = SIMD_FUNC3(SynetPreprocessInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSynetPreprocessInit(srcW, srcH, srcFormat, yuvType, dstW, dstH, channels, method, dstType, dstFormat, isRgb, letterbox, padding, mean, scale);
+#else
+    assert(0);
+    return NULL;
+#endif
+}
+
+SIMD_API size_t SimdSynetPreprocessInternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetPreprocess*)context)->InternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetPreprocessRun(void* context, const uint8_t* const* src, const size_t* srcStride, uint8_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetPreprocess*)context)->Run(src, srcStride, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
     SIMD_EMPTY();
@@ -6997,6 +7648,90 @@ SIMD_API void SimdYuv420pToUyvy422(const uint8_t* y, size_t yStride, const uint8
         Base::Yuv420pToUyvy422(y, yStride, u, uStride, v, vStride, width, height, uyvy, uyvyStride);
 }
 
+SIMD_API void SimdYuyv422ToBgr(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuyv422ToBgr(yuyv, yuyvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuyv422ToBgr(yuyv, yuyvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Yuyv422ToBgr(yuyv, yuyvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuyv422ToBgr(yuyv, yuyvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuyv422ToBgra(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuyv422ToBgra(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuyv422ToBgra(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Yuyv422ToBgra(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuyv422ToBgra(yuyv, yuyvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuyv422ToGray(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* gray, size_t grayStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuyv422ToGray(yuyv, yuyvStride, width, height, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuyv422ToGray(yuyv, yuyvStride, width, height, gray, grayStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Yuyv422ToGray(yuyv, yuyvStride, width, height, gray, grayStride);
+    else
+#endif
+        Base::Yuyv422ToGray(yuyv, yuyvStride, width, height, gray, grayStride);
+}
+
+SIMD_API void SimdYuyv422ToYuv420p(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* u, size_t uStride, uint8_t* v, size_t vStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuyv422ToYuv420p(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuyv422ToYuv420p(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Yuyv422ToYuv420p(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+    else
+#endif
+        Base::Yuyv422ToYuv420p(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+}
+
 
 
 
@@ -337,8 +337,21 @@ typedef enum
     SimdImageFilePng,
     /*! A JPEG (Joint Photographic Experts Group) image file format. */
     SimdImageFileJpeg,
+    /*! A QOI (Quite OK Image) lossless image file format. */
+    SimdImageFileQoi,
 } SimdImageFileType;
 
+/*! @ingroup lut3d_conversion
+    Describes type of interpolation of 3D LUT (look-up table). It is used in function ::SimdLut3dInit.
+*/
+typedef enum
+{
+    /*! Trilinear interpolation between 8 nearest nodes of 3D LUT. */
+    SimdLut3dInterpolationTrilinear = 0,
+    /*! Tetrahedral interpolation between 4 nodes of 3D LUT. It is faster than trilinear one and better preserves neutral colors. */
+    SimdLut3dInterpolationTetrahedral,
+} SimdLut3dInterpolationType;
+
 /*! @ingroup c_types
     Describes types of binary operation between two images performed by function ::SimdOperationBinary8u.
     Images must have the same format (unsigned 8-bit integer for every channel).
@@ -420,6 +433,8 @@ typedef enum
     SimdPixelFormatUyvy16,
     /*! A 32-bit (4 8-bit channels) ARGB (Alpha, Red, Green, Blue) pixel format. */
     SimdPixelFormatArgb32,
+    /*! A 16-bit (2 8-bit channels) YUYV422 pixel format. */
+    SimdPixelFormatYuyv16,
 } SimdPixelFormatType;
 
 /*! @ingroup recursive_bilateral_filter
@@ -447,6 +462,79 @@ enum SimdReduceType
     SimdReduce5x5, /*!< Using of function ::SimdReduceGray5x5 for image reducing. */
 };
 
+/*! @ingroup separable_filter
+    Describes types of border (out-of-image pixels) extrapolation. It is used in functions ::SimdBoxFilterInit, ::SimdMedianFilterInit and ::SimdSeparableFilterInit.
+*/
+typedef enum
+{
+    /*! Border pixels are equal to the nearest image pixel: aaaa|abcdefgh|hhhh. */
+    SimdBorderReplicate = 0,
+    /*! Border pixels are reflected including edge pixel: dcba|abcdefgh|hgfe. */
+    SimdBorderReflect,
+    /*! Border pixels are reflected excluding edge pixel: edcb|abcdefgh|gfed. */
+    SimdBorderMirror,
+    /*! Border pixels are equal to given constant value: vvvv|abcdefgh|vvvv. */
+    SimdBorderConstant,
+} SimdBorderType;
+
+/*! @ingroup distance_transform
+    Describes types of distance transform. It is used in function ::SimdDistanceTransformInit.
+*/
+typedef enum
+{
+    /*! Exact Euclidean distance (Felzenszwalb-Huttenlocher algorithm). */
+    SimdDistanceEuclidean = 0,
+    /*! Approximation of Euclidean distance with using of 3x3 chamfer mask (weights 3 and 4 divided by 3). */
+    SimdDistanceChamfer3x3,
+    /*! Approximation of Euclidean distance with using of 5x5 chamfer mask (weights 5, 7 and 11 divided by 5). */
+    SimdDistanceChamfer5x5,
+} SimdDistanceType;
+
+/*! @ingroup segmentation
+    Describes statistics of connected component. It is used in functions ::SimdConnectedComponentsRun and ::SimdConnectedComponentsStatistics.
+*/
+typedef struct SimdConnectedComponent
+{
+    uint32_t left; /*!< A left side of component bounding box (inclusive). */
+    uint32_t top; /*!< A top side of component bounding box (inclusive). */
+    uint32_t right; /*!< A right side of component bounding box (exclusive). */
+    uint32_t bottom; /*!< A bottom side of component bounding box (exclusive). */
+    uint64_t area; /*!< An area (number of points) of component. */
+    uint64_t x; /*!< A first-order moment x (sum of X over component points). */
+    uint64_t y; /*!< A first-order moment y (sum of Y over component points). */
+    uint64_t xx; /*!< A second-order moment xx (sum of X*X over component points). */
+    uint64_t xy; /*!< A second-order moment xy (sum of X*Y over component points). */
+    uint64_t yy; /*!< A second-order moment yy (sum of Y*Y over component points). */
+} SimdConnectedComponent;
+
+/*! @ingroup correlation
+    Describes types of template matching score. It is used in function ::SimdTemplateMatchInit.
+*/
+typedef enum
+{
+    /*! Sum of absolute differences between template and image window (the less the better). */
+    SimdTemplateMatchSad = 0,
+    /*! Sum of squared differences between template and image window (the less the better). */
+    SimdTemplateMatchSsd,
+    /*! Normalized cross-correlation (correlation coefficient in range [-1, 1]) between template and image window (the greater the better). */
+    SimdTemplateMatchNcc,
+} SimdTemplateMatchType;
+
+/*! @ingroup morphology
+    Describes types of morphological operation. It is used in function ::SimdMorphologyInit.
+*/
+typedef enum
+{
+    /*! Erosion: minimum over structuring element. */
+    SimdMorphologyErode = 0,
+    /*! Dilation: maximum over structuring element. */
+    SimdMorphologyDilate,
+    /*! Opening: erosion followed by dilation. */
+    SimdMorphologyOpen,
+    /*! Closing: dilation followed by erosion. */
+    SimdMorphologyClose,
+} SimdMorphologyType;
+
 /*! @ingroup resizing
     Describes resized image channel types.
 */
@@ -474,9 +562,9 @@ typedef enum
     SimdResizeMethodNearestPytorch,
     /*! Bilinear method. */
     SimdResizeMethodBilinear,
-    /*! Bilinear Caffe compatible method. It is relevant only for ::SimdResizeChannelFloat (32-bit float channel type).*/
+    /*! Bilinear Caffe compatible method. It is relevant only for ::SimdResizeChannelFloat (32-bit float channel type) and ::SimdResizeChannelBf16 (16-bit BFloat16 channel type).*/
     SimdResizeMethodBilinearCaffe,
-    /*! Bilinear Pytorch compatible method. It is relevant only for ::SimdResizeChannelFloat (32-bit float channel type).*/
+    /*! Bilinear Pytorch compatible method. It is relevant only for ::SimdResizeChannelFloat (32-bit float channel type) and ::SimdResizeChannelBf16 (16-bit BFloat16 channel type).*/
     SimdResizeMethodBilinearPytorch,
     /*! Bicubic method. */
     SimdResizeMethodBicubic,
@@ -484,6 +572,8 @@ typedef enum
     SimdResizeMethodArea,
     /*! Area method for previously reduced in 2 times image. */
     SimdResizeMethodAreaFast,
+    /*! Lanczos method (with window of size 3). It is relevant only for ::SimdResizeChannelByte (8-bit integer channel type) and ::SimdResizeChannelFloat (32-bit float channel type).*/
+    SimdResizeMethodLanczos,
 } SimdResizeMethodType;
 
 /*! @ingroup synet_types
@@ -587,6 +677,20 @@ typedef enum
     SimdTensorData16f, /*!< 16-bit floating point (Half Precision). */
 } SimdTensorDataType;
 
+/*! @ingroup synet_types
+    Describes pixel format of input image of <a href="http://github.com/ermig1979/Synet">Synet Framework</a> preprocessing. It is used in function ::SimdSynetPreprocessInit.
+*/
+typedef enum
+{
+    SimdSynetPreprocessGray8 = 0, /*!< A single 8-bit gray plane. */
+    SimdSynetPreprocessBgr24, /*!< A single plane of 24-bit BGR pixels. */
+    SimdSynetPreprocessBgra32, /*!< A single plane of 32-bit BGRA pixels. */
+    SimdSynetPreprocessRgb24, /*!< A single plane of 24-bit RGB pixels. */
+    SimdSynetPreprocessRgba32, /*!< A single plane of 32-bit RGBA pixels. */
+    SimdSynetPreprocessNv12, /*!< NV12: 8-bit Y plane and interleaved UV plane with half width and height. */
+    SimdSynetPreprocessYuv420p, /*!< I420: 8-bit Y, U and V planes, U and V planes have half width and height. */
+} SimdSynetPreprocessFormatType;
+
 /*! @ingroup transform
     Describes transform type used in function ::SimdTransformImage in order to describe result of transformation.
 */
@@ -1713,6 +1817,72 @@ extern "C"
     */
     SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup bayer_conversion
+
+        \fn void SimdBayerToBgrMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgr, size_t bgrStride);
+
+        \short Converts 8-bit Bayer image to 24-bit BGR with using of Malvar-He-Cutler demosaicing.
+
+        In contrast to ::SimdBayerToBgr it uses gradient-corrected linear interpolation (Malvar-He-Cutler 5x5 filters).
+        It is slower, but much better preserves edges and has no zipper artifacts. Image borders are mirrored.
+        All images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::BayerToBgrMhc(const View<A>& bayer, View<A>& bgr).
+
+        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
+        \param [in] width - an image width. It must be even and not less than 4.
+        \param [in] height - an image height. It must be even and not less than 4.
+        \param [in] bayerStride - a row size of the bayer image.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdBayerToBgrMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgr, size_t bgrStride);
+
+    /*! @ingroup bayer_conversion
+
+        \fn void SimdBayerToBgraMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgra, size_t bgraStride, uint8_t alpha);
+
+        \short Converts 8-bit Bayer image to 32-bit BGRA with using of Malvar-He-Cutler demosaicing.
+
+        In contrast to ::SimdBayerToBgra it uses gradient-corrected linear interpolation (Malvar-He-Cutler 5x5 filters).
+        It is slower, but much better preserves edges and has no zipper artifacts. Image borders are mirrored.
+        All images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::BayerToBgraMhc(const View<A>& bayer, View<A>& bgra, uint8_t alpha).
+
+        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
+        \param [in] width - an image width. It must be even and not less than 4.
+        \param [in] height - an image height. It must be even and not less than 4.
+        \param [in] bayerStride - a row size of the bayer image.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+    */
+    SIMD_API void SimdBayerToBgraMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgra, size_t bgraStride, uint8_t alpha);
+
+    /*! @ingroup bayer_conversion
+
+        \fn void SimdBayerToGrayMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* gray, size_t grayStride);
+
+        \short Converts 8-bit Bayer image to 8-bit gray with using of Malvar-He-Cutler demosaicing.
+
+        It is equal to consecutive calls of ::SimdBayerToBgrMhc and ::SimdBgrToGray but does not need intermediate BGR image.
+        All images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::BayerToGrayMhc(const View<A>& bayer, View<A>& gray).
+
+        \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
+        \param [in] width - an image width. It must be even and not less than 4.
+        \param [in] height - an image height. It must be even and not less than 4.
+        \param [in] bayerStride - a row size of the bayer image.
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [out] gray - a pointer to pixels data of output 8-bit gray image.
+        \param [in] grayStride - a row size of the gray image.
+    */
+    SIMD_API void SimdBayerToGrayMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* gray, size_t grayStride);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
@@ -1812,6 +1982,29 @@ extern "C"
     */
     SIMD_API void SimdBgraToRgba(const uint8_t* bgra, size_t width, size_t height, size_t bgraStride, uint8_t* rgba, size_t rgbaStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToNv12V2(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to NV12.
+
+        The input BGRA and output Y images must have the same width and height.
+        The output UV image (with interleaved U and V color planes) must have half size relative to Y component.
+
+        \note This function has a C++ wrapper Simd::BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] yuvType - a type of output YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdBgraToNv12V2(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
@@ -2058,6 +2251,29 @@ extern "C"
     SIMD_API void SimdBgrToRgb(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgb, size_t rgbStride);
 
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToNv12V2(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to NV12.
+
+        The input BGR and output Y images must have the same width and height.
+        The output UV image (with interleaved U and V color planes) must have half size relative to Y component.
+
+        \note This function has a C++ wrapper Simd::BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] yuvType - a type of output YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdBgrToNv12V2(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType);
+
     /*! @ingroup bgr_conversion
 
         \fn void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t bgrStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
@@ -2249,6 +2465,94 @@ extern "C"
     SIMD_API void SimdAveragingBinarizationV2(const uint8_t* src, size_t srcStride, size_t width, size_t height,
         size_t neighborhood, int32_t shift, uint8_t positive, uint8_t negative, uint8_t* dst, size_t dstStride);
 
+    /*! @ingroup box_filter
+
+        \fn void * SimdBoxFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type, size_t radiusX, size_t radiusY, SimdBorderType border, const float * borderValue);
+
+        \short Creates context of box (mean) image filter of arbitrary size.
+
+        For every point:
+        \verbatim
+        dst[x, y, c] = Round(sum(src[x + i, y + j, c], i = -radiusX..radiusX, j = -radiusY..radiusY) / ((2*radiusX + 1)*(2*radiusY + 1)));
+        \endverbatim
+        where out-of-image points of source image are extrapolated in accordance with border type.
+        The rounding is performed only for 8-bit output.
+        The filter uses running sums, so its computational cost does not depend on the filter size.
+        Column sums are updated by vector instructions, image rows are processed in parallel by several threads (see ::SimdSetThreadNumber).
+
+        \note For 32-bit float images running sums are accumulated in 32-bit float, so there is a small accumulated rounding error.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] type - a type of image channel. It can be ::SimdPixelFormatGray8 (8-bit unsigned integer) or ::SimdPixelFormatFloat (32-bit float).
+        \param [in] radiusX - a horizontal radius of the filter window. The window width is equal to 2*radiusX + 1.
+        \param [in] radiusY - a vertical radius of the filter window. The window height is equal to 2*radiusY + 1.
+        \param [in] border - a type of border extrapolation.
+        \param [in] borderValue - a pointer to border value. It is used only for ::SimdBorderConstant. It can be NULL (0 is used by default).
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdBoxFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdBoxFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type,
+        size_t radiusX, size_t radiusY, SimdBorderType border, const float * borderValue);
+
+    /*! @ingroup box_filter
+
+        \fn void SimdBoxFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs box (mean) image filtration.
+
+        \param [in] filter - a filter context. It must be created by function ::SimdBoxFilterInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the filtered output image. It must not be the same as input image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdBoxFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup canny_filter
+
+        \fn void * SimdCannyInit(size_t width, size_t height, float low, float high, SimdBool l2);
+
+        \short Creates context of Canny edge detector for 8-bit gray image.
+
+        The detector performs following steps:
+        - calculation of image gradient with using of 3x3 Sobel kernels (out-of-image points are replicated from the nearest image point);
+        - calculation of gradient magnitude (L1: |dx| + |dy|, or L2: sqrt(dx*dx + dy*dy)) and quantization of gradient direction to 4 sectors (0, 45, 90 and 135 degrees);
+        - non-maximum suppression along gradient direction;
+        - hysteresis thresholding: points with magnitude greater than high threshold are edges, points with magnitude greater than low threshold are edges if they are connected (8-connectivity) with another edge point.
+
+        Gradient, magnitude, direction quantization and non-maximum suppression are fused and performed by vector instructions row by row.
+        Hysteresis uses an explicit stack of strong edge points, so every point is visited only once.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] low - a low threshold of gradient magnitude. It must be non-negative.
+        \param [in] high - a high threshold of gradient magnitude. It must not be less than low threshold.
+        \param [in] l2 - a flag to use L2 norm of gradient magnitude instead of L1 norm.
+        \return a pointer to Canny context. On error it returns NULL.
+                This pointer is used in functions ::SimdCannyRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdCannyInit(size_t width, size_t height, float low, float high, SimdBool l2);
+
+    /*! @ingroup canny_filter
+
+        \fn void SimdCannyRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs Canny edge detection.
+
+        Output image contains 255 for edge points and 0 for all other points.
+
+        \param [in] context - a Canny context. It must be created by function ::SimdCannyInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the 8-bit gray input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the 8-bit gray output edge image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdCannyRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup conditional
 
         \fn void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t value, SimdCompareType compareType, uint32_t * count);
@@ -2425,6 +2729,56 @@ extern "C"
     SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         uint8_t threshold, SimdCompareType compareType, uint8_t value, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup segmentation
+
+        \fn void * SimdConnectedComponentsInit(size_t width, size_t height, size_t connectivity);
+
+        \short Creates context of connected component labeling for 8-bit binary mask.
+
+        All non-zero points of the mask belong to foreground. Foreground points are grouped in connected components (with 4- or 8-connectivity).
+        The labeling is based on runs of foreground points: runs are extracted from every row with using of vector instructions 
+        and are merged with overlapping runs of previous row by union-find algorithm. 
+        The image is processed by horizontal strips in parallel threads, the strips are merged at their borders.
+        Components are numbered from 1 in order of their first point (in raster scan order), so result does not depend on number of threads.
+        Area, bounding box and moments of every component are calculated during the same processing.
+
+        \param [in] width - a width of the mask and output label image.
+        \param [in] height - a height of the mask and output label image.
+        \param [in] connectivity - a connectivity of components. It can be 4 or 8.
+        \return a pointer to connected components context. On error it returns NULL.
+                This pointer is used in functions ::SimdConnectedComponentsRun and ::SimdConnectedComponentsStatistics.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdConnectedComponentsInit(size_t width, size_t height, size_t connectivity);
+
+    /*! @ingroup segmentation
+
+        \fn size_t SimdConnectedComponentsRun(const void * context, const uint8_t * mask, size_t maskStride, uint32_t * labels, size_t labelsStride);
+
+        \short Performs connected component labeling of 8-bit binary mask.
+
+        \param [in] context - a connected components context. It must be created by function ::SimdConnectedComponentsInit and released by function ::SimdRelease.
+        \param [in] mask - a pointer to pixels data of the input 8-bit mask.
+        \param [in] maskStride - a row size (in bytes) of the input mask.
+        \param [out] labels - a pointer to 32-bit unsigned integer output label image. Background points have zero label, 
+                    points of i-th component have label i (1 <= i <= number of components). It can be NULL (then only statistics are calculated).
+        \param [in] labelsStride - a row size (in bytes) of the output label image.
+        \return number of found connected components. Their statistics can be obtained with using of function ::SimdConnectedComponentsStatistics.
+    */
+    SIMD_API size_t SimdConnectedComponentsRun(const void * context, const uint8_t * mask, size_t maskStride, uint32_t * labels, size_t labelsStride);
+
+    /*! @ingroup segmentation
+
+        \fn const SimdConnectedComponent * SimdConnectedComponentsStatistics(const void * context);
+
+        \short Gets statistics of connected components found by last call of function ::SimdConnectedComponentsRun.
+
+        \param [in] context - a connected components context. It must be created by function ::SimdConnectedComponentsInit and released by function ::SimdRelease.
+        \return a pointer to array of component statistics (i-th element describes component with label i + 1). 
+                It is valid until next call of function ::SimdConnectedComponentsRun. It is NULL if there are no components.
+    */
+    SIMD_API const SimdConnectedComponent * SimdConnectedComponentsStatistics(const void * context);
+
     /*! @ingroup copying
 
         \fn void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride);
@@ -2935,6 +3289,47 @@ extern "C"
     SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
         ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup distance_transform
+
+        \fn void * SimdDistanceTransformInit(size_t width, size_t height, SimdDistanceType type, SimdPixelFormatType format);
+
+        \short Creates context of distance transform for 8-bit gray mask.
+
+        For every point of the mask the transform calculates distance to the nearest zero point of the mask (zero points have zero distance).
+        Out-of-image points are ignored. If there are no zero points in the mask then output image is filled by maximal value (FLT_MAX or 65535).
+
+        Exact Euclidean distance (::SimdDistanceEuclidean) is calculated with using of Felzenszwalb-Huttenlocher algorithm: 
+        vertical distances are found by two column scans (vector instructions, column blocks are processed in parallel threads), 
+        then every row (rows are processed in parallel threads) is processed with using of lower envelope of parabolas (integer arithmetic, so the result is exact).
+
+        Chamfer distances (::SimdDistanceChamfer3x3, ::SimdDistanceChamfer5x5) are calculated by forward and backward raster scans 
+        (contributions of neighboring rows are calculated with using of vector instructions). 
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] type - a type of distance transform.
+        \param [in] format - a format of output distance image. It can be ::SimdPixelFormatFloat (32-bit float) or 
+                   ::SimdPixelFormatInt16 (16-bit unsigned integer, distance is rounded and saturated to 65535).
+        \return a pointer to distance transform context. On error it returns NULL.
+                This pointer is used in functions ::SimdDistanceTransformRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdDistanceTransformInit(size_t width, size_t height, SimdDistanceType type, SimdPixelFormatType format);
+
+    /*! @ingroup distance_transform
+
+        \fn void SimdDistanceTransformRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs distance transform for 8-bit gray mask.
+
+        \param [in] context - a distance transform context. It must be created by function ::SimdDistanceTransformInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input 8-bit gray mask.
+        \param [in] srcStride - a row size (in bytes) of the input mask.
+        \param [out] dst - a pointer to pixels data of the output distance image (32-bit float or 16-bit unsigned integer).
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdDistanceTransformRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup filling
 
         \fn void SimdFill(uint8_t * dst, size_t stride, size_t width, size_t height, size_t pixelSize, uint8_t value);
@@ -3346,7 +3741,7 @@ extern "C"
         dst[dx, dy] = sum;
         \endverbatim
 
-        \param [in] filter - a filter context. It must be created by function ::SimdGaussianBlurInit and released by function ::SimdRelease.
+        \param [in] filter - a filter context. It must be created by function ::SimdGaussianBlurInit (or ::SimdGaussianBlurIirInit) and released by function ::SimdRelease.
         \param [in] src - a pointer to pixels data of the original input image.
         \param [in] srcStride - a row size (in bytes) of the input image.
         \param [out] dst - a pointer to pixels data of the filtered output image.
@@ -3354,6 +3749,43 @@ extern "C"
     */
     SIMD_API void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
 
+    /*! @ingroup gaussian_filter
+
+        \fn void * SimdGaussianBlurIirInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type, const float * sigma);
+
+        \short Creates recursive (IIR) Gaussian blur filter context.
+
+        Unlike ::SimdGaussianBlurInit the filter has per-pixel cost independent of sigma, so it is intended for large blur radius.
+        It uses third-order recursive approximation of Gaussian (Young - van Vliet) applied forward and backward along rows and then along columns:
+        \verbatim
+        q = sigma >= 2.5 ? 0.98711*sigma - 0.96330 : 3.97156 - 4.14554*sqrt(1 - 0.26891*sigma);
+        b0 = 1.57825 + 2.44413*q + 1.42810*q^2 + 0.422205*q^3;
+        a1 = (2.44413*q + 2.85619*q^2 + 1.26661*q^3)/b0;
+        a2 = -(1.42810*q^2 + 1.26661*q^3)/b0;
+        a3 = 0.422205*q^3/b0;
+        b = 1 - (a1 + a2 + a3);
+
+        w[n] = b*x[n] + a1*w[n - 1] + a2*w[n - 2] + a3*w[n - 3];
+        y[n] = b*w[n] + a1*y[n + 1] + a2*y[n + 2] + a3*y[n + 3];
+        \endverbatim
+        Out-of-image points are replicated from the nearest image point (initial state of backward pass is calculated in accordance with Triggs - Sdika method).
+        Accuracy of approximation is lower than accuracy of ::SimdGaussianBlurInit for small sigma.
+        Rows are processed in groups with using of vector instructions, columns are processed in vertical stripes.
+        Image is processed in multiple threads.
+        Optimized implementations keep the order of operations of the base one, but their results are not bit-identical to it:
+        they can differ within float rounding errors (for example, because of fused multiply-add) and by 1 for 8-bit output.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] type - a type of image channels. It can be ::SimdPixelFormatGray8 (8-bit unsigned integer) or ::SimdPixelFormatFloat (32-bit float).
+        \param [in] sigma - a pointer to sigma parameter (blur radius). Its value must be not less than 0.5.
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdGaussianBlurRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdGaussianBlurIirInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type, const float * sigma);
+
     /*! @ingroup matrix
 
         \fn void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
@@ -3838,6 +4270,55 @@ extern "C"
     */
     SIMD_API uint8_t* SimdImageLoadFromFile(const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
 
+    /*! @ingroup image_io
+
+        \fn void* SimdImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+        \short Maps a binary PGM (P5) or PPM (P6) image file into memory.
+
+        The file is mapped (with using of mmap or its analog) and is not copied. 
+        Pixels of the image can be accessed with using of functions ::SimdImageMapData and ::SimdImageMapRows.
+
+        \param [in] path - a path to input image file.
+        \param [out] width - a pointer to width of the image.
+        \param [out] height - a pointer to height of the image.
+        \param [in, out] format - a pointer to pixel format of output image.
+            Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
+            Or set ::SimdPixelFormatNone and use pixel format of input image file (::SimdPixelFormatGray8 for PGM and ::SimdPixelFormatRgb24 for PPM).
+        \return a pointer to image map context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+    /*! @ingroup image_io
+
+        \fn const uint8_t* SimdImageMapData(const void* context, size_t* stride);
+
+        \short Gets a pointer to pixels of mapped image file without copying.
+
+        It works only if output pixel format is equal to pixel format of image file (::SimdPixelFormatGray8 for PGM and ::SimdPixelFormatRgb24 for PPM).
+        Returned pixels are valid until the context is released.
+
+        \param [in] context - an image map context. It must be created by function ::SimdImageMapFromFile.
+        \param [out] stride - a pointer to row size of the image in bytes.
+        \return a pointer to read-only pixels data of the image. It returns NULL if output pixel format requires conversion.
+    */
+    SIMD_API const uint8_t* SimdImageMapData(const void* context, size_t* stride);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageMapRows(const void* context, size_t row, size_t count, uint8_t* dst, size_t dstStride);
+
+        \short Copies (and converts to output pixel format) given rows of mapped image file.
+
+        \param [in] context - an image map context. It must be created by function ::SimdImageMapFromFile.
+        \param [in] row - an index of the first row to copy.
+        \param [in] count - a number of rows to copy.
+        \param [out] dst - a pointer to pixels data of output image (rows buffer). It must have width and pixel format returned by function ::SimdImageMapFromFile.
+        \param [in] dstStride - a row size of output image.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdImageMapRows(const void* context, size_t row, size_t count, uint8_t* dst, size_t dstStride);
+
     /*! @ingroup other_conversion
 
         \fn void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
@@ -4064,6 +4545,49 @@ extern "C"
     */
     SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup lut3d_conversion
+
+        \fn void* SimdLut3dInit(size_t size, const float* table, SimdLut3dInterpolationType interpolation);
+
+        \short Creates context of color transformation with using of 3D LUT (look-up table).
+
+        The table has layout of Adobe .cube files: it contains size*size*size RGB nodes (3 float values in range [0, 1]).
+        Red index changes fastest, then green index, then blue index:
+        \verbatim
+        node(r, g, b) = table + ((b * size + g) * size + r) * 3;
+        \endverbatim
+        The table is converted to internal fixed-point format, so it can be released after this call.
+
+        \param [in] size - a size of 3D LUT along every dimension. It must be in range [2, 256] (typical values are 17, 33 and 65).
+        \param [in] table - a pointer to 3D LUT nodes.
+        \param [in] interpolation - a type of interpolation between nodes of 3D LUT.
+        \return a pointer to 3D LUT context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in function ::SimdLut3dRun.
+    */
+    SIMD_API void* SimdLut3dInit(size_t size, const float* table, SimdLut3dInterpolationType interpolation);
+
+    /*! @ingroup lut3d_conversion
+
+        \fn void SimdLut3dRun(const void* context, const uint8_t* src, size_t srcStride, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t dstStride);
+
+        \short Performs color transformation of image with using of 3D LUT.
+
+        Input and output images must have the same width, height and format. Alpha channel (if it exists) is copied without changes.
+        Transformation can be performed in place (src == dst).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] context - a 3D LUT context. It must be created by function ::SimdLut3dInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of input image.
+        \param [in] srcStride - a row size of input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] format - a pixel format of input and output images. It can be ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24 or ::SimdPixelFormatRgba32.
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] dstStride - a row size of output image.
+    */
+    SIMD_API void SimdLut3dRun(const void* context, const uint8_t* src, size_t srcStride, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t dstStride);
+
     /*! @ingroup other_filter
 
         \fn void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
@@ -4092,6 +4616,45 @@ extern "C"
     SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         size_t channelCount, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup median_filter
+
+        \fn void * SimdMedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, const uint8_t * borderValue);
+
+        \short Creates context of median filter with square window of arbitrary size.
+
+        The filter window is a square (2*radius + 1)x(2*radius + 1). Out-of-image points of source image are extrapolated in accordance with border type.
+        The filter uses constant-time algorithm (S. Perreault, P. Hebert, "Median Filtering in Constant Time"): 
+        it keeps histogram of every image column and updates histogram of filter window by adding and subtracting of column histograms.
+        So its computational cost does not depend on the filter size. Unlike the lazy scheme of the paper (where fine bins are updated only on demand),
+        all 256 fine and 16 coarse bins of window histogram are updated at every step with using of vector instructions. Image rows are processed in parallel by several threads (see ::SimdSetThreadNumber).
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output 8-bit image. Its value must be in range [1..4].
+        \param [in] radius - a radius of filter window. It must be less than 128.
+        \param [in] border - a type of border extrapolation.
+        \param [in] borderValue - a pointer to the array with border value for every channel. The size of the array must be equal to channels.
+                    It is used only for ::SimdBorderConstant. It can be NULL (0 is used by default).
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdMedianFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdMedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, const uint8_t * borderValue);
+
+    /*! @ingroup median_filter
+
+        \fn void SimdMedianFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs median filtration of 8-bit image with square window of arbitrary size.
+
+        \param [in] filter - a filter context. It must be created by function ::SimdMedianFilterInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the filtered output image. It must not be the same as input image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdMedianFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup median_filter
 
         \fn void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
@@ -4176,6 +4739,42 @@ extern "C"
     SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         size_t channelCount, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup morphology
+
+        \fn void * SimdMorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+
+        \short Creates context of morphological operation (erosion, dilation, opening or closing) for 8-bit gray image.
+
+        The structuring element is a rectangle kernelX x kernelY with anchor (kernelX/2, kernelY/2).
+        Out-of-image points are ignored (they do not affect the result). 
+        The operation uses van Herk/Gil-Werman algorithm: separable row and column passes with block prefix and suffix minimums (maximums),
+        so its computational cost does not depend on the size of structuring element.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] type - a type of morphological operation.
+        \param [in] kernelX - a width of structuring element. It must be greater than 0.
+        \param [in] kernelY - a height of structuring element. It must be greater than 0.
+        \return a pointer to morphology context. On error it returns NULL.
+                This pointer is used in functions ::SimdMorphologyRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdMorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+
+    /*! @ingroup morphology
+
+        \fn void SimdMorphologyRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs morphological operation for 8-bit gray image.
+
+        \param [in] context - a morphology context. It must be created by function ::SimdMorphologyInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input 8-bit gray image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output 8-bit gray image. It must not be the same as input image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdMorphologyRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup neural
 
         \fn void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
@@ -4683,57 +5282,380 @@ extern "C"
     */
     SIMD_API void SimdNeuralPooling2x2Max2x2(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
 
-    /*! @ingroup neural
+    /*! @ingroup neural
+
+        \fn void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+
+        \short Reduces input 32-bit float image in two times (takes maximum value in 3x3 window and copies to the output image).
+
+        \note This function is used in Simd::Neural.
+
+        \param [in] src - a pointer to the input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in 32-float values).
+        \param [in] width - a width of the input image (output image width must have size width/2).
+        \param [in] height - a height of the input image (output image height must have size height/2).
+        \param [in, out] dst - a pointer to the output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in 32-float values).
+    */
+    SIMD_API void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+
+    /*! @ingroup neural
+
+        \fn void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
+
+        \short Adds convolution of the input multichannel 32-bit float image to the output multichannel 32-bit float image.
+
+        \note There is a restriction to the size of output image:
+        \verbatim
+        dstWidth = (srcWidth + 2 * padX - (dilationX * (kernelX - 1) + 1)) / strideX + 1.
+        dstHeight = (srcHeight + 2 * padY - (dilationY * (kernelY - 1) + 1)) / strideY + 1.
+        \endverbatim
+
+        \param [in] src - a pointer to the input multichannel 32-bit float image. Total size of the input image is equal to srcWidth*srcHeight*srcDepth.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcDepth - a number of channels in the input image.
+        \param [in] weight - a pointer to the convolution weights. Total size of the weights is equal to `kernelX*kernelY*srcDepth*dstDepth`.
+        \param [in] kernelX - a width of the convolution kernel.
+        \param [in] kernelY - a height of the convolution kernel.
+        \param [in] padX - a pad to the x-coordinate of the input image.
+        \param [in] padY - a pad to the y-coordinate of the input image.
+        \param [in] strideX - a x-stride of the convolution.
+        \param [in] strideY - a y-stride of the convolution.
+        \param [in] dilationX - a x-stride of the convolution.
+        \param [in] dilationY - a y-stride of the convolution.
+        \param [in, out] buffer - a pointer to the external temporal buffer used by the algorithm. Can be NULL (the algorithm uses internal buffer).
+        \param [in, out] size - a pointer to the size of the external temporal buffer. If the size is too small it will contain required value. Required size is approximately equal to `dstWidth*dstHeight*srcDepth*kernelX*kernelY*sizeof(float)`. Can be NULL.
+        \param [in, out] dst - a pointer to the output multichannel 32-bit float image. Total size of the output image is equal to `dstWidth*dstHeight*dstDepth`.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstDepth - a number of channels in the output image.
+        \param [in] add - a flag which signalizes that we want add or assign value of convolution to the output image.
+    */
+    SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        NV12 is a semi-planar YUV 4:2:0 format: a full resolution Y plane is followed by a half resolution plane with interleaved U and V samples.
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half size relative to Y component (its row contains width/2 UV pairs).
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        NV12 is a semi-planar YUV 4:2:0 format: a full resolution Y plane is followed by a half resolution plane with interleaved U and V samples.
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half size relative to Y component (its row contains width/2 UV pairs).
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        NV12 is a semi-planar YUV 4:2:0 format: a full resolution Y plane is followed by a half resolution plane with interleaved U and V samples.
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half size relative to Y component (its row contains width/2 UV pairs).
+
+        \note This function has a C++ wrappers: Simd::Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 24-bit BGR image.
+
+        NV21 is a semi-planar YUV 4:2:0 format: a full resolution Y plane is followed by a half resolution plane with interleaved V and U samples.
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half size relative to Y component (its row contains width/2 VU pairs).
+
+        \note This function has a C++ wrappers: Simd::Nv21ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved V and U color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 32-bit BGRA image.
+
+        NV21 is a semi-planar YUV 4:2:0 format: a full resolution Y plane is followed by a half resolution plane with interleaved V and U samples.
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half size relative to Y component (its row contains width/2 VU pairs).
+
+        \note This function has a C++ wrappers: Simd::Nv21ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved V and U color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 24-bit RGB image.
+
+        NV21 is a semi-planar YUV 4:2:0 format: a full resolution Y plane is followed by a half resolution plane with interleaved V and U samples.
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half size relative to Y component (its row contains width/2 VU pairs).
+
+        \note This function has a C++ wrappers: Simd::Nv21ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601);
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved V and U color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p10ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts 10-bit yuv420p10 image to 24-bit BGR image.
+
+        yuv420p10 is a planar YUV 4:2:0 format with 16-bit little-endian samples which hold 10-bit values in low bits (higher bits are ignored).
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have half size relative to Y component.
+
+        \note This function has a C++ wrappers: Simd::Yuv420p10ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image (in bytes).
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image (in bytes).
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image (in bytes).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420p10ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p10ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts 10-bit yuv420p10 image to 32-bit BGRA image.
+
+        yuv420p10 is a planar YUV 4:2:0 format with 16-bit little-endian samples which hold 10-bit values in low bits (higher bits are ignored).
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have half size relative to Y component.
+
+        \note This function has a C++ wrappers: Simd::Yuv420p10ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image (in bytes).
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image (in bytes).
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image (in bytes).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420p10ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p10ToBgr48pV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * blue, size_t blueStride, uint8_t * green, size_t greenStride, uint8_t * red, size_t redStride, SimdYuvType yuvType);
+
+        \short Converts 10-bit yuv420p10 image to 48-bit planar BGR image.
+
+        yuv420p10 is a planar YUV 4:2:0 format with 16-bit little-endian samples which hold 10-bit values in low bits (higher bits are ignored).
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have half size relative to Y component.
+        Output color values are scaled to full 16-bit range [0..65535] and stored with the most significant byte first (as in ::SimdBgr48pToBgra32).
+
+        \note This function has a C++ wrappers: Simd::Yuv420p10ToBgr48p(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image (in bytes).
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image (in bytes).
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image (in bytes).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] blue - a pointer to pixels data of output 16-bit image with blue color plane.
+        \param [in] blueStride - a row size of the blue image (in bytes).
+        \param [out] green - a pointer to pixels data of output 16-bit image with green color plane.
+        \param [in] greenStride - a row size of the green image (in bytes).
+        \param [out] red - a pointer to pixels data of output 16-bit image with red color plane.
+        \param [in] redStride - a row size of the red image (in bytes).
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420p10ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, uint8_t* blue, size_t blueStride, uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdP010ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts 10-bit P010 image to 24-bit BGR image.
+
+        P010 is a semi-planar YUV 4:2:0 format with 16-bit samples which hold 10-bit values in high bits (lower 6 bits are ignored):
+        a full resolution Y plane is followed by a half resolution plane with interleaved U and V samples.
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half size relative to Y component (its row contains width/2 UV pairs).
+
+        \note This function has a C++ wrappers: Simd::P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image (in bytes).
+        \param [in] uv - a pointer to pixels data of input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [in] uvStride - a row size of the uv image (in bytes).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdP010ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdP010ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
-        \fn void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+        \short Converts 10-bit P010 image to 32-bit BGRA image.
 
-        \short Reduces input 32-bit float image in two times (takes maximum value in 3x3 window and copies to the output image).
+        P010 is a semi-planar YUV 4:2:0 format with 16-bit samples which hold 10-bit values in high bits (lower 6 bits are ignored):
+        a full resolution Y plane is followed by a half resolution plane with interleaved U and V samples.
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half size relative to Y component (its row contains width/2 UV pairs).
 
-        \note This function is used in Simd::Neural.
+        \note This function has a C++ wrappers: Simd::P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
 
-        \param [in] src - a pointer to the input 32-bit float image.
-        \param [in] srcStride - a row size of the input image (in 32-float values).
-        \param [in] width - a width of the input image (output image width must have size width/2).
-        \param [in] height - a height of the input image (output image height must have size height/2).
-        \param [in, out] dst - a pointer to the output 32-bit float image.
-        \param [in] dstStride - a row size of the output image (in 32-float values).
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image (in bytes).
+        \param [in] uv - a pointer to pixels data of input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [in] uvStride - a row size of the uv image (in bytes).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
     */
-    SIMD_API void SimdNeuralPooling2x2Max3x3(const float * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride);
+    SIMD_API void SimdP010ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
-    /*! @ingroup neural
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
+        \fn void SimdP010ToBgr48pV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * blue, size_t blueStride, uint8_t * green, size_t greenStride, uint8_t * red, size_t redStride, SimdYuvType yuvType);
 
-        \short Adds convolution of the input multichannel 32-bit float image to the output multichannel 32-bit float image.
+        \short Converts 10-bit P010 image to 48-bit planar BGR image.
 
-        \note There is a restriction to the size of output image:
-        \verbatim
-        dstWidth = (srcWidth + 2 * padX - (dilationX * (kernelX - 1) + 1)) / strideX + 1.
-        dstHeight = (srcHeight + 2 * padY - (dilationY * (kernelY - 1) + 1)) / strideY + 1.
-        \endverbatim
+        P010 is a semi-planar YUV 4:2:0 format with 16-bit samples which hold 10-bit values in high bits (lower 6 bits are ignored):
+        a full resolution Y plane is followed by a half resolution plane with interleaved U and V samples.
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half size relative to Y component (its row contains width/2 UV pairs).
+        Output color values are scaled to full 16-bit range [0..65535] and stored with the most significant byte first (as in ::SimdBgr48pToBgra32).
 
-        \param [in] src - a pointer to the input multichannel 32-bit float image. Total size of the input image is equal to srcWidth*srcHeight*srcDepth.
-        \param [in] srcWidth - a width of the input image.
-        \param [in] srcHeight - a height of the input image.
-        \param [in] srcDepth - a number of channels in the input image.
-        \param [in] weight - a pointer to the convolution weights. Total size of the weights is equal to `kernelX*kernelY*srcDepth*dstDepth`.
-        \param [in] kernelX - a width of the convolution kernel.
-        \param [in] kernelY - a height of the convolution kernel.
-        \param [in] padX - a pad to the x-coordinate of the input image.
-        \param [in] padY - a pad to the y-coordinate of the input image.
-        \param [in] strideX - a x-stride of the convolution.
-        \param [in] strideY - a y-stride of the convolution.
-        \param [in] dilationX - a x-stride of the convolution.
-        \param [in] dilationY - a y-stride of the convolution.
-        \param [in, out] buffer - a pointer to the external temporal buffer used by the algorithm. Can be NULL (the algorithm uses internal buffer).
-        \param [in, out] size - a pointer to the size of the external temporal buffer. If the size is too small it will contain required value. Required size is approximately equal to `dstWidth*dstHeight*srcDepth*kernelX*kernelY*sizeof(float)`. Can be NULL.
-        \param [in, out] dst - a pointer to the output multichannel 32-bit float image. Total size of the output image is equal to `dstWidth*dstHeight*dstDepth`.
-        \param [in] dstWidth - a width of the output image.
-        \param [in] dstHeight - a height of the output image.
-        \param [in] dstDepth - a number of channels in the output image.
-        \param [in] add - a flag which signalizes that we want add or assign value of convolution to the output image.
+        \note This function has a C++ wrappers: Simd::P010ToBgr48p(const View<A>& y, const View<A>& uv, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image (in bytes).
+        \param [in] uv - a pointer to pixels data of input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [in] uvStride - a row size of the uv image (in bytes).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] blue - a pointer to pixels data of output 16-bit image with blue color plane.
+        \param [in] blueStride - a row size of the blue image (in bytes).
+        \param [out] green - a pointer to pixels data of output 16-bit image with green color plane.
+        \param [in] greenStride - a row size of the green image (in bytes).
+        \param [out] red - a pointer to pixels data of output 16-bit image with red color plane.
+        \param [in] redStride - a row size of the red image (in bytes).
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
     */
-    SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
+    SIMD_API void SimdP010ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+        size_t width, size_t height, uint8_t* blue, size_t blueStride, uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride, SimdYuvType yuvType);
 
     /*! @ingroup operation
 
@@ -4782,6 +5704,60 @@ extern "C"
     SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
         size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type);
 
+    /*! @ingroup optical_flow
+
+        \fn void * SimdOpticalFlowLkInit(size_t width, size_t height, size_t window, size_t levels, size_t iterations, float epsilon);
+
+        \short Creates context of pyramidal Lucas-Kanade sparse optical flow tracker for 8-bit gray images.
+
+        Both images are reduced to Gaussian pyramids (see ::SimdReduceGray5x5) with using of ::SimdPyramidBuilderInit. 
+        Image gradients of previous image are estimated with Scharr operator at every pyramid level. 
+        Every point is tracked from the top pyramid level to the base one: the window around the point is bilinear sampled with fixed-point weights 
+        and the displacement is refined iteratively by solving of 2x2 linear system. 
+        Points are processed in parallel threads. The result does not depend on number of threads and used instruction set.
+
+        Typical use case:
+        \verbatim
+        void * tracker = SimdOpticalFlowLkInit(width, height, 21, 3, 30, 0.01f);
+        if (tracker)
+        {
+             SimdOpticalFlowLkRun(tracker, prev, prevStride, next, nextStride, prevPoints, count, nextPoints, status);
+             SimdRelease(tracker);
+        }
+        \endverbatim
+
+        \param [in] width - a width of the images.
+        \param [in] height - a height of the images.
+        \param [in] window - a size of search window at every pyramid level. It must be odd number in range [3, 31].
+        \param [in] levels - a number of pyramid levels (including the base image). Levels which are not larger than the window are not used.
+        \param [in] iterations - a maximal number of iterations at every pyramid level. It must be positive.
+        \param [in] epsilon - a minimal displacement (in pixels) at which iterations are stopped. It must be non-negative.
+        \return a pointer to optical flow context. On error it returns NULL.
+                This pointer is used in function ::SimdOpticalFlowLkRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdOpticalFlowLkInit(size_t width, size_t height, size_t window, size_t levels, size_t iterations, float epsilon);
+
+    /*! @ingroup optical_flow
+
+        \fn void SimdOpticalFlowLkRun(const void * context, const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, const float * prevPoints, size_t count, float * nextPoints, uint8_t * status);
+
+        \short Tracks points from previous 8-bit gray image to next one.
+
+        \param [in] context - an optical flow context. It must be created by function ::SimdOpticalFlowLkInit and released by function ::SimdRelease.
+        \param [in] prev - a pointer to pixels data of previous image.
+        \param [in] prevStride - a row size of previous image.
+        \param [in] next - a pointer to pixels data of next image.
+        \param [in] nextStride - a row size of next image.
+        \param [in] prevPoints - a pointer to array of points (pairs of x and y coordinates) in previous image.
+        \param [in] count - a number of points.
+        \param [out] nextPoints - a pointer to array of found positions (pairs of x and y coordinates) of the points in next image.
+        \param [out] status - a pointer to array of point statuses: 1 if the point is tracked, 0 if it is lost 
+                    (it leaves the image or its neighborhood has not enough texture). It can be NULL.
+    */
+    SIMD_API void SimdOpticalFlowLkRun(const void * context, const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, 
+        const float * prevPoints, size_t count, float * nextPoints, uint8_t * status);
+
     /*! @ingroup operation
 
         \fn void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height);
@@ -4805,6 +5781,69 @@ extern "C"
     SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal,
         uint8_t * dst, size_t stride, size_t width, size_t height);
 
+    /*! @ingroup resizing
+
+        \fn void * SimdPyramidBuilderInit(size_t width, size_t height, size_t levels, double scale, enum SimdReduceType reduce, SimdBool compensation);
+
+        \short Creates context of 8-bit gray image pyramid builder.
+
+        The builder fills all upper levels of the pyramid in a single pass over the base image:
+        every level is produced by strips of rows as soon as required rows of previous level are ready, so they are read back while they are still in cache.
+        Large images are split into horizontal bands which are processed in parallel.
+        If scale is equal to 2, then every level has size (size + 1)/2 of previous level and is reduced from it with using of function
+        ::SimdReduceGray2x2, ::SimdReduceGray3x3, ::SimdReduceGray4x4 or ::SimdReduceGray5x5 (the result is the same as for these functions).
+        Otherwise level sizes are equal to Round(size/pow(scale, level)) and every level is bilinear resized from previous level.
+
+        Typical use case:
+        \verbatim
+        void * builder = SimdPyramidBuilderInit(width, height, levels, 2.0, SimdReduce2x2, SimdTrue);
+        if (builder)
+        {
+             SimdPyramidBuilderRun(builder, src, srcStride, dst, dstStride);
+             SimdRelease(builder);
+        }
+        \endverbatim
+
+        \note This function is used in C++ wrapper Simd::Build(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation).
+
+        \param [in] width - a width of the base image.
+        \param [in] height - a height of the base image.
+        \param [in] levels - a number of pyramid levels (including the base image).
+        \param [in] scale - a scale factor between neighboring levels. It must be greater than 1.
+        \param [in] reduce - a type of function used for image reducing. It is relevant only if scale is equal to 2.
+        \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5.
+        \return a pointer to pyramid builder context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdPyramidBuilderLevelSize and ::SimdPyramidBuilderRun.
+    */
+    SIMD_API void * SimdPyramidBuilderInit(size_t width, size_t height, size_t levels, double scale, enum SimdReduceType reduce, SimdBool compensation);
+
+    /*! @ingroup resizing
+
+        \fn void SimdPyramidBuilderLevelSize(const void * builder, size_t level, size_t * width, size_t * height);
+
+        \short Gets size of given pyramid level.
+
+        \param [in] builder - a pyramid builder context. It must be created by function ::SimdPyramidBuilderInit and released by function ::SimdRelease.
+        \param [in] level - an index of pyramid level. Level 0 is the base image.
+        \param [out] width - a pointer to width of the level.
+        \param [out] height - a pointer to height of the level.
+    */
+    SIMD_API void SimdPyramidBuilderLevelSize(const void * builder, size_t level, size_t * width, size_t * height);
+
+    /*! @ingroup resizing
+
+        \fn void SimdPyramidBuilderRun(const void * builder, const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride);
+
+        \short Builds upper levels of 8-bit gray image pyramid.
+
+        \param [in] builder - a pyramid builder context. It must be created by function ::SimdPyramidBuilderInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the base image.
+        \param [in] srcStride - a row size of the base image.
+        \param [out] dst - an array (of size levels - 1) of pointers to pixels data of levels 1, 2, ... .
+        \param [in] dstStride - an array (of size levels - 1) of row sizes of levels 1, 2, ... .
+    */
+    SIMD_API void SimdPyramidBuilderRun(const void * builder, const uint8_t * src, size_t srcStride, uint8_t * const * dst, const size_t * dstStride);
+
     /*! @ingroup recursive_bilateral_filter
 
         \fn void * SimdRecursiveBilateralFilterInit(size_t width, size_t height, size_t channels, const float* sigmaSpatial, const float* sigmaRange, SimdRecursiveBilateralFilterFlags flags);
@@ -4822,6 +5861,10 @@ extern "C"
         }
         \endverbatim
 
+        The filtering is performed by several threads (see ::SimdSetThreadNumber): horizontal pass processes bands of image rows,
+        vertical pass processes stripes of image columns. Stripe width is chosen so that working memory of each thread in the vertical pass fits in L2 cache.
+        Both passes are split along their independent dimension, so the result does not depend on number of threads.
+
         \param [in] width - a width of input and output image.
         \param [in] height - a height of input and output image.
         \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
@@ -5101,6 +6144,9 @@ extern "C"
 
         \short Performs image resizing.
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The destination image is split into horizontal bands. The number of bands is fixed at the moment of ::SimdResizerInit call.
+
         \param [in] resizer - a resize context. It must be created by function ::SimdResizerInit and released by function ::SimdRelease.
         \param [in] src - a pointer to pixels data of the original input image.
         \param [in] srcStride - a row size (in bytes) of the input image.
@@ -5109,6 +6155,58 @@ extern "C"
     */
     SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup resizing
+
+        \fn void * SimdCropResizerInit(size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        \short Creates crop-and-resize context.
+
+        This context crops a set of rectangles from one input image and resizes each of them to the same output size.
+        Resize coefficients are cached for every unique rectangle size, so it is cheaper than creation of separate context by ::SimdResizerInit for every rectangle.
+        Cached coefficients are reused only by rectangles of exactly the same width and height. Every thread keeps at most 64 sizes,
+        the least recently used one is released when a new size is added.
+
+        An using example (crop and resize of detected faces in BGR-24 image):
+        \verbatim
+        void * resizer = SimdCropResizerInit(112, 112, 3, SimdResizeChannelByte, SimdResizeMethodBilinear);
+        if (resizer)
+        {
+             SimdCropResizerRun(resizer, src, srcStride, rects, count, dst, 112 * 3);
+             SimdRelease(resizer);
+        }
+        \endverbatim
+
+        \param [in] dstX - a width of the output images.
+        \param [in] dstY - a height of the output images.
+        \param [in] channels - a channel number of input and output images.
+        \param [in] type - a type of input and output image channel.
+        \param [in] method - a method used in order to resize images.
+        \return a pointer to crop-and-resize context. On error it returns NULL.
+                This pointer is used in functions ::SimdCropResizerRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdCropResizerInit(size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn void SimdCropResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, const size_t * rects, size_t count, uint8_t * dst, size_t dstStride);
+
+        \short Crops a set of rectangles from the input image and resizes them to the output batch.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The rectangles are distributed between threads.
+
+        \param [in] resizer - a crop-and-resize context. It must be created by function ::SimdCropResizerInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in] rects - a pointer to array of rectangles. Every rectangle is described by 4 values: left, top, right, bottom.
+            The rectangles must be not empty and lie inside the input image.
+        \param [in] count - a number of rectangles.
+        \param [out] dst - a pointer to pixels data of the output batch. The i-th output image starts at dst + i * dstY * dstStride.
+        \param [in] dstStride - a row size (in bytes) of the output images.
+    */
+    SIMD_API void SimdCropResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, const size_t * rects, size_t count, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup rgb_conversion
 
         \fn void SimdRgbToBgra(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -5262,6 +6360,55 @@ extern "C"
     SIMD_API void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
         ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom);
 
+    /*! @ingroup separable_filter
+
+        \fn void * SimdSeparableFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType srcType, SimdPixelFormatType dstType, const float * rowKernel, size_t rowSize, const float * colKernel, size_t colSize, SimdBorderType border, const float * borderValue);
+
+        \short Creates context of image filtration with arbitrary separable kernel.
+
+        For every point:
+        \verbatim
+        rx = rowSize/2, ry = colSize/2;
+        dst[x, y, c] = Saturate(Round(
+            sum(colKernel[j] * sum(rowKernel[i] * src[x + i - rx, y + j - ry, c], i = 0..rowSize-1), j = 0..colSize-1)));
+        \endverbatim
+        where out-of-image points of source image are extrapolated in accordance with border type.
+        The rounding and the saturation are performed only for integer output types.
+        The filter performs row and column passes in 32-bit float. Row pass results are stored in ring buffer of colSize rows, 
+        so every source row is loaded and filtered only once.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] srcType - a type of input image channel. It can be ::SimdPixelFormatGray8 (8-bit unsigned integer), ::SimdPixelFormatInt16 (16-bit signed integer) or ::SimdPixelFormatFloat (32-bit float).
+        \param [in] dstType - a type of output image channel. It can be ::SimdPixelFormatGray8, ::SimdPixelFormatInt16 or ::SimdPixelFormatFloat.
+        \param [in] rowKernel - a pointer to horizontal (row) kernel. 
+        \param [in] rowSize - a size of horizontal kernel. It must be greater than 0.
+        \param [in] colKernel - a pointer to vertical (column) kernel. 
+        \param [in] colSize - a size of vertical kernel. It must be greater than 0.
+        \param [in] border - a type of border extrapolation.
+        \param [in] borderValue - a pointer to border value. It is used only for ::SimdBorderConstant. It can be NULL (0 is used by default).
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdSeparableFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdSeparableFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType srcType, SimdPixelFormatType dstType,
+        const float * rowKernel, size_t rowSize, const float * colKernel, size_t colSize, SimdBorderType border, const float * borderValue);
+
+    /*! @ingroup separable_filter
+
+        \fn void SimdSeparableFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs image filtration with arbitrary separable kernel.
+
+        \param [in] filter - a filter context. It must be created by function ::SimdSeparableFilterInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the filtered output image. It must not be the same as input image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdSeparableFilterRun(const void * filter, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup shifting
 
         \fn void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY, size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride);
@@ -5625,6 +6772,79 @@ extern "C"
     */
     SIMD_API void SimdSquaredDifferenceKahanSum32f(const float * a, const float * b, size_t size, float * sum);
 
+    /*! @ingroup correlation
+
+        \fn void * SimdTemplateMatchInit(size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels);
+
+        \short Creates context of template matching for 8-bit gray images.
+
+        The score of every template position is calculated with using of vector instructions: 
+        sums of absolute differences, squared differences or products for many neighboring positions are accumulated at once. 
+        Normalized cross-correlation uses integral image (see ::SimdIntegral) to get sums over image windows.
+        Rows of the response map are processed in parallel threads. Scores are calculated exactly, so the result does not depend on used instruction set.
+
+        Typical use case:
+        \verbatim
+        void * matcher = SimdTemplateMatchInit(srcWidth, srcHeight, tmpWidth, tmpHeight, SimdTemplateMatchNcc, 3);
+        if (matcher)
+        {
+             size_t x, y;
+             float score = SimdTemplateMatchSearch(matcher, src, srcStride, tmp, tmpStride, &x, &y);
+             SimdRelease(matcher);
+        }
+        \endverbatim
+
+        \param [in] srcWidth - a width of the image.
+        \param [in] srcHeight - a height of the image.
+        \param [in] tmpWidth - a width of the template. It must not be greater than the image width and 65535.
+        \param [in] tmpHeight - a height of the template. It must not be greater than the image height. Template area must be less than 2^23.
+        \param [in] type - a type of matching score.
+        \param [in] levels - a number of pyramid levels used in function ::SimdTemplateMatchSearch (1 means full search without pyramid). 
+                    Levels with template size less than 4 are not used.
+        \return a pointer to template matching context. On error it returns NULL.
+                This pointer is used in functions ::SimdTemplateMatchRun and ::SimdTemplateMatchSearch.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdTemplateMatchInit(size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels);
+
+    /*! @ingroup correlation
+
+        \fn void SimdTemplateMatchRun(const void * context, const uint8_t * src, size_t srcStride, const uint8_t * tmp, size_t tmpStride, float * dst, size_t dstStride);
+
+        \short Calculates full response map of template matching.
+
+        \param [in] context - a template matching context. It must be created by function ::SimdTemplateMatchInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the image.
+        \param [in] srcStride - a row size of the image.
+        \param [in] tmp - a pointer to pixels data of the template.
+        \param [in] tmpStride - a row size of the template.
+        \param [out] dst - a pointer to 32-bit float response map. Its size is (srcWidth - tmpWidth + 1)x(srcHeight - tmpHeight + 1). 
+                    Every value is the score of the template placed with its left-top corner at given point of the image.
+        \param [in] dstStride - a row size of the response map (in 32-float values).
+    */
+    SIMD_API void SimdTemplateMatchRun(const void * context, const uint8_t * src, size_t srcStride, const uint8_t * tmp, size_t tmpStride, float * dst, size_t dstStride);
+
+    /*! @ingroup correlation
+
+        \fn float SimdTemplateMatchSearch(const void * context, const uint8_t * src, size_t srcStride, const uint8_t * tmp, size_t tmpStride, size_t * x, size_t * y);
+
+        \short Finds the best position of template in the image.
+
+        If the context has several pyramid levels then the image and the template are reduced (see ::SimdReduceGray2x2) with using of ::SimdPyramidBuilderInit.
+        The full response map is calculated only at the top level. Several best local extremums of the map are refined 
+        at every lower level within small neighborhood. Otherwise the full response map of original image is searched.
+
+        \param [in] context - a template matching context. It must be created by function ::SimdTemplateMatchInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the image.
+        \param [in] srcStride - a row size of the image.
+        \param [in] tmp - a pointer to pixels data of the template.
+        \param [in] tmpStride - a row size of the template.
+        \param [out] x - a pointer to x coordinate of the best template position (its left-top corner).
+        \param [out] y - a pointer to y coordinate of the best template position (its left-top corner).
+        \return the score of the best position.
+    */
+    SIMD_API float SimdTemplateMatchSearch(const void * context, const uint8_t * src, size_t srcStride, const uint8_t * tmp, size_t tmpStride, size_t * x, size_t * y);
+
     /*! @ingroup other_statistic
 
         \fn void SimdGetStatistic(const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t * min, uint8_t * max, uint8_t * average);
@@ -7424,6 +8644,72 @@ extern "C"
         size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
 
 
+    /*! @ingroup synet_conversion
+
+        \fn void* SimdSynetPreprocessInit(size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, SimdYuvType yuvType, size_t dstW, size_t dstH, size_t channels, SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, uint8_t padding, const float* mean, const float* scale);
+
+        \short Initilizes fused preprocessing of input image for neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        It joins color conversion, resizing, normalization and layout conversion (which are usually performed by ::SimdResizerRun and ::SimdSynetSetInput) 
+        into one pass over the image without intermediate buffer of the resized image.
+        Algorithm's details (example for NCHW tensor format without letterbox):
+        \verbatim
+        for(c = 0; c < channels; ++c)
+            for(y = 0; y < dstH; ++y)
+                for(x = 0; x < dstW; ++x)
+                    dst[(c*dstH + y)*dstW + x] = (Resized(c, x, y) - mean[c]) * scale[c];
+        \endverbatim
+        where Resized(c, x, y) is channel c of pixel of source image (converted to BGR, RGB or gray) resized to (dstW, dstH) with given method.
+        In letterbox mode the image is resized with preserving of aspect ratio, centered in output tensor and borders are filled by (padding - mean[c]) * scale[c].
+        Output values are rounded with saturation for ::SimdTensorData8u and rounded to nearest BFloat16 for ::SimdTensorData16b.
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] srcFormat - a pixel format of input image.
+        \param [in] yuvType - a type of YUV standard. It is used only for ::SimdSynetPreprocessNv12 and ::SimdSynetPreprocessYuv420p formats.
+        \param [in] dstW - a width of output image tensor.
+        \param [in] dstH - a height of output image tensor.
+        \param [in] channels - a number of channels in output image tensor. It can be 1 (gray) or 3 (BGR or RGB).
+        \param [in] method - a resize method. There are supported ::SimdResizeMethodNearest and ::SimdResizeMethodBilinear.
+        \param [in] dstType - a data type of output tensor. There are supported ::SimdTensorData32f, ::SimdTensorData16b and ::SimdTensorData8u.
+        \param [in] dstFormat - a format of output image tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] isRgb - a flag of RGB channel order of output tensor (else it is BGR).
+        \param [in] letterbox - a flag of resizing with preserving of aspect ratio.
+        \param [in] padding - a pixel value used for letterbox borders.
+        \param [in] mean - a pointer to the array with mean values for every channel of output tensor. Can be NULL (zero mean).
+        \param [in] scale - a pointer to the array with scale values for every channel of output tensor. Can be NULL (unit scale).
+        \return a pointer to preprocessing context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetPreprocessInternalBufferSize and ::SimdSynetPreprocessRun.
+    */
+    SIMD_API void* SimdSynetPreprocessInit(size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, SimdYuvType yuvType, size_t dstW, size_t dstH, size_t channels,
+        SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, uint8_t padding, const float* mean, const float* scale);
+
+    /*! @ingroup synet_conversion
+
+        \fn size_t SimdSynetPreprocessInternalBufferSize(const void* context);
+
+        \short Gets size of internal buffer used inside preprocessing algorithm.
+
+        \param [in] context - a pointer to preprocessing context. It must be created by function ::SimdSynetPreprocessInit and released by function ::SimdRelease.
+        \return size of internal buffer used inside preprocessing algorithm.
+    */
+    SIMD_API size_t SimdSynetPreprocessInternalBufferSize(const void* context);
+
+    /*! @ingroup synet_conversion
+
+        \fn void SimdSynetPreprocessRun(void* context, const uint8_t* const* src, const size_t* srcStride, uint8_t* dst);
+
+        \short Performs fused preprocessing of input image.
+
+        \param [in] context - a pointer to preprocessing context. It must be created by function ::SimdSynetPreprocessInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to array with pointers to planes of input image. 
+            It contains 1 plane for packed formats, 2 planes (Y, UV) for ::SimdSynetPreprocessNv12 and 3 planes (Y, U, V) for ::SimdSynetPreprocessYuv420p.
+            Chroma planes must have size ((srcW + 1) / 2, (srcH + 1) / 2).
+        \param [in] srcStride - a pointer to array with row sizes (in bytes) of the planes of input image.
+        \param [out] dst - a pointer to output image tensor. It has size = channels * dstH * dstW.
+    */
+    SIMD_API void SimdSynetPreprocessRun(void* context, const uint8_t* const* src, const size_t* srcStride, uint8_t* dst);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
@@ -8885,6 +10171,92 @@ extern "C"
     */
     SIMD_API void SimdYuv420pToUyvy422(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         size_t width, size_t height, uint8_t* uyvy, size_t uyvyStride);
+
+    /*! @ingroup yuyv_conversion
+
+        \fn void SimdYuyv422ToBgr(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts 16-bit YUYV422 image to 24-bit BGR image.
+
+        The input and output images must have the same width and height. Width must be even number.
+
+        \note This function has a C++ wrappers: Simd::Yuyv422ToBgr(const View<A>& yuyv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601);
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit YUYV422 image.
+        \param [in] yuyvStride - a row size of the YUYV422 image.
+        \param [in] width - an image width. Width must be even number.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuyv422ToBgr(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuyv_conversion
+
+        \fn void SimdYuyv422ToBgra(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts 16-bit YUYV422 image to 32-bit BGRA image.
+
+        The input and output images must have the same width and height. Width must be even number.
+
+        \note This function has a C++ wrappers: Simd::Yuyv422ToBgra(const View<A>& yuyv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601);
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit YUYV422 image.
+        \param [in] yuyvStride - a row size of the YUYV422 image.
+        \param [in] width - an image width. Width must be even number.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuyv422ToBgra(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuyv_conversion
+
+        \fn void SimdYuyv422ToGray(const uint8_t * yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t * gray, size_t grayStride);
+
+        \short Extracts Y (luma) channel of 16-bit YUYV422 image into 8-bit gray image.
+
+        The input and output images must have the same width and height. Width must be even number.
+        The luma values are copied as is (without range expansion). Use ::SimdYToGray to expand them to full range if it is required.
+
+        \note This function has a C++ wrappers: Simd::Yuyv422ToGray(const View<A>& yuyv, View<A>& gray);
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit YUYV422 image.
+        \param [in] yuyvStride - a row size of the YUYV422 image.
+        \param [in] width - an image width. Width must be even number.
+        \param [in] height - an image height.
+        \param [out] gray - a pointer to pixels data of output 8-bit gray image.
+        \param [in] grayStride - a row size of the gray image.
+    */
+    SIMD_API void SimdYuyv422ToGray(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* gray, size_t grayStride);
+
+    /*! @ingroup yuyv_conversion
+
+        \fn void SimdYuyv422ToYuv420p(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* u, size_t uStride, uint8_t* v, size_t vStride);
+
+        \short Converts 16-bit YUYV422 image to YUV420P.
+
+        The input YUYV422 and output Y images must have the same width and height.
+        The output U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrapper Simd::Yuyv422ToYuv420p(const View<A>& yuyv, View<A>& y, View<A>& u, View<A>& v).
+
+        \param [in] yuyv - a pointer to pixels data of input 16-bit YUYV422 image.
+        \param [in] yuyvStride - a row size of the YUYV422 image.
+        \param [in] width - an image width. Width must be even number.
+        \param [in] height - an image height. Height must be even number.
+        \param[out] y - a pointer to pixels data of output 8 - bit image with Y color plane.
+        \param[in] yStride - a row size of the y image.
+        \param[out] u - a pointer to pixels data of output 8 - bit image with U color plane.
+        \param[in] uStride - a row size of the u image.
+        \param[out] v - a pointer to pixels data of output 8 - bit image with V color plane.
+        \param[in] vStride - a row size of the v image.
+    */
+    SIMD_API void SimdYuyv422ToYuv420p(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height,
+        uint8_t* y, size_t yStride, uint8_t* u, size_t uStride, uint8_t* v, size_t vStride);
 #ifdef __cplusplus
 }
 #endif
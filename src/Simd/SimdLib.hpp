@@ -811,6 +811,73 @@ namespace Simd
         SimdBayerToBgra(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgra.data, bgra.stride, alpha);
     }
 
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerToBgrMhc(const View<A>& bayer, View<A>& bgr);
+
+        \short Converts 8-bit Bayer image to 24-bit BGR with using of Malvar-He-Cutler demosaicing.
+
+        All images must have the same width and height. The width and the height must be even and not less than 4.
+
+        \note This function is a C++ wrapper for function ::SimdBayerToBgrMhc.
+
+        \param [in] bayer - an input 8-bit Bayer image.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void BayerToBgrMhc(const View<A>& bayer, View<A>& bgr)
+    {
+        assert(EqualSize(bgr, bayer) && bgr.format == View<A>::Bgr24);
+        assert(bayer.format >= View<A>::BayerGrbg && bayer.format <= View<A>::BayerBggr);
+        assert((bayer.width % 2 == 0) && (bayer.height % 2 == 0) && bayer.width >= 4 && bayer.height >= 4);
+
+        SimdBayerToBgrMhc(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerToBgraMhc(const View<A>& bayer, View<A>& bgra, uint8_t alpha = 0xFF);
+
+        \short Converts 8-bit Bayer image to 32-bit BGRA with using of Malvar-He-Cutler demosaicing.
+
+        All images must have the same width and height. The width and the height must be even and not less than 4.
+
+        \note This function is a C++ wrapper for function ::SimdBayerToBgraMhc.
+
+        \param [in] bayer - an input 8-bit Bayer image.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void BayerToBgraMhc(const View<A>& bayer, View<A>& bgra, uint8_t alpha = 0xFF)
+    {
+        assert(EqualSize(bgra, bayer) && bgra.format == View<A>::Bgra32);
+        assert(bayer.format >= View<A>::BayerGrbg && bayer.format <= View<A>::BayerBggr);
+        assert((bayer.width % 2 == 0) && (bayer.height % 2 == 0) && bayer.width >= 4 && bayer.height >= 4);
+
+        SimdBayerToBgraMhc(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, bgra.data, bgra.stride, alpha);
+    }
+
+    /*! @ingroup bayer_conversion
+
+        \fn void BayerToGrayMhc(const View<A>& bayer, View<A>& gray);
+
+        \short Converts 8-bit Bayer image to 8-bit gray with using of Malvar-He-Cutler demosaicing.
+
+        All images must have the same width and height. The width and the height must be even and not less than 4.
+
+        \note This function is a C++ wrapper for function ::SimdBayerToGrayMhc.
+
+        \param [in] bayer - an input 8-bit Bayer image.
+        \param [out] gray - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void BayerToGrayMhc(const View<A>& bayer, View<A>& gray)
+    {
+        assert(EqualSize(gray, bayer) && gray.format == View<A>::Gray8);
+        assert(bayer.format >= View<A>::BayerGrbg && bayer.format <= View<A>::BayerBggr);
+        assert((bayer.width % 2 == 0) && (bayer.height % 2 == 0) && bayer.width >= 4 && bayer.height >= 4);
+
+        SimdBayerToGrayMhc(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)bayer.format, gray.data, gray.stride);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToBayer(const View<A>& bgra, View<A>& bayer)
@@ -913,6 +980,30 @@ namespace Simd
         SimdBgraToRgba(bgra.data, bgra.width, bgra.height, bgra.stride, rgba.data, rgba.stride);
     }
 
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 32-bit BGRA image to NV12.
+
+        The input BGRA and output Y images must have the same width and height.
+        The output UV image (with interleaved U and V color planes) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdBgraToNv12V2.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] uv - an output 16-bit image with interleaved U and V color planes.
+        \param [in] yuvType - a type of output YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToNv12V2(bgra.data, bgra.stride, bgra.width, bgra.height, y.data, y.stride, uv.data, uv.stride, yuvType);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
@@ -1185,6 +1276,30 @@ namespace Simd
         SimdRgbToBgra(bgr.data, bgr.width, bgr.height, bgr.stride, rgba.data, rgba.stride, alpha);
     }
 
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 24-bit BGR image to NV12.
+
+        The input BGR and output Y images must have the same width and height.
+        The output UV image (with interleaved U and V color planes) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToNv12V2.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] uv - an output 16-bit image with interleaved U and V color planes.
+        \param [in] yuvType - a type of output YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToNv12V2(bgr.data, bgr.stride, bgr.width, bgr.height, y.data, y.stride, uv.data, uv.stride, yuvType);
+    }
+
     /*! @ingroup bgr_conversion
 
         \fn void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
@@ -2656,6 +2771,307 @@ namespace Simd
         SimdNeuralConvert(src.data, src.stride, src.width, src.height, dst, stride, inversion ? 1 : 0);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image (with interleaved U and V color planes) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved U and V color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgrV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image (with interleaved U and V color planes) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved U and V color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgraV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image (with interleaved U and V color planes) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToRgbV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved U and V color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && rgb.format == View<A>::Rgb24);
+
+        SimdNv12ToRgbV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image (with interleaved V and U color planes) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved V and U color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdNv21ToBgrV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image (with interleaved V and U color planes) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved V and U color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdNv21ToBgraV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv21ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV21 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image (with interleaved V and U color planes) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv21ToRgbV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved V and U color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv21ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == rgb.width && y.height == rgb.height);
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && rgb.format == View<A>::Rgb24);
+
+        SimdNv21ToRgbV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p10ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 10-bit yuv420p10 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p10ToBgrV2.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p10ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && Compatible(u, v) && y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Int16 && u.format == View<A>::Int16 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv420p10ToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p10ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 10-bit yuv420p10 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p10ToBgraV2.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 0xFF by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p10ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && Compatible(u, v) && y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Int16 && u.format == View<A>::Int16 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv420p10ToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p10ToBgr48p(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 10-bit yuv420p10 image to 48-bit planar BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have half size relative to Y component.
+        Output color values are scaled to full 16-bit range [0..65535] and stored with the most significant byte first (as in Simd::Bgr48pToBgra32).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p10ToBgr48pV2.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [out] blue - an output 16-bit image with blue color plane.
+        \param [out] green - an output 16-bit image with green color plane.
+        \param [out] red - an output 16-bit image with red color plane.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p10ToBgr48p(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && Compatible(u, v) && y.width == blue.width && y.height == blue.height && y.width == green.width && y.height == green.height && y.width == red.width && y.height == red.height);
+        assert(y.format == View<A>::Int16 && u.format == View<A>::Int16 && blue.format == View<A>::Int16 && green.format == View<A>::Int16 && red.format == View<A>::Int16);
+
+        SimdYuv420p10ToBgr48pV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, blue.data, blue.stride, green.data, green.stride, red.data, red.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 10-bit P010 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image (with interleaved 16-bit U and V color planes) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgrV2.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && bgr.format == View<A>::Bgr24);
+
+        SimdP010ToBgrV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 10-bit P010 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image (with interleaved 16-bit U and V color planes) must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgraV2.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 0xFF by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && bgra.format == View<A>::Bgra32);
+
+        SimdP010ToBgraV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToBgr48p(const View<A>& y, const View<A>& uv, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 10-bit P010 image to 48-bit planar BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image (with interleaved 16-bit U and V color planes) must have half size relative to Y component.
+        Output color values are scaled to full 16-bit range [0..65535] and stored with the most significant byte first (as in Simd::Bgr48pToBgra32).
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgr48pV2.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [out] blue - an output 16-bit image with blue color plane.
+        \param [out] green - an output 16-bit image with green color plane.
+        \param [out] red - an output 16-bit image with red color plane.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgr48p(const View<A>& y, const View<A>& uv, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.width == blue.width && y.height == blue.height && y.width == green.width && y.height == green.height && y.width == red.width && y.height == red.height);
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && blue.format == View<A>::Int16 && green.format == View<A>::Int16 && red.format == View<A>::Int16);
+
+        SimdP010ToBgr48pV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, blue.data, blue.stride, green.data, green.stride, red.data, red.stride, yuvType);
+    }
+
     /*! @ingroup operation
 
         \fn void OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type)
@@ -4127,7 +4543,7 @@ namespace Simd
     */
     template<template<class> class A> SIMD_INLINE void Uyvy422ToBgr(const View<A>& uyvy, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
     {
-        assert(EqualSize(uyvy, bgr) && uyvy.format == View<A>::Uyvy32 && bgr.format == View<A>::Bgr24);
+        assert(EqualSize(uyvy, bgr) && uyvy.format == View<A>::Uyvy16 && bgr.format == View<A>::Bgr24);
 
         SimdUyvy422ToBgr(uyvy.data, uyvy.stride, uyvy.width, uyvy.height, bgr.data, bgr.stride, yuvType);
     }
@@ -4153,9 +4569,9 @@ namespace Simd
         assert(y.width == uyvy.width && y.height == uyvy.height);
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
-        assert(uyvy.format == View<A>::Uyvy32 && y.format == View<A>::Gray8);
+        assert(uyvy.format == View<A>::Uyvy16 && y.format == View<A>::Gray8);
 
-        SimdUyvy422ToBgr(uyvy.data, uyvy.stride, uyvy.width, uyvy.height, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+        SimdUyvy422ToYuv420p(uyvy.data, uyvy.stride, uyvy.width, uyvy.height, y.data, y.stride, u.data, u.stride, v.data, v.stride);
     }
 
     /*! @ingroup warp_affine
@@ -4684,11 +5100,100 @@ namespace Simd
         assert(y.width == uyvy.width && y.height == uyvy.height);
         assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
         assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
-        assert(uyvy.format == View<A>::Uyvy32 && y.format == View<A>::Gray8);
+        assert(uyvy.format == View<A>::Uyvy16 && y.format == View<A>::Gray8);
 
         SimdYuv420pToUyvy422(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, uyvy.data, uyvy.stride);
     }
 
+    /*! @ingroup yuyv_conversion
+
+        \fn void Yuyv422ToBgr(const View<A>& yuyv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601);
+
+        \short Converts 16-bit YUYV422 image to 24-bit BGR image.
+
+        The input and output images must have the same width and height. Width must be even number.
+
+        \note This function is a C++ wrapper for function ::SimdYuyv422ToBgr.
+
+        \param [in] yuyv - an input 16-bit YUYV422 image.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuyv422ToBgr(const View<A>& yuyv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(yuyv, bgr) && yuyv.format == View<A>::Yuyv16 && bgr.format == View<A>::Bgr24);
+
+        SimdYuyv422ToBgr(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuyv_conversion
+
+        \fn void Yuyv422ToBgra(const View<A>& yuyv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601);
+
+        \short Converts 16-bit YUYV422 image to 32-bit BGRA image.
+
+        The input and output images must have the same width and height. Width must be even number.
+
+        \note This function is a C++ wrapper for function ::SimdYuyv422ToBgra.
+
+        \param [in] yuyv - an input 16-bit YUYV422 image.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuyv422ToBgra(const View<A>& yuyv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(yuyv, bgra) && yuyv.format == View<A>::Yuyv16 && bgra.format == View<A>::Bgra32);
+
+        SimdYuyv422ToBgra(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuyv_conversion
+
+        \fn void Yuyv422ToGray(const View<A>& yuyv, View<A>& gray);
+
+        \short Extracts Y (luma) channel of 16-bit YUYV422 image into 8-bit gray image.
+
+        The input and output images must have the same width and height. Width must be even number.
+
+        \note This function is a C++ wrapper for function ::SimdYuyv422ToGray.
+
+        \param [in] yuyv - an input 16-bit YUYV422 image.
+        \param [out] gray - an output 8-bit gray image.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuyv422ToGray(const View<A>& yuyv, View<A>& gray)
+    {
+        assert(EqualSize(yuyv, gray) && yuyv.format == View<A>::Yuyv16 && gray.format == View<A>::Gray8);
+
+        SimdYuyv422ToGray(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, gray.data, gray.stride);
+    }
+
+    /*! @ingroup yuyv_conversion
+
+        \fn void Yuyv422ToYuv420p(const View<A>& yuyv, View<A>& y, View<A>& u, View<A>& v);
+
+        \short Converts 16-bit YUYV422 image to YUV420P.
+
+        The input YUYV422 and output Y images must have the same width and height.
+        The output U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuyv422ToYuv420p.
+
+        \param [in] yuyv - an input 16-bit YUYV422 image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuyv422ToYuv420p(const View<A>& yuyv, View<A>& y, View<A>& u, View<A>& v)
+    {
+        assert(y.width == yuyv.width && y.height == yuyv.height);
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(yuyv.format == View<A>::Yuyv16 && y.format == View<A>::Gray8);
+
+        SimdYuyv422ToYuv420p(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+    }
+
     /*! @ingroup universal_conversion
 
         \fn void Convert(const View<A> & src, View<A> & dst)
@@ -4858,14 +5363,35 @@ namespace Simd
 
         \short Builds the pyramid (fills upper levels on the base of the lowest level).
 
+        \note This function is a C++ wrapper for function ::SimdPyramidBuilderRun.
+            If the pyramid builder can't be created then the levels are reduced one by one with using of Simd::ReduceGray.
+
         \param [out] pyramid - a built pyramid.
         \param [in] reduceType - a type of function used for image reducing.
         \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5. It is equal to 'true' by default.
     */
     template<template<class> class A> SIMD_INLINE void Build(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation = true)
     {
-        for (size_t level = 1; level < pyramid.Size(); ++level)
-            Simd::ReduceGray(pyramid.At(level - 1), pyramid.At(level), reduceType, compensation);
+        if (pyramid.Size() < 2)
+            return;
+        void * builder = SimdPyramidBuilderInit(pyramid.At(0).width, pyramid.At(0).height, pyramid.Size(), 2.0, reduceType, compensation ? SimdTrue : SimdFalse);
+        if (builder)
+        {
+            std::vector<uint8_t*> dst(pyramid.Size() - 1);
+            std::vector<size_t> dstStride(pyramid.Size() - 1);
+            for (size_t level = 1; level < pyramid.Size(); ++level)
+            {
+                dst[level - 1] = pyramid.At(level).data;
+                dstStride[level - 1] = pyramid.At(level).stride;
+            }
+            SimdPyramidBuilderRun(builder, pyramid.At(0).data, pyramid.At(0).stride, dst.data(), dstStride.data());
+            SimdRelease(builder);
+        }
+        else
+        {
+            for (size_t level = 1; level < pyramid.Size(); ++level)
+                Simd::ReduceGray(pyramid.At(level - 1), pyramid.At(level), reduceType, compensation);
+        }
     }
 }
 
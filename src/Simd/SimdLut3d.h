@@ -0,0 +1,229 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdLut3d_h__
+#define __SimdLut3d_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct Lut3dParam
+    {
+        size_t size;
+        SimdLut3dInterpolationType interpolation;
+
+        Lut3dParam(size_t s, SimdLut3dInterpolationType i)
+            : size(s)
+            , interpolation(i)
+        {
+        }
+
+        bool Valid() const
+        {
+            if (size < 2 || size > 256)
+                return false;
+            if (interpolation != SimdLut3dInterpolationTrilinear && interpolation != SimdLut3dInterpolationTetrahedral)
+                return false;
+            return true;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class Lut3d : public Deletable
+    {
+    public:
+        Lut3d(const Lut3dParam& param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t dstStride) const = 0;
+
+    protected:
+        Lut3dParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        const int LUT3D_WEIGHT_SHIFT = 8;
+        const int LUT3D_WEIGHT_ONE = 1 << LUT3D_WEIGHT_SHIFT;
+        const int LUT3D_NODE_SHIFT = 6;
+        const int LUT3D_ROUND = 1 << (LUT3D_WEIGHT_SHIFT - 1);
+        const int LUT3D_SHIFT = LUT3D_WEIGHT_SHIFT + LUT3D_NODE_SHIFT;
+        const int LUT3D_FINAL_ROUND = 1 << (LUT3D_SHIFT - 1);
+
+        struct Lut3dIndex
+        {
+            int32_t offset[3][256], weight[3][256], step[3];
+        };
+
+        SIMD_INLINE int Lut3dLerp(int a, int b, int w)
+        {
+            return (a * (LUT3D_WEIGHT_ONE - w) + b * w + LUT3D_ROUND) >> LUT3D_WEIGHT_SHIFT;
+        }
+
+        SIMD_INLINE void Lut3dTetrahedral(const Lut3dIndex& index, int wb, int wg, int wr, int offset[4], int weight[4])
+        {
+            int sb = index.step[0], sg = index.step[1], sr = index.step[2];
+            offset[0] = 0;
+            offset[3] = sb + sg + sr;
+            if (wr > wg)
+            {
+                if (wg > wb)
+                {
+                    offset[1] = sr, offset[2] = sr + sg;
+                    weight[0] = LUT3D_WEIGHT_ONE - wr, weight[1] = wr - wg, weight[2] = wg - wb, weight[3] = wb;
+                }
+                else if (wr > wb)
+                {
+                    offset[1] = sr, offset[2] = sr + sb;
+                    weight[0] = LUT3D_WEIGHT_ONE - wr, weight[1] = wr - wb, weight[2] = wb - wg, weight[3] = wg;
+                }
+                else
+                {
+                    offset[1] = sb, offset[2] = sr + sb;
+                    weight[0] = LUT3D_WEIGHT_ONE - wb, weight[1] = wb - wr, weight[2] = wr - wg, weight[3] = wg;
+                }
+            }
+            else
+            {
+                if (wb > wg)
+                {
+                    offset[1] = sb, offset[2] = sg + sb;
+                    weight[0] = LUT3D_WEIGHT_ONE - wb, weight[1] = wb - wg, weight[2] = wg - wr, weight[3] = wr;
+                }
+                else if (wb > wr)
+                {
+                    offset[1] = sg, offset[2] = sg + sb;
+                    weight[0] = LUT3D_WEIGHT_ONE - wg, weight[1] = wg - wb, weight[2] = wb - wr, weight[3] = wr;
+                }
+                else
+                {
+                    offset[1] = sg, offset[2] = sr + sg;
+                    weight[0] = LUT3D_WEIGHT_ONE - wg, weight[1] = wg - wr, weight[2] = wr - wb, weight[3] = wb;
+                }
+            }
+        }
+
+        template<bool tetrahedral> SIMD_INLINE void Lut3dPixel(const Lut3dIndex& index, const int16_t* nodes, int blue, int green, int red, int bgr[3])
+        {
+            const int16_t* p = nodes + index.offset[0][blue] + index.offset[1][green] + index.offset[2][red];
+            int wb = index.weight[0][blue], wg = index.weight[1][green], wr = index.weight[2][red];
+            if (tetrahedral)
+            {
+                int offset[4], weight[4];
+                Lut3dTetrahedral(index, wb, wg, wr, offset, weight);
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    int sum = p[offset[0] + c] * weight[0] + p[offset[1] + c] * weight[1] + p[offset[2] + c] * weight[2] + p[offset[3] + c] * weight[3];
+                    bgr[c] = (sum + LUT3D_FINAL_ROUND) >> LUT3D_SHIFT;
+                }
+            }
+            else
+            {
+                int sb = index.step[0], sg = index.step[1], sr = index.step[2];
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    const int16_t* p0 = p + c, * p1 = p0 + sb;
+                    int g0 = Lut3dLerp(Lut3dLerp(p0[0], p0[sr], wr), Lut3dLerp(p0[sg], p0[sg + sr], wr), wg);
+                    int g1 = Lut3dLerp(Lut3dLerp(p1[0], p1[sr], wr), Lut3dLerp(p1[sg], p1[sg + sr], wr), wg);
+                    bgr[c] = (g0 * (LUT3D_WEIGHT_ONE - wb) + g1 * wb + LUT3D_FINAL_ROUND) >> LUT3D_SHIFT;
+                }
+            }
+        }
+
+        template<bool tetrahedral, size_t channels, bool rgb> SIMD_INLINE void Lut3dPixel(const Lut3dIndex& index, const int16_t* nodes, const uint8_t* src, uint8_t* dst)
+        {
+            int bgr[3];
+            Lut3dPixel<tetrahedral>(index, nodes, src[rgb ? 2 : 0], src[1], src[rgb ? 0 : 2], bgr);
+            uint8_t alpha = channels == 4 ? src[3] : 0;
+            dst[rgb ? 2 : 0] = (uint8_t)bgr[0];
+            dst[1] = (uint8_t)bgr[1];
+            dst[rgb ? 0 : 2] = (uint8_t)bgr[2];
+            if (channels == 4)
+                dst[3] = alpha;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        class Lut3dInt : public Simd::Lut3d
+        {
+        public:
+            Lut3dInt(const Lut3dParam& param, const float* table);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, SimdPixelFormatType format, uint8_t* dst, size_t dstStride) const;
+
+            typedef void (*RowPtr)(const Lut3dIndex& index, const int16_t* nodes, const uint8_t* src, size_t width, uint8_t* dst);
+
+        protected:
+            static int FormatIndex(SimdPixelFormatType format);
+
+            Array16i _nodes;
+            Lut3dIndex _index;
+            RowPtr _rows[4];
+            size_t _threads;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* Lut3dInit(size_t size, const float* table, SimdLut3dInterpolationType interpolation);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class Lut3dInt : public Base::Lut3dInt
+        {
+        public:
+            Lut3dInt(const Lut3dParam& param, const float* table);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* Lut3dInit(size_t size, const float* table, SimdLut3dInterpolationType interpolation);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class Lut3dInt : public Sse41::Lut3dInt
+        {
+        public:
+            Lut3dInt(const Lut3dParam& param, const float* table);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* Lut3dInit(size_t size, const float* table, SimdLut3dInterpolationType interpolation);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,159 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMedianFilter_h__
+#define __SimdMedianFilter_h__
+
+#include "Simd/SimdSeparableFilter.h"
+
+namespace Simd
+{
+    struct MedianFilterParam
+    {
+        size_t width, height, channels, radius;
+        SimdBorderType border;
+        uint8_t borderValue[4];
+
+        MedianFilterParam(size_t w, size_t h, size_t c, size_t r, SimdBorderType b, const uint8_t* bv)
+            : width(w)
+            , height(h)
+            , channels(c)
+            , radius(r)
+            , border(b)
+        {
+            for (size_t i = 0; i < 4; ++i)
+                borderValue[i] = bv && i < c ? bv[i] : 0;
+        }
+
+        bool Valid() const
+        {
+            if (width == 0 || height == 0 || channels == 0 || channels > 4)
+                return false;
+            if (border < SimdBorderReplicate || border > SimdBorderConstant)
+                return false;
+            if (Kernel() * Kernel() > 0xFFFF)
+                return false;
+            return true;
+        }
+
+        SIMD_INLINE size_t Kernel() const
+        {
+            return 2 * radius + 1;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class MedianFilter : Deletable
+    {
+    public:
+        MedianFilter(const MedianFilterParam& param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        MedianFilterParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        const size_t MF_FINE = 256, MF_COARSE = 16, MF_HIST = MF_FINE + MF_COARSE;
+
+        typedef void (*MedianFilterUpdatePtr)(const uint16_t* add, const uint16_t* sub, uint16_t* hist);
+
+        class MedianFilterDefault : public Simd::MedianFilter
+        {
+        public:
+            MedianFilterDefault(const MedianFilterParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            const uint8_t* Row(const uint8_t* src, size_t srcStride, ptrdiff_t row) const;
+            const uint16_t* Col(const uint16_t* cols, size_t x, size_t c) const;
+            void RunBand(const uint8_t* src, size_t srcStride, size_t yBeg, size_t yEnd, uint16_t* buf, uint8_t* dst, size_t dstStride);
+
+            size_t _size, _bufSize, _threads;
+            Array8u _border;
+            Array16u _zero, _const, _buffers;
+            Array32i _index;
+            MedianFilterUpdatePtr _update;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, const uint8_t* borderValue);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class MedianFilterDefault : public Base::MedianFilterDefault
+        {
+        public:
+            MedianFilterDefault(const MedianFilterParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, const uint8_t* borderValue);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class MedianFilterDefault : public Sse41::MedianFilterDefault
+        {
+        public:
+            MedianFilterDefault(const MedianFilterParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, const uint8_t* borderValue);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class MedianFilterDefault : public Avx2::MedianFilterDefault
+        {
+        public:
+            MedianFilterDefault(const MedianFilterParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MedianFilterInit(size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, const uint8_t* borderValue);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,146 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMorphology_h__
+#define __SimdMorphology_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct MorphologyParam
+    {
+        size_t width, height;
+        SimdMorphologyType type;
+        size_t kernelX, kernelY;
+
+        MorphologyParam(size_t w, size_t h, SimdMorphologyType t, size_t kx, size_t ky)
+            : width(w)
+            , height(h)
+            , type(t)
+            , kernelX(kx)
+            , kernelY(ky)
+        {
+        }
+
+        bool Valid() const
+        {
+            if (width == 0 || height == 0 || kernelX == 0 || kernelY == 0)
+                return false;
+            if (type < SimdMorphologyErode || type > SimdMorphologyClose)
+                return false;
+            return true;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class Morphology : Deletable
+    {
+    public:
+        Morphology(const MorphologyParam& param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        MorphologyParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        typedef void (*MorphologyOpPtr)(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* dst);
+
+        class MorphologyDefault : public Simd::Morphology
+        {
+        public:
+            MorphologyDefault(const MorphologyParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void Apply(bool dilate, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            void ApplyVertical(bool dilate, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            void ApplyHorizontal(bool dilate, uint8_t* dst, size_t dstStride);
+
+            size_t _stride;
+            Array8u _fill[2], _row, _g, _h, _image;
+            MorphologyOpPtr _op[2];
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class MorphologyDefault : public Base::MorphologyDefault
+        {
+        public:
+            MorphologyDefault(const MorphologyParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class MorphologyDefault : public Sse41::MorphologyDefault
+        {
+        public:
+            MorphologyDefault(const MorphologyParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class MorphologyDefault : public Avx2::MorphologyDefault
+        {
+        public:
+            MorphologyDefault(const MorphologyParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+    }
+#endif
+}
+
+#endif
@@ -130,6 +130,7 @@ namespace Simd
             case SimdImageFilePpmBin: return new ImagePpmBinLoader(param);
             case SimdImageFilePng: return new Base::ImagePngLoader(param);
             case SimdImageFileJpeg: return new Base::ImageJpegLoader(param);
+            case SimdImageFileQoi: return new Base::ImageQoiLoader(param);
             default:
                 return NULL;
             }
@@ -149,6 +150,11 @@ namespace Simd
             }
             return NULL;
         }
+
+        void* ImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            return Simd::ImageMapFromFile(CreateImageLoader, path, width, height, format);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -110,6 +110,7 @@ namespace Simd
             case SimdImageFilePpmBin: return new ImagePpmBinSaver(param);
             case SimdImageFilePng: return new ImagePngSaver(param);
             case SimdImageFileJpeg: return new ImageJpegSaver(param);
+            case SimdImageFileQoi:  return new Base::ImageQoiSaver(param);
             default:
                 return NULL;
             }
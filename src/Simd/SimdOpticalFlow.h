@@ -0,0 +1,174 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdOpticalFlow_h__
+#define __SimdOpticalFlow_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdPyramidBuilder.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct OpticalFlowLkParam
+    {
+        size_t width, height, window, levels, iterations;
+        float epsilon;
+
+        OpticalFlowLkParam(size_t w, size_t h, size_t ws, size_t l, size_t i, float e)
+            : width(w)
+            , height(h)
+            , window(ws)
+            , levels(l)
+            , iterations(i)
+            , epsilon(e)
+        {
+        }
+
+        bool Valid() const
+        {
+            if (width == 0 || height == 0 || width >= 0x40000000 || height >= 0x40000000)
+                return false;
+            if (window < 3 || window > 31 || (window & 1) == 0)
+                return false;
+            if (levels == 0 || levels > 16 || iterations == 0 || !(epsilon >= 0.0f))
+                return false;
+            return true;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class OpticalFlowLk : Deletable
+    {
+    public:
+        OpticalFlowLk(const OpticalFlowLkParam& param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t* prev, size_t prevStride, const uint8_t* next, size_t nextStride, 
+            const float* prevPoints, size_t count, float* nextPoints, uint8_t* status) = 0;
+
+    protected:
+        OpticalFlowLkParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        const size_t LK_PATCH_STRIDE = 32;
+        const int LK_WEIGHT_BITS = 14;
+        const int LK_VALUE_BITS = 5;
+
+        void LkGradient(const uint8_t* src, size_t srcStride, size_t width, size_t height, int16_t* dx, int16_t* dy, size_t dStride);
+
+        void LkPatch(const uint8_t* src, size_t srcStride, const int16_t* dx, const int16_t* dy, size_t dStride, 
+            size_t size, const int* weights, int16_t* patch, int64_t* sums);
+
+        void LkMismatch(const uint8_t* src, size_t srcStride, size_t size, const int* weights, const int16_t* patch, int64_t* sums);
+
+        typedef void (*LkGradientPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, int16_t* dx, int16_t* dy, size_t dStride);
+        typedef void (*LkPatchPtr)(const uint8_t* src, size_t srcStride, const int16_t* dx, const int16_t* dy, size_t dStride,
+            size_t size, const int* weights, int16_t* patch, int64_t* sums);
+        typedef void (*LkMismatchPtr)(const uint8_t* src, size_t srcStride, size_t size, const int* weights, const int16_t* patch, int64_t* sums);
+
+        class OpticalFlowLkDefault : public Simd::OpticalFlowLk
+        {
+        public:
+            OpticalFlowLkDefault(const OpticalFlowLkParam& param, PyramidBuilderInitPtr pyramidInit);
+            virtual ~OpticalFlowLkDefault();
+
+            virtual void Run(const uint8_t* prev, size_t prevStride, const uint8_t* next, size_t nextStride,
+                const float* prevPoints, size_t count, float* nextPoints, uint8_t* status);
+
+        protected:
+            void Build(const uint8_t* src, size_t srcStride, std::vector<Array8u> & pyramid);
+            void Gradient();
+            bool Track(size_t thread, float x, float y, float* point);
+
+            size_t _threads, _levels, _border;
+            std::vector<size_t> _width, _height, _stride;
+            std::vector<Array8u> _prev, _next;
+            std::vector<Array16i> _dx, _dy;
+            std::vector<Array16i> _patches;
+            PyramidBuilder * _pyramid;
+            LkGradientPtr _gradient;
+            LkPatchPtr _patch;
+            LkMismatchPtr _mismatch;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t window, size_t levels, size_t iterations, float epsilon);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class OpticalFlowLkDefault : public Base::OpticalFlowLkDefault
+        {
+        public:
+            OpticalFlowLkDefault(const OpticalFlowLkParam& param, Base::PyramidBuilderInitPtr pyramidInit);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t window, size_t levels, size_t iterations, float epsilon);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class OpticalFlowLkDefault : public Sse41::OpticalFlowLkDefault
+        {
+        public:
+            OpticalFlowLkDefault(const OpticalFlowLkParam& param, Base::PyramidBuilderInitPtr pyramidInit);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t window, size_t levels, size_t iterations, float epsilon);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class OpticalFlowLkDefault : public Avx2::OpticalFlowLkDefault
+        {
+        public:
+            OpticalFlowLkDefault(const OpticalFlowLkParam& param, Base::PyramidBuilderInitPtr pyramidInit);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t window, size_t levels, size_t iterations, float epsilon);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,186 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdPyramidBuilder_h__
+#define __SimdPyramidBuilder_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdResizer.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct PyramidBuilderParam
+    {
+        size_t width, height, levels;
+        double scale;
+        SimdReduceType reduce;
+        bool compensation;
+
+        PyramidBuilderParam(size_t w, size_t h, size_t l, double s, SimdReduceType r, bool c)
+            : width(w)
+            , height(h)
+            , levels(l)
+            , scale(s)
+            , reduce(r)
+            , compensation(c)
+        {
+        }
+
+        bool Valid() const
+        {
+            if (width == 0 || height == 0 || levels == 0 || !(scale > 1.0))
+                return false;
+            if (reduce < SimdReduce2x2 || reduce > SimdReduce5x5)
+                return false;
+            return true;
+        }
+
+        bool Reduce() const
+        {
+            return scale == 2.0;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class PyramidBuilder : public Deletable
+        {
+        public:
+            PyramidBuilder(const PyramidBuilderParam& param, ResizerInitPtr resizerInit);
+            virtual ~PyramidBuilder();
+
+            void LevelSize(size_t level, size_t* width, size_t* height) const;
+
+            void Run(const uint8_t* src, size_t srcStride, uint8_t* const* dst, const size_t* dstStride);
+
+        protected:
+            virtual void Reduce(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+                uint8_t* dst, size_t dstWidth, size_t dstHeight, size_t dstStride) const;
+
+            struct Band
+            {
+                size_t beg, end, validBeg, validEnd;
+            };
+
+            void SetBands(size_t count);
+            void RunBand(size_t thread, size_t band, uint8_t* const* data, const size_t* stride);
+            void Produce(size_t thread, size_t level, size_t beg, size_t end, uint8_t* const* data, const size_t* stride);
+
+            PyramidBuilderParam _param;
+            std::vector<size_t> _width, _height;
+            std::vector<std::vector<size_t>> _lo, _hi;
+            std::vector<Band> _bands;
+            std::vector<Resizer*> _resizers;
+            std::vector<Array8u> _buffers;
+            size_t _threads, _strip;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* PyramidBuilderInit(size_t width, size_t height, size_t levels, double scale, SimdReduceType reduce, SimdBool compensation);
+
+        typedef void* (*PyramidBuilderInitPtr)(size_t width, size_t height, size_t levels, double scale, SimdReduceType reduce, SimdBool compensation);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class PyramidBuilder : public Base::PyramidBuilder
+        {
+        public:
+            PyramidBuilder(const PyramidBuilderParam& param, Base::ResizerInitPtr resizerInit);
+
+        protected:
+            virtual void Reduce(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+                uint8_t* dst, size_t dstWidth, size_t dstHeight, size_t dstStride) const;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* PyramidBuilderInit(size_t width, size_t height, size_t levels, double scale, SimdReduceType reduce, SimdBool compensation);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class PyramidBuilder : public Sse41::PyramidBuilder
+        {
+        public:
+            PyramidBuilder(const PyramidBuilderParam& param, Base::ResizerInitPtr resizerInit);
+
+        protected:
+            virtual void Reduce(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+                uint8_t* dst, size_t dstWidth, size_t dstHeight, size_t dstStride) const;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* PyramidBuilderInit(size_t width, size_t height, size_t levels, double scale, SimdReduceType reduce, SimdBool compensation);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class PyramidBuilder : public Avx2::PyramidBuilder
+        {
+        public:
+            PyramidBuilder(const PyramidBuilderParam& param, Base::ResizerInitPtr resizerInit);
+
+        protected:
+            virtual void Reduce(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+                uint8_t* dst, size_t dstWidth, size_t dstHeight, size_t dstStride) const;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* PyramidBuilderInit(size_t width, size_t height, size_t levels, double scale, SimdReduceType reduce, SimdBool compensation);
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class PyramidBuilder : public Base::PyramidBuilder
+        {
+        public:
+            PyramidBuilder(const PyramidBuilderParam& param, Base::ResizerInitPtr resizerInit);
+
+        protected:
+            virtual void Reduce(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+                uint8_t* dst, size_t dstWidth, size_t dstHeight, size_t dstStride) const;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* PyramidBuilderInit(size_t width, size_t height, size_t levels, double scale, SimdReduceType reduce, SimdBool compensation);
+    }
+#endif
+}
+
+#endif
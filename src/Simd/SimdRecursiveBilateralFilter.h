@@ -90,9 +90,22 @@ namespace Simd
         typedef void (*FilterPtr)(const RbfParam& p, float* buf, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
 
     protected:
+        void InitStripes(size_t columnSize);
+
+        size_t StripeNumber() const
+        {
+            return _param.width / _stripe;
+        }
+
+        size_t StripeWidthMax() const
+        {
+            return _param.width - (StripeNumber() - 1) * _stripe;
+        }
+
         RbfParam _param;
         Array8u _buffer;
         FilterPtr _hFilter, _vFilter;
+        size_t _threads, _stripe, _size;
     };
 
     //-----------------------------------------------------------------------------------------
@@ -146,7 +159,7 @@ namespace Simd
             virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
 
         protected:
-            float* GetBuffer();
+            uint8_t* GetBuffer();
         };
 
         class RecursiveBilateralFilterFast : public Simd::RecursiveBilateralFilter
@@ -157,9 +170,9 @@ namespace Simd
             virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
 
         protected:
-            uint8_t* GetBuffer();
+            uint8_t* GetBuffer(size_t dstStride);
         private:
-            size_t _size, _stride;
+            size_t _stride;
         };
 
         void * RecursiveBilateralFilterInit(size_t width, size_t height, size_t channels, const float* sigmaSpatial, const float* sigmaRange, SimdRecursiveBilateralFilterFlags flags);
@@ -27,6 +27,9 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdMath.h"
 
+#include <vector>
+#include <map>
+
 #define SIMD_RESIZER_BICUBIC_BITS 7 // 7, 11
 
 namespace Simd
@@ -71,6 +74,18 @@ namespace Simd
                 (method == SimdResizeMethodBilinear || method == SimdResizeMethodBilinearCaffe || method == SimdResizeMethodBilinearPytorch);
         }
 
+        bool IsBf16Bilinear() const
+        {
+            return type == SimdResizeChannelBf16 &&
+                (method == SimdResizeMethodBilinear || method == SimdResizeMethodBilinearCaffe || method == SimdResizeMethodBilinearPytorch);
+        }
+
+        bool IsFilter() const
+        {
+            return (type == SimdResizeChannelFloat && (method == SimdResizeMethodBicubic || method == SimdResizeMethodArea || 
+                method == SimdResizeMethodAreaFast || method == SimdResizeMethodLanczos)) || (type == SimdResizeChannelByte && method == SimdResizeMethodLanczos);
+        }
+
         bool IsByteBicubic() const
         {
             return type == SimdResizeChannelByte && method == SimdResizeMethodBicubic;
@@ -107,13 +122,31 @@ namespace Simd
     public:
         Resizer(const ResParam & param)
             : _param(param)
+            , _yBeg(0)
+            , _yEnd(param.dstH)
+            , _bandBeg(0)
+            , _bandEnd(param.dstH)
         {
         }
 
         virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
 
+        void SetRows(size_t yBeg, size_t yEnd)
+        {
+            _yBeg = yBeg;
+            _yEnd = yEnd;
+        }
+
+        void SetBand(size_t yBeg, size_t yEnd)
+        {
+            SetRows(yBeg, yEnd);
+            _bandBeg = yBeg;
+            _bandEnd = yEnd;
+        }
+
     protected:
         ResParam _param;
+        size_t _yBeg, _yEnd, _bandBeg, _bandEnd;
     };
 
     //-------------------------------------------------------------------------------------------------
@@ -128,7 +161,7 @@ namespace Simd
             size_t _pixelSize;
             Array32i _ix, _iy;
 
-            void EstimateIndex(size_t srcSize, size_t dstSize, size_t channelSize, size_t channels, int32_t* indices);
+            void EstimateIndex(size_t srcSize, size_t dstSize, size_t beg, size_t end, size_t channelSize, size_t channels, int32_t* indices);
 
             void EstimateParams();
         public:
@@ -144,7 +177,8 @@ namespace Simd
         protected:
             Array32i _ax, _ix, _ay, _iy, _bx[2];
 
-            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, int32_t * alphas);
+            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t beg, size_t end, size_t channels, int32_t * indices, int32_t * alphas);
+            void EstimateRows();
         public:
             ResizerByteBilinear(const ResParam & param);
 
@@ -159,7 +193,8 @@ namespace Simd
             Array32i _ix, _iy;
             Array32f _ax, _ay, _bx[2];
 
-            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t* indices, float* alphas);
+            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t beg, size_t end, size_t channels, int32_t* indices, float* alphas);
+            void EstimateRows();
 
             template<size_t N> void RunB(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
             template<size_t N> void RunS(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
@@ -180,7 +215,8 @@ namespace Simd
             Array32i _ix, _iy;
             Array32f _ax, _ay, _bx[2];
 
-            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas);
+            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t beg, size_t end, size_t channels, int32_t * indices, float * alphas);
+            void EstimateRows();
 
             virtual void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
 
@@ -192,6 +228,25 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class ResizerBf16Bilinear : public Resizer
+        {
+        protected:
+            Array32i _ix, _iy;
+            Array32f _ax, _ay, _bx[2];
+
+            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t beg, size_t end, size_t channels, int32_t* indices, float* alphas);
+            void EstimateRows();
+
+            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+
+        public:
+            ResizerBf16Bilinear(const ResParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         const int32_t BICUBIC_RANGE = 1 << SIMD_RESIZER_BICUBIC_BITS;
         const int32_t BICUBIC_SHIFT = SIMD_RESIZER_BICUBIC_BITS * 2;
         const int32_t BICUBIC_ROUND = 1 << (BICUBIC_SHIFT - 1);
@@ -202,7 +257,7 @@ namespace Simd
             Array32i _ix, _iy, _ax, _ay, _bx[4];
             size_t _xn, _xt, _sxl;
 
-            void EstimateIndexAlpha(size_t sizeS, size_t sizeD, size_t N, Array32i& index, Array32i& alpha);
+            void EstimateIndexAlpha(size_t sizeS, size_t sizeD, size_t beg, size_t end, size_t N, Array32i& index, Array32i& alpha);
 
             void Init(bool sparse);
 
@@ -225,7 +280,7 @@ namespace Simd
         protected:
             Array32i _ax, _ix, _ay, _iy, _by;
 
-            void EstimateParams(size_t srcSize, size_t dstSize, size_t range, int32_t* alpha, int32_t* index);
+            void EstimateParams(size_t srcSize, size_t dstSize, size_t beg, size_t end, size_t range, int32_t* alpha, int32_t* index);
         public:
             ResizerByteArea(const ResParam& param);
         };
@@ -235,6 +290,8 @@ namespace Simd
         class ResizerByteArea1x1 : public ResizerByteArea
         {
         protected:
+            void EstimateRows();
+
             template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
         public:
             ResizerByteArea1x1(const ResParam& param);
@@ -247,6 +304,8 @@ namespace Simd
         class ResizerByteArea2x2 : public ResizerByteArea
         {
         protected:
+            void EstimateRows();
+
             template<size_t N> void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
         public:
             ResizerByteArea2x2(const ResParam& param);
@@ -256,7 +315,82 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class ResizerFilter : public Resizer
+        {
+        protected:
+            size_t _nx, _ny, _rs, _bs;
+            Array32i _ix, _iy, _by;
+            Array32f _ax, _ay, _bx, _sx;
+
+            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t& support, Array32i& index, Array32f& alpha);
+
+            virtual void ConvertRow(const uint8_t* src, float* dst);
+            virtual void FilterRow(const float* src, float* dst);
+            virtual void FilterCol(const float* const* src, const float* ay, uint8_t* dst);
+        public:
+            ResizerFilter(const ResParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        typedef void* (*ResizerInitPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        class ResizerParallel : public Resizer
+        {
+        public:
+            ResizerParallel(const ResParam& param, ResizerInitPtr init, size_t bands);
+            virtual ~ResizerParallel();
+
+            bool Ok() const { return _bands.size() > 0; }
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        private:
+            std::vector<Resizer*> _bands;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class CropResizer : public Deletable
+        {
+        public:
+            CropResizer(const ResParam& param, ResizerInitPtr init);
+            virtual ~CropResizer();
+
+            void Run(const uint8_t* src, size_t srcStride, const size_t* rects, size_t count, uint8_t* dst, size_t dstStride);
+
+        private:
+            struct Cached
+            {
+                Resizer* resizer;
+                size_t used;
+            };
+            typedef std::map<uint64_t, Cached> Resizers;
+
+            struct Cache
+            {
+                Resizers resizers;
+                size_t time;
+                Cache() : time(0) {}
+            };
+
+            Resizer* Get(size_t thread, size_t srcW, size_t srcH);
+
+            ResParam _param;
+            ResizerInitPtr _init;
+            size_t _threads;
+            std::vector<Cache> _caches;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerParallelInit(ResizerInitPtr init, size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * CropResizerInit(ResizerInitPtr init, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -330,6 +464,16 @@ namespace Simd
         public:
             ResizerFloatBilinear(const ResParam& param);
         };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerBf16Bilinear : public Base::ResizerBf16Bilinear
+        {
+        protected:
+            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+        public:
+            ResizerBf16Bilinear(const ResParam& param);
+        };
         
         //-------------------------------------------------------------------------------------------------
 
@@ -377,6 +521,18 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class ResizerFilter : public Base::ResizerFilter
+        {
+        protected:
+            virtual void ConvertRow(const uint8_t* src, float* dst);
+            virtual void FilterRow(const float* src, float* dst);
+            virtual void FilterCol(const float* const* src, const float* ay, uint8_t* dst);
+        public:
+            ResizerFilter(const ResParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_SSE41_ENABLE
@@ -437,6 +593,14 @@ namespace Simd
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerBf16Bilinear : public Sse41::ResizerBf16Bilinear
+        {
+        protected:
+            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+        public:
+            ResizerBf16Bilinear(const ResParam& param);
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         class ResizerByteBicubic : public Sse41::ResizerByteBicubic
@@ -476,6 +640,18 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class ResizerFilter : public Sse41::ResizerFilter
+        {
+        protected:
+            virtual void ConvertRow(const uint8_t* src, float* dst);
+            virtual void FilterRow(const float* src, float* dst);
+            virtual void FilterCol(const float* const* src, const float* ay, uint8_t* dst);
+        public:
+            ResizerFilter(const ResParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX2_ENABLE 
@@ -537,6 +713,14 @@ namespace Simd
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerBf16Bilinear : public Avx2::ResizerBf16Bilinear
+        {
+        protected:
+            virtual void Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride);
+        public:
+            ResizerBf16Bilinear(const ResParam& param);
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         class ResizerByteBicubic : public Avx2::ResizerByteBicubic
@@ -576,6 +760,18 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class ResizerFilter : public Avx2::ResizerFilter
+        {
+        protected:
+            virtual void ConvertRow(const uint8_t* src, float* dst);
+            virtual void FilterRow(const float* src, float* dst);
+            virtual void FilterCol(const float* const* src, const float* ay, uint8_t* dst);
+        public:
+            ResizerFilter(const ResParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX512BW_ENABLE 
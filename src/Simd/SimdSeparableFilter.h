@@ -0,0 +1,213 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSeparableFilter_h__
+#define __SimdSeparableFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct SepFilterParam
+    {
+        size_t width, height, channels;
+        SimdPixelFormatType srcType, dstType;
+        size_t rowSize, colSize;
+        SimdBorderType border;
+        float borderValue;
+
+        SepFilterParam(size_t w, size_t h, size_t c, SimdPixelFormatType st, SimdPixelFormatType dt, size_t rs, size_t cs, SimdBorderType b, const float* bv)
+            : width(w)
+            , height(h)
+            , channels(c)
+            , srcType(st)
+            , dstType(dt)
+            , rowSize(rs)
+            , colSize(cs)
+            , border(b)
+            , borderValue(bv ? *bv : 0.0f)
+        {
+        }
+
+        bool Valid() const
+        {
+            if (width == 0 || height == 0 || channels == 0 || channels > 4 || rowSize == 0 || colSize == 0)
+                return false;
+            if (!ValidType(srcType) || !ValidType(dstType))
+                return false;
+            if (border < SimdBorderReplicate || border > SimdBorderConstant)
+                return false;
+            return true;
+        }
+
+        static bool ValidType(SimdPixelFormatType type)
+        {
+            return type == SimdPixelFormatGray8 || type == SimdPixelFormatInt16 || type == SimdPixelFormatFloat;
+        }
+
+        static size_t TypeSize(SimdPixelFormatType type)
+        {
+            return type == SimdPixelFormatGray8 ? 1 : (type == SimdPixelFormatInt16 ? 2 : 4);
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class SeparableFilter : Deletable
+    {
+    public:
+        SeparableFilter(const SepFilterParam& param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        SepFilterParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        SIMD_INLINE ptrdiff_t BorderIndex(ptrdiff_t index, ptrdiff_t size, SimdBorderType border)
+        {
+            if (index >= 0 && index < size)
+                return index;
+            switch (border)
+            {
+            case SimdBorderReplicate:
+                return index < 0 ? 0 : size - 1;
+            case SimdBorderReflect:
+                while (index < 0 || index >= size)
+                    index = index < 0 ? -index - 1 : 2 * size - index - 1;
+                return index;
+            case SimdBorderMirror:
+                if (size == 1)
+                    return 0;
+                while (index < 0 || index >= size)
+                    index = index < 0 ? -index : 2 * size - index - 2;
+                return index;
+            default:
+                return -1;
+            }
+        }
+
+        template<SimdPixelFormatType type> SIMD_INLINE void SepFilterStore(float value, uint8_t* dst, size_t index);
+
+        template<> SIMD_INLINE void SepFilterStore<SimdPixelFormatGray8>(float value, uint8_t* dst, size_t index)
+        {
+            dst[index] = (uint8_t)RestrictRange(Round(value), 0, 255);
+        }
+
+        template<> SIMD_INLINE void SepFilterStore<SimdPixelFormatInt16>(float value, uint8_t* dst, size_t index)
+        {
+            ((int16_t*)dst)[index] = (int16_t)RestrictRange(Round(value), -32768, 32767);
+        }
+
+        template<> SIMD_INLINE void SepFilterStore<SimdPixelFormatFloat>(float value, uint8_t* dst, size_t index)
+        {
+            ((float*)dst)[index] = value;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        typedef void (*SepFilterLoadPtr)(const uint8_t* src, size_t size, float* dst);
+        typedef void (*SepFilterRowPtr)(const float* src, size_t size, size_t channels, const float* kernel, size_t kernelSize, float* dst);
+        typedef void (*SepFilterColPtr)(const float* src, size_t stride, size_t size, const float* kernel, size_t kernelSize, uint8_t* dst);
+
+        class SeparableFilterDefault : public Simd::SeparableFilter
+        {
+        public:
+            SeparableFilterDefault(const SepFilterParam& param, const float* rowKernel, const float* colKernel);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void SetRow(const uint8_t* src, size_t srcStride, ptrdiff_t row, float* dst);
+
+            size_t _size, _stride, _rowAnchor, _colAnchor;
+            Array32f _rowKernel, _colKernel, _buf, _rows;
+            SepFilterLoadPtr _load;
+            SepFilterRowPtr _row;
+            SepFilterColPtr _col;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType srcType, SimdPixelFormatType dstType,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize, SimdBorderType border, const float* borderValue);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SeparableFilterDefault : public Base::SeparableFilterDefault
+        {
+        public:
+            SeparableFilterDefault(const SepFilterParam& param, const float* rowKernel, const float* colKernel);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType srcType, SimdPixelFormatType dstType,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize, SimdBorderType border, const float* borderValue);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SeparableFilterDefault : public Sse41::SeparableFilterDefault
+        {
+        public:
+            SeparableFilterDefault(const SepFilterParam& param, const float* rowKernel, const float* colKernel);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType srcType, SimdPixelFormatType dstType,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize, SimdBorderType border, const float* borderValue);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SeparableFilterDefault : public Avx2::SeparableFilterDefault
+        {
+        public:
+            SeparableFilterDefault(const SepFilterParam& param, const float* rowKernel, const float* colKernel);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType srcType, SimdPixelFormatType dstType,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize, SimdBorderType border, const float* borderValue);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,210 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdInterleave.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i LoadMhc(const uint8_t* p)
+        {
+            return _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)p));
+        }
+
+        template<bool greenOdd> SIMD_INLINE void BayerMhc8(const uint8_t* const* rows, size_t x, __m128i& own, __m128i& green, __m128i& other)
+        {
+            const int mask = greenOdd ? 0xAA : 0x55;
+            const uint8_t* r0 = rows[0] + x, * r1 = rows[1] + x, * r2 = rows[2] + x, * r3 = rows[3] + x, * r4 = rows[4] + x;
+            __m128i c = LoadMhc(r2 + 2);
+            __m128i h1 = _mm_add_epi16(LoadMhc(r2 + 1), LoadMhc(r2 + 3));
+            __m128i h2 = _mm_add_epi16(LoadMhc(r2 + 0), LoadMhc(r2 + 4));
+            __m128i v1 = _mm_add_epi16(LoadMhc(r1 + 2), LoadMhc(r3 + 2));
+            __m128i v2 = _mm_add_epi16(LoadMhc(r0 + 2), LoadMhc(r4 + 2));
+            __m128i d = _mm_add_epi16(_mm_add_epi16(LoadMhc(r1 + 1), LoadMhc(r1 + 3)), _mm_add_epi16(LoadMhc(r3 + 1), LoadMhc(r3 + 3)));
+            __m128i hv2 = _mm_add_epi16(h2, v2);
+            __m128i c8 = _mm_slli_epi16(c, 3);
+            __m128i c10 = _mm_add_epi16(c8, _mm_slli_epi16(c, 1));
+            __m128i c16 = _mm_slli_epi16(c, 4);
+            __m128i gc = _mm_sub_epi16(_mm_add_epi16(c8, _mm_slli_epi16(_mm_add_epi16(h1, v1), 2)), _mm_slli_epi16(hv2, 1));
+            __m128i xd = _mm_add_epi16(_mm_add_epi16(c8, _mm_slli_epi16(c, 2)), _mm_slli_epi16(d, 2));
+            xd = _mm_sub_epi16(xd, _mm_add_epi16(hv2, _mm_slli_epi16(hv2, 1)));
+            __m128i hc = _mm_add_epi16(_mm_sub_epi16(_mm_add_epi16(c10, _mm_slli_epi16(h1, 3)), _mm_slli_epi16(_mm_add_epi16(h2, d), 1)), v2);
+            __m128i vc = _mm_add_epi16(_mm_sub_epi16(_mm_add_epi16(c10, _mm_slli_epi16(v1, 3)), _mm_slli_epi16(_mm_add_epi16(v2, d), 1)), h2);
+            own = _mm_srai_epi16(_mm_add_epi16(_mm_blend_epi16(c16, hc, mask), K16_0008), 4);
+            green = _mm_srai_epi16(_mm_add_epi16(_mm_blend_epi16(gc, c16, mask), K16_0008), 4);
+            other = _mm_srai_epi16(_mm_add_epi16(_mm_blend_epi16(xd, vc, mask), K16_0008), 4);
+        }
+
+        template<bool greenOdd> SIMD_INLINE void BayerMhc16(const uint8_t* const* rows, size_t x, bool redRow, __m128i bgr[3])
+        {
+            __m128i own0, green0, other0, own1, green1, other1;
+            BayerMhc8<greenOdd>(rows, x + 0, own0, green0, other0);
+            BayerMhc8<greenOdd>(rows, x + 8, own1, green1, other1);
+            bgr[redRow ? 2 : 0] = _mm_packus_epi16(own0, own1);
+            bgr[1] = _mm_packus_epi16(green0, green1);
+            bgr[redRow ? 0 : 2] = _mm_packus_epi16(other0, other1);
+        }
+
+        template<bool greenOdd> void BayerToBgrMhc(const uint8_t* const* rows, size_t width, bool redRow, uint8_t* bgr)
+        {
+            __m128i _bgr[3];
+            for (size_t col = 0; col < width;)
+            {
+                if (col + A > width)
+                    col = width - A;
+                BayerMhc16<greenOdd>(rows, col, redRow, _bgr);
+                uint8_t* dst = bgr + 3 * col;
+                _mm_storeu_si128((__m128i*)dst + 0, InterleaveBgr<0>(_bgr[0], _bgr[1], _bgr[2]));
+                _mm_storeu_si128((__m128i*)dst + 1, InterleaveBgr<1>(_bgr[0], _bgr[1], _bgr[2]));
+                _mm_storeu_si128((__m128i*)dst + 2, InterleaveBgr<2>(_bgr[0], _bgr[1], _bgr[2]));
+                col += A;
+            }
+        }
+
+        void BayerToBgrMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            Base::BayerMhcRows buffer(bayer, bayerStride, width, height);
+            const uint8_t* rows[5];
+            bool redRow, greenOdd;
+            for (size_t row = 0; row < height; ++row)
+            {
+                buffer.Get(row, rows);
+                Base::BayerMhcRowType(bayerFormat, row, redRow, greenOdd);
+                if (greenOdd)
+                    BayerToBgrMhc<true>(rows, width, redRow, bgr);
+                else
+                    BayerToBgrMhc<false>(rows, width, redRow, bgr);
+                bgr += bgrStride;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void StoreMhcBgra(const __m128i bgr[3], const __m128i& alpha, uint8_t* bgra)
+        {
+            __m128i bgLo = _mm_unpacklo_epi8(bgr[0], bgr[1]);
+            __m128i bgHi = _mm_unpackhi_epi8(bgr[0], bgr[1]);
+            __m128i raLo = _mm_unpacklo_epi8(bgr[2], alpha);
+            __m128i raHi = _mm_unpackhi_epi8(bgr[2], alpha);
+            _mm_storeu_si128((__m128i*)bgra + 0, _mm_unpacklo_epi16(bgLo, raLo));
+            _mm_storeu_si128((__m128i*)bgra + 1, _mm_unpackhi_epi16(bgLo, raLo));
+            _mm_storeu_si128((__m128i*)bgra + 2, _mm_unpacklo_epi16(bgHi, raHi));
+            _mm_storeu_si128((__m128i*)bgra + 3, _mm_unpackhi_epi16(bgHi, raHi));
+        }
+
+        template<bool greenOdd> void BayerToBgraMhc(const uint8_t* const* rows, size_t width, bool redRow, const __m128i& alpha, uint8_t* bgra)
+        {
+            __m128i bgr[3];
+            for (size_t col = 0; col < width;)
+            {
+                if (col + A > width)
+                    col = width - A;
+                BayerMhc16<greenOdd>(rows, col, redRow, bgr);
+                StoreMhcBgra(bgr, alpha, bgra + 4 * col);
+                col += A;
+            }
+        }
+
+        void BayerToBgraMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert(width >= A);
+
+            Base::BayerMhcRows buffer(bayer, bayerStride, width, height);
+            const uint8_t* rows[5];
+            bool redRow, greenOdd;
+            __m128i _alpha = _mm_set1_epi8((char)alpha);
+            for (size_t row = 0; row < height; ++row)
+            {
+                buffer.Get(row, rows);
+                Base::BayerMhcRowType(bayerFormat, row, redRow, greenOdd);
+                if (greenOdd)
+                    BayerToBgraMhc<true>(rows, width, redRow, _alpha, bgra);
+                else
+                    BayerToBgraMhc<false>(rows, width, redRow, _alpha, bgra);
+                bgra += bgraStride;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        const __m128i K16_MHC_BLUE_RED = SIMD_MM_SET2_EPI16(Base::BLUE_TO_GRAY_WEIGHT, Base::RED_TO_GRAY_WEIGHT);
+        const __m128i K16_MHC_GREEN_ROUND = SIMD_MM_SET2_EPI16(Base::GREEN_TO_GRAY_WEIGHT, Base::BGR_TO_GRAY_ROUND_TERM);
+
+        SIMD_INLINE __m128i MhcBgrToGray(__m128i blue, __m128i green, __m128i red)
+        {
+            blue = _mm_max_epi16(_mm_min_epi16(blue, K16_00FF), K_ZERO);
+            green = _mm_max_epi16(_mm_min_epi16(green, K16_00FF), K_ZERO);
+            red = _mm_max_epi16(_mm_min_epi16(red, K16_00FF), K_ZERO);
+            __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(blue, red), K16_MHC_BLUE_RED), _mm_madd_epi16(_mm_unpacklo_epi16(green, K16_0001), K16_MHC_GREEN_ROUND));
+            __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(blue, red), K16_MHC_BLUE_RED), _mm_madd_epi16(_mm_unpackhi_epi16(green, K16_0001), K16_MHC_GREEN_ROUND));
+            return _mm_packs_epi32(_mm_srai_epi32(lo, Base::BGR_TO_GRAY_AVERAGING_SHIFT), _mm_srai_epi32(hi, Base::BGR_TO_GRAY_AVERAGING_SHIFT));
+        }
+
+        template<bool greenOdd> SIMD_INLINE __m128i BayerToGrayMhc8(const uint8_t* const* rows, size_t x, bool redRow)
+        {
+            __m128i own, green, other;
+            BayerMhc8<greenOdd>(rows, x, own, green, other);
+            return redRow ? MhcBgrToGray(other, green, own) : MhcBgrToGray(own, green, other);
+        }
+
+        template<bool greenOdd> void BayerToGrayMhc(const uint8_t* const* rows, size_t width, bool redRow, uint8_t* gray)
+        {
+            for (size_t col = 0; col < width;)
+            {
+                if (col + A > width)
+                    col = width - A;
+                __m128i lo = BayerToGrayMhc8<greenOdd>(rows, col + 0, redRow);
+                __m128i hi = BayerToGrayMhc8<greenOdd>(rows, col + 8, redRow);
+                _mm_storeu_si128((__m128i*)(gray + col), _mm_packus_epi16(lo, hi));
+                col += A;
+            }
+        }
+
+        void BayerToGrayMhc(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* gray, size_t grayStride)
+        {
+            assert(width >= A);
+
+            Base::BayerMhcRows buffer(bayer, bayerStride, width, height);
+            const uint8_t* rows[5];
+            bool redRow, greenOdd;
+            for (size_t row = 0; row < height; ++row)
+            {
+                buffer.Get(row, rows);
+                Base::BayerMhcRowType(bayerFormat, row, redRow, greenOdd);
+                if (greenOdd)
+                    BayerToGrayMhc<true>(rows, width, redRow, gray);
+                else
+                    BayerToGrayMhc<false>(rows, width, redRow, gray);
+                gray += grayStride;
+            }
+        }
+    }
+#endif
+}
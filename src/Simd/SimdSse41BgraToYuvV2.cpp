@@ -344,6 +344,75 @@ namespace Simd
             default:
                 assert(0);
             }
+#endif
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T> SIMD_INLINE void BgraToNv12V2(const uint8_t* bgra0, size_t bgraStride, uint8_t* y0, size_t yStride, uint8_t* uv)
+        {
+            const uint8_t* bgra1 = bgra0 + bgraStride;
+            uint8_t* y1 = y0 + yStride;
+
+            __m128i _b16_r16[2][2][2], _g16_1[2][2][2];
+            Store<false>((__m128i*)y0 + 0, LoadAndBgrToY8<T>((__m128i*)bgra0 + 0, _b16_r16[0][0], _g16_1[0][0]));
+            Store<false>((__m128i*)y0 + 1, LoadAndBgrToY8<T>((__m128i*)bgra0 + 4, _b16_r16[0][1], _g16_1[0][1]));
+            Store<false>((__m128i*)y1 + 0, LoadAndBgrToY8<T>((__m128i*)bgra1 + 0, _b16_r16[1][0], _g16_1[1][0]));
+            Store<false>((__m128i*)y1 + 1, LoadAndBgrToY8<T>((__m128i*)bgra1 + 4, _b16_r16[1][1], _g16_1[1][1]));
+
+            Average16(_b16_r16[0][0][0], _b16_r16[1][0][0]);
+            Average16(_b16_r16[0][0][1], _b16_r16[1][0][1]);
+            Average16(_b16_r16[0][1][0], _b16_r16[1][1][0]);
+            Average16(_b16_r16[0][1][1], _b16_r16[1][1][1]);
+
+            Average16(_g16_1[0][0][0], _g16_1[1][0][0]);
+            Average16(_g16_1[0][0][1], _g16_1[1][0][1]);
+            Average16(_g16_1[0][1][0], _g16_1[1][1][0]);
+            Average16(_g16_1[0][1][1], _g16_1[1][1][1]);
+
+            __m128i _u = _mm_packus_epi16(BgrToU16<T>(_b16_r16[0][0], _g16_1[0][0]), BgrToU16<T>(_b16_r16[0][1], _g16_1[0][1]));
+            __m128i _v = _mm_packus_epi16(BgrToV16<T>(_b16_r16[0][0], _g16_1[0][0]), BgrToV16<T>(_b16_r16[0][1], _g16_1[0][1]));
+            Store<false>((__m128i*)uv + 0, _mm_unpacklo_epi8(_u, _v));
+            Store<false>((__m128i*)uv + 1, _mm_unpackhi_epi8(_u, _v));
+        }
+
+        template <class T>  void BgraToNv12V2(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height, uint8_t* y, size_t yStride,
+            uint8_t* uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+
+            size_t widthDA = AlignLo(width, DA);
+            const size_t A8 = A * 8;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgra = 0; colY < widthDA; colY += DA, colBgra += A8)
+                    BgraToNv12V2<T>(bgra + colBgra, bgraStride, y + colY, yStride, uv + colY);
+                if (width != widthDA)
+                {
+                    size_t colY = width - DA;
+                    BgraToNv12V2<T>(bgra + colY * 4, bgraStride, y + colY, yStride, uv + colY);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        void BgraToNv12V2(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height, uint8_t* y, size_t yStride,
+            uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+#if defined(SIMD_X86_ENABLE) && defined(NDEBUG) && defined(_MSC_VER) && _MSC_VER <= 1900
+            Base::BgraToNv12V2(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+#else
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToNv12V2<Base::Bt601>(bgra, bgraStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgraToNv12V2<Base::Bt709>(bgra, bgraStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgraToNv12V2<Base::Bt2020>(bgra, bgraStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvTrect871: BgraToNv12V2<Base::Trect871>(bgra, bgraStride, width, height, y, yStride, uv, uvStride); break;
+            default:
+                assert(0);
+            }
 #endif
         }
     }
@@ -0,0 +1,134 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE void BoxFilterCol8u(const uint8_t* add, const uint8_t* sub, uint32_t* sum)
+        {
+            __m128i a = _mm_loadu_si128((__m128i*)add);
+            __m128i s = _mm_loadu_si128((__m128i*)sub);
+            __m128i lo = _mm_sub_epi16(_mm_unpacklo_epi8(a, K_ZERO), _mm_unpacklo_epi8(s, K_ZERO));
+            __m128i hi = _mm_sub_epi16(_mm_unpackhi_epi8(a, K_ZERO), _mm_unpackhi_epi8(s, K_ZERO));
+            _mm_storeu_si128((__m128i*)sum + 0, _mm_add_epi32(_mm_loadu_si128((__m128i*)sum + 0), _mm_cvtepi16_epi32(lo)));
+            _mm_storeu_si128((__m128i*)sum + 1, _mm_add_epi32(_mm_loadu_si128((__m128i*)sum + 1), _mm_cvtepi16_epi32(_mm_srli_si128(lo, 8))));
+            _mm_storeu_si128((__m128i*)sum + 2, _mm_add_epi32(_mm_loadu_si128((__m128i*)sum + 2), _mm_cvtepi16_epi32(hi)));
+            _mm_storeu_si128((__m128i*)sum + 3, _mm_add_epi32(_mm_loadu_si128((__m128i*)sum + 3), _mm_cvtepi16_epi32(_mm_srli_si128(hi, 8))));
+        }
+
+        static void BoxFilterCol8u(const uint8_t* add, const uint8_t* sub, size_t size, uint8_t* sum)
+        {
+            uint32_t* ps = (uint32_t*)sum;
+            size_t sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+                BoxFilterCol8u(add + i, sub + i, ps + i);
+            for (; i < size; ++i)
+                ps[i] += add[i] - sub[i];
+        }
+
+        static void BoxFilterCol32f(const uint8_t* add, const uint8_t* sub, size_t size, uint8_t* sum)
+        {
+            const float* pa = (const float*)add, * pb = (const float*)sub;
+            float* ps = (float*)sum;
+            size_t sizeF = AlignLo(size, F), sizeF4 = AlignLo(size, 4 * F), i = 0;
+            for (; i < sizeF4; i += 4 * F)
+            {
+                _mm_storeu_ps(ps + i + 0 * F, _mm_add_ps(_mm_loadu_ps(ps + i + 0 * F), _mm_sub_ps(_mm_loadu_ps(pa + i + 0 * F), _mm_loadu_ps(pb + i + 0 * F))));
+                _mm_storeu_ps(ps + i + 1 * F, _mm_add_ps(_mm_loadu_ps(ps + i + 1 * F), _mm_sub_ps(_mm_loadu_ps(pa + i + 1 * F), _mm_loadu_ps(pb + i + 1 * F))));
+                _mm_storeu_ps(ps + i + 2 * F, _mm_add_ps(_mm_loadu_ps(ps + i + 2 * F), _mm_sub_ps(_mm_loadu_ps(pa + i + 2 * F), _mm_loadu_ps(pb + i + 2 * F))));
+                _mm_storeu_ps(ps + i + 3 * F, _mm_add_ps(_mm_loadu_ps(ps + i + 3 * F), _mm_sub_ps(_mm_loadu_ps(pa + i + 3 * F), _mm_loadu_ps(pb + i + 3 * F))));
+            }
+            for (; i < sizeF; i += F)
+                _mm_storeu_ps(ps + i, _mm_add_ps(_mm_loadu_ps(ps + i), _mm_sub_ps(_mm_loadu_ps(pa + i), _mm_loadu_ps(pb + i))));
+            for (; i < size; ++i)
+                ps[i] += pa[i] - pb[i];
+        }
+
+        SIMD_INLINE __m128i BoxFilterScale(const uint32_t* sum, __m128 scale)
+        {
+            return _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((__m128i*)sum)), scale));
+        }
+
+        static void BoxFilterStore8u(const uint8_t* sum, size_t size, float scale, uint8_t* dst)
+        {
+            const uint32_t* ps = (const uint32_t*)sum;
+            __m128 _scale = _mm_set1_ps(scale);
+            size_t sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+            {
+                __m128i lo = _mm_packs_epi32(BoxFilterScale(ps + i + 0 * F, _scale), BoxFilterScale(ps + i + 1 * F, _scale));
+                __m128i hi = _mm_packs_epi32(BoxFilterScale(ps + i + 2 * F, _scale), BoxFilterScale(ps + i + 3 * F, _scale));
+                _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+            }
+            for (; i < size; ++i)
+                dst[i] = (uint8_t)Simd::Min(Round(float(ps[i]) * scale), 255);
+        }
+
+        static void BoxFilterStore32f(const uint8_t* sum, size_t size, float scale, uint8_t* dst)
+        {
+            const float* ps = (const float*)sum;
+            float* pd = (float*)dst;
+            __m128 _scale = _mm_set1_ps(scale);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm_storeu_ps(pd + i, _mm_mul_ps(_mm_loadu_ps(ps + i), _scale));
+            for (; i < size; ++i)
+                pd[i] = ps[i] * scale;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        BoxFilterDefault::BoxFilterDefault(const BoxFilterParam& param)
+            : Base::BoxFilterDefault(param)
+        {
+            if (_param.type == SimdPixelFormatGray8)
+            {
+                _col = BoxFilterCol8u;
+                _store = BoxFilterStore8u;
+            }
+            else
+            {
+                _col = BoxFilterCol32f;
+                _store = BoxFilterStore32f;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type,
+            size_t radiusX, size_t radiusY, SimdBorderType border, const float* borderValue)
+        {
+            BoxFilterParam param(width, height, channels, type, radiusX, radiusY, border, borderValue);
+            if (!param.Valid())
+                return NULL;
+            return new BoxFilterDefault(param);
+        }
+    }
+#endif
+}
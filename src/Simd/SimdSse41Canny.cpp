@@ -0,0 +1,157 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template<bool l2> SIMD_INLINE __m128i CannyMagnitude(__m128i dx, __m128i dy)
+        {
+            return l2 ? _mm_add_epi32(_mm_mullo_epi32(dx, dx), _mm_mullo_epi32(dy, dy)) : _mm_add_epi32(_mm_abs_epi32(dx), _mm_abs_epi32(dy));
+        }
+
+        SIMD_INLINE __m128i CannyDirection(__m128i dx, __m128i dy)
+        {
+            __m128i ax = _mm_abs_epi32(dx), ay = _mm_slli_epi32(_mm_abs_epi32(dy), 15);
+            __m128i tg22x = _mm_mullo_epi32(ax, _mm_set1_epi32(Base::CANNY_TG22));
+            __m128i tg67x = _mm_add_epi32(tg22x, _mm_slli_epi32(ax, 16));
+            __m128i dir = _mm_sub_epi32(_mm_set1_epi32(Base::CannyDirMainDiagonal), _mm_srai_epi32(_mm_xor_si128(dx, dy), 31));
+            dir = _mm_blendv_epi8(dir, _mm_set1_epi32(Base::CannyDirVertical), _mm_cmpgt_epi32(ay, tg67x));
+            return _mm_blendv_epi8(dir, _mm_set1_epi32(Base::CannyDirHorizontal), _mm_cmpgt_epi32(tg22x, ay));
+        }
+
+        SIMD_INLINE __m128i LoadU8(const uint8_t* src)
+        {
+            return _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)src));
+        }
+
+        template<bool l2> SIMD_INLINE void CannyGradient(const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, size_t x, int32_t* mag, uint8_t* dir)
+        {
+            __m128i a0 = LoadU8(s0 + x - 1), b0 = LoadU8(s0 + x), c0 = LoadU8(s0 + x + 1);
+            __m128i a1 = LoadU8(s1 + x - 1), c1 = LoadU8(s1 + x + 1);
+            __m128i a2 = LoadU8(s2 + x - 1), b2 = LoadU8(s2 + x), c2 = LoadU8(s2 + x + 1);
+            __m128i dx = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(c0, c2), _mm_slli_epi16(c1, 1)), _mm_add_epi16(_mm_add_epi16(a0, a2), _mm_slli_epi16(a1, 1)));
+            __m128i dy = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(a2, c2), _mm_slli_epi16(b2, 1)), _mm_add_epi16(_mm_add_epi16(a0, c0), _mm_slli_epi16(b0, 1)));
+            __m128i dx0 = _mm_cvtepi16_epi32(dx), dx1 = _mm_cvtepi16_epi32(_mm_srli_si128(dx, 8));
+            __m128i dy0 = _mm_cvtepi16_epi32(dy), dy1 = _mm_cvtepi16_epi32(_mm_srli_si128(dy, 8));
+            _mm_storeu_si128((__m128i*)(mag + x) + 0, CannyMagnitude<l2>(dx0, dy0));
+            _mm_storeu_si128((__m128i*)(mag + x) + 1, CannyMagnitude<l2>(dx1, dy1));
+            __m128i d16 = _mm_packs_epi32(CannyDirection(dx0, dy0), CannyDirection(dx1, dy1));
+            _mm_storel_epi64((__m128i*)(dir + x), _mm_packus_epi16(d16, K_ZERO));
+        }
+
+        template<bool l2> void CannyGradientRow(const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, size_t width, int32_t* mag, uint8_t* dir)
+        {
+            if (width < HA + 2)
+            {
+                for (size_t x = 0; x < width; ++x)
+                    Base::CannyGradient<l2>(s0, s1, s2, x ? x - 1 : 0, x, Simd::Min(x + 1, width - 1), mag, dir);
+                return;
+            }
+            Base::CannyGradient<l2>(s0, s1, s2, 0, 0, 1, mag, dir);
+            size_t body = width - 1, x = 1;
+            for (; x + HA <= body; x += HA)
+                CannyGradient<l2>(s0, s1, s2, x, mag, dir);
+            if (x < body)
+                CannyGradient<l2>(s0, s1, s2, body - HA, mag, dir);
+            Base::CannyGradient<l2>(s0, s1, s2, width - 2, width - 1, width - 1, mag, dir);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128i CannyNms(const int32_t* m0, const int32_t* m1, const int32_t* m2, const uint8_t* dir, size_t x, __m128i low, __m128i high)
+        {
+            __m128i m = _mm_loadu_si128((__m128i*)(m1 + x));
+            __m128i d = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)(dir + x)));
+            __m128i isH = _mm_cmpeq_epi32(d, _mm_set1_epi32(Base::CannyDirHorizontal));
+            __m128i isV = _mm_cmpeq_epi32(d, _mm_set1_epi32(Base::CannyDirVertical));
+            __m128i isM = _mm_cmpeq_epi32(d, _mm_set1_epi32(Base::CannyDirMainDiagonal));
+            __m128i prev = _mm_blendv_epi8(_mm_loadu_si128((__m128i*)(m0 + x + 1)), _mm_loadu_si128((__m128i*)(m0 + x - 1)), isM);
+            prev = _mm_blendv_epi8(prev, _mm_loadu_si128((__m128i*)(m0 + x)), isV);
+            prev = _mm_blendv_epi8(prev, _mm_loadu_si128((__m128i*)(m1 + x - 1)), isH);
+            __m128i next = _mm_blendv_epi8(_mm_loadu_si128((__m128i*)(m2 + x - 1)), _mm_loadu_si128((__m128i*)(m2 + x + 1)), isM);
+            next = _mm_blendv_epi8(next, _mm_loadu_si128((__m128i*)(m2 + x)), isV);
+            next = _mm_blendv_epi8(next, _mm_loadu_si128((__m128i*)(m1 + x + 1)), isH);
+            __m128i cand = _mm_andnot_si128(_mm_cmpgt_epi32(next, m), _mm_and_si128(_mm_cmpgt_epi32(m, low), _mm_cmpgt_epi32(m, prev)));
+            __m128i strong = _mm_and_si128(cand, _mm_cmpgt_epi32(m, high));
+            return _mm_sub_epi32(K_ZERO, _mm_add_epi32(cand, strong));
+        }
+
+        static void CannyNmsRow(const int32_t* m0, const int32_t* m1, const int32_t* m2, const uint8_t* dir, size_t width, int32_t low, int32_t high, uint8_t* map)
+        {
+            __m128i _low = _mm_set1_epi32(low), _high = _mm_set1_epi32(high);
+            size_t widthF = AlignLo(width, F), widthA = AlignLo(width, A), x = 0;
+            for (; x < widthA; x += A)
+            {
+                __m128i lo = _mm_packs_epi32(CannyNms(m0, m1, m2, dir, x + 0 * F, _low, _high), CannyNms(m0, m1, m2, dir, x + 1 * F, _low, _high));
+                __m128i hi = _mm_packs_epi32(CannyNms(m0, m1, m2, dir, x + 2 * F, _low, _high), CannyNms(m0, m1, m2, dir, x + 3 * F, _low, _high));
+                _mm_storeu_si128((__m128i*)(map + x), _mm_packus_epi16(lo, hi));
+            }
+            for (; x < widthF; x += F)
+            {
+                __m128i codes = _mm_packus_epi16(_mm_packs_epi32(CannyNms(m0, m1, m2, dir, x, _low, _high), K_ZERO), K_ZERO);
+                *(int32_t*)(map + x) = _mm_cvtsi128_si32(codes);
+            }
+            for (; x < width; ++x)
+                map[x] = Base::CannyNms(m0, m1, m2, dir, x, low, high);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void CannyOutput(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            __m128i edge = _mm_set1_epi8(2);
+            size_t widthA = AlignLo(width, A), x = 0;
+            for (; x < widthA; x += A)
+                _mm_storeu_si128((__m128i*)(dst + x), _mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(map + x)), edge));
+            for (; x < width; ++x)
+                dst[x] = map[x] == 2 ? 0xFF : 0x00;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        CannyDefault::CannyDefault(const CannyParam& param)
+            : Base::CannyDefault(param)
+        {
+            _gradient = _param.l2 ? CannyGradientRow<true> : CannyGradientRow<false>;
+            _nms = CannyNmsRow;
+            _output = CannyOutput;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CannyInit(size_t width, size_t height, float low, float high, SimdBool l2)
+        {
+            CannyParam param(width, height, low, high, l2);
+            if (!param.Valid())
+                return NULL;
+            return new CannyDefault(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,113 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdConnectedComponents.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void CclRowRuns(const uint8_t* mask, size_t width, Base::CclRuns& runs)
+        {
+            size_t widthA = AlignLo(width, A), x = 0, beg = 0;
+            bool open = false;
+            __m128i zero = _mm_setzero_si128();
+            for (; x < widthA; x += A)
+            {
+                int zeros = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(mask + x)), zero));
+                if (zeros == (open ? 0x0000 : 0xFFFF))
+                    continue;
+                for (size_t i = 0; i < A; ++i)
+                {
+                    bool on = ((zeros >> i) & 1) == 0;
+                    if (on != open)
+                    {
+                        if (on)
+                            beg = x + i;
+                        else
+                            runs.push_back(Base::CclRun((uint32_t)beg, uint32_t(x + i), (uint32_t)runs.size()));
+                        open = on;
+                    }
+                }
+            }
+            for (; x < width; ++x)
+            {
+                bool on = mask[x] != 0;
+                if (on != open)
+                {
+                    if (on)
+                        beg = x;
+                    else
+                        runs.push_back(Base::CclRun((uint32_t)beg, (uint32_t)x, (uint32_t)runs.size()));
+                    open = on;
+                }
+            }
+            if (open)
+                runs.push_back(Base::CclRun((uint32_t)beg, (uint32_t)width, (uint32_t)runs.size()));
+        }
+
+        SIMD_INLINE void CclFill(uint32_t* dst, size_t beg, size_t end, uint32_t value)
+        {
+            __m128i _value = _mm_set1_epi32(value);
+            size_t x = beg;
+            for (; x + F <= end; x += F)
+                _mm_storeu_si128((__m128i*)(dst + x), _value);
+            for (; x < end; ++x)
+                dst[x] = value;
+        }
+
+        void CclFillRow(const Base::CclRun* runs, size_t count, size_t width, const uint32_t* ids, uint32_t* dst)
+        {
+            size_t x = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                CclFill(dst, x, runs[i].beg, 0);
+                CclFill(dst, runs[i].beg, runs[i].end, ids[i]);
+                x = runs[i].end;
+            }
+            CclFill(dst, x, width, 0);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ConnectedComponentsDefault::ConnectedComponentsDefault(const ConnectedComponentsParam& param)
+            : Base::ConnectedComponentsDefault(param)
+        {
+            _rowRuns = CclRowRuns;
+            _fillRow = CclFillRow;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ConnectedComponentsInit(size_t width, size_t height, size_t connectivity)
+        {
+            ConnectedComponentsParam param(width, height, connectivity);
+            if (!param.Valid())
+                return NULL;
+            return new ConnectedComponentsDefault(param);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
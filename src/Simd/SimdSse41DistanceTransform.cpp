@@ -0,0 +1,220 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistanceTransform.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i DistanceMasked(const uint8_t* src, __m128i value)
+        {
+            return _mm_andnot_si128(_mm_cmpeq_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)src)), _mm_setzero_si128()), value);
+        }
+
+        SIMD_INLINE void DistanceColsFirst(const uint8_t* src, int32_t* dst, __m128i inf)
+        {
+            _mm_storeu_si128((__m128i*)dst, DistanceMasked(src, inf));
+        }
+
+        SIMD_INLINE void DistanceColsDown(const uint8_t* src, const int32_t* prev, int32_t* dst, __m128i inf, __m128i one)
+        {
+            __m128i p = _mm_add_epi32(_mm_loadu_si128((__m128i*)prev), one);
+            _mm_storeu_si128((__m128i*)dst, DistanceMasked(src, _mm_min_epi32(p, inf)));
+        }
+
+        SIMD_INLINE void DistanceColsUp(const int32_t* next, int32_t* dst, __m128i one)
+        {
+            __m128i n = _mm_add_epi32(_mm_loadu_si128((__m128i*)next), one);
+            _mm_storeu_si128((__m128i*)dst, _mm_min_epi32(_mm_loadu_si128((__m128i*)dst), n));
+        }
+
+        void DistanceCols(const uint8_t* src, size_t srcStride, size_t size, size_t height, int32_t* dst, size_t dstStride)
+        {
+            if (size < F)
+            {
+                Base::DistanceCols(src, srcStride, size, height, dst, dstStride);
+                return;
+            }
+            __m128i inf = _mm_set1_epi32(Base::DISTANCE_INF), one = _mm_set1_epi32(1);
+            size_t sizeF = AlignLo(size, F), tail = size - F, x;
+            for (x = 0; x < sizeF; x += F)
+                DistanceColsFirst(src + x, dst + x, inf);
+            if (sizeF < size)
+                DistanceColsFirst(src + tail, dst + tail, inf);
+            for (size_t y = 1; y < height; ++y)
+            {
+                const uint8_t* s = src + y * srcStride;
+                const int32_t* p = dst + (y - 1) * dstStride;
+                int32_t* d = dst + y * dstStride;
+                for (x = 0; x < sizeF; x += F)
+                    DistanceColsDown(s + x, p + x, d + x, inf, one);
+                if (sizeF < size)
+                    DistanceColsDown(s + tail, p + tail, d + tail, inf, one);
+            }
+            for (size_t y = height - 2; y < height; --y)
+            {
+                const int32_t* n = dst + (y + 1) * dstStride;
+                int32_t* d = dst + y * dstStride;
+                for (x = 0; x < sizeF; x += F)
+                    DistanceColsUp(n + x, d + x, one);
+                if (sizeF < size)
+                    DistanceColsUp(n + tail, d + tail, one);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<bool five> SIMD_INLINE __m128i DistanceChamfer(const int32_t* r1, const int32_t* r2, const __m128i* w)
+        {
+            __m128i d = _mm_min_epi32(_mm_add_epi32(_mm_loadu_si128((__m128i*)r1), w[0]),
+                _mm_add_epi32(_mm_min_epi32(_mm_loadu_si128((__m128i*)(r1 - 1)), _mm_loadu_si128((__m128i*)(r1 + 1))), w[1]));
+            if (five)
+            {
+                __m128i d1 = _mm_min_epi32(_mm_loadu_si128((__m128i*)(r1 - 2)), _mm_loadu_si128((__m128i*)(r1 + 2)));
+                __m128i d2 = _mm_min_epi32(_mm_loadu_si128((__m128i*)(r2 - 1)), _mm_loadu_si128((__m128i*)(r2 + 1)));
+                d = _mm_min_epi32(d, _mm_add_epi32(_mm_min_epi32(d1, d2), w[2]));
+            }
+            return d;
+        }
+
+        template<bool five> SIMD_INLINE void DistanceForward(const uint8_t* src, const int32_t* r1, const int32_t* r2, const __m128i* w, int32_t* dst)
+        {
+            __m128i d = _mm_min_epi32(DistanceChamfer<five>(r1, r2, w), w[3]);
+            _mm_storeu_si128((__m128i*)dst, DistanceMasked(src, d));
+        }
+
+        template<bool five> void DistanceChamferForward(const uint8_t* src, const int32_t* r1, const int32_t* r2, size_t width, const int32_t* weight, int32_t* dst)
+        {
+            if (width < F)
+            {
+                Base::DistanceChamferForward<five>(src, r1, r2, width, weight, dst);
+                return;
+            }
+            __m128i w[4] = { _mm_set1_epi32(weight[0]), _mm_set1_epi32(weight[1]), _mm_set1_epi32(weight[2]), _mm_set1_epi32(Base::DISTANCE_INF) };
+            size_t widthF = AlignLo(width, F), tail = width - F;
+            for (size_t x = 0; x < widthF; x += F)
+                DistanceForward<five>(src + x, r1 + x, r2 + x, w, dst + x);
+            if (widthF < width)
+                DistanceForward<five>(src + tail, r1 + tail, r2 + tail, w, dst + tail);
+        }
+
+        template<bool five> SIMD_INLINE void DistanceBackward(const int32_t* r1, const int32_t* r2, const __m128i* w, int32_t* dst)
+        {
+            _mm_storeu_si128((__m128i*)dst, _mm_min_epi32(_mm_loadu_si128((__m128i*)dst), DistanceChamfer<five>(r1, r2, w)));
+        }
+
+        template<bool five> void DistanceChamferBackward(const uint8_t* src, const int32_t* r1, const int32_t* r2, size_t width, const int32_t* weight, int32_t* dst)
+        {
+            if (width < F)
+            {
+                Base::DistanceChamferBackward<five>(src, r1, r2, width, weight, dst);
+                return;
+            }
+            __m128i w[3] = { _mm_set1_epi32(weight[0]), _mm_set1_epi32(weight[1]), _mm_set1_epi32(weight[2]) };
+            size_t widthF = AlignLo(width, F), tail = width - F;
+            for (size_t x = 0; x < widthF; x += F)
+                DistanceBackward<five>(r1 + x, r2 + x, w, dst + x);
+            if (widthF < width)
+                DistanceBackward<five>(r1 + tail, r2 + tail, w, dst + tail);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void DistanceStoreSq(const float* src, size_t size, uint8_t* dst)
+        {
+            float* d = (float*)dst;
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm_storeu_ps(d + i, _mm_sqrt_ps(_mm_loadu_ps(src + i)));
+            for (; i < size; ++i)
+                d[i] = ::sqrt(src[i]);
+        }
+
+        void DistanceStoreSq16u(const float* src, size_t size, uint8_t* dst)
+        {
+            uint16_t* d = (uint16_t*)dst;
+            size_t sizeDF = AlignLo(size, DF), i = 0;
+            for (; i < sizeDF; i += DF)
+            {
+                __m128i d0 = _mm_cvtps_epi32(_mm_sqrt_ps(_mm_loadu_ps(src + i + 0)));
+                __m128i d1 = _mm_cvtps_epi32(_mm_sqrt_ps(_mm_loadu_ps(src + i + F)));
+                _mm_storeu_si128((__m128i*)(d + i), _mm_packus_epi32(d0, d1));
+            }
+            for (; i < size; ++i)
+                d[i] = (uint16_t)Simd::Min(Round(::sqrt(src[i])), 0xFFFF);
+        }
+
+        void DistanceStoreInt(const int32_t* src, size_t size, float scale, uint8_t* dst)
+        {
+            float* d = (float*)dst;
+            __m128 _scale = _mm_set1_ps(scale);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm_storeu_ps(d + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((__m128i*)(src + i))), _scale));
+            for (; i < size; ++i)
+                d[i] = float(src[i]) * scale;
+        }
+
+        void DistanceStoreInt16u(const int32_t* src, size_t size, float scale, uint8_t* dst)
+        {
+            uint16_t* d = (uint16_t*)dst;
+            __m128 _scale = _mm_set1_ps(scale);
+            size_t sizeDF = AlignLo(size, DF), i = 0;
+            for (; i < sizeDF; i += DF)
+            {
+                __m128i d0 = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((__m128i*)(src + i + 0))), _scale));
+                __m128i d1 = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((__m128i*)(src + i + F))), _scale));
+                _mm_storeu_si128((__m128i*)(d + i), _mm_packus_epi32(d0, d1));
+            }
+            for (; i < size; ++i)
+                d[i] = (uint16_t)Simd::Min(Round(float(src[i]) * scale), 0xFFFF);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        DistanceTransformDefault::DistanceTransformDefault(const DistanceTransformParam& param)
+            : Base::DistanceTransformDefault(param)
+        {
+            bool f32 = _param.format == SimdPixelFormatFloat, five = _param.type == SimdDistanceChamfer5x5;
+            _cols = DistanceCols;
+            _forward = five ? DistanceChamferForward<true> : DistanceChamferForward<false>;
+            _backward = five ? DistanceChamferBackward<true> : DistanceChamferBackward<false>;
+            _storeSq = f32 ? DistanceStoreSq : DistanceStoreSq16u;
+            _storeInt = f32 ? DistanceStoreInt : DistanceStoreInt16u;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceType type, SimdPixelFormatType format)
+        {
+            DistanceTransformParam param(width, height, type, format);
+            if (!param.Valid())
+                return NULL;
+            return new DistanceTransformDefault(param);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
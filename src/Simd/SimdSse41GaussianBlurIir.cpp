@@ -0,0 +1,137 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdTranspose.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        struct IirRow
+        {
+            static SIMD_INLINE void Run(const float* p1, const float* p2, const float* p3, size_t size, const Base::AlgIir& a, float* dst)
+            {
+                __m128 b = _mm_set1_ps(a.b), a1 = _mm_set1_ps(a.a1), a2 = _mm_set1_ps(a.a2), a3 = _mm_set1_ps(a.a3);
+                size_t sizeF = AlignLo(size, F), x = 0;
+                for (; x < sizeF; x += F)
+                {
+                    __m128 sum = _mm_add_ps(_mm_mul_ps(b, _mm_loadu_ps(dst + x)), _mm_mul_ps(a1, _mm_loadu_ps(p1 + x)));
+                    sum = _mm_add_ps(sum, _mm_mul_ps(a2, _mm_loadu_ps(p2 + x)));
+                    _mm_storeu_ps(dst + x, _mm_add_ps(sum, _mm_mul_ps(a3, _mm_loadu_ps(p3 + x))));
+                }
+                for (; x < size; ++x)
+                    dst[x] = a.b * dst[x] + a.a1 * p1[x] + a.a2 * p2[x] + a.a3 * p3[x];
+            }
+        };
+
+        SIMD_INLINE void LoadIir(const uint8_t* src, float* dst)
+        {
+            _mm_storeu_ps(dst, _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)src))));
+        }
+
+        SIMD_INLINE void LoadIir(const float* src, float* dst)
+        {
+            _mm_storeu_ps(dst, _mm_loadu_ps(src));
+        }
+
+        template<class T> void BlurIirHor(const BlurParam& p, const Base::AlgIir& a, const uint8_t* src, size_t srcStride, size_t rows, float* buf, float* dst, size_t dstStride)
+        {
+            size_t size = p.width * p.channels, sizeF = AlignLo(size, F), i;
+            const T* s[F];
+            for (size_t r = 0; r < F; ++r)
+                s[r] = (const T*)(src + Simd::Min(r, rows - 1) * srcStride);
+            float tmp[F * F];
+            for (i = 0; i < sizeF; i += F)
+            {
+                for (size_t r = 0; r < F; ++r)
+                    LoadIir(s[r] + i, tmp + r * F);
+                Transpose4x4<false>(tmp, F, buf + i * F, F);
+            }
+            for (; i < size; ++i)
+                for (size_t r = 0; r < F; ++r)
+                    buf[i * F + r] = float(s[r][i]);
+            Base::GaussianBlurIirPass<IirRow>(buf, F, size, p.channels, F, a, [](size_t, const float*) {});
+            if (rows == F)
+            {
+                for (i = 0; i < sizeF; i += F)
+                    Transpose4x4<false>(buf + i * F, F, dst + i, dstStride);
+                for (; i < size; ++i)
+                    for (size_t r = 0; r < F; ++r)
+                        dst[r * dstStride + i] = buf[i * F + r];
+            }
+            else
+            {
+                for (i = 0; i < size; ++i)
+                    for (size_t r = 0; r < rows; ++r)
+                        dst[r * dstStride + i] = buf[i * F + r];
+            }
+        }
+
+        SIMD_INLINE void StoreIir(const float* src, size_t size, uint8_t* dst)
+        {
+            size_t size16 = AlignLo(size, A), i = 0;
+            for (; i < size16; i += A)
+            {
+                __m128i i0 = _mm_packs_epi32(_mm_cvtps_epi32(_mm_loadu_ps(src + i + 0 * F)), _mm_cvtps_epi32(_mm_loadu_ps(src + i + 1 * F)));
+                __m128i i1 = _mm_packs_epi32(_mm_cvtps_epi32(_mm_loadu_ps(src + i + 2 * F)), _mm_cvtps_epi32(_mm_loadu_ps(src + i + 3 * F)));
+                _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(i0, i1));
+            }
+            for (; i < size; ++i)
+                dst[i] = (uint8_t)Base::RestrictRange(Round(src[i]), 0, 255);
+        }
+
+        SIMD_INLINE void StoreIir(const float* src, size_t size, float* dst)
+        {
+            memcpy(dst, src, size * sizeof(float));
+        }
+
+        template<class T> void BlurIirVer(const BlurParam& p, const Base::AlgIir& a, float* buf, size_t stride, size_t size, uint8_t* dst, size_t dstStride)
+        {
+            Base::GaussianBlurIirPass<IirRow>(buf, stride, p.height, 1, size, a, [&](size_t y, const float* row) { StoreIir(row, size, (T*)(dst + y * dstStride)); });
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianBlurIir::GaussianBlurIir(const BlurParam& param, SimdPixelFormatType type)
+            : Base::GaussianBlurIir(param, type)
+        {
+            _hor = _type == SimdPixelFormatGray8 ? BlurIirHor<uint8_t> : BlurIirHor<float>;
+            _ver = _type == SimdPixelFormatGray8 ? BlurIirVer<uint8_t> : BlurIirVer<float>;
+            InitBuffers(F);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* GaussianBlurIirInit(size_t width, size_t height, size_t channels, SimdPixelFormatType type, const float* sigma)
+        {
+            BlurParam param(width, height, channels, sigma, NULL, A);
+            if (!param.Valid() || param.sigma < 0.5f || (type != SimdPixelFormatGray8 && type != SimdPixelFormatFloat))
+                return NULL;
+            return new GaussianBlurIir(param, type);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
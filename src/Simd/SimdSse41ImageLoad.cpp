@@ -135,6 +135,7 @@ namespace Simd
             case SimdImageFilePpmBin: return new ImagePpmBinLoader(param);
             case SimdImageFilePng: return new ImagePngLoader(param);
             case SimdImageFileJpeg: return new ImageJpegLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
             default:
                 return NULL;
             }
@@ -154,6 +155,11 @@ namespace Simd
             }
             return NULL;
         }
+
+        void* ImageMapFromFile(const char* path, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            return Simd::ImageMapFromFile(CreateImageLoader, path, width, height, format);
+        }
     }
 #endif// SIMD_SSE41_ENABLE
 }
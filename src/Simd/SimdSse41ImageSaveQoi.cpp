@@ -0,0 +1,163 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        const __m128i K8_QOI_RGB_TO_RGBA = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, -1, 0x3, 0x4, 0x5, -1, 0x6, 0x7, 0x8, -1, 0x9, 0xA, 0xB, -1);
+        const __m128i K8_QOI_GREEN = SIMD_MM_SETR_EPI8(0x1, 0x1, 0x1, 0x1, 0x5, 0x5, 0x5, 0x5, 0x9, 0x9, 0x9, 0x9, 0xD, 0xD, 0xD, 0xD);
+        const __m128i K8_QOI_HASH = SIMD_MM_SETR_EPI8(3, 5, 7, 11, 3, 5, 7, 11, 3, 5, 7, 11, 3, 5, 7, 11);
+        const __m128i K8_QOI_DIFF = SIMD_MM_SETR_EPI8(16, 4, 1, 0, 16, 4, 1, 0, 16, 4, 1, 0, 16, 4, 1, 0);
+        const __m128i K8_QOI_LUMA = SIMD_MM_SETR_EPI8(16, 0, 1, 0, 16, 0, 1, 0, 16, 0, 1, 0, 16, 0, 1, 0);
+        const __m128i K8_QOI_LUMA_BIAS = SIMD_MM_SETR_EPI8(8, 32, 8, 0, 8, 32, 8, 0, 8, 32, 8, 0, 8, 32, 8, 0);
+        const __m128i K32_QOI_DIFF_MASK = SIMD_MM_SET1_EPI32(0x00FCFCFC);
+        const __m128i K32_QOI_LUMA_MASK = SIMD_MM_SET1_EPI32(0x00F0C0F0);
+        const __m128i K32_QOI_GREEN_MASK = SIMD_MM_SET1_EPI32(0x0000FF00);
+        const __m128i K32_QOI_ALPHA_MASK = SIMD_MM_SET1_EPI32(0xFF000000);
+
+        template<int channels> SIMD_INLINE __m128i QoiLoad(const uint8_t* src);
+
+        template<> SIMD_INLINE __m128i QoiLoad<3>(const uint8_t* src)
+        {
+            return _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src), K8_QOI_RGB_TO_RGBA), K32_QOI_ALPHA_MASK);
+        }
+
+        template<> SIMD_INLINE __m128i QoiLoad<4>(const uint8_t* src)
+        {
+            return _mm_loadu_si128((__m128i*)src);
+        }
+
+        template<int channels> SIMD_INLINE uint8_t* QoiEncode4(const uint8_t* src, uint32_t* index, uint32_t& prev, int& run, uint8_t* dst)
+        {
+            __m128i cur = QoiLoad<channels>(src);
+            __m128i prv = QoiLoad<channels>(src - channels);
+            int equal = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(cur, prv)));
+            if (equal == 0xF && run + 4 < Base::QOI_RUN_MAX)
+            {
+                run += 4;
+                return dst;
+            }
+            __m128i delta = _mm_sub_epi8(cur, prv);
+            __m128i sameAlpha = _mm_cmpeq_epi32(_mm_and_si128(delta, K32_QOI_ALPHA_MASK), _mm_setzero_si128());
+            __m128i diffBias = _mm_add_epi8(delta, K8_02);
+            __m128i isDiff = _mm_and_si128(_mm_cmpeq_epi32(_mm_and_si128(diffBias, K32_QOI_DIFF_MASK), _mm_setzero_si128()), sameAlpha);
+            __m128i diff = _mm_or_si128(_mm_madd_epi16(_mm_maddubs_epi16(diffBias, K8_QOI_DIFF), K16_0001), _mm_set1_epi32(Base::QOI_OP_DIFF));
+            __m128i delta_g = _mm_subs_epi8(delta, _mm_shuffle_epi8(delta, K8_QOI_GREEN));
+            __m128i lumaBias = _mm_add_epi8(_mm_blendv_epi8(delta_g, delta, K32_QOI_GREEN_MASK), K8_QOI_LUMA_BIAS);
+            __m128i isLuma = _mm_and_si128(_mm_cmpeq_epi32(_mm_and_si128(lumaBias, K32_QOI_LUMA_MASK), _mm_setzero_si128()), sameAlpha);
+            __m128i luma = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(lumaBias, 8), K32_000000FF), _mm_set1_epi32(Base::QOI_OP_LUMA));
+            luma = _mm_or_si128(luma, _mm_slli_epi32(_mm_madd_epi16(_mm_maddubs_epi16(lumaBias, K8_QOI_LUMA), K16_0001), 8));
+            __m128i rgb = _mm_or_si128(_mm_slli_epi32(cur, 8), _mm_set1_epi32(Base::QOI_OP_RGB));
+            __m128i code = _mm_blendv_epi8(_mm_blendv_epi8(rgb, luma, isLuma), diff, isDiff);
+            __m128i size = _mm_blendv_epi8(_mm_blendv_epi8(_mm_set1_epi32(4), _mm_set1_epi32(2), isLuma), _mm_set1_epi32(1), isDiff);
+            size = _mm_blendv_epi8(_mm_set1_epi32(5), size, sameAlpha);
+            __m128i hash = _mm_and_si128(_mm_madd_epi16(_mm_maddubs_epi16(cur, K8_QOI_HASH), K16_0001), _mm_set1_epi32(63));
+
+            SIMD_ALIGNED(16) uint32_t _px[4], _code[4], _size[4], _hash[4];
+            _mm_store_si128((__m128i*)_px, cur);
+            _mm_store_si128((__m128i*)_code, code);
+            _mm_store_si128((__m128i*)_size, size);
+            _mm_store_si128((__m128i*)_hash, hash);
+            for (int i = 0; i < 4; ++i)
+            {
+                if (equal & (1 << i))
+                {
+                    if (++run == Base::QOI_RUN_MAX)
+                    {
+                        *dst++ = Base::QOI_OP_RUN | (run - 1);
+                        run = 0;
+                    }
+                    continue;
+                }
+                if (run)
+                {
+                    *dst++ = Base::QOI_OP_RUN | (run - 1);
+                    run = 0;
+                }
+                uint32_t px = _px[i], h = _hash[i];
+                if (index[h] == px)
+                    *dst++ = Base::QOI_OP_INDEX | h;
+                else
+                {
+                    index[h] = px;
+                    if (_size[i] == 5)
+                    {
+                        *dst++ = Base::QOI_OP_RGBA;
+                        *(uint32_t*)dst = px;
+                        dst += 4;
+                    }
+                    else
+                    {
+                        *(uint32_t*)dst = _code[i];
+                        dst += _size[i];
+                    }
+                }
+            }
+            prev = _px[3];
+            return dst;
+        }
+
+        template<int channels> uint8_t* QoiEncodeRow(const uint8_t* src, size_t width, uint32_t* index, uint32_t& prev, int& run, uint8_t* dst)
+        {
+            const size_t step = channels == 3 ? 6 : 4;
+            size_t x = 0;
+            if (width)
+            {
+                dst = Base::QoiEncodePixel<channels>(src, index, prev, run, dst);
+                x += 1;
+            }
+            for (; x + step <= width; x += 4)
+                dst = QoiEncode4<channels>(src + x * channels, index, prev, run, dst);
+            for (; x < width; ++x)
+                dst = Base::QoiEncodePixel<channels>(src + x * channels, index, prev, run, dst);
+            return dst;
+        }
+
+        //---------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : Base::ImageQoiSaver(param)
+        {
+            if (_param.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _convert = Sse41::GrayToBgr; break;
+                case SimdPixelFormatBgr24: _convert = Sse41::BgrToRgb; break;
+                case SimdPixelFormatBgra32: _convert = Sse41::BgraToRgba; break;
+                default: break;
+                }
+            }
+            _encodeRow = _channels == 4 ? QoiEncodeRow<4> : QoiEncodeRow<3>;
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
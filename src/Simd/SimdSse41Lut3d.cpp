@@ -0,0 +1,149 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdLut3d.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        const __m128i K32_LUT3D_ROUND = SIMD_MM_SET1_EPI32(Base::LUT3D_ROUND);
+        const __m128i K32_LUT3D_FINAL_ROUND = SIMD_MM_SET1_EPI32(Base::LUT3D_FINAL_ROUND);
+        const __m128i K32_LUT3D_ALPHA = SIMD_MM_SET1_EPI32(0xFF000000);
+
+        const __m128i K8_LUT3D_BGRX_TO_BGR = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+        const __m128i K8_LUT3D_BGRX_TO_RGB = SIMD_MM_SETR_EPI8(0x2, 0x1, 0x0, 0x6, 0x5, 0x4, 0xA, 0x9, 0x8, 0xE, 0xD, 0xC, -1, -1, -1, -1);
+        const __m128i K8_LUT3D_BGRX_TO_RGBX = SIMD_MM_SETR_EPI8(0x2, 0x1, 0x0, 0x3, 0x6, 0x5, 0x4, 0x7, 0xA, 0x9, 0x8, 0xB, 0xE, 0xD, 0xC, 0xF);
+
+        SIMD_INLINE __m128i LoadNode(const int16_t* p)
+        {
+            return _mm_loadl_epi64((__m128i*)p);
+        }
+
+        SIMD_INLINE __m128i Lut3dWeight(int w0, int w1)
+        {
+            return _mm_set1_epi32(w0 | w1 << 16);
+        }
+
+        SIMD_INLINE __m128i Lut3dPair(__m128i lo, __m128i hi)
+        {
+            return _mm_or_si128(lo, _mm_slli_epi32(hi, 16));
+        }
+
+        SIMD_INLINE __m128i Lut3dLerp(__m128i pair, __m128i weight)
+        {
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(pair, weight), K32_LUT3D_ROUND), Base::LUT3D_WEIGHT_SHIFT);
+        }
+
+        template<bool tetrahedral, bool rgb> SIMD_INLINE __m128i Lut3dPixel(const Base::Lut3dIndex& index, const int16_t* nodes, const uint8_t* src)
+        {
+            int blue = src[rgb ? 2 : 0], green = src[1], red = src[rgb ? 0 : 2];
+            const int16_t* p = nodes + index.offset[0][blue] + index.offset[1][green] + index.offset[2][red];
+            int wb = index.weight[0][blue], wg = index.weight[1][green], wr = index.weight[2][red];
+            __m128i sum;
+            if (tetrahedral)
+            {
+                int offset[4], weight[4];
+                Base::Lut3dTetrahedral(index, wb, wg, wr, offset, weight);
+                __m128i n01 = _mm_unpacklo_epi16(LoadNode(p + offset[0]), LoadNode(p + offset[1]));
+                __m128i n23 = _mm_unpacklo_epi16(LoadNode(p + offset[2]), LoadNode(p + offset[3]));
+                sum = _mm_add_epi32(_mm_madd_epi16(n01, Lut3dWeight(weight[0], weight[1])), _mm_madd_epi16(n23, Lut3dWeight(weight[2], weight[3])));
+            }
+            else
+            {
+                int sb = index.step[0], sg = index.step[1], sr = index.step[2];
+                __m128i _wr = Lut3dWeight(Base::LUT3D_WEIGHT_ONE - wr, wr);
+                __m128i _wg = Lut3dWeight(Base::LUT3D_WEIGHT_ONE - wg, wg);
+                __m128i _wb = Lut3dWeight(Base::LUT3D_WEIGHT_ONE - wb, wb);
+                const int16_t* p1 = p + sb;
+                __m128i r00 = Lut3dLerp(_mm_unpacklo_epi16(LoadNode(p), LoadNode(p + sr)), _wr);
+                __m128i r10 = Lut3dLerp(_mm_unpacklo_epi16(LoadNode(p + sg), LoadNode(p + sg + sr)), _wr);
+                __m128i r01 = Lut3dLerp(_mm_unpacklo_epi16(LoadNode(p1), LoadNode(p1 + sr)), _wr);
+                __m128i r11 = Lut3dLerp(_mm_unpacklo_epi16(LoadNode(p1 + sg), LoadNode(p1 + sg + sr)), _wr);
+                __m128i g0 = Lut3dLerp(Lut3dPair(r00, r10), _wg);
+                __m128i g1 = Lut3dLerp(Lut3dPair(r01, r11), _wg);
+                sum = _mm_madd_epi16(Lut3dPair(g0, g1), _wb);
+            }
+            return _mm_srai_epi32(_mm_add_epi32(sum, K32_LUT3D_FINAL_ROUND), Base::LUT3D_SHIFT);
+        }
+
+        template<bool tetrahedral, size_t channels, bool rgb> void Lut3dRow(const Base::Lut3dIndex& index, const int16_t* nodes, const uint8_t* src, size_t width, uint8_t* dst)
+        {
+            size_t width4 = AlignLo(width, 4), x = 0;
+            for (; x < width4; x += 4, src += 4 * channels, dst += 4 * channels)
+            {
+                __m128i p0 = Lut3dPixel<tetrahedral, rgb>(index, nodes, src + 0 * channels);
+                __m128i p1 = Lut3dPixel<tetrahedral, rgb>(index, nodes, src + 1 * channels);
+                __m128i p2 = Lut3dPixel<tetrahedral, rgb>(index, nodes, src + 2 * channels);
+                __m128i p3 = Lut3dPixel<tetrahedral, rgb>(index, nodes, src + 3 * channels);
+                __m128i bgrx = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+                if (channels == 4)
+                {
+                    if (rgb)
+                        bgrx = _mm_shuffle_epi8(bgrx, K8_LUT3D_BGRX_TO_RGBX);
+                    _mm_storeu_si128((__m128i*)dst, _mm_blendv_epi8(bgrx, _mm_loadu_si128((__m128i*)src), K32_LUT3D_ALPHA));
+                }
+                else
+                {
+                    __m128i bgr = _mm_shuffle_epi8(bgrx, rgb ? K8_LUT3D_BGRX_TO_RGB : K8_LUT3D_BGRX_TO_BGR);
+                    _mm_storel_epi64((__m128i*)dst, bgr);
+                    *(int32_t*)(dst + 8) = _mm_extract_epi32(bgr, 2);
+                }
+            }
+            for (; x < width; ++x, src += channels, dst += channels)
+                Base::Lut3dPixel<tetrahedral, channels, rgb>(index, nodes, src, dst);
+        }
+
+        template<bool tetrahedral> void SetRows(Base::Lut3dInt::RowPtr rows[4])
+        {
+            rows[0] = Lut3dRow<tetrahedral, 3, false>;
+            rows[1] = Lut3dRow<tetrahedral, 4, false>;
+            rows[2] = Lut3dRow<tetrahedral, 3, true>;
+            rows[3] = Lut3dRow<tetrahedral, 4, true>;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        Lut3dInt::Lut3dInt(const Lut3dParam& param, const float* table)
+            : Base::Lut3dInt(param, table)
+        {
+            if (param.interpolation == SimdLut3dInterpolationTetrahedral)
+                SetRows<true>(_rows);
+            else
+                SetRows<false>(_rows);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* Lut3dInit(size_t size, const float* table, SimdLut3dInterpolationType interpolation)
+        {
+            Lut3dParam param(size, interpolation);
+            if (!param.Valid() || table == NULL)
+                return NULL;
+            return new Lut3dInt(param, table);
+        }
+    }
+#endif
+}
@@ -0,0 +1,175 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdOpticalFlow.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i LkLoad8u(const uint8_t* src)
+        {
+            return _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)src));
+        }
+
+        void LkGradient(const uint8_t* src, size_t srcStride, size_t width, size_t height, int16_t* dx, int16_t* dy, size_t dStride)
+        {
+            const __m128i k3 = _mm_set1_epi16(3), k10 = _mm_set1_epi16(10);
+            for (size_t y = 0; y < height; ++y)
+            {
+                const uint8_t* s0 = src - srcStride;
+                const uint8_t* s1 = src;
+                const uint8_t* s2 = src + srcStride;
+                for (size_t x = 0; x < width; x += HA)
+                {
+                    __m128i l0 = LkLoad8u(s0 + x - 1), c0 = LkLoad8u(s0 + x), r0 = LkLoad8u(s0 + x + 1);
+                    __m128i l1 = LkLoad8u(s1 + x - 1), r1 = LkLoad8u(s1 + x + 1);
+                    __m128i l2 = LkLoad8u(s2 + x - 1), c2 = LkLoad8u(s2 + x), r2 = LkLoad8u(s2 + x + 1);
+                    __m128i gx = _mm_add_epi16(_mm_mullo_epi16(k3, _mm_add_epi16(_mm_sub_epi16(r0, l0), _mm_sub_epi16(r2, l2))), _mm_mullo_epi16(k10, _mm_sub_epi16(r1, l1)));
+                    __m128i gy = _mm_add_epi16(_mm_mullo_epi16(k3, _mm_add_epi16(_mm_sub_epi16(l2, l0), _mm_sub_epi16(r2, r0))), _mm_mullo_epi16(k10, _mm_sub_epi16(c2, c0)));
+                    _mm_storeu_si128((__m128i*)(dx + x), gx);
+                    _mm_storeu_si128((__m128i*)(dy + x), gy);
+                }
+                src += srcStride;
+                dx += dStride;
+                dy += dStride;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m128i LkValue(const uint8_t* s0, const uint8_t* s1, const __m128i& w01, const __m128i& w23)
+        {
+            const int shift = Base::LK_WEIGHT_BITS - Base::LK_VALUE_BITS;
+            const __m128i round = _mm_set1_epi32(1 << (shift - 1));
+            __m128i a0 = LkLoad8u(s0), b0 = LkLoad8u(s0 + 1), a1 = LkLoad8u(s1), b1 = LkLoad8u(s1 + 1);
+            __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(a0, b0), w01), _mm_madd_epi16(_mm_unpacklo_epi16(a1, b1), w23));
+            __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(a0, b0), w01), _mm_madd_epi16(_mm_unpackhi_epi16(a1, b1), w23));
+            return _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(lo, round), shift), _mm_srai_epi32(_mm_add_epi32(hi, round), shift));
+        }
+
+        SIMD_INLINE __m128i LkValue(const int16_t* d0, const int16_t* d1, const __m128i& w01, const __m128i& w23)
+        {
+            const int shift = Base::LK_WEIGHT_BITS;
+            const __m128i round = _mm_set1_epi32(1 << (shift - 1));
+            __m128i a0 = _mm_loadu_si128((__m128i*)d0), b0 = _mm_loadu_si128((__m128i*)(d0 + 1));
+            __m128i a1 = _mm_loadu_si128((__m128i*)d1), b1 = _mm_loadu_si128((__m128i*)(d1 + 1));
+            __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(a0, b0), w01), _mm_madd_epi16(_mm_unpacklo_epi16(a1, b1), w23));
+            __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(a0, b0), w01), _mm_madd_epi16(_mm_unpackhi_epi16(a1, b1), w23));
+            return _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(lo, round), shift), _mm_srai_epi32(_mm_add_epi32(hi, round), shift));
+        }
+
+        SIMD_INLINE __m128i LkWidenSum(const __m128i& sum, const __m128i& value)
+        {
+            return _mm_add_epi64(sum, _mm_add_epi64(_mm_cvtepi32_epi64(value), _mm_cvtepi32_epi64(_mm_srli_si128(value, 8))));
+        }
+
+        SIMD_INLINE int64_t LkExtract(const __m128i& sum)
+        {
+            return _mm_cvtsi128_si64(sum) + _mm_extract_epi64(sum, 1);
+        }
+
+        void LkPatch(const uint8_t* src, size_t srcStride, const int16_t* dx, const int16_t* dy, size_t dStride,
+            size_t size, const int* weights, int16_t* patch, int64_t* sums)
+        {
+            const size_t plane = Base::LK_PATCH_STRIDE * Base::LK_PATCH_STRIDE;
+            const __m128i w01 = _mm_set1_epi32(weights[0] | (weights[1] << 16));
+            const __m128i w23 = _mm_set1_epi32(weights[2] | (weights[3] << 16));
+            const __m128i index = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+            __m128i xx = _mm_setzero_si128(), xy = _mm_setzero_si128(), yy = _mm_setzero_si128();
+            for (size_t y = 0; y < size; ++y)
+            {
+                int16_t* pI = patch + y * Base::LK_PATCH_STRIDE, * pX = pI + plane, * pY = pX + plane;
+                __m128i rxx = _mm_setzero_si128(), rxy = _mm_setzero_si128(), ryy = _mm_setzero_si128();
+                for (size_t x = 0; x < size; x += HA)
+                {
+                    __m128i mask = _mm_cmpgt_epi16(_mm_set1_epi16(int16_t(size - x)), index);
+                    __m128i ix = _mm_and_si128(mask, LkValue(dx + x, dx + dStride + x, w01, w23));
+                    __m128i iy = _mm_and_si128(mask, LkValue(dy + x, dy + dStride + x, w01, w23));
+                    _mm_storeu_si128((__m128i*)(pI + x), LkValue(src + x, src + srcStride + x, w01, w23));
+                    _mm_storeu_si128((__m128i*)(pX + x), ix);
+                    _mm_storeu_si128((__m128i*)(pY + x), iy);
+                    rxx = _mm_add_epi32(rxx, _mm_madd_epi16(ix, ix));
+                    rxy = _mm_add_epi32(rxy, _mm_madd_epi16(ix, iy));
+                    ryy = _mm_add_epi32(ryy, _mm_madd_epi16(iy, iy));
+                }
+                xx = LkWidenSum(xx, rxx);
+                xy = LkWidenSum(xy, rxy);
+                yy = LkWidenSum(yy, ryy);
+                src += srcStride;
+                dx += dStride;
+                dy += dStride;
+            }
+            sums[0] = LkExtract(xx);
+            sums[1] = LkExtract(xy);
+            sums[2] = LkExtract(yy);
+        }
+
+        void LkMismatch(const uint8_t* src, size_t srcStride, size_t size, const int* weights, const int16_t* patch, int64_t* sums)
+        {
+            const size_t plane = Base::LK_PATCH_STRIDE * Base::LK_PATCH_STRIDE;
+            const __m128i w01 = _mm_set1_epi32(weights[0] | (weights[1] << 16));
+            const __m128i w23 = _mm_set1_epi32(weights[2] | (weights[3] << 16));
+            __m128i bx = _mm_setzero_si128(), by = _mm_setzero_si128();
+            for (size_t y = 0; y < size; ++y)
+            {
+                const int16_t* pI = patch + y * Base::LK_PATCH_STRIDE, * pX = pI + plane, * pY = pX + plane;
+                __m128i rbx = _mm_setzero_si128(), rby = _mm_setzero_si128();
+                for (size_t x = 0; x < size; x += HA)
+                {
+                    __m128i diff = _mm_sub_epi16(LkValue(src + x, src + srcStride + x, w01, w23), _mm_loadu_si128((__m128i*)(pI + x)));
+                    rbx = _mm_add_epi32(rbx, _mm_madd_epi16(diff, _mm_loadu_si128((__m128i*)(pX + x))));
+                    rby = _mm_add_epi32(rby, _mm_madd_epi16(diff, _mm_loadu_si128((__m128i*)(pY + x))));
+                }
+                bx = LkWidenSum(bx, rbx);
+                by = LkWidenSum(by, rby);
+                src += srcStride;
+            }
+            sums[0] = LkExtract(bx);
+            sums[1] = LkExtract(by);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        OpticalFlowLkDefault::OpticalFlowLkDefault(const OpticalFlowLkParam& param, Base::PyramidBuilderInitPtr pyramidInit)
+            : Base::OpticalFlowLkDefault(param, pyramidInit)
+        {
+            _gradient = LkGradient;
+            _patch = LkPatch;
+            _mismatch = LkMismatch;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t window, size_t levels, size_t iterations, float epsilon)
+        {
+            OpticalFlowLkParam param(width, height, window, levels, iterations, epsilon);
+            if (!param.Valid())
+                return NULL;
+            return new OpticalFlowLkDefault(param, PyramidBuilderInit);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
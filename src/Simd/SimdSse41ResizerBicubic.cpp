@@ -43,11 +43,11 @@ namespace Simd
             _iy.Resize(sizeD);
             _ay.Resize(sizeD * 4);
             float scale = float(sizeS) / float(sizeD);
-            size_t i = 0, sizeDF = AlignLo(sizeD, F);
-            int32_t* ay = _ay.data;
-            if (sizeDF)
+            size_t i = AlignLo(_bandBeg, F), sizeDF = Min(AlignHi(_bandEnd, F), AlignLo(sizeD, F));
+            int32_t* ay = _ay.data + i * 4;
+            if (i < sizeDF)
             {
-                __m128i _i = _mm_setr_epi32(0, 1, 2, 3);
+                __m128i _i = _mm_add_epi32(_mm_set1_epi32((int)i), _mm_setr_epi32(0, 1, 2, 3));
                 __m128 _scale = _mm_set1_ps(scale);
                 __m128 _0 = _mm_set1_ps(0.0f);
                 __m128 _05 = _mm_set1_ps(0.5f);
@@ -89,7 +89,7 @@ namespace Simd
                     _i = _mm_add_epi32(_i, K32_00000004);
                 }
             }
-            for (; i < sizeD; ++i, ay += 4)
+            for (; i < _bandEnd; ++i, ay += 4)
             {
                 float pos = (float)((i + 0.5f) * scale - 0.5f);
                 int idx = (int)::floor(pos);
@@ -267,7 +267,8 @@ namespace Simd
             assert(_xn == 0 && _xt == _param.dstW);
             size_t step = 4 / N;
             size_t body = AlignLoAny(_param.dstW - (N == 3 ? 1 : 0), step);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
                 const uint8_t* src1 = src + sy * srcStride;
@@ -369,7 +370,8 @@ namespace Simd
         template<int N> void ResizerByteBicubic::RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
             int32_t prev = -1;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 int32_t sy = _iy[dy], next = prev;
                 for (int32_t curr = sy - 1, end = sy + 3; curr < end; ++curr)
@@ -25,6 +25,7 @@
 #include "Simd/SimdStore.h"
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdResizerCommon.h"
+#include "Simd/SimdBFloat16.h"
 
 namespace Simd
 {
@@ -221,7 +222,8 @@ namespace Simd
             const int32_t* ix = _ix.data;
             size_t dstW = _param.dstW;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm_set1_epi16(int16_t(_ay[yDst]));
@@ -278,7 +280,8 @@ namespace Simd
             const uint8_t* ax = _ax.data;
             const Idx* ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t yDst = _yBeg; yDst < _yEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm_set1_epi16(int16_t(_ay[yDst]));
@@ -315,6 +318,7 @@ namespace Simd
         {
             assert(_param.dstW >= A);
 
+            EstimateRows();
             EstimateParams();
             switch (_param.channels)
             {
@@ -348,7 +352,8 @@ namespace Simd
             size_t rs4 = AlignLo(rs, 4);
             size_t rs8 = AlignLo(rs, 8);
             __m128 _1 = _mm_set1_ps(1.0f);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -447,7 +452,8 @@ namespace Simd
             size_t rs4 = AlignLo(rs, 4);
             size_t rs8 = AlignLo(rs, 8);
             __m128 _1 = _mm_set1_ps(1.0f);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -602,7 +608,8 @@ namespace Simd
             int32_t prev = -2;
             size_t rsh = AlignLo(rs, Sse41::F);
             __m128 _1 = _mm_set1_ps(1.0f);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
             {
                 float fy1 = _ay[dy];
                 float fy0 = 1.0f - fy1;
@@ -670,6 +677,83 @@ namespace Simd
                     dst[dx] = pbx[0][dx] * fy0 + pbx[1][dx] * fy1;
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerBf16Bilinear::ResizerBf16Bilinear(const ResParam& param)
+            : Base::ResizerBf16Bilinear(param)
+        {
+        }
+
+        void ResizerBf16Bilinear::Run(const uint16_t* src, size_t srcStride, uint16_t* dst, size_t dstStride)
+        {
+            size_t cn = _param.channels;
+            size_t rs = _param.dstW * cn;
+            float* pbx[2] = { _bx[0].data, _bx[1].data };
+            int32_t prev = -2;
+            size_t rsF = AlignLo(rs, F), rsDF = AlignLo(rs, DF);
+            __m128 _1 = _mm_set1_ps(1.0f);
+            dst += _yBeg * dstStride;
+            for (size_t dy = _yBeg; dy < _yEnd; dy++, dst += dstStride)
+            {
+                float fy1 = _ay[dy];
+                float fy0 = 1.0f - fy1;
+                int32_t sy = _iy[dy];
+                int32_t k = 0;
+
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+
+                prev = sy;
+
+                for (; k < 2; k++)
+                {
+                    float* pb = pbx[k];
+                    const uint16_t* ps0 = src + (sy + k) * srcStride;
+                    const uint16_t* ps1 = ps0 + cn - 1;
+                    size_t dx = 0;
+                    for (; dx < rsF; dx += F)
+                    {
+                        const int32_t* ix = _ix.data + dx;
+                        __m128i s0 = _mm_setr_epi32(*(int32_t*)(ps0 + ix[0]), *(int32_t*)(ps0 + ix[1]), *(int32_t*)(ps0 + ix[2]), *(int32_t*)(ps0 + ix[3]));
+                        __m128i s1 = cn == 1 ? s0 : _mm_setr_epi32(*(int32_t*)(ps1 + ix[0]), *(int32_t*)(ps1 + ix[1]), *(int32_t*)(ps1 + ix[2]), *(int32_t*)(ps1 + ix[3]));
+                        __m128 fx1 = _mm_load_ps(_ax.data + dx);
+                        __m128 fx0 = _mm_sub_ps(_1, fx1);
+                        __m128 m0 = _mm_mul_ps(BFloat16ToFloat32Even(s0), fx0);
+                        __m128 m1 = _mm_mul_ps(BFloat16ToFloat32Odd(s1), fx1);
+                        _mm_store_ps(pb + dx, _mm_add_ps(m0, m1));
+                    }
+                    for (; dx < rs; dx++)
+                    {
+                        int32_t sx = _ix[dx];
+                        float fx = _ax[dx];
+                        pb[dx] = Base::BFloat16ToFloat32(ps0[sx]) * (1.0f - fx) + Base::BFloat16ToFloat32(ps0[sx + cn]) * fx;
+                    }
+                }
+
+                size_t dx = 0;
+                __m128 _fy0 = _mm_set1_ps(fy0);
+                __m128 _fy1 = _mm_set1_ps(fy1);
+                for (; dx < rsDF; dx += DF)
+                {
+                    __m128 d0 = _mm_add_ps(_mm_mul_ps(_mm_load_ps(pbx[0] + dx + 0), _fy0), _mm_mul_ps(_mm_load_ps(pbx[1] + dx + 0), _fy1));
+                    __m128 d1 = _mm_add_ps(_mm_mul_ps(_mm_load_ps(pbx[0] + dx + F), _fy0), _mm_mul_ps(_mm_load_ps(pbx[1] + dx + F), _fy1));
+                    _mm_storeu_si128((__m128i*)(dst + dx), Float32ToBFloat16(d0, d1));
+                }
+                for (; dx < rsF; dx += F)
+                {
+                    __m128 d0 = _mm_add_ps(_mm_mul_ps(_mm_load_ps(pbx[0] + dx), _fy0), _mm_mul_ps(_mm_load_ps(pbx[1] + dx), _fy1));
+                    _mm_storel_epi64((__m128i*)(dst + dx), _mm_packus_epi32(Float32ToBFloat16(d0), K_ZERO));
+                }
+                for (; dx < rs; dx++)
+                    dst[dx] = Base::Float32ToBFloat16(pbx[0][dx] * fy0 + pbx[1][dx] * fy1);
+            }
+        }
     }
 #endif
 }
@@ -0,0 +1,110 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        ResizerFilter::ResizerFilter(const ResParam& param)
+            : Base::ResizerFilter(param)
+        {
+        }
+
+        void ResizerFilter::ConvertRow(const uint8_t* src, float* dst)
+        {
+            size_t size = _param.srcW * _param.channels, sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)(src + i)))));
+            for (; i < size; ++i)
+                dst[i] = src[i];
+        }
+
+        void ResizerFilter::FilterRow(const float* src, float* dst)
+        {
+            size_t cn = _param.channels, rsF = AlignLo(_rs, F), dx = 0;
+            for (; dx < rsF; dx += F)
+            {
+                const float* ps0 = src + _ix[dx + 0];
+                const float* ps1 = src + _ix[dx + 1];
+                const float* ps2 = src + _ix[dx + 2];
+                const float* ps3 = src + _ix[dx + 3];
+                const float* ax = _ax.data + dx;
+                __m128 sum = _mm_setzero_ps();
+                for (size_t k = 0, o = 0; k < _nx; k++, o += cn, ax += _rs)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_setr_ps(ps0[o], ps1[o], ps2[o], ps3[o]), _mm_loadu_ps(ax)));
+                _mm_storeu_ps(dst + dx, sum);
+            }
+            for (; dx < _rs; dx++)
+            {
+                const float* ps = src + _ix[dx];
+                const float* ax = _ax.data + dx;
+                float sum = 0.0f;
+                for (size_t k = 0; k < _nx; k++, ps += cn, ax += _rs)
+                    sum += ps[0] * ax[0];
+                dst[dx] = sum;
+            }
+        }
+
+        SIMD_INLINE __m128 FilterCol(const float* const* src, const float* ay, size_t ny, size_t offset)
+        {
+            __m128 sum = _mm_mul_ps(_mm_loadu_ps(src[0] + offset), _mm_set1_ps(ay[0]));
+            for (size_t k = 1; k < ny; k++)
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src[k] + offset), _mm_set1_ps(ay[k])));
+            return sum;
+        }
+
+        void ResizerFilter::FilterCol(const float* const* src, const float* ay, uint8_t* dst)
+        {
+            size_t rsF = AlignLo(_rs, F), dx = 0;
+            if (_param.type == SimdResizeChannelByte)
+            {
+                for (; dx < rsF; dx += F)
+                {
+                    __m128i i32 = _mm_cvtps_epi32(Sse41::FilterCol(src, ay, _ny, dx));
+                    *(int32_t*)(dst + dx) = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(i32, K_ZERO), K_ZERO));
+                }
+            }
+            else
+            {
+                for (; dx < rsF; dx += F)
+                    _mm_storeu_ps((float*)dst + dx, Sse41::FilterCol(src, ay, _ny, dx));
+            }
+            for (; dx < _rs; dx++)
+            {
+                float sum = 0.0f;
+                for (size_t k = 0; k < _ny; k++)
+                    sum += src[k][dx] * ay[k];
+                if (_param.type == SimdResizeChannelByte)
+                    dst[dx] = (uint8_t)Base::RestrictRange(Round(sum), 0, 255);
+                else
+                    ((float*)dst)[dx] = sum;
+            }
+        }
+    }
+#endif
+}
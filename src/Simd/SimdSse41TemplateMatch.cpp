@@ -0,0 +1,147 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdTemplateMatch.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE void TmAdd(const __m128i& sum, uint64_t* sums)
+        {
+            _mm_storeu_si128((__m128i*)sums + 0, _mm_add_epi64(_mm_loadu_si128((__m128i*)sums + 0), _mm_cvtepu32_epi64(sum)));
+            _mm_storeu_si128((__m128i*)sums + 1, _mm_add_epi64(_mm_loadu_si128((__m128i*)sums + 1), _mm_cvtepu32_epi64(_mm_srli_si128(sum, 8))));
+        }
+
+        void TmSad(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            size_t width16 = AlignLo(width, A), x = 0;
+            for (; x < width16; x += A)
+            {
+                __m128i sum0 = _mm_setzero_si128(), sum1 = _mm_setzero_si128(), sum2 = _mm_setzero_si128(), sum3 = _mm_setzero_si128();
+                for (size_t t = 0; t < size;)
+                {
+                    __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+                    for (size_t end = Min(size, t + 256); t < end; ++t)
+                    {
+                        __m128i s = _mm_loadu_si128((__m128i*)(src + x + t));
+                        __m128i v = _mm_set1_epi8(tmp[t]);
+                        __m128i d = _mm_or_si128(_mm_subs_epu8(s, v), _mm_subs_epu8(v, s));
+                        lo = _mm_add_epi16(lo, _mm_unpacklo_epi8(d, K_ZERO));
+                        hi = _mm_add_epi16(hi, _mm_unpackhi_epi8(d, K_ZERO));
+                    }
+                    sum0 = _mm_add_epi32(sum0, _mm_unpacklo_epi16(lo, K_ZERO));
+                    sum1 = _mm_add_epi32(sum1, _mm_unpackhi_epi16(lo, K_ZERO));
+                    sum2 = _mm_add_epi32(sum2, _mm_unpacklo_epi16(hi, K_ZERO));
+                    sum3 = _mm_add_epi32(sum3, _mm_unpackhi_epi16(hi, K_ZERO));
+                }
+                TmAdd(sum0, sums + x + 0);
+                TmAdd(sum1, sums + x + 4);
+                TmAdd(sum2, sums + x + 8);
+                TmAdd(sum3, sums + x + 12);
+            }
+            if (x < width)
+                Base::TmSad(src + x, tmp, size, width - x, sums + x);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<bool ssd> SIMD_INLINE void TmMadd(const __m128i& a, const __m128i& b, const __m128i& t, __m128i& lo, __m128i& hi)
+        {
+            if (ssd)
+            {
+                __m128i dlo = _mm_sub_epi16(_mm_unpacklo_epi16(a, b), t);
+                __m128i dhi = _mm_sub_epi16(_mm_unpackhi_epi16(a, b), t);
+                lo = _mm_add_epi32(lo, _mm_madd_epi16(dlo, dlo));
+                hi = _mm_add_epi32(hi, _mm_madd_epi16(dhi, dhi));
+            }
+            else
+            {
+                lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), t));
+                hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), t));
+            }
+        }
+
+        template<bool ssd> void TmMadd(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            size_t width8 = AlignLo(width, HA), size2 = AlignLo(size, 2), x = 0;
+            for (; x < width8; x += HA)
+            {
+                __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+                const uint8_t* s = src + x;
+                size_t t = 0;
+                for (; t < size2; t += 2)
+                {
+                    __m128i a = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)(s + t + 0)));
+                    __m128i b = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)(s + t + 1)));
+                    TmMadd<ssd>(a, b, _mm_set1_epi32(tmp[t] | (tmp[t + 1] << 16)), lo, hi);
+                }
+                if (t < size)
+                {
+                    __m128i a = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)(s + t)));
+                    TmMadd<ssd>(a, K_ZERO, _mm_set1_epi32(tmp[t]), lo, hi);
+                }
+                TmAdd(lo, sums + x + 0);
+                TmAdd(hi, sums + x + 4);
+            }
+            if (x < width)
+            {
+                if (ssd)
+                    Base::TmSsd(src + x, tmp, size, width - x, sums + x);
+                else
+                    Base::TmCorr(src + x, tmp, size, width - x, sums + x);
+            }
+        }
+
+        void TmSsd(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            TmMadd<true>(src, tmp, size, width, sums);
+        }
+
+        void TmCorr(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums)
+        {
+            TmMadd<false>(src, tmp, size, width, sums);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        TemplateMatchDefault::TemplateMatchDefault(const TemplateMatchParam& param, Base::PyramidBuilderInitPtr pyramidInit)
+            : Base::TemplateMatchDefault(param, pyramidInit)
+        {
+            SetRow(param.type, TmSad, TmSsd, TmCorr);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* TemplateMatchInit(size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels)
+        {
+            TemplateMatchParam param(srcWidth, srcHeight, tmpWidth, tmpHeight, type, levels);
+            if (!param.Valid())
+                return NULL;
+            return new TemplateMatchDefault(param, PyramidBuilderInit);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
@@ -0,0 +1,332 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        template <bool p010> SIMD_INLINE __m128i Yuv10(__m128i value)
+        {
+            static const __m128i MASK = SIMD_MM_SET1_EPI16(0x03FF);
+            return p010 ? _mm_srli_epi16(value, 6) : _mm_and_si128(value, MASK);
+        }
+
+        template <class T, bool p010> SIMD_INLINE __m128i LoadY10(const uint8_t* y)
+        {
+            static const __m128i Y_LO = SIMD_MM_SET1_EPI16(4 * T::Y_LO);
+            return _mm_sub_epi16(Yuv10<p010>(_mm_loadu_si128((__m128i*)y)), Y_LO);
+        }
+
+        template <class T, bool p010> SIMD_INLINE void LoadUv10(const uint8_t* u, const uint8_t* v, __m128i* u16, __m128i* v16)
+        {
+            static const __m128i UV_Z = SIMD_MM_SET1_EPI16(4 * T::UV_Z);
+            if (p010)
+            {
+                static const __m128i UV_TO_U = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x0, 0x1, 0x4, 0x5, 0x4, 0x5, 0x8, 0x9, 0x8, 0x9, 0xC, 0xD, 0xC, 0xD);
+                static const __m128i UV_TO_V = SIMD_MM_SETR_EPI8(0x2, 0x3, 0x2, 0x3, 0x6, 0x7, 0x6, 0x7, 0xA, 0xB, 0xA, 0xB, 0xE, 0xF, 0xE, 0xF);
+                for (size_t i = 0; i < 2; ++i)
+                {
+                    __m128i uv = _mm_sub_epi16(Yuv10<true>(_mm_loadu_si128((__m128i*)u + i)), UV_Z);
+                    u16[i] = _mm_shuffle_epi8(uv, UV_TO_U);
+                    v16[i] = _mm_shuffle_epi8(uv, UV_TO_V);
+                }
+            }
+            else
+            {
+                __m128i _u = _mm_sub_epi16(Yuv10<false>(_mm_loadu_si128((__m128i*)u)), UV_Z);
+                u16[0] = _mm_unpacklo_epi16(_u, _u);
+                u16[1] = _mm_unpackhi_epi16(_u, _u);
+                __m128i _v = _mm_sub_epi16(Yuv10<false>(_mm_loadu_si128((__m128i*)v)), UV_Z);
+                v16[0] = _mm_unpacklo_epi16(_v, _v);
+                v16[1] = _mm_unpackhi_epi16(_v, _v);
+            }
+        }
+
+        template <class T, int shift> SIMD_INLINE void Yuv10ToBgr32(__m128i y16_4, __m128i u16_v16, __m128i& b32, __m128i& g32, __m128i& r32)
+        {
+            static const __m128i YA_RT = SIMD_MM_SET2_EPI16(T::Y_2_A, 1 << (shift - 3));
+            static const __m128i UB_0 = SIMD_MM_SET2_EPI16(T::U_2_B, 0);
+            static const __m128i UG_VG = SIMD_MM_SET2_EPI16(T::U_2_G, T::V_2_G);
+            static const __m128i _0_VR = SIMD_MM_SET2_EPI16(0, T::V_2_R);
+            __m128i y32 = _mm_madd_epi16(y16_4, YA_RT);
+            b32 = _mm_srai_epi32(_mm_add_epi32(y32, _mm_madd_epi16(u16_v16, UB_0)), shift);
+            g32 = _mm_srai_epi32(_mm_add_epi32(y32, _mm_madd_epi16(u16_v16, UG_VG)), shift);
+            r32 = _mm_srai_epi32(_mm_add_epi32(y32, _mm_madd_epi16(u16_v16, _0_VR)), shift);
+        }
+
+        template <class T> SIMD_INLINE void Yuv10ToBgr8(__m128i y16, __m128i u16, __m128i v16, __m128i& b16, __m128i& g16, __m128i& r16)
+        {
+            __m128i b0, g0, r0, b1, g1, r1;
+            Yuv10ToBgr32<T, T::F_SHIFT + 2>(_mm_unpacklo_epi16(y16, K16_0004), _mm_unpacklo_epi16(u16, v16), b0, g0, r0);
+            Yuv10ToBgr32<T, T::F_SHIFT + 2>(_mm_unpackhi_epi16(y16, K16_0004), _mm_unpackhi_epi16(u16, v16), b1, g1, r1);
+            b16 = SaturateI16ToU8(_mm_packs_epi32(b0, b1));
+            g16 = SaturateI16ToU8(_mm_packs_epi32(g0, g1));
+            r16 = SaturateI16ToU8(_mm_packs_epi32(r0, r1));
+        }
+
+        SIMD_INLINE __m128i Expand16(__m128i lo, __m128i hi)
+        {
+            __m128i value = _mm_min_epu16(_mm_packus_epi32(lo, hi), K16_FF00);
+            value = _mm_add_epi16(value, _mm_srli_epi16(value, 8));
+            return _mm_or_si128(_mm_srli_epi16(value, 8), _mm_slli_epi16(value, 8));
+        }
+
+        template <class T> SIMD_INLINE void Yuv10ToBgr16(__m128i y16, __m128i u16, __m128i v16, __m128i& b16, __m128i& g16, __m128i& r16)
+        {
+            __m128i b0, g0, r0, b1, g1, r1;
+            Yuv10ToBgr32<T, T::F_SHIFT - 6>(_mm_unpacklo_epi16(y16, K16_0004), _mm_unpacklo_epi16(u16, v16), b0, g0, r0);
+            Yuv10ToBgr32<T, T::F_SHIFT - 6>(_mm_unpackhi_epi16(y16, K16_0004), _mm_unpackhi_epi16(u16, v16), b1, g1, r1);
+            b16 = Expand16(b0, b1);
+            g16 = Expand16(g0, g1);
+            r16 = Expand16(r0, r1);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool p010> SIMD_INLINE void Yuv10ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* u, const uint8_t* v, uint8_t* bgr, size_t bgrStride)
+        {
+            __m128i _u[2], _v[2], b[2], g[2], r[2];
+            LoadUv10<T, p010>(u, v, _u, _v);
+            for (size_t row = 0; row < 2; ++row)
+            {
+                for (size_t i = 0; i < 2; ++i)
+                    Yuv10ToBgr8<T>(LoadY10<T, p010>(y + i * A), _u[i], _v[i], b[i], g[i], r[i]);
+                __m128i blue = _mm_packus_epi16(b[0], b[1]);
+                __m128i green = _mm_packus_epi16(g[0], g[1]);
+                __m128i red = _mm_packus_epi16(r[0], r[1]);
+                _mm_storeu_si128((__m128i*)bgr + 0, InterleaveBgr<0>(blue, green, red));
+                _mm_storeu_si128((__m128i*)bgr + 1, InterleaveBgr<1>(blue, green, red));
+                _mm_storeu_si128((__m128i*)bgr + 2, InterleaveBgr<2>(blue, green, red));
+                y += yStride;
+                bgr += bgrStride;
+            }
+        }
+
+        template <class T, bool p010> void Yuv10ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (height >= 2));
+
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Yuv10ToBgrV2<T, p010>(y + col * 2, yStride, u + (p010 ? col * 2 : col), v + col, bgr + col * 3, bgrStride);
+                if (widthA < width)
+                {
+                    size_t col = width - A;
+                    Yuv10ToBgrV2<T, p010>(y + col * 2, yStride, u + (p010 ? col * 2 : col), v + col, bgr + col * 3, bgrStride);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <bool p010> void Yuv10ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv10ToBgrV2<Base::Bt601, p010>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Yuv10ToBgrV2<Base::Bt709, p010>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Yuv10ToBgrV2<Base::Bt2020, p010>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Yuv10ToBgrV2<Base::Trect871, p010>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuv420p10ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv10ToBgrV2<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+        }
+
+        void P010ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv10ToBgrV2<true>(y, yStride, uv, uvStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void StoreBgra(__m128i b16, __m128i g16, __m128i r16, __m128i a16, __m128i* bgra)
+        {
+            __m128i bg = _mm_or_si128(b16, _mm_slli_epi16(g16, 8));
+            __m128i ra = _mm_or_si128(r16, a16);
+            _mm_storeu_si128(bgra + 0, _mm_unpacklo_epi16(bg, ra));
+            _mm_storeu_si128(bgra + 1, _mm_unpackhi_epi16(bg, ra));
+        }
+
+        template <class T, bool p010> SIMD_INLINE void Yuv10ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, const uint8_t* v,
+            const __m128i& a16, uint8_t* bgra, size_t bgraStride)
+        {
+            __m128i _u[2], _v[2], b, g, r;
+            LoadUv10<T, p010>(u, v, _u, _v);
+            for (size_t row = 0; row < 2; ++row)
+            {
+                for (size_t i = 0; i < 2; ++i)
+                {
+                    Yuv10ToBgr8<T>(LoadY10<T, p010>(y + i * A), _u[i], _v[i], b, g, r);
+                    StoreBgra(b, g, r, a16, (__m128i*)bgra + 2 * i);
+                }
+                y += yStride;
+                bgra += bgraStride;
+            }
+        }
+
+        template <class T, bool p010> void Yuv10ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (height >= 2));
+
+            __m128i a16 = _mm_set1_epi16(alpha << 8);
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Yuv10ToBgraV2<T, p010>(y + col * 2, yStride, u + (p010 ? col * 2 : col), v + col, a16, bgra + col * 4, bgraStride);
+                if (widthA < width)
+                {
+                    size_t col = width - A;
+                    Yuv10ToBgraV2<T, p010>(y + col * 2, yStride, u + (p010 ? col * 2 : col), v + col, a16, bgra + col * 4, bgraStride);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        template <bool p010> void Yuv10ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv10ToBgraV2<Base::Bt601, p010>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Yuv10ToBgraV2<Base::Bt709, p010>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Yuv10ToBgraV2<Base::Bt2020, p010>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvTrect871: Yuv10ToBgraV2<Base::Trect871, p010>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuv420p10ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv10ToBgraV2<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void P010ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv10ToBgraV2<true>(y, yStride, uv, uvStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool p010> SIMD_INLINE void Yuv10ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* u, const uint8_t* v,
+            uint8_t* blue, size_t blueStride, uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride)
+        {
+            __m128i _u[2], _v[2], b, g, r;
+            LoadUv10<T, p010>(u, v, _u, _v);
+            for (size_t row = 0; row < 2; ++row)
+            {
+                for (size_t i = 0; i < 2; ++i)
+                {
+                    Yuv10ToBgr16<T>(LoadY10<T, p010>(y + i * A), _u[i], _v[i], b, g, r);
+                    _mm_storeu_si128((__m128i*)blue + i, b);
+                    _mm_storeu_si128((__m128i*)green + i, g);
+                    _mm_storeu_si128((__m128i*)red + i, r);
+                }
+                y += yStride;
+                blue += blueStride;
+                green += greenStride;
+                red += redStride;
+            }
+        }
+
+        template <class T, bool p010> void Yuv10ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* blue, size_t blueStride,
+            uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (height >= 2));
+
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Yuv10ToBgr48pV2<T, p010>(y + col * 2, yStride, u + (p010 ? col * 2 : col), v + col,
+                        blue + col * 2, blueStride, green + col * 2, greenStride, red + col * 2, redStride);
+                if (widthA < width)
+                {
+                    size_t col = width - A;
+                    Yuv10ToBgr48pV2<T, p010>(y + col * 2, yStride, u + (p010 ? col * 2 : col), v + col,
+                        blue + col * 2, blueStride, green + col * 2, greenStride, red + col * 2, redStride);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                blue += 2 * blueStride;
+                green += 2 * greenStride;
+                red += 2 * redStride;
+            }
+        }
+
+        template <bool p010> void Yuv10ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* blue, size_t blueStride,
+            uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv10ToBgr48pV2<Base::Bt601, p010>(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride); break;
+            case SimdYuvBt709: Yuv10ToBgr48pV2<Base::Bt709, p010>(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride); break;
+            case SimdYuvBt2020: Yuv10ToBgr48pV2<Base::Bt2020, p010>(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride); break;
+            case SimdYuvTrect871: Yuv10ToBgr48pV2<Base::Trect871, p010>(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuv420p10ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, uint8_t* blue, size_t blueStride, uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride, SimdYuvType yuvType)
+        {
+            Yuv10ToBgr48pV2<false>(y, yStride, u, uStride, v, vStride, width, height, blue, blueStride, green, greenStride, red, redStride, yuvType);
+        }
+
+        void P010ToBgr48pV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* blue, size_t blueStride, uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride, SimdYuvType yuvType)
+        {
+            Yuv10ToBgr48pV2<true>(y, yStride, uv, uvStride, uv, uvStride, width, height, blue, blueStride, green, greenStride, red, redStride, yuvType);
+        }
+    }
+#endif
+}
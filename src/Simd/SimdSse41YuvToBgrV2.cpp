@@ -422,6 +422,119 @@ namespace Simd
             else
                 Yuv444pToRgbV2<false>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool nv21> SIMD_INLINE void Nv12ToBgrV2(const uint8_t* y0, size_t yStride, const uint8_t* uv, uint8_t* bgr0, size_t bgrStride)
+        {
+            __m128i u, v;
+            UnpackNv12<nv21>(_mm_loadu_si128((__m128i*)uv), u, v);
+            YuvToBgrV2<false, T>(_mm_loadu_si128((__m128i*)y0), u, v, (__m128i*)bgr0);
+            YuvToBgrV2<false, T>(_mm_loadu_si128((__m128i*)(y0 + yStride)), u, v, (__m128i*)(bgr0 + bgrStride));
+        }
+
+        template <class T, bool nv21> void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (height >= 2));
+
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Nv12ToBgrV2<T, nv21>(y + col, yStride, uv + col, bgr + 3 * col, bgrStride);
+                if (widthA < width)
+                {
+                    size_t col = width - A;
+                    Nv12ToBgrV2<T, nv21>(y + col, yStride, uv + col, bgr + 3 * col, bgrStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <bool nv21> void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgrV2<Base::Bt601, nv21>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt709: Nv12ToBgrV2<Base::Bt709, nv21>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvBt2020: Nv12ToBgrV2<Base::Bt2020, nv21>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            case SimdYuvTrect871: Nv12ToBgrV2<Base::Trect871, nv21>(y, yStride, uv, uvStride, width, height, bgr, bgrStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToBgrV2<false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+        }
+
+        void Nv21ToBgrV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToBgrV2<true>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+        }
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool nv21> SIMD_INLINE void Nv12ToRgbV2(const uint8_t* y0, size_t yStride, const uint8_t* uv, uint8_t* rgb0, size_t rgbStride)
+        {
+            __m128i u, v;
+            UnpackNv12<nv21>(_mm_loadu_si128((__m128i*)uv), u, v);
+            YuvToRgbV2<false, T>(_mm_loadu_si128((__m128i*)y0), u, v, (__m128i*)rgb0);
+            YuvToRgbV2<false, T>(_mm_loadu_si128((__m128i*)(y0 + yStride)), u, v, (__m128i*)(rgb0 + rgbStride));
+        }
+
+        template <class T, bool nv21> void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (height >= 2));
+
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Nv12ToRgbV2<T, nv21>(y + col, yStride, uv + col, rgb + 3 * col, rgbStride);
+                if (widthA < width)
+                {
+                    size_t col = width - A;
+                    Nv12ToRgbV2<T, nv21>(y + col, yStride, uv + col, rgb + 3 * col, rgbStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                rgb += 2 * rgbStride;
+            }
+        }
+
+        template <bool nv21> void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToRgbV2<Base::Bt601, nv21>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt709: Nv12ToRgbV2<Base::Bt709, nv21>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvBt2020: Nv12ToRgbV2<Base::Bt2020, nv21>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            case SimdYuvTrect871: Nv12ToRgbV2<Base::Trect871, nv21>(y, yStride, uv, uvStride, width, height, rgb, rgbStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToRgbV2<false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+        }
+
+        void Nv21ToRgbV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToRgbV2<true>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+        }
     }
 #endif
 }
@@ -507,6 +507,64 @@ namespace Simd
             else
                 Yuv444pToRgbaV2<false>(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha, yuvType);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, bool nv21> SIMD_INLINE void Nv12ToBgraV2(const uint8_t* y0, size_t yStride, const uint8_t* uv, const __m128i& a_0, uint8_t* bgra0, size_t bgraStride)
+        {
+            __m128i u, v;
+            UnpackNv12<nv21>(_mm_loadu_si128((__m128i*)uv), u, v);
+            YuvToBgra<false, T>(_mm_loadu_si128((__m128i*)y0), u, v, a_0, (__m128i*)bgra0);
+            YuvToBgra<false, T>(_mm_loadu_si128((__m128i*)(y0 + yStride)), u, v, a_0, (__m128i*)(bgra0 + bgraStride));
+        }
+
+        template <class T, bool nv21> void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (height >= 2));
+
+            __m128i a_0 = _mm_slli_si128(_mm_set1_epi16(alpha), 1);
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Nv12ToBgraV2<T, nv21>(y + col, yStride, uv + col, a_0, bgra + 4 * col, bgraStride);
+                if (widthA < width)
+                {
+                    size_t col = width - A;
+                    Nv12ToBgraV2<T, nv21>(y + col, yStride, uv + col, a_0, bgra + 4 * col, bgraStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        template <bool nv21> void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToBgraV2<Base::Bt601, nv21>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt709: Nv12ToBgraV2<Base::Bt709, nv21>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToBgraV2<Base::Bt2020, nv21>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToBgraV2<Base::Trect871, nv21>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToBgraV2<false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv21ToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToBgraV2<true>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
     }
 #endif
 }
@@ -0,0 +1,132 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdDeinterleave.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template<bool align> SIMD_INLINE void Yuyv422ToGray(const uint8_t* yuyv, uint8_t* gray)
+        {
+            __m128i lo = _mm_and_si128(Load<align>((__m128i*)yuyv + 0), K16_00FF);
+            __m128i hi = _mm_and_si128(Load<align>((__m128i*)yuyv + 1), K16_00FF);
+            Store<align>((__m128i*)gray, _mm_packus_epi16(lo, hi));
+        }
+
+        template<bool align> void Yuyv422ToGray(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* gray, size_t grayStride)
+        {
+            assert((width % 2 == 0) && width >= A);
+            if (align)
+                assert(Aligned(yuyv) && Aligned(yuyvStride) && Aligned(gray) && Aligned(grayStride));
+
+            size_t widthA = AlignLo(width, A);
+            size_t tail = width - A;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Yuyv422ToGray<align>(yuyv + 2 * col, gray + col);
+                if (widthA != width)
+                    Yuyv422ToGray<false>(yuyv + 2 * tail, gray + tail);
+                yuyv += yuyvStride;
+                gray += grayStride;
+            }
+        }
+
+        void Yuyv422ToGray(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* gray, size_t grayStride)
+        {
+            if (Aligned(yuyv) && Aligned(yuyvStride) && Aligned(gray) && Aligned(grayStride))
+                Yuyv422ToGray<true>(yuyv, yuyvStride, width, height, gray, grayStride);
+            else
+                Yuyv422ToGray<false>(yuyv, yuyvStride, width, height, gray, grayStride);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<bool align> SIMD_INLINE void Yuyv422ToYuv420p(const uint8_t* yuyv0, size_t yuyvStride, uint8_t* y0, size_t yStride, uint8_t* u, uint8_t* v)
+        {
+            __m128i yuyv00 = Load<align>((__m128i*)yuyv0 + 0);
+            __m128i yuyv01 = Load<align>((__m128i*)yuyv0 + 1);
+            __m128i yuyv02 = Load<align>((__m128i*)yuyv0 + 2);
+            __m128i yuyv03 = Load<align>((__m128i*)yuyv0 + 3);
+
+            Store<align>((__m128i*)y0 + 0, Deinterleave8<0>(yuyv00, yuyv01));
+            Store<align>((__m128i*)y0 + 1, Deinterleave8<0>(yuyv02, yuyv03));
+
+            const uint8_t* yuyv1 = yuyv0 + yuyvStride;
+            __m128i yuyv10 = Load<align>((__m128i*)yuyv1 + 0);
+            __m128i yuyv11 = Load<align>((__m128i*)yuyv1 + 1);
+            __m128i yuyv12 = Load<align>((__m128i*)yuyv1 + 2);
+            __m128i yuyv13 = Load<align>((__m128i*)yuyv1 + 3);
+
+            uint8_t* y1 = y0 + yStride;
+            Store<align>((__m128i*)y1 + 0, Deinterleave8<0>(yuyv10, yuyv11));
+            Store<align>((__m128i*)y1 + 1, Deinterleave8<0>(yuyv12, yuyv13));
+
+            __m128i uv0 = _mm_avg_epu8(Deinterleave8<1>(yuyv00, yuyv01), Deinterleave8<1>(yuyv10, yuyv11));
+            __m128i uv1 = _mm_avg_epu8(Deinterleave8<1>(yuyv02, yuyv03), Deinterleave8<1>(yuyv12, yuyv13));
+
+            Store<align>((__m128i*)u, Deinterleave8<0>(uv0, uv1));
+            Store<align>((__m128i*)v, Deinterleave8<1>(uv0, uv1));
+        }
+
+        template<bool align> void Yuyv422ToYuv420p(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* u, size_t uStride, uint8_t* v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && width >= 2 * A);
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(yuyv) && Aligned(yuyvStride));
+            }
+
+            size_t width2A = AlignLo(width, 2 * A);
+            size_t tailYuyv = width * 2 - 4 * A;
+            size_t tailY = width - 2 * A;
+            size_t tailUV = width / 2 - A;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colYuyv = 0, colY = 0, colUV = 0; colY < width2A; colYuyv += 4 * A, colY += 2 * A, colUV += 1 * A)
+                    Yuyv422ToYuv420p<align>(yuyv + colYuyv, yuyvStride, y + colY, yStride, u + colUV, v + colUV);
+                if (width2A != width)
+                    Yuyv422ToYuv420p<false>(yuyv + tailYuyv, yuyvStride, y + tailY, yStride, u + tailUV, v + tailUV);
+                yuyv += 2 * yuyvStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        void Yuyv422ToYuv420p(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* u, size_t uStride, uint8_t* v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(yuyv) && Aligned(yuyvStride))
+                Yuyv422ToYuv420p<true>(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+            else
+                Yuyv422ToYuv420p<false>(yuyv, yuyvStride, width, height, y, yStride, u, uStride, v, vStride);
+        }
+    }
+#endif
+}
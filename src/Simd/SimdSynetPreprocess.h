@@ -0,0 +1,218 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetPreprocess_h__
+#define __SimdSynetPreprocess_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct SynetPreprocessParam
+    {
+        size_t srcW, srcH, dstW, dstH, channels;
+        SimdSynetPreprocessFormatType srcFormat;
+        SimdYuvType yuvType;
+        SimdResizeMethodType method;
+        SimdTensorDataType dstType;
+        SimdTensorFormatType dstFormat;
+        SimdBool isRgb, letterbox;
+        uint8_t padding;
+        float mean[3], scale[3];
+
+        SynetPreprocessParam(size_t sw, size_t sh, SimdSynetPreprocessFormatType sf, SimdYuvType yt, size_t dw, size_t dh, size_t c,
+            SimdResizeMethodType m, SimdTensorDataType dt, SimdTensorFormatType df, SimdBool rgb, SimdBool lb, uint8_t p, const float* mn, const float* sc)
+            : srcW(sw)
+            , srcH(sh)
+            , dstW(dw)
+            , dstH(dh)
+            , channels(c)
+            , srcFormat(sf)
+            , yuvType(yt)
+            , method(m)
+            , dstType(dt)
+            , dstFormat(df)
+            , isRgb(rgb)
+            , letterbox(lb)
+            , padding(p)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                mean[i] = mn ? mn[i < c ? i : 0] : 0.0f;
+                scale[i] = sc ? sc[i < c ? i : 0] : 1.0f;
+            }
+        }
+
+        bool Valid() const
+        {
+            if (srcW == 0 || srcH == 0 || dstW == 0 || dstH == 0)
+                return false;
+            if (channels != 1 && channels != 3)
+                return false;
+            if (srcFormat < SimdSynetPreprocessGray8 || srcFormat > SimdSynetPreprocessYuv420p)
+                return false;
+            if (IsYuv() && (yuvType < SimdYuvBt601 || yuvType > SimdYuvTrect871))
+                return false;
+            if (method != SimdResizeMethodNearest && method != SimdResizeMethodBilinear)
+                return false;
+            if (dstType != SimdTensorData32f && dstType != SimdTensorData16b && dstType != SimdTensorData8u)
+                return false;
+            if (dstFormat != SimdTensorFormatNchw && dstFormat != SimdTensorFormatNhwc)
+                return false;
+            return true;
+        }
+
+        SIMD_INLINE bool IsYuv() const
+        {
+            return srcFormat == SimdSynetPreprocessNv12 || srcFormat == SimdSynetPreprocessYuv420p;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class SynetPreprocess : public Deletable
+    {
+    public:
+        SynetPreprocess(const SynetPreprocessParam& param)
+            : _param(param)
+        {
+        }
+
+        virtual size_t InternalBufferSize() const
+        {
+            return 0;
+        }
+
+        virtual void Run(const uint8_t* const* src, const size_t* srcStride, uint8_t* dst) = 0;
+
+    protected:
+        SynetPreprocessParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        SIMD_INLINE float SynetPreprocessNormalize(float src0, float src1, float k0, float k1, float scale, float shift)
+        {
+            return (src0 * k0 + src1 * k1) * scale + shift;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        class SynetPreprocessFused : public Simd::SynetPreprocess
+        {
+        public:
+            SynetPreprocessFused(const SynetPreprocessParam& param);
+
+            virtual size_t InternalBufferSize() const;
+
+            virtual void Run(const uint8_t* const* src, const size_t* srcStride, uint8_t* dst);
+
+            typedef void (*DeinterleaveUvRowPtr)(const uint8_t* uv, size_t width, uint8_t* u, uint8_t* v);
+            typedef void (*YuvToBgrRowPtr)(const uint8_t* y, const uint8_t* u, const uint8_t* v, size_t width, SimdYuvType yuvType, uint8_t* bgr);
+            typedef void (*ResizeRowPtr)(const uint8_t* src, size_t srcSize, const int32_t* idx0, const int32_t* idx1, const float* alpha, size_t size, float* buf, float* dst);
+            typedef void (*NormalizeRowPtr)(const float* src0, const float* src1, float k0, float k1, const float* scale, const float* shift, size_t size, uint8_t* dst);
+
+        protected:
+            const uint8_t* ConvertRow(const uint8_t* const* src, const size_t* srcStride, size_t row);
+            const float* ResizedRow(const uint8_t* const* src, const size_t* srcStride, int32_t row, int32_t keep);
+            void SetPadding(uint8_t* dst, size_t x, size_t y, size_t w, size_t h);
+
+            size_t _rW, _rH, _rX, _rY, _elem;
+            Array32i _ix, _iy;
+            Array32f _ax, _ay, _scale, _shift, _rows[2], _buf;
+            Array8u _bgr, _cvt, _uv, _pad;
+            int32_t _rowIdx[2];
+            DeinterleaveUvRowPtr _deinterleaveUvRow;
+            YuvToBgrRowPtr _yuvToBgrRow;
+            ResizeRowPtr _resizeRow;
+            NormalizeRowPtr _normalizeRow;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetPreprocessDeinterleaveUvRow(const uint8_t* uv, size_t width, uint8_t* u, uint8_t* v);
+
+        void SynetPreprocessYuvToBgrRow(const uint8_t* y, const uint8_t* u, const uint8_t* v, size_t width, SimdYuvType yuvType, uint8_t* bgr);
+
+        void SynetPreprocessResizeRow(const uint8_t* src, size_t srcSize, const int32_t* idx0, const int32_t* idx1, const float* alpha, size_t size, float* buf, float* dst);
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, SimdYuvType yuvType, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, uint8_t padding, const float* mean, const float* scale);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SynetPreprocessFused : public Base::SynetPreprocessFused
+        {
+        public:
+            SynetPreprocessFused(const SynetPreprocessParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, SimdYuvType yuvType, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, uint8_t padding, const float* mean, const float* scale);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetPreprocessFused : public Sse41::SynetPreprocessFused
+        {
+        public:
+            SynetPreprocessFused(const SynetPreprocessParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, SimdYuvType yuvType, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, uint8_t padding, const float* mean, const float* scale);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SynetPreprocessFused : public Avx2::SynetPreprocessFused
+        {
+        public:
+            SynetPreprocessFused(const SynetPreprocessParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, SimdYuvType yuvType, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, uint8_t padding, const float* mean, const float* scale);
+    }
+#endif
+}
+
+#endif
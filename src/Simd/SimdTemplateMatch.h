@@ -0,0 +1,223 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdTemplateMatch_h__
+#define __SimdTemplateMatch_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdPyramidBuilder.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct TemplateMatchParam
+    {
+        size_t srcWidth, srcHeight, tmpWidth, tmpHeight, levels;
+        SimdTemplateMatchType type;
+
+        TemplateMatchParam(size_t sw, size_t sh, size_t tw, size_t th, SimdTemplateMatchType t, size_t l)
+            : srcWidth(sw)
+            , srcHeight(sh)
+            , tmpWidth(tw)
+            , tmpHeight(th)
+            , levels(l)
+            , type(t)
+        {
+        }
+
+        bool Valid() const
+        {
+            if (tmpWidth == 0 || tmpHeight == 0 || tmpWidth > srcWidth || tmpHeight > srcHeight)
+                return false;
+            if (tmpWidth > 0xFFFF || tmpWidth * tmpHeight >= 0x800000 || srcWidth >= 0x40000000 || srcHeight >= 0x40000000)
+                return false;
+            if (type < SimdTemplateMatchSad || type > SimdTemplateMatchNcc || levels == 0 || levels > 16)
+                return false;
+            return true;
+        }
+
+        size_t DstWidth() const
+        {
+            return srcWidth - tmpWidth + 1;
+        }
+
+        size_t DstHeight() const
+        {
+            return srcHeight - tmpHeight + 1;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class TemplateMatch : Deletable
+    {
+    public:
+        TemplateMatch(const TemplateMatchParam& param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t* src, size_t srcStride, const uint8_t* tmp, size_t tmpStride, float* dst, size_t dstStride) = 0;
+
+        virtual float Search(const uint8_t* src, size_t srcStride, const uint8_t* tmp, size_t tmpStride, size_t* x, size_t* y) = 0;
+
+    protected:
+        TemplateMatchParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        const size_t TM_CANDIDATES = 4;
+        const size_t TM_RADIUS = 2;
+        const size_t TM_MIN_SIZE = 4;
+
+        void TmSad(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        void TmSsd(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        void TmCorr(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        typedef void (*TmRowPtr)(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        typedef void (*IntegralPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* sum, size_t sumStride, 
+            uint8_t* sqsum, size_t sqsumStride, uint8_t* tilted, size_t tiltedStride, SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
+
+        class TemplateMatchDefault : public Simd::TemplateMatch
+        {
+        public:
+            TemplateMatchDefault(const TemplateMatchParam& param, PyramidBuilderInitPtr pyramidInit);
+            virtual ~TemplateMatchDefault();
+
+            virtual void Run(const uint8_t* src, size_t srcStride, const uint8_t* tmp, size_t tmpStride, float* dst, size_t dstStride);
+
+            virtual float Search(const uint8_t* src, size_t srcStride, const uint8_t* tmp, size_t tmpStride, size_t* x, size_t* y);
+
+        protected:
+            struct Level
+            {
+                size_t srcWidth, srcHeight, tmpWidth, tmpHeight, srcStride, tmpStride;
+                const uint8_t* src, * tmp;
+                Array8u srcBuf, tmpBuf;
+                Array32u sum;
+                Array<double> sqsum;
+                uint64_t tmpSum, tmpSqsum;
+            };
+
+            void SetRow(SimdTemplateMatchType type, TmRowPtr sad, TmRowPtr ssd, TmRowPtr corr);
+            void Prepare(Level& level, const uint8_t* src, size_t srcStride, const uint8_t* tmp, size_t tmpStride);
+            void Score(size_t thread, const Level& level, size_t x, size_t y, size_t width, size_t height, float* dst, size_t dstStride);
+            void Map(const Level& level, float* dst, size_t dstStride);
+
+            SIMD_INLINE bool Better(float a, float b) const
+            {
+                return _param.type == SimdTemplateMatchNcc ? a > b : a < b;
+            }
+
+            size_t _threads, _levels;
+            std::vector<Level> _pyramid;
+            PyramidBuilder* _srcBuilder, * _tmpBuilder;
+            std::vector<std::vector<uint64_t>> _sums;
+            Array32f _map;
+            TmRowPtr _row;
+            IntegralPtr _integral;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* TemplateMatchInit(size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void TmSad(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        void TmSsd(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        void TmCorr(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class TemplateMatchDefault : public Base::TemplateMatchDefault
+        {
+        public:
+            TemplateMatchDefault(const TemplateMatchParam& param, Base::PyramidBuilderInitPtr pyramidInit);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* TemplateMatchInit(size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void TmSad(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        void TmSsd(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        void TmCorr(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class TemplateMatchDefault : public Sse41::TemplateMatchDefault
+        {
+        public:
+            TemplateMatchDefault(const TemplateMatchParam& param, Base::PyramidBuilderInitPtr pyramidInit);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* TemplateMatchInit(size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        void TmSad(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        void TmSsd(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        void TmCorr(const uint8_t* src, const uint8_t* tmp, size_t size, size_t width, uint64_t* sums);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class TemplateMatchDefault : public Avx2::TemplateMatchDefault
+        {
+        public:
+            TemplateMatchDefault(const TemplateMatchParam& param, Base::PyramidBuilderInitPtr pyramidInit);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* TemplateMatchInit(size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels);
+    }
+#endif
+}
+
+#endif
@@ -117,6 +117,8 @@ namespace Simd
             Uyvy16,
             /*! A 32-bit (4 8-bit channels) ARGB (Alpha, Red, Green, Blue) pixel format. */
             Argb32,
+            /*! A 16-bit (2 8-bit channels) YUYV422 pixel format. */
+            Yuyv16,
         };
 
         /*!
@@ -1144,6 +1146,7 @@ namespace Simd
         case Rgba32:    return 4;
         case Uyvy16:    return 2;
         case Argb32:    return 4;
+        case Yuyv16:    return 2;
         default: assert(0); return 0;
         }
     }
@@ -1177,6 +1180,7 @@ namespace Simd
         case Rgba32:    return 1;
         case Uyvy16:    return 1;
         case Argb32:    return 1;
+        case Yuyv16:    return 1;
         default: assert(0); return 0;
         }
     }
@@ -1210,6 +1214,7 @@ namespace Simd
         case Rgba32:    return 4;
         case Uyvy16:    return 2;
         case Argb32:    return 4;
+        case Yuyv16:    return 2;
         default: assert(0); return 0;
         }
     }
@@ -286,6 +286,14 @@ namespace Simd
             return _mm_subs_epi16(UnpackU8<part>(uv, K_ZERO), UV_Z);
         }
 
+        template <bool nv21> SIMD_INLINE void UnpackNv12(const __m128i& uv, __m128i& u, __m128i& v)
+        {
+            static const __m128i UV_TO_U = SIMD_MM_SETR_EPI8(0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE);
+            static const __m128i UV_TO_V = SIMD_MM_SETR_EPI8(0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF);
+            u = _mm_shuffle_epi8(uv, nv21 ? UV_TO_V : UV_TO_U);
+            v = _mm_shuffle_epi8(uv, nv21 ? UV_TO_U : UV_TO_V);
+        }
+
         template <class T> SIMD_INLINE __m128i YuvToRed16(__m128i y16, __m128i v16)
         {
             __m128i lo = YuvToRed32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(v16, K_ZERO));
@@ -455,6 +463,18 @@ namespace Simd
             return _mm256_subs_epi16(UnpackU8<part>(uv, K_ZERO), UV_Z);
         }
 
+        template <bool nv21> SIMD_INLINE void UnpackNv12(const __m256i& uv, __m256i& u, __m256i& v)
+        {
+            static const __m256i UV_TO_U = SIMD_MM256_SETR_EPI8(
+                0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE,
+                0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE);
+            static const __m256i UV_TO_V = SIMD_MM256_SETR_EPI8(
+                0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF,
+                0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF);
+            u = _mm256_shuffle_epi8(uv, nv21 ? UV_TO_V : UV_TO_U);
+            v = _mm256_shuffle_epi8(uv, nv21 ? UV_TO_U : UV_TO_V);
+        }
+
         template <class T> SIMD_INLINE __m256i YuvToRed16(__m256i y16, __m256i v16)
         {
             __m256i lo = YuvToRed32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(v16, K_ZERO));
@@ -620,6 +640,22 @@ namespace Simd
             return _mm512_subs_epi16(UnpackU8<part>(uv, K_ZERO), UV_Z);
         }
 
+        template <bool nv21> SIMD_INLINE void UnpackNv12(const __m512i& uv, __m512i& u, __m512i& v)
+        {
+            static const __m512i UV_TO_U = SIMD_MM512_SETR_EPI8(
+                0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE,
+                0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE,
+                0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE,
+                0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE);
+            static const __m512i UV_TO_V = SIMD_MM512_SETR_EPI8(
+                0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF,
+                0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF,
+                0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF,
+                0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF);
+            u = _mm512_shuffle_epi8(uv, nv21 ? UV_TO_V : UV_TO_U);
+            v = _mm512_shuffle_epi8(uv, nv21 ? UV_TO_U : UV_TO_V);
+        }
+
         template <class T> SIMD_INLINE __m512i YuvToRed16(__m512i y16, __m512i v16)
         {
             __m512i lo = YuvToRed32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(v16, K_ZERO));
@@ -85,6 +85,7 @@ namespace Test
     TEST_ADD_GROUP_A0(SquaredDifferenceSum32f);
     TEST_ADD_GROUP_A0(SquaredDifferenceKahanSum32f);
     TEST_ADD_GROUP_A0(CosineDistance32f);
+    TEST_ADD_GROUP_A0(TemplateMatch);
 
     TEST_ADD_GROUP_A0(AddFeatureDifference);
 
@@ -111,13 +112,16 @@ namespace Test
     TEST_ADD_GROUP_A0(GrayToBgra);
     TEST_ADD_GROUP_A0(RgbToBgra);
 
+    TEST_ADD_GROUP_A0(BgraToNv12V2);
     TEST_ADD_GROUP_A0(BgraToYuv420pV2);
     TEST_ADD_GROUP_A0(BgraToYuv422pV2);
     TEST_ADD_GROUP_A0(BgraToYuv444pV2);
+    TEST_ADD_GROUP_A0(BgrToNv12V2);
     TEST_ADD_GROUP_A0(BgrToYuv420pV2);
     TEST_ADD_GROUP_A0(BgrToYuv422pV2);
     TEST_ADD_GROUP_A0(BgrToYuv444pV2);
     TEST_ADD_GROUP_A0(Uyvy422ToYuv420p);
+    TEST_ADD_GROUP_A0(Yuyv422ToYuv420p);
     TEST_ADD_GROUP_A0(BgraToYuva420pV2);
 
     TEST_ADD_GROUP_A0(BackgroundGrowRangeSlow);
@@ -136,6 +140,10 @@ namespace Test
 
     TEST_ADD_GROUP_A0(BayerToBgra);
 
+    TEST_ADD_GROUP_A0(BayerToBgrMhc);
+    TEST_ADD_GROUP_A0(BayerToBgraMhc);
+    TEST_ADD_GROUP_A0(BayerToGrayMhc);
+
     TEST_ADD_GROUP_A0(Float32ToBFloat16);
     TEST_ADD_GROUP_A0(BFloat16ToFloat32);
 
@@ -225,15 +233,18 @@ namespace Test
     TEST_ADD_GROUP_A0(Nv12SaveAsJpegToMemory);
     TEST_ADD_GROUP_A0(Yuv420pSaveAsJpegToMemory);
     TEST_ADD_GROUP_AS(ImageLoadFromMemory);
+    TEST_ADD_GROUP_A0(ImageMapFromFile);
 
     TEST_ADD_GROUP_A0(MeanFilter3x3);
     TEST_ADD_GROUP_A0(MedianFilterRhomb3x3);
     TEST_ADD_GROUP_A0(MedianFilterRhomb5x5);
     TEST_ADD_GROUP_A0(MedianFilterSquare3x3);
     TEST_ADD_GROUP_A0(MedianFilterSquare5x5);
+    TEST_ADD_GROUP_A0(MedianFilter);
     TEST_ADD_GROUP_A0(GaussianBlur3x3);
     TEST_ADD_GROUP_A0(AbsGradientSaturatedSum);
     TEST_ADD_GROUP_A0(LbpEstimate);
+    TEST_ADD_GROUP_A0(Lut3d);
     TEST_ADD_GROUP_A0(NormalizeHistogram);
     TEST_ADD_GROUP_A0(SobelDx);
     TEST_ADD_GROUP_A0(SobelDxAbs);
@@ -243,6 +254,14 @@ namespace Test
     TEST_ADD_GROUP_A0(Laplace);
     TEST_ADD_GROUP_A0(LaplaceAbs);
     TEST_ADD_GROUP_AS(GaussianBlur);
+    TEST_ADD_GROUP_A0(GaussianBlurIir);
+
+    TEST_ADD_GROUP_A0(SeparableFilter);
+    TEST_ADD_GROUP_A0(BoxFilter);
+    TEST_ADD_GROUP_A0(Morphology);
+    TEST_ADD_GROUP_A0(Canny);
+    TEST_ADD_GROUP_A0(DistanceTransform);
+    TEST_ADD_GROUP_A0(ConnectedComponents);
     TEST_ADD_GROUP_A0(RecursiveBilateralFilter);
 
     TEST_ADD_GROUP_A0(Histogram);
@@ -306,12 +325,14 @@ namespace Test
     TEST_ADD_GROUP_A0(ReduceGray3x3);
     TEST_ADD_GROUP_A0(ReduceGray4x4);
     TEST_ADD_GROUP_A0(ReduceGray5x5);
+    TEST_ADD_GROUP_A0(PyramidBuilder);
 
     TEST_ADD_GROUP_A0(Reorder16bit);
     TEST_ADD_GROUP_A0(Reorder32bit);
     TEST_ADD_GROUP_A0(Reorder64bit);
 
     TEST_ADD_GROUP_A0(Resizer);
+    TEST_ADD_GROUP_A0(CropResizer);
     TEST_ADD_GROUP_0S(ResizeYuv420p);
 
     TEST_ADD_GROUP_A0(SegmentationShrinkRegion);
@@ -320,6 +341,7 @@ namespace Test
     TEST_ADD_GROUP_A0(SegmentationPropagate2x2);
 
     TEST_ADD_GROUP_A0(ShiftBilinear);
+    TEST_ADD_GROUP_A0(OpticalFlowLk);
     TEST_ADD_GROUP_0S(ShiftDetectorRand);
     TEST_ADD_GROUP_0S(ShiftDetectorFile);
 
@@ -367,6 +389,7 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetConvert32fTo8u);
     TEST_ADD_GROUP_A0(SynetConvert8uTo32f);
     TEST_ADD_GROUP_A0(SynetSetInput);
+    TEST_ADD_GROUP_A0(SynetPreprocess);
 
     TEST_ADD_GROUP_A0(SynetConvolution8iForward);
 
@@ -420,6 +443,10 @@ namespace Test
 
     TEST_ADD_GROUP_A0(Uyvy422ToBgr);
 
+    TEST_ADD_GROUP_A0(Yuyv422ToBgr);
+    TEST_ADD_GROUP_A0(Yuyv422ToBgra);
+    TEST_ADD_GROUP_A0(Yuyv422ToGray);
+
     TEST_ADD_GROUP_A0(WarpAffine);
 #ifdef SIMD_OPENCV_ENABLE
     TEST_ADD_GROUP_0S(WarpAffineOpenCv);
@@ -468,6 +495,16 @@ namespace Test
     TEST_ADD_GROUP_A0(Yuv422pToRgbV2);
     TEST_ADD_GROUP_AS(Yuv420pToRgbV2);
     TEST_ADD_GROUP_A0(Yuv420pToUyvy422);
+    TEST_ADD_GROUP_A0(Nv12ToBgrV2);
+    TEST_ADD_GROUP_A0(Nv21ToBgrV2);
+    TEST_ADD_GROUP_A0(Nv12ToRgbV2);
+    TEST_ADD_GROUP_A0(Nv21ToRgbV2);
+    TEST_ADD_GROUP_A0(Yuv420p10ToBgrV2);
+    TEST_ADD_GROUP_A0(Yuv420p10ToBgraV2);
+    TEST_ADD_GROUP_A0(Yuv420p10ToBgr48pV2);
+    TEST_ADD_GROUP_A0(P010ToBgrV2);
+    TEST_ADD_GROUP_A0(P010ToBgraV2);
+    TEST_ADD_GROUP_A0(P010ToBgr48pV2);
 
     TEST_ADD_GROUP_A0(Yuva420pToBgraV2);
     TEST_ADD_GROUP_A0(Yuva422pToBgraV2);
@@ -476,6 +513,8 @@ namespace Test
     TEST_ADD_GROUP_A0(Yuv422pToBgraV2);
     TEST_ADD_GROUP_A0(Yuv420pToBgraV2);
     TEST_ADD_GROUP_A0(Yuv444pToRgbaV2);
+    TEST_ADD_GROUP_A0(Nv12ToBgraV2);
+    TEST_ADD_GROUP_A0(Nv21ToBgraV2);
 
     //-------------------------------------------------------------------------------------------------
 
@@ -143,6 +143,31 @@ namespace Test
         return result;
     }
 
+    bool Yuyv422ToYuv420pAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && AnyToYuvAutoTest(View::Yuyv16, 2, 2, FUNC_YUVN(Simd::Base::Yuyv422ToYuv420p), FUNC_YUVN(SimdYuyv422ToYuv420p));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && AnyToYuvAutoTest(View::Yuyv16, 2, 2, FUNC_YUVN(Simd::Sse41::Yuyv422ToYuv420p), FUNC_YUVN(SimdYuyv422ToYuv420p));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvAutoTest(View::Yuyv16, 2, 2, FUNC_YUVN(Simd::Avx2::Yuyv422ToYuv420p), FUNC_YUVN(SimdYuyv422ToYuv420p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && AnyToYuvAutoTest(View::Yuyv16, 2, 2, FUNC_YUVN(Simd::Avx512bw::Yuyv422ToYuv420p), FUNC_YUVN(SimdYuyv422ToYuv420p));
+#endif
+
+        return result;
+    }
+
     //-------------------------------------------------------------------------------------------------
 
     namespace
@@ -167,7 +192,7 @@ namespace Test
 
 #define FUNC_YUV2(function) FuncYuv2(function, #function)
 
-    bool AnyToYuvV2AutoTest(int width, int height, View::Format srcType, int dx, int dy, SimdYuvType yuvType, const FuncYuv2& f1, const FuncYuv2& f2)
+    bool AnyToYuvV2AutoTest(int width, int height, View::Format srcType, int dx, int dy, SimdYuvType yuvType, const FuncYuv2& f1, const FuncYuv2& f2, bool random = false)
     {
         bool result = true;
 
@@ -177,8 +202,10 @@ namespace Test
         const int uvHeight = height / dy;
 
         View src(width, height, srcType, NULL, TEST_ALIGN(width));
-        //FillRandom(src);
-        FillSequence(src);
+        if (random)
+            FillRandom(src);
+        else
+            FillSequence(src);
 
         View y1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
         View u1(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
@@ -198,13 +225,13 @@ namespace Test
         return result;
     }
 
-    bool AnyToYuvV2AutoTest(View::Format srcType, int dx, int dy, const FuncYuv2& f1, const FuncYuv2& f2)
+    bool AnyToYuvV2AutoTest(View::Format srcType, int dx, int dy, const FuncYuv2& f1, const FuncYuv2& f2, bool random = false)
     {
         bool result = true;
 
-        result = result && AnyToYuvV2AutoTest(W, H, srcType, dx, dy, SimdYuvBt601, f1, f2);
-        result = result && AnyToYuvV2AutoTest(W + O * dx, H - O * dy, srcType, dx, dy, SimdYuvBt709, f1, f2);
-        result = result && AnyToYuvV2AutoTest(W - O * dx, H + O * dy, srcType, dx, dy, SimdYuvBt2020, f1, f2);
+        result = result && AnyToYuvV2AutoTest(W, H, srcType, dx, dy, SimdYuvBt601, f1, f2, random);
+        result = result && AnyToYuvV2AutoTest(W + O * dx, H - O * dy, srcType, dx, dy, SimdYuvBt709, f1, f2, random);
+        result = result && AnyToYuvV2AutoTest(W - O * dx, H + O * dy, srcType, dx, dy, SimdYuvBt2020, f1, f2, random);
 
         return result;
     }
@@ -223,7 +250,10 @@ namespace Test
         
 #ifdef SIMD_AVX2_ENABLE
         if (Simd::Avx2::Enable && TestAvx2())
+        {
             result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV2(Simd::Avx2::BgraToYuv420pV2), FUNC_YUV2(SimdBgraToYuv420pV2));
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV2(Simd::Avx2::BgraToYuv420pV2), FUNC_YUV2(Simd::Base::BgraToYuv420pV2), true);
+        }
 #endif 
         
 #ifdef SIMD_AVX512BW_ENABLE
@@ -253,7 +283,10 @@ namespace Test
 
 #ifdef SIMD_AVX2_ENABLE
         if (Simd::Avx2::Enable && TestAvx2())
+        {
             result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV2(Simd::Avx2::BgraToYuv422pV2), FUNC_YUV2(SimdBgraToYuv422pV2));
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV2(Simd::Avx2::BgraToYuv422pV2), FUNC_YUV2(Simd::Base::BgraToYuv422pV2), true);
+        }
 #endif 
 
 #ifdef SIMD_AVX512BW_ENABLE
@@ -486,4 +519,116 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncNv12
+        {
+            typedef void(*FuncPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* y, size_t yStride,
+                uint8_t* uv, size_t uvStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncNv12(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& src, View& y, View& uv, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, y.data, y.stride, uv.data, uv.stride, yuvType);
+            }
+        };
+    }
+
+#define FUNC_NV12(function) FuncNv12(function, #function)
+
+    bool AnyToNv12V2AutoTest(int width, int height, View::Format srcType, SimdYuvType yuvType, const FuncNv12& f1, const FuncNv12& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int uvWidth = width / 2;
+        const int uvHeight = height / 2;
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View y1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View uv1(uvWidth, uvHeight, View::Uv16, NULL, TEST_ALIGN(width));
+
+        View y2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View uv2(uvWidth, uvHeight, View::Uv16, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, y1, uv1, yuvType));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, y2, uv2, yuvType));
+
+        result = result && Compare(y1, y2, 0, true, 64, 0, "y");
+        result = result && Compare(uv1, uv2, 0, true, 64, 0, "uv");
+
+        return result;
+    }
+
+    bool AnyToNv12V2AutoTest(View::Format srcType, const FuncNv12& f1, const FuncNv12& f2)
+    {
+        bool result = true;
+
+        result = result && AnyToNv12V2AutoTest(W, H, srcType, SimdYuvBt601, f1, f2);
+        result = result && AnyToNv12V2AutoTest(W + O * 2, H - O * 2, srcType, SimdYuvBt709, f1, f2);
+        result = result && AnyToNv12V2AutoTest(W - O * 2, H + O * 2, srcType, SimdYuvBt2020, f1, f2);
+
+        return result;
+    }
+
+    bool BgraToNv12V2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && AnyToNv12V2AutoTest(View::Bgra32, FUNC_NV12(Simd::Base::BgraToNv12V2), FUNC_NV12(SimdBgraToNv12V2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && AnyToNv12V2AutoTest(View::Bgra32, FUNC_NV12(Simd::Sse41::BgraToNv12V2), FUNC_NV12(SimdBgraToNv12V2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && AnyToNv12V2AutoTest(View::Bgra32, FUNC_NV12(Simd::Avx2::BgraToNv12V2), FUNC_NV12(SimdBgraToNv12V2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && AnyToNv12V2AutoTest(View::Bgra32, FUNC_NV12(Simd::Avx512bw::BgraToNv12V2), FUNC_NV12(SimdBgraToNv12V2));
+#endif
+
+        return result;
+    }
+
+    bool BgrToNv12V2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && AnyToNv12V2AutoTest(View::Bgr24, FUNC_NV12(Simd::Base::BgrToNv12V2), FUNC_NV12(SimdBgrToNv12V2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && AnyToNv12V2AutoTest(View::Bgr24, FUNC_NV12(Simd::Sse41::BgrToNv12V2), FUNC_NV12(SimdBgrToNv12V2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && AnyToNv12V2AutoTest(View::Bgr24, FUNC_NV12(Simd::Avx2::BgrToNv12V2), FUNC_NV12(SimdBgrToNv12V2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && AnyToNv12V2AutoTest(View::Bgr24, FUNC_NV12(Simd::Avx512bw::BgrToNv12V2), FUNC_NV12(SimdBgrToNv12V2));
+#endif
+
+        return result;
+    }
 }
@@ -0,0 +1,219 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncMhc
+        {
+            typedef void(*FuncPtr)(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* dst, size_t dstStride);
+            FuncPtr func;
+            String description;
+
+            FuncMhc(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_MHC(func) FuncMhc(func, #func)
+
+    bool BayerToAnyMhcAutoTest(int width, int height, View::Format srcFormat, View::Format dstFormat, const FuncMhc & f1, const FuncMhc & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "] of " << FormatDescription(srcFormat) << ".");
+
+        View s(width, height, srcFormat, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, dstFormat, NULL, TEST_ALIGN(width));
+        View d2(width, height, dstFormat, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, d2));
+
+        result = result && Compare(d1, d2, 0, true, 32);
+
+        return result;
+    }
+
+    bool BayerToAnyMhcAutoTest(View::Format dstFormat, const FuncMhc & f1, const FuncMhc & f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::BayerGrbg; format <= View::BayerBggr; format = View::Format(format + 1))
+        {
+            result = result && BayerToAnyMhcAutoTest(W, H, format, dstFormat, f1, f2);
+            result = result && BayerToAnyMhcAutoTest(W + E, H - E, format, dstFormat, f1, f2);
+            result = result && BayerToAnyMhcAutoTest(W - E, H + E, format, dstFormat, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool BayerToBgrMhcAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && BayerToAnyMhcAutoTest(View::Bgr24, FUNC_MHC(Simd::Base::BayerToBgrMhc), FUNC_MHC(SimdBayerToBgrMhc));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::A)
+            result = result && BayerToAnyMhcAutoTest(View::Bgr24, FUNC_MHC(Simd::Sse41::BayerToBgrMhc), FUNC_MHC(SimdBayerToBgrMhc));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::A)
+            result = result && BayerToAnyMhcAutoTest(View::Bgr24, FUNC_MHC(Simd::Avx2::BayerToBgrMhc), FUNC_MHC(SimdBayerToBgrMhc));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::A)
+            result = result && BayerToAnyMhcAutoTest(View::Bgr24, FUNC_MHC(Simd::Avx512bw::BayerToBgrMhc), FUNC_MHC(SimdBayerToBgrMhc));
+#endif
+
+        return result;
+    }
+
+    bool BayerToGrayMhcAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && BayerToAnyMhcAutoTest(View::Gray8, FUNC_MHC(Simd::Base::BayerToGrayMhc), FUNC_MHC(SimdBayerToGrayMhc));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::A)
+            result = result && BayerToAnyMhcAutoTest(View::Gray8, FUNC_MHC(Simd::Sse41::BayerToGrayMhc), FUNC_MHC(SimdBayerToGrayMhc));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::A)
+            result = result && BayerToAnyMhcAutoTest(View::Gray8, FUNC_MHC(Simd::Avx2::BayerToGrayMhc), FUNC_MHC(SimdBayerToGrayMhc));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::A)
+            result = result && BayerToAnyMhcAutoTest(View::Gray8, FUNC_MHC(Simd::Avx512bw::BayerToGrayMhc), FUNC_MHC(SimdBayerToGrayMhc));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncMhcA
+        {
+            typedef void(*FuncPtr)(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t* bgra, size_t bgraStride, uint8_t alpha);
+            FuncPtr func;
+            String description;
+
+            FuncMhcA(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, View & dst, uint8_t alpha) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, dst.data, dst.stride, alpha);
+            }
+        };
+    }
+
+#define FUNC_MHC_A(func) FuncMhcA(func, #func)
+
+    bool BayerToBgraMhcAutoTest(int width, int height, View::Format format, const FuncMhcA & f1, const FuncMhcA & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "] of " << FormatDescription(format) << ".");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        uint8_t alpha = Random(256);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, d1, alpha));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, d2, alpha));
+
+        result = result && Compare(d1, d2, 0, true, 32);
+
+        return result;
+    }
+
+    bool BayerToBgraMhcAutoTest(const FuncMhcA & f1, const FuncMhcA & f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::BayerGrbg; format <= View::BayerBggr; format = View::Format(format + 1))
+        {
+            result = result && BayerToBgraMhcAutoTest(W, H, format, f1, f2);
+            result = result && BayerToBgraMhcAutoTest(W + E, H - E, format, f1, f2);
+            result = result && BayerToBgraMhcAutoTest(W - E, H + E, format, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool BayerToBgraMhcAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && BayerToBgraMhcAutoTest(FUNC_MHC_A(Simd::Base::BayerToBgraMhc), FUNC_MHC_A(SimdBayerToBgraMhc));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::A)
+            result = result && BayerToBgraMhcAutoTest(FUNC_MHC_A(Simd::Sse41::BayerToBgraMhc), FUNC_MHC_A(SimdBayerToBgraMhc));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::A)
+            result = result && BayerToBgraMhcAutoTest(FUNC_MHC_A(Simd::Avx2::BayerToBgraMhc), FUNC_MHC_A(SimdBayerToBgraMhc));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::A)
+            result = result && BayerToBgraMhcAutoTest(FUNC_MHC_A(Simd::Avx512bw::BayerToBgraMhc), FUNC_MHC_A(SimdBayerToBgraMhc));
+#endif
+
+        return result;
+    }
+}
@@ -110,6 +110,12 @@ namespace Test
         Frame fs(2, 2, Frame::Yuv420p);
         Frame fd(2, 2, Frame::Bgr24);
         Simd::Convert(fs, fd);
+
+        Frame fy(2, 2, Frame::Yuyv16);
+        Simd::Convert(fy, fd);
+
+        Frame fy3(2, 3, Frame::Yuyv16), f444(2, 3, Frame::Yuv444p);
+        Simd::Convert(fy3, f444);
     }
 
     static void TestPyramid()
@@ -24,6 +24,9 @@
 #include "Test/TestCompare.h"
 #include "Test/TestPerformance.h"
 #include "Test/TestRandom.h"
+#include "Test/TestString.h"
+
+#include "Simd/SimdTemplateMatch.h"
 
 namespace Test
 {
@@ -456,4 +459,123 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncTm
+        {
+            typedef void* (*FuncPtr)(size_t srcWidth, size_t srcHeight, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels);
+
+            FuncPtr func;
+            String description;
+
+            FuncTm(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(const View& tmp, SimdTemplateMatchType type, size_t levels)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << tmp.width << "x" << tmp.height << "-" << (type == SimdTemplateMatchSad ? "SAD" : (type == SimdTemplateMatchSsd ? "SSD" : "NCC")) << "-" << levels << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, const View& tmp, SimdTemplateMatchType type, size_t levels, View& dst, size_t* x, size_t* y, float* score) const
+            {
+                void* context = func(src.width, src.height, tmp.width, tmp.height, type, levels);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdTemplateMatchRun(context, src.data, src.stride, tmp.data, tmp.stride, (float*)dst.data, dst.stride / sizeof(float));
+                    *score = SimdTemplateMatchSearch(context, src.data, src.stride, tmp.data, tmp.stride, x, y);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_TM(function) \
+    FuncTm(function, std::string(#function))
+
+    bool TemplateMatchAutoTest(size_t width, size_t height, size_t tmpWidth, size_t tmpHeight, SimdTemplateMatchType type, size_t levels, FuncTm f1, FuncTm f2)
+    {
+        bool result = true;
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width)), noise(width / 4, height / 4, View::Gray8);
+        FillRandom(noise);
+        void* resizer = SimdResizerInit(noise.width, noise.height, width, height, 1, SimdResizeChannelByte, SimdResizeMethodBilinear);
+        SimdResizerRun(resizer, noise.data, noise.stride, src.data, src.stride);
+        SimdRelease(resizer);
+        View tmp(tmpWidth, tmpHeight, View::Gray8, NULL, TEST_ALIGN(tmpWidth));
+        Simd::Copy(src.Region(width / 3, height / 2, width / 3 + tmpWidth, height / 2 + tmpHeight), tmp);
+
+        f1.Update(tmp, type, levels);
+        f2.Update(tmp, type, levels);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View dst1(width - tmpWidth + 1, height - tmpHeight + 1, View::Float, NULL, TEST_ALIGN(width));
+        View dst2(width - tmpWidth + 1, height - tmpHeight + 1, View::Float, NULL, TEST_ALIGN(width));
+        size_t x1, y1, x2, y2;
+        float score1, score2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, tmp, type, levels, dst1, &x1, &y1, &score1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, tmp, type, levels, dst2, &x2, &y2, &score2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        if (result && (x1 != x2 || y1 != y2 || score1 != score2))
+        {
+            TEST_LOG_SS(Error, "Search results are different: (" << x1 << ", " << y1 << ", " << score1 << ") != (" << x2 << ", " << y2 << ", " << score2 << ").");
+            result = false;
+        }
+
+        if (result && (x1 != width / 3 || y1 != height / 2))
+        {
+            TEST_LOG_SS(Error, "Found template position (" << x1 << ", " << y1 << ") is not equal to original one (" << width / 3 << ", " << height / 2 << ").");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool TemplateMatchAutoTest(const FuncTm& f1, const FuncTm& f2)
+    {
+        bool result = true;
+
+        result = result && TemplateMatchAutoTest(W, H, 16, 12, SimdTemplateMatchSad, 1, f1, f2);
+        result = result && TemplateMatchAutoTest(W + O, H - O, 24, 18, SimdTemplateMatchSad, 3, f1, f2);
+        result = result && TemplateMatchAutoTest(W - O, H + O, 19, 13, SimdTemplateMatchSsd, 1, f1, f2);
+        result = result && TemplateMatchAutoTest(W + O, H - O, 23, 17, SimdTemplateMatchSsd, 3, f1, f2);
+        result = result && TemplateMatchAutoTest(W - O, H + O, 40, 9, SimdTemplateMatchNcc, 2, f1, f2);
+        result = result && TemplateMatchAutoTest(W, H, 31, 21, SimdTemplateMatchNcc, 3, f1, f2);
+
+        return result;
+    }
+
+    bool TemplateMatchAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && TemplateMatchAutoTest(FUNC_TM(Simd::Base::TemplateMatchInit), FUNC_TM(SimdTemplateMatchInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && TemplateMatchAutoTest(FUNC_TM(Simd::Sse41::TemplateMatchInit), FUNC_TM(SimdTemplateMatchInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && TemplateMatchAutoTest(FUNC_TM(Simd::Avx2::TemplateMatchInit), FUNC_TM(SimdTemplateMatchInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && TemplateMatchAutoTest(FUNC_TM(Simd::Avx512bw::TemplateMatchInit), FUNC_TM(SimdTemplateMatchInit));
+#endif
+
+        return result;
+    }
 }
@@ -27,8 +27,15 @@
 #include "Test/TestFile.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdDistanceTransform.h"
+#include "Simd/SimdConnectedComponents.h"
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdMedianFilter.h"
+#include "Simd/SimdMorphology.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
+#include "Simd/SimdSeparableFilter.h"
 
 namespace Test
 {
@@ -292,6 +299,108 @@ namespace Test
         return result;
     }
 
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncMF
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, const uint8_t* borderValue);
+
+            FuncPtr func;
+            String description;
+
+            FuncMF(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t c, size_t r, SimdBorderType b)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << c << ":" << r << "-" << (int)b << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t radius, SimdBorderType border, const uint8_t* borderValue, View& dst) const
+            {
+                void* filter = func(src.width, src.height, src.ChannelCount(), radius, border, borderValue);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdMedianFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_MF(function) \
+    FuncMF(function, std::string(#function))
+
+    bool MedianFilterAutoTest(size_t width, size_t height, size_t channels, size_t radius, SimdBorderType border, FuncMF f1, FuncMF f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, radius, border);
+        f2.Update(channels, radius, border);
+
+        View src;
+        if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
+            return false;
+
+        View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+
+        const uint8_t borderValue[4] = { 99, 7, 177, 250 };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, radius, border, borderValue, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, radius, border, borderValue, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool MedianFilterAutoTest(const FuncMF& f1, const FuncMF& f2)
+    {
+        bool result = true;
+
+        for (int channels = 1; channels <= 4; channels++)
+        {
+            result = result && MedianFilterAutoTest(W, H, channels, 3, SimdBorderReplicate, f1, f2);
+            result = result && MedianFilterAutoTest(W + O, H - O, channels, 7, SimdBorderReflect, f1, f2);
+        }
+        result = result && MedianFilterAutoTest(W - O, H + O, 1, 1, SimdBorderMirror, f1, f2);
+        result = result && MedianFilterAutoTest(W + O, H - O, 3, 5, SimdBorderConstant, f1, f2);
+        result = result && MedianFilterAutoTest(W - O, H + O, 4, 2, SimdBorderConstant, f1, f2);
+
+        return result;
+    }
+
+    bool MedianFilterAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && MedianFilterAutoTest(FUNC_MF(Simd::Base::MedianFilterInit), FUNC_MF(SimdMedianFilterInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && MedianFilterAutoTest(FUNC_MF(Simd::Sse41::MedianFilterInit), FUNC_MF(SimdMedianFilterInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && MedianFilterAutoTest(FUNC_MF(Simd::Avx2::MedianFilterInit), FUNC_MF(SimdMedianFilterInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && MedianFilterAutoTest(FUNC_MF(Simd::Avx512bw::MedianFilterInit), FUNC_MF(SimdMedianFilterInit));
+#endif 
+
+        return result;
+    }
+
     bool GaussianBlur3x3AutoTest()
     {
         bool result = true;
@@ -793,155 +902,945 @@ namespace Test
         return result;
     }
 
-    //---------------------------------------------------------------------------------------------
-
-    SIMD_INLINE String ToStr(SimdRecursiveBilateralFilterFlags flags)
-    {
-        std::stringstream ss;
-        ss << (Simd::Precise(flags) ? "p" : "f");
-        ss << (Simd::DiffType(flags) == Simd::RbfDiffAvg ? "a" : (Simd::DiffType(flags) == Simd::RbfDiffMax ? "m" : "s"));
-        return ss.str();
-    }
+    //-----------------------------------------------------------------------
 
     namespace
     {
-        struct FuncRBF
+        struct FuncGBI
         {
-            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, const float* spatial, const float* range, SimdRecursiveBilateralFilterFlags flags);
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, SimdPixelFormatType type, const float* sigma);
 
             FuncPtr func;
             String description;
 
-            FuncRBF(const FuncPtr& f, const String& d) : func(f), description(d) {}
+            FuncGBI(const FuncPtr& f, const String& d) : func(f), description(d) {}
 
-            void Update(size_t c, float s, float r, SimdRecursiveBilateralFilterFlags f)
+            void Update(size_t c, View::Format t, float s)
             {
                 std::stringstream ss;
                 ss << description;
-                ss << "[" << ToStr(f) << "-" << c << "]";
+                ss << "[" << c << ":" << ToString(t) << ":" << ToString(s, 1, true) << "]";
                 description = ss.str();
             }
 
-            void Call(const View& src, float spatial, float range, SimdRecursiveBilateralFilterFlags flags, View& dst) const
+            void Call(const View& src, size_t channels, float sigma, View& dst) const
             {
-                void* filter = NULL;
-                filter = func(src.width, src.height, src.ChannelCount(), &spatial, &range, flags);
+                void* filter = func(src.width / channels, src.height, channels, (SimdPixelFormatType)src.format, &sigma);
                 {
                     TEST_PERFORMANCE_TEST(description);
-                    SimdRecursiveBilateralFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                    SimdGaussianBlurRun(filter, src.data, src.stride, dst.data, dst.stride);
                 }
                 SimdRelease(filter);
             }
         };
     }
 
-#define FUNC_RBF(function) \
-    FuncRBF(function, std::string(#function))
+#define FUNC_GBI(function) \
+    FuncGBI(function, std::string(#function))
 
-    SIMD_INLINE bool SaveRbf(const View & view, const String& desc, size_t width, size_t height, size_t channels, float spatial, float range, SimdRecursiveBilateralFilterFlags flags)
+    bool GaussianBlurIirAutoTest(size_t width, size_t height, size_t channels, View::Format type, float sigma, FuncGBI f1, FuncGBI f2)
     {
-        std::stringstream ss;
-        ss << MakePath("_out", desc) << "_" << view.width << "x" << view.height << "x" << View::ChannelCount(view.format);
-        ss << "_" << ToString(spatial, 2, 1) << "_" << ToString(range, 2, 1) << "_" << ToStr(flags) << ".png";
-        return CreatePathIfNotExist(ss.str(), true) && view.Save(ss.str(), SimdImageFilePng);
+        bool result = true;
+
+        f1.Update(channels, type, sigma);
+        f2.Update(channels, type, sigma);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width * channels, height, type, NULL, TEST_ALIGN(width));
+        const float range = 100.0f;
+        if (type == View::Gray8)
+            FillRandom(src);
+        else
+            FillRandom32f(src, -range, range);
+
+        View dst1(width * channels, height, type, NULL, TEST_ALIGN(width));
+        View dst2(width * channels, height, type, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, sigma, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, sigma, dst2));
+
+        // The recursion accumulates rounding errors (and FMA differences) proportionally to the range of source values.
+        if (type == View::Float)
+            result = result && Compare(dst1, dst2, EPS * range / 20.0f, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 1, true, 64);
+
+        return result;
     }
 
-    bool RecursiveBilateralFilterAutoTest(size_t width, size_t height, size_t channels, 
-        float spatial, float range, SimdRecursiveBilateralFilterFlags flags, FuncRBF f1, FuncRBF f2)
+    bool GaussianBlurIirAutoTest(const FuncGBI& f1, const FuncGBI& f2)
     {
         bool result = true;
 
-        f1.Update(channels, spatial, range, flags);
-        f2.Update(channels, spatial, range, flags);
+        for (size_t channels = 1; channels <= 4; channels++)
+        {
+            result = result && GaussianBlurIirAutoTest(W, H, channels, View::Gray8, 2.0f, f1, f2);
+            result = result && GaussianBlurIirAutoTest(W + O, H - O, channels, View::Float, 10.0f, f1, f2);
+        }
+        result = result && GaussianBlurIirAutoTest(W - O, H + O, 3, View::Gray8, 30.0f, f1, f2);
+        result = result && GaussianBlurIirAutoTest(W + O, H - O, 1, View::Float, 0.5f, f1, f2);
 
-        View src;
-        if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
-            return false;
+        return result;
+    }
 
-        View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
-        View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
-        Simd::Fill(dst1, 0x01);
-        Simd::Fill(dst2, 0x03);
+    bool GaussianBlurIirAutoTest()
+    {
+        bool result = true;
 
-        TEST_ALIGN(SIMD_ALIGN);
+        if (TestBase())
+            result = result && GaussianBlurIirAutoTest(FUNC_GBI(Simd::Base::GaussianBlurIirInit), FUNC_GBI(SimdGaussianBlurIirInit));
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, spatial, range, flags, dst1));
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && GaussianBlurIirAutoTest(FUNC_GBI(Simd::Sse41::GaussianBlurIirInit), FUNC_GBI(SimdGaussianBlurIirInit));
+#endif 
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, spatial, range, flags, dst2));
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && GaussianBlurIirAutoTest(FUNC_GBI(Simd::Avx2::GaussianBlurIirInit), FUNC_GBI(SimdGaussianBlurIirInit));
+#endif 
 
-        int maxDifference = 0;
-        if (!Simd::FmaAvoid(flags) || width != W || width <= 128)
-#if defined(_WIN32) 
-            maxDifference = 2;
-#else
-            maxDifference = 1;
-#endif
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && GaussianBlurIirAutoTest(FUNC_GBI(Simd::Avx512bw::GaussianBlurIirInit), FUNC_GBI(SimdGaussianBlurIirInit));
+#endif 
 
-        result = result && Compare(dst1, dst2, maxDifference, true, 64);
+        return result;
+    }
 
-        if (!REAL_IMAGE.empty() || NOISE_IMAGE == false || result == false)
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSF
         {
-            SaveRbf(src, "src", width, height, channels, spatial, range, flags);
-            SaveRbf(dst1, "dst1", width, height, channels, spatial, range, flags);
-            SaveRbf(dst2, "dst2", width, height, channels, spatial, range, flags);
-        }
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, SimdPixelFormatType srcType, SimdPixelFormatType dstType,
+                const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize, SimdBorderType border, const float* borderValue);
 
-        return result;
+            FuncPtr func;
+            String description;
+
+            FuncSF(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t c, View::Format s, View::Format d, size_t rs, size_t cs, SimdBorderType b)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << c << ":" << ToString(s) << "-" << ToString(d) << ":" << rs << "x" << cs << "-" << (int)b << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t channels, const Buffer32f& rowKernel, const Buffer32f& colKernel, SimdBorderType border, float borderValue, View& dst) const
+            {
+                void* filter = func(src.width / channels, src.height, channels, (SimdPixelFormatType)src.format, (SimdPixelFormatType)dst.format,
+                    rowKernel.data(), rowKernel.size(), colKernel.data(), colKernel.size(), border, &borderValue);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdSeparableFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
     }
 
-    bool RecursiveBilateralFilterAutoTest(size_t channels, float spatial, float range, SimdRecursiveBilateralFilterFlags flags, const FuncRBF& f1, const FuncRBF& f2)
+#define FUNC_SF(function) \
+    FuncSF(function, std::string(#function))
+
+    bool SeparableFilterAutoTest(size_t width, size_t height, size_t channels, View::Format srcType, View::Format dstType, 
+        size_t rowSize, size_t colSize, SimdBorderType border, FuncSF f1, FuncSF f2)
     {
         bool result = true;
 
-        result = result && RecursiveBilateralFilterAutoTest(W, H, channels, spatial, range, flags, f1, f2);
-        result = result && RecursiveBilateralFilterAutoTest(W + O, H - O, channels, spatial, range, flags, f1, f2);
+        f1.Update(channels, srcType, dstType, rowSize, colSize, border);
+        f2.Update(channels, srcType, dstType, rowSize, colSize, border);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width * channels, height, srcType, NULL, TEST_ALIGN(width));
+        float range = 0;
+        if (srcType == View::Gray8)
+            FillRandom(src), range = 255.0f;
+        else if (srcType == View::Int16)
+            FillRandom16u(src, 0, 2000), range = 2000.0f;
+        else
+            FillRandom32f(src, -100.0f, 100.0f), range = 100.0f;
+
+        Buffer32f rowKernel(rowSize), colKernel(colSize);
+        FillRandom(rowKernel, -0.5f, 1.0f);
+        FillRandom(colKernel, -0.5f, 1.0f);
+        const float borderValue = 7.0f;
+
+        View dst1(width * channels, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width * channels, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, rowKernel, colKernel, border, borderValue, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, rowKernel, colKernel, border, borderValue, dst2));
+
+        if (dstType == View::Float)
+            result = result && Compare(dst1, dst2, EPS * range / 100.0f, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 1, true, 64);
 
         return result;
     }
 
-    bool RecursiveBilateralFilterAutoTest(const FuncRBF& f1, const FuncRBF& f2)
+    bool SeparableFilterAutoTest(const FuncSF& f1, const FuncSF& f2)
     {
         bool result = true;
 
-#if defined(_WIN32) 
-        int fma = 0;
-#else
-        int fma = SimdRecursiveBilateralFilterFmaAvoid;
-#endif
+        const View::Format G = View::Gray8, I = View::Int16, F = View::Float;
 
-        int fa = SimdRecursiveBilateralFilterFast | SimdRecursiveBilateralFilterDiffAvg | fma;
-        int fm = SimdRecursiveBilateralFilterFast | SimdRecursiveBilateralFilterDiffMax | fma;
-        int fs = SimdRecursiveBilateralFilterFast | SimdRecursiveBilateralFilterDiffSum | fma;
-        int pa = SimdRecursiveBilateralFilterPrecise | SimdRecursiveBilateralFilterDiffAvg | fma;
+        for (size_t channels = 1; channels <= 4; channels++)
+            result = result && SeparableFilterAutoTest(W, H, channels, G, G, 5, 5, SimdBorderReplicate, f1, f2);
 
-        for (int channels = 1; channels <= 4; channels++)
-        {
-            if (channels == 2 && (!REAL_IMAGE.empty() || NOISE_IMAGE == false))
-                continue;
-            result = result && RecursiveBilateralFilterAutoTest(channels, 0.12f, 0.09f, (SimdRecursiveBilateralFilterFlags)fa, f1, f2);
-            result = result && RecursiveBilateralFilterAutoTest(channels, 0.12f, 0.09f, (SimdRecursiveBilateralFilterFlags)fm, f1, f2);
-            //result = result && RecursiveBilateralFilterAutoTest(channels, 0.12f, 0.09f, (SimdRecursiveBilateralFilterFlags)fs, f1, f2);
-            result = result && RecursiveBilateralFilterAutoTest(channels, 0.12f, 0.09f, (SimdRecursiveBilateralFilterFlags)pa, f1, f2);
-        }
+        result = result && SeparableFilterAutoTest(W + O, H - O, 3, G, G, 3, 7, SimdBorderReflect, f1, f2);
+        result = result && SeparableFilterAutoTest(W - O, H + O, 1, G, I, 3, 3, SimdBorderMirror, f1, f2);
+        result = result && SeparableFilterAutoTest(W + O, H - O, 2, G, F, 7, 1, SimdBorderConstant, f1, f2);
+        result = result && SeparableFilterAutoTest(W - O, H + O, 1, I, I, 1, 7, SimdBorderReplicate, f1, f2);
+        result = result && SeparableFilterAutoTest(W + O, H - O, 4, I, F, 5, 3, SimdBorderMirror, f1, f2);
+        result = result && SeparableFilterAutoTest(W - O, H + O, 1, F, F, 9, 9, SimdBorderReflect, f1, f2);
+        result = result && SeparableFilterAutoTest(W + O, H - O, 3, F, G, 4, 6, SimdBorderConstant, f1, f2);
 
         return result;
     }
 
-    bool RecursiveBilateralFilterAutoTest()
+    bool SeparableFilterAutoTest()
     {
         bool result = true;
 
         if (TestBase())
-            result = result && RecursiveBilateralFilterAutoTest(FUNC_RBF(Simd::Base::RecursiveBilateralFilterInit), FUNC_RBF(SimdRecursiveBilateralFilterInit));
+            result = result && SeparableFilterAutoTest(FUNC_SF(Simd::Base::SeparableFilterInit), FUNC_SF(SimdSeparableFilterInit));
 
 #ifdef SIMD_SSE41_ENABLE
         if (Simd::Sse41::Enable && TestSse41())
-            result = result && RecursiveBilateralFilterAutoTest(FUNC_RBF(Simd::Sse41::RecursiveBilateralFilterInit), FUNC_RBF(SimdRecursiveBilateralFilterInit));
+            result = result && SeparableFilterAutoTest(FUNC_SF(Simd::Sse41::SeparableFilterInit), FUNC_SF(SimdSeparableFilterInit));
 #endif 
 
 #ifdef SIMD_AVX2_ENABLE
         if (Simd::Avx2::Enable && TestAvx2())
-            result = result && RecursiveBilateralFilterAutoTest(FUNC_RBF(Simd::Avx2::RecursiveBilateralFilterInit), FUNC_RBF(SimdRecursiveBilateralFilterInit));
+            result = result && SeparableFilterAutoTest(FUNC_SF(Simd::Avx2::SeparableFilterInit), FUNC_SF(SimdSeparableFilterInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && SeparableFilterAutoTest(FUNC_SF(Simd::Avx512bw::SeparableFilterInit), FUNC_SF(SimdSeparableFilterInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncBF
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, SimdPixelFormatType type,
+                size_t radiusX, size_t radiusY, SimdBorderType border, const float* borderValue);
+
+            FuncPtr func;
+            String description;
+
+            FuncBF(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t c, View::Format t, size_t rx, size_t ry, SimdBorderType b)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << c << ":" << ToString(t) << ":" << rx << "x" << ry << "-" << (int)b << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t channels, size_t radiusX, size_t radiusY, SimdBorderType border, float borderValue, View& dst) const
+            {
+                void* filter = func(src.width / channels, src.height, channels, (SimdPixelFormatType)src.format, radiusX, radiusY, border, &borderValue);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdBoxFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_BF(function) \
+    FuncBF(function, std::string(#function))
+
+    bool BoxFilterAutoTest(size_t width, size_t height, size_t channels, View::Format type, size_t radiusX, size_t radiusY, SimdBorderType border, FuncBF f1, FuncBF f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, type, radiusX, radiusY, border);
+        f2.Update(channels, type, radiusX, radiusY, border);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width * channels, height, type, NULL, TEST_ALIGN(width));
+        if (type == View::Gray8)
+            FillRandom(src);
+        else
+            FillRandom32f(src, -100.0f, 100.0f);
+        const float borderValue = 77.0f;
+
+        View dst1(width * channels, height, type, NULL, TEST_ALIGN(width));
+        View dst2(width * channels, height, type, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, radiusX, radiusY, border, borderValue, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, radiusX, radiusY, border, borderValue, dst2));
+
+        if (type == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool BoxFilterAutoTest(const FuncBF& f1, const FuncBF& f2)
+    {
+        bool result = true;
+
+        for (size_t channels = 1; channels <= 4; channels++)
+        {
+            result = result && BoxFilterAutoTest(W, H, channels, View::Gray8, 2, 2, SimdBorderReplicate, f1, f2);
+            result = result && BoxFilterAutoTest(W + O, H - O, channels, View::Float, 3, 1, SimdBorderMirror, f1, f2);
+        }
+        result = result && BoxFilterAutoTest(W - O, H + O, 1, View::Gray8, 15, 15, SimdBorderReflect, f1, f2);
+        result = result && BoxFilterAutoTest(W + O, H - O, 3, View::Gray8, 0, 7, SimdBorderConstant, f1, f2);
+        result = result && BoxFilterAutoTest(W - O, H + O, 2, View::Float, 9, 0, SimdBorderConstant, f1, f2);
+        result = result && BoxFilterAutoTest(W + O, H - O, 1, View::Float, 20, 20, SimdBorderReplicate, f1, f2);
+
+        return result;
+    }
+
+    bool BoxFilterAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && BoxFilterAutoTest(FUNC_BF(Simd::Base::BoxFilterInit), FUNC_BF(SimdBoxFilterInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && BoxFilterAutoTest(FUNC_BF(Simd::Sse41::BoxFilterInit), FUNC_BF(SimdBoxFilterInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && BoxFilterAutoTest(FUNC_BF(Simd::Avx2::BoxFilterInit), FUNC_BF(SimdBoxFilterInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && BoxFilterAutoTest(FUNC_BF(Simd::Avx512bw::BoxFilterInit), FUNC_BF(SimdBoxFilterInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncMo
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY);
+
+            FuncPtr func;
+            String description;
+
+            FuncMo(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdMorphologyType t, size_t kx, size_t ky)
+            {
+                const char* names[4] = { "erode", "dilate", "open", "close" };
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << names[t] << "-" << kx << "x" << ky << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, SimdMorphologyType type, size_t kernelX, size_t kernelY, View& dst) const
+            {
+                void* context = func(src.width, src.height, type, kernelX, kernelY);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdMorphologyRun(context, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_MO(function) \
+    FuncMo(function, std::string(#function))
+
+    bool MorphologyAutoTest(size_t width, size_t height, SimdMorphologyType type, size_t kernelX, size_t kernelY, FuncMo f1, FuncMo f2)
+    {
+        bool result = true;
+
+        f1.Update(type, kernelX, kernelY);
+        f2.Update(type, kernelX, kernelY);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, type, kernelX, kernelY, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, type, kernelX, kernelY, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool MorphologyAutoTest(const FuncMo& f1, const FuncMo& f2)
+    {
+        bool result = true;
+
+        result = result && MorphologyAutoTest(W, H, SimdMorphologyErode, 3, 3, f1, f2);
+        result = result && MorphologyAutoTest(W + O, H - O, SimdMorphologyDilate, 7, 5, f1, f2);
+        result = result && MorphologyAutoTest(W - O, H + O, SimdMorphologyOpen, 15, 1, f1, f2);
+        result = result && MorphologyAutoTest(W + O, H - O, SimdMorphologyClose, 4, 21, f1, f2);
+
+        return result;
+    }
+
+    bool MorphologyAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Base::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Sse41::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Avx2::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Avx512bw::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncCn
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, float low, float high, SimdBool l2);
+
+            FuncPtr func;
+            String description;
+
+            FuncCn(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(float low, float high, SimdBool l2)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << low << "-" << high << "-" << (l2 ? "l2" : "l1") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, float low, float high, SimdBool l2, View& dst) const
+            {
+                void* context = func(src.width, src.height, low, high, l2);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdCannyRun(context, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_CN(function) \
+    FuncCn(function, std::string(#function))
+
+    bool CannyAutoTest(size_t width, size_t height, float low, float high, SimdBool l2, FuncCn f1, FuncCn f2)
+    {
+        bool result = true;
+
+        f1.Update(low, high, l2);
+        f2.Update(low, high, l2);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, low, high, l2, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, low, high, l2, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool CannyAutoTest(const FuncCn& f1, const FuncCn& f2)
+    {
+        bool result = true;
+
+        result = result && CannyAutoTest(W, H, 100.0f, 300.0f, SimdFalse, f1, f2);
+        result = result && CannyAutoTest(W + O, H - O, 200.0f, 400.0f, SimdTrue, f1, f2);
+        result = result && CannyAutoTest(W - O, H + O, 50.0f, 150.0f, SimdTrue, f1, f2);
+
+        return result;
+    }
+
+    bool CannyAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && CannyAutoTest(FUNC_CN(Simd::Base::CannyInit), FUNC_CN(SimdCannyInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && CannyAutoTest(FUNC_CN(Simd::Sse41::CannyInit), FUNC_CN(SimdCannyInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && CannyAutoTest(FUNC_CN(Simd::Avx2::CannyInit), FUNC_CN(SimdCannyInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && CannyAutoTest(FUNC_CN(Simd::Avx512bw::CannyInit), FUNC_CN(SimdCannyInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncDt
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, SimdDistanceType type, SimdPixelFormatType format);
+
+            FuncPtr func;
+            String description;
+
+            FuncDt(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdDistanceType t, View::Format f, bool sparse)
+            {
+                const char* names[3] = { "edt", "3x3", "5x5" };
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << names[t] << "-" << ToString(f) << "-" << (sparse ? "sparse" : "dense") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, SimdDistanceType type, View& dst) const
+            {
+                void* context = func(src.width, src.height, type, (SimdPixelFormatType)dst.format);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdDistanceTransformRun(context, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_DT(function) \
+    FuncDt(function, std::string(#function))
+
+    bool DistanceTransformAutoTest(size_t width, size_t height, SimdDistanceType type, View::Format format, bool sparse, FuncDt f1, FuncDt f2)
+    {
+        bool result = true;
+
+        f1.Update(type, format, sparse);
+        f2.Update(type, format, sparse);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        if (sparse)
+            FillRandom(src);
+        else
+            FillRandomMask(src, 1);
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, type, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, type, dst2));
+
+        if (format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool DistanceTransformAutoTest(const FuncDt& f1, const FuncDt& f2)
+    {
+        bool result = true;
+
+        result = result && DistanceTransformAutoTest(W, H, SimdDistanceEuclidean, View::Float, true, f1, f2);
+        result = result && DistanceTransformAutoTest(W + O, H - O, SimdDistanceEuclidean, View::Int16, false, f1, f2);
+        result = result && DistanceTransformAutoTest(W - O, H + O, SimdDistanceChamfer3x3, View::Float, true, f1, f2);
+        result = result && DistanceTransformAutoTest(W + O, H - O, SimdDistanceChamfer3x3, View::Int16, false, f1, f2);
+        result = result && DistanceTransformAutoTest(W - O, H + O, SimdDistanceChamfer5x5, View::Float, true, f1, f2);
+        result = result && DistanceTransformAutoTest(W + O, H - O, SimdDistanceChamfer5x5, View::Int16, true, f1, f2);
+
+        return result;
+    }
+
+    bool DistanceTransformAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && DistanceTransformAutoTest(FUNC_DT(Simd::Base::DistanceTransformInit), FUNC_DT(SimdDistanceTransformInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && DistanceTransformAutoTest(FUNC_DT(Simd::Sse41::DistanceTransformInit), FUNC_DT(SimdDistanceTransformInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && DistanceTransformAutoTest(FUNC_DT(Simd::Avx2::DistanceTransformInit), FUNC_DT(SimdDistanceTransformInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && DistanceTransformAutoTest(FUNC_DT(Simd::Avx512bw::DistanceTransformInit), FUNC_DT(SimdDistanceTransformInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncCc
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t connectivity);
+
+            FuncPtr func;
+            String description;
+
+            FuncCc(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t connectivity, bool sparse)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << connectivity << "-" << (sparse ? "sparse" : "dense") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& mask, size_t connectivity, View& labels, size_t & count, std::vector<SimdConnectedComponent> & components) const
+            {
+                void* context = func(mask.width, mask.height, connectivity);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    count = SimdConnectedComponentsRun(context, mask.data, mask.stride, (uint32_t*)labels.data, labels.stride);
+                }
+                const SimdConnectedComponent* statistics = SimdConnectedComponentsStatistics(context);
+                components.assign(statistics, statistics + count);
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_CC(function) \
+    FuncCc(function, std::string(#function))
+
+    bool ConnectedComponentsAutoTest(size_t width, size_t height, size_t connectivity, bool sparse, FuncCc f1, FuncCc f2)
+    {
+        bool result = true;
+
+        f1.Update(connectivity, sparse);
+        f2.Update(connectivity, sparse);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        if (sparse)
+            FillRandomMask(mask, 255);
+        else
+            FillRandom(mask);
+
+        View labels1(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        View labels2(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        size_t count1, count2;
+        std::vector<SimdConnectedComponent> components1, components2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(mask, connectivity, labels1, count1, components1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(mask, connectivity, labels2, count2, components2));
+
+        TEST_CHECK_VALUE(count);
+
+        result = result && Compare(labels1, labels2, 0, true, 64);
+
+        result = result && Compare((uint8_t*)components1.data(), components1.size() * sizeof(SimdConnectedComponent),
+            (uint8_t*)components2.data(), components2.size() * sizeof(SimdConnectedComponent), 0, true, 64, "components");
+
+        return result;
+    }
+
+    bool ConnectedComponentsAutoTest(const FuncCc& f1, const FuncCc& f2)
+    {
+        bool result = true;
+
+        result = result && ConnectedComponentsAutoTest(W, H, 4, true, f1, f2);
+        result = result && ConnectedComponentsAutoTest(W + O, H - O, 8, true, f1, f2);
+        result = result && ConnectedComponentsAutoTest(W - O, H + O, 4, false, f1, f2);
+        result = result && ConnectedComponentsAutoTest(W + O, H - O, 8, false, f1, f2);
+
+        return result;
+    }
+
+    bool ConnectedComponentsAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Base::ConnectedComponentsInit), FUNC_CC(SimdConnectedComponentsInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Sse41::ConnectedComponentsInit), FUNC_CC(SimdConnectedComponentsInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Avx2::ConnectedComponentsInit), FUNC_CC(SimdConnectedComponentsInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Avx512bw::ConnectedComponentsInit), FUNC_CC(SimdConnectedComponentsInit));
+#endif 
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    SIMD_INLINE String ToStr(SimdRecursiveBilateralFilterFlags flags)
+    {
+        std::stringstream ss;
+        ss << (Simd::Precise(flags) ? "p" : "f");
+        ss << (Simd::DiffType(flags) == Simd::RbfDiffAvg ? "a" : (Simd::DiffType(flags) == Simd::RbfDiffMax ? "m" : "s"));
+        return ss.str();
+    }
+
+    namespace
+    {
+        struct FuncRBF
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, const float* spatial, const float* range, SimdRecursiveBilateralFilterFlags flags);
+
+            FuncPtr func;
+            String description;
+
+            FuncRBF(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t c, float s, float r, SimdRecursiveBilateralFilterFlags f)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << ToStr(f) << "-" << c << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, float spatial, float range, SimdRecursiveBilateralFilterFlags flags, View& dst) const
+            {
+                void* filter = NULL;
+                filter = func(src.width, src.height, src.ChannelCount(), &spatial, &range, flags);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdRecursiveBilateralFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_RBF(function) \
+    FuncRBF(function, std::string(#function))
+
+    SIMD_INLINE bool SaveRbf(const View & view, const String& desc, size_t width, size_t height, size_t channels, float spatial, float range, SimdRecursiveBilateralFilterFlags flags)
+    {
+        std::stringstream ss;
+        ss << MakePath("_out", desc) << "_" << view.width << "x" << view.height << "x" << View::ChannelCount(view.format);
+        ss << "_" << ToString(spatial, 2, 1) << "_" << ToString(range, 2, 1) << "_" << ToStr(flags) << ".png";
+        return CreatePathIfNotExist(ss.str(), true) && view.Save(ss.str(), SimdImageFilePng);
+    }
+
+    bool RecursiveBilateralFilterAutoTest(size_t width, size_t height, size_t channels, 
+        float spatial, float range, SimdRecursiveBilateralFilterFlags flags, FuncRBF f1, FuncRBF f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, spatial, range, flags);
+        f2.Update(channels, spatial, range, flags);
+
+        View src;
+        if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
+            return false;
+
+        View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        Simd::Fill(dst1, 0x01);
+        Simd::Fill(dst2, 0x03);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, spatial, range, flags, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, spatial, range, flags, dst2));
+
+        int maxDifference = 0;
+        if (!Simd::FmaAvoid(flags) || width != W || width <= 128)
+#if defined(_WIN32) 
+            maxDifference = 2;
+#else
+            maxDifference = 1;
+#endif
+
+        result = result && Compare(dst1, dst2, maxDifference, true, 64);
+
+        if (result && !Simd::Precise(flags))
+        {
+            View dst3(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+            Simd::Copy(src, dst3);
+            void* filter = f1.func(src.width, src.height, src.ChannelCount(), &spatial, &range, flags);
+            SimdRecursiveBilateralFilterRun(filter, dst3.data, dst3.stride, dst3.data, dst3.stride);
+            SimdRelease(filter);
+            result = result && Compare(dst1, dst3, 0, true, 64, 0, "in-place");
+        }
+
+        if (!REAL_IMAGE.empty() || NOISE_IMAGE == false || result == false)
+        {
+            SaveRbf(src, "src", width, height, channels, spatial, range, flags);
+            SaveRbf(dst1, "dst1", width, height, channels, spatial, range, flags);
+            SaveRbf(dst2, "dst2", width, height, channels, spatial, range, flags);
+        }
+
+        return result;
+    }
+
+    bool RecursiveBilateralFilterAutoTest(size_t channels, float spatial, float range, SimdRecursiveBilateralFilterFlags flags, const FuncRBF& f1, const FuncRBF& f2)
+    {
+        bool result = true;
+
+        result = result && RecursiveBilateralFilterAutoTest(W, H, channels, spatial, range, flags, f1, f2);
+        result = result && RecursiveBilateralFilterAutoTest(W + O, H - O, channels, spatial, range, flags, f1, f2);
+
+        return result;
+    }
+
+    bool RecursiveBilateralFilterAutoTest(const FuncRBF& f1, const FuncRBF& f2)
+    {
+        bool result = true;
+
+#if defined(_WIN32) 
+        int fma = 0;
+#else
+        int fma = SimdRecursiveBilateralFilterFmaAvoid;
+#endif
+
+        int fa = SimdRecursiveBilateralFilterFast | SimdRecursiveBilateralFilterDiffAvg | fma;
+        int fm = SimdRecursiveBilateralFilterFast | SimdRecursiveBilateralFilterDiffMax | fma;
+        int fs = SimdRecursiveBilateralFilterFast | SimdRecursiveBilateralFilterDiffSum | fma;
+        int pa = SimdRecursiveBilateralFilterPrecise | SimdRecursiveBilateralFilterDiffAvg | fma;
+
+        for (int channels = 1; channels <= 4; channels++)
+        {
+            if (channels == 2 && (!REAL_IMAGE.empty() || NOISE_IMAGE == false))
+                continue;
+            result = result && RecursiveBilateralFilterAutoTest(channels, 0.12f, 0.09f, (SimdRecursiveBilateralFilterFlags)fa, f1, f2);
+            result = result && RecursiveBilateralFilterAutoTest(channels, 0.12f, 0.09f, (SimdRecursiveBilateralFilterFlags)fm, f1, f2);
+            //result = result && RecursiveBilateralFilterAutoTest(channels, 0.12f, 0.09f, (SimdRecursiveBilateralFilterFlags)fs, f1, f2);
+            result = result && RecursiveBilateralFilterAutoTest(channels, 0.12f, 0.09f, (SimdRecursiveBilateralFilterFlags)pa, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool RecursiveBilateralFilterStripeAutoTest(const FuncRBF& f1, const FuncRBF& f2)
+    {
+        bool result = true;
+
+#if defined(_WIN32) 
+        int fma = 0;
+#else
+        int fma = SimdRecursiveBilateralFilterFmaAvoid;
+#endif
+
+        int fa = SimdRecursiveBilateralFilterFast | SimdRecursiveBilateralFilterDiffAvg | fma;
+        int pa = SimdRecursiveBilateralFilterPrecise | SimdRecursiveBilateralFilterDiffAvg | fma;
+
+        // Tall image: the vertical pass stripe is reduced to its minimal width (64), so the image is split into 3 stripes.
+        size_t width = 64 * 3 + 5, height = SimdCpuInfo(SimdCpuInfoCacheL2) / 64 + 1;
+
+        for (int channels = 1; channels <= 3; channels += 2)
+        {
+            result = result && RecursiveBilateralFilterAutoTest(width, height, channels, 0.12f, 0.09f, (SimdRecursiveBilateralFilterFlags)fa, f1, f2);
+            result = result && RecursiveBilateralFilterAutoTest(width, height, channels, 0.12f, 0.09f, (SimdRecursiveBilateralFilterFlags)pa, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool RecursiveBilateralFilterAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && RecursiveBilateralFilterAutoTest(FUNC_RBF(Simd::Base::RecursiveBilateralFilterInit), FUNC_RBF(SimdRecursiveBilateralFilterInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+        {
+            result = result && RecursiveBilateralFilterAutoTest(FUNC_RBF(Simd::Sse41::RecursiveBilateralFilterInit), FUNC_RBF(SimdRecursiveBilateralFilterInit));
+            result = result && RecursiveBilateralFilterStripeAutoTest(FUNC_RBF(Simd::Sse41::RecursiveBilateralFilterInit), FUNC_RBF(Simd::Base::RecursiveBilateralFilterInit));
+        }
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+        {
+            result = result && RecursiveBilateralFilterAutoTest(FUNC_RBF(Simd::Avx2::RecursiveBilateralFilterInit), FUNC_RBF(SimdRecursiveBilateralFilterInit));
+            result = result && RecursiveBilateralFilterStripeAutoTest(FUNC_RBF(Simd::Avx2::RecursiveBilateralFilterInit), FUNC_RBF(Simd::Base::RecursiveBilateralFilterInit));
+        }
 #endif
 
         return result;
@@ -108,6 +108,8 @@ namespace Test
             ss << suffix << ".png";
         if (file == SimdImageFileJpeg)
             ss << "_" << ToString(quality) << suffix << ".jpg";
+        else if (file == SimdImageFileQoi)
+            ss << suffix << ".qoi";
         const String dir = "_out";
         String path = MakePath(dir, ss.str());
         return CreatePathIfNotExist(dir, false) && image.Save(path, file, quality);
@@ -224,6 +226,7 @@ namespace Test
                 }
                 result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 65, f1, f2);
             }
+            result = result && ImageSaveToMemoryAutoTest(formats[format], SimdImageFileQoi, 100, f1, f2);
         }
 
         return result;
@@ -595,6 +598,8 @@ namespace Test
             return format == View::Gray8;
         if (file == SimdImageFilePpmTxt || file == SimdImageFilePpmBin)
             return format != View::Bgra32 && format != View::Rgba32;
+        if (file == SimdImageFileQoi)
+            return true;
         return false;
     }
 
@@ -678,6 +683,7 @@ namespace Test
                 }
                 result = result && ImageLoadFromMemoryAutoTest(formats[format], (SimdImageFileType)file, 65, f1, f2);
             }
+            result = result && ImageLoadFromMemoryAutoTest(formats[format], SimdImageFileQoi, 100, f1, f2);
         }
 
         return result;
@@ -715,6 +721,146 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncMF
+        {
+            typedef void* (*FuncPtr)(const char* path, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+            FuncPtr func;
+            String desc;
+
+            FuncMF(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format, SimdImageFileType file)
+            {
+                desc = desc + "[" + ToString(format) + "-" + ToString(file) + "]";
+            }
+
+            bool Call(const String& path, View::Format format, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                size_t width, height;
+                SimdPixelFormatType mapFormat = (SimdPixelFormatType)format;
+                void* map = func(path.c_str(), &width, &height, &mapFormat);
+                if (map == NULL)
+                    return false;
+                dst.Recreate(width, height, (View::Format)mapFormat);
+                bool result = SimdImageMapRows(map, 0, height, dst.data, dst.stride) == SimdTrue;
+                SimdRelease(map);
+                return result;
+            }
+        };
+    }
+
+#define FUNC_MF(func) \
+    FuncMF(func, std::string(#func))
+
+    bool ImageMapFromFileAutoTest(size_t width, size_t height, View::Format format, SimdImageFileType file, FuncMF f1, FuncMF f2)
+    {
+        bool result = true;
+
+        f1.Update(format, file);
+        f2.Update(format, file);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << ", " << height << "].");
+
+        View src(width, height, file == SimdImageFilePgmBin ? View::Gray8 : View::Rgb24);
+        FillRandom(src);
+
+        const String dir = "_out";
+        String path = MakePath(dir, "ImageMap." + ToExtension(file));
+        if (!(CreatePathIfNotExist(dir, false) && src.Save(path, file)))
+        {
+            TEST_LOG_SS(Error, "Can't save image to '" << path << "'!");
+            return false;
+        }
+
+        View dst1, dst2, dst3;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(result = result && f1.Call(path, format, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(result = result && f2.Call(path, format, dst2));
+
+        if (!result)
+        {
+            TEST_LOG_SS(Error, "Can't map image from '" << path << "'!");
+            return false;
+        }
+
+        result = result && dst3.Load(path, format);
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+        result = result && Compare(dst1, dst3, 0, true, 64, 0, "dst1 & dst3");
+
+        if (format == src.format)
+        {
+            size_t mapWidth, mapHeight, mapStride;
+            SimdPixelFormatType mapFormat = SimdPixelFormatNone;
+            void* map = SimdImageMapFromFile(path.c_str(), &mapWidth, &mapHeight, &mapFormat);
+            const uint8_t* data = map ? SimdImageMapData(map, &mapStride) : NULL;
+            if (data)
+                result = result && Compare(View(mapWidth, mapHeight, mapStride, (View::Format)mapFormat, (void*)data), src, 0, true, 64, 0, "map & src");
+            else
+            {
+                TEST_LOG_SS(Error, "Can't get data of mapped image '" << path << "'!");
+                result = false;
+            }
+            if (map)
+                SimdRelease(map);
+        }
+
+        return result;
+    }
+
+    bool ImageMapFromFileAutoTest(const FuncMF& f1, const FuncMF& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        for (size_t format = 0; format < formats.size(); format++)
+        {
+            result = result && ImageMapFromFileAutoTest(W, H, formats[format], SimdImageFilePgmBin, f1, f2);
+            result = result && ImageMapFromFileAutoTest(W + O, H - O, formats[format], SimdImageFilePgmBin, f1, f2);
+            result = result && ImageMapFromFileAutoTest(W, H, formats[format], SimdImageFilePpmBin, f1, f2);
+            result = result && ImageMapFromFileAutoTest(W + O, H - O, formats[format], SimdImageFilePpmBin, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool ImageMapFromFileAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && ImageMapFromFileAutoTest(FUNC_MF(Simd::Base::ImageMapFromFile), FUNC_MF(SimdImageMapFromFile));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && ImageMapFromFileAutoTest(FUNC_MF(Simd::Sse41::ImageMapFromFile), FUNC_MF(SimdImageMapFromFile));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && ImageMapFromFileAutoTest(FUNC_MF(Simd::Avx2::ImageMapFromFile), FUNC_MF(SimdImageMapFromFile));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && ImageMapFromFileAutoTest(FUNC_MF(Simd::Avx512bw::ImageMapFromFile), FUNC_MF(SimdImageMapFromFile));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && ImageMapFromFileAutoTest(FUNC_MF(Simd::Neon::ImageMapFromFile), FUNC_MF(SimdImageMapFromFile));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool ImageLoadFromMemorySpecialTest(const String & name, View::Format format, const FuncLM& f1, const FuncLM& f2)
     {
         bool result = true;
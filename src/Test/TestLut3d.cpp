@@ -0,0 +1,151 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+#include "Simd/SimdLut3d.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncL3
+        {
+            typedef void* (*FuncPtr)(size_t size, const float* table, SimdLut3dInterpolationType interpolation);
+
+            FuncPtr func;
+            String desc;
+
+            FuncL3(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t size, SimdLut3dInterpolationType interpolation, View::Format format)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << size << (interpolation == SimdLut3dInterpolationTetrahedral ? "-Th-" : "-Tl-") << ToString(format) << "]";
+                desc = ss.str();
+            }
+
+            void Call(const void* context, const View& src, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                SimdLut3dRun(context, src.data, src.stride, src.width, src.height, (SimdPixelFormatType)src.format, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_L3(function) FuncL3(function, #function)
+
+    bool Lut3dAutoTest(size_t width, size_t height, size_t size, SimdLut3dInterpolationType interpolation, View::Format format, FuncL3 f1, FuncL3 f2)
+    {
+        bool result = true;
+
+        f1.Update(size, interpolation, format);
+        f2.Update(size, interpolation, format);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " for size [" << width << "," << height << "].");
+
+        Buffer32f table(size * size * size * 3);
+        FillRandom(table, -0.1f, 1.1f);
+
+        View src(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+
+        void* context1 = f1.func(size, table.data(), interpolation);
+        void* context2 = f2.func(size, table.data(), interpolation);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        if (result)
+        {
+            for (size_t b = 0, i = 0; b < size; ++b)
+            {
+                for (size_t g = 0; g < size; ++g)
+                {
+                    for (size_t r = 0; r < size; ++r, i += 3)
+                    {
+                        table[i + 0] = float(r) / float(size - 1);
+                        table[i + 1] = float(g) / float(size - 1);
+                        table[i + 2] = float(b) / float(size - 1);
+                    }
+                }
+            }
+            void* context = f1.func(size, table.data(), interpolation);
+            SimdLut3dRun(context, src.data, src.stride, src.width, src.height, (SimdPixelFormatType)src.format, dst1.data, dst1.stride);
+            ::SimdRelease(context);
+
+            result = result && Compare(src, dst1, 1, true, 64, 0, "identity");
+        }
+
+        return result;
+    }
+
+    bool Lut3dAutoTest(const FuncL3& f1, const FuncL3& f2)
+    {
+        bool result = true;
+
+        SimdLut3dInterpolationType tl = SimdLut3dInterpolationTrilinear, th = SimdLut3dInterpolationTetrahedral;
+
+        result = result && Lut3dAutoTest(W, H, 33, tl, View::Bgr24, f1, f2);
+        result = result && Lut3dAutoTest(W, H, 33, th, View::Bgr24, f1, f2);
+        result = result && Lut3dAutoTest(W + O, H - O, 17, tl, View::Bgra32, f1, f2);
+        result = result && Lut3dAutoTest(W + O, H - O, 17, th, View::Bgra32, f1, f2);
+        result = result && Lut3dAutoTest(W - O, H + O, 65, tl, View::Rgb24, f1, f2);
+        result = result && Lut3dAutoTest(W - O, H + O, 65, th, View::Rgb24, f1, f2);
+        result = result && Lut3dAutoTest(W, H, 2, th, View::Rgba32, f1, f2);
+
+        return result;
+    }
+
+    bool Lut3dAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Lut3dAutoTest(FUNC_L3(Simd::Base::Lut3dInit), FUNC_L3(SimdLut3dInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && Lut3dAutoTest(FUNC_L3(Simd::Sse41::Lut3dInit), FUNC_L3(SimdLut3dInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && Lut3dAutoTest(FUNC_L3(Simd::Avx2::Lut3dInit), FUNC_L3(SimdLut3dInit));
+#endif 
+
+        return result;
+    }
+}
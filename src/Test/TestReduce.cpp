@@ -26,6 +26,8 @@
 #include "Test/TestString.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdPyramidBuilder.h"
+
 namespace Test
 {
     namespace
@@ -353,4 +355,143 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncPB
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t levels, double scale, SimdReduceType reduce, SimdBool compensation);
+
+            FuncPtr func;
+            String description;
+
+            FuncPB(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(double scale, SimdReduceType reduce, bool compensation)
+            {
+                description = description + "[" + ToString(scale, 2, false) + "-" + ToString(int(reduce)) + "-" + ToString(int(compensation)) + "]";
+            }
+
+            void Call(const void* builder, const View& src, const std::vector<uint8_t*>& dst, const std::vector<size_t>& dstStride) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                SimdPyramidBuilderRun(builder, src.data, src.stride, dst.data(), dstStride.data());
+            }
+        };
+    }
+
+#define FUNC_PB(function) FuncPB(function, #function)
+
+    bool PyramidBuilderAutoTest(size_t width, size_t height, size_t levels, double scale, SimdReduceType reduce, bool compensation, FuncPB f1, FuncPB f2)
+    {
+        bool result = true;
+
+        f1.Update(scale, reduce, compensation);
+        f2.Update(scale, reduce, compensation);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << ", " << levels << "].");
+
+        void* builder1 = f1.func(width, height, levels, scale, reduce, compensation ? SimdTrue : SimdFalse);
+        void* builder2 = f2.func(width, height, levels, scale, reduce, compensation ? SimdTrue : SimdFalse);
+        if (builder1 == NULL || builder2 == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't create pyramid builder!");
+            SimdRelease(builder1);
+            SimdRelease(builder2);
+            return false;
+        }
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        std::vector<View> dst1(levels), dst2(levels), dst3(levels);
+        std::vector<uint8_t*> data1(levels - 1), data2(levels - 1);
+        std::vector<size_t> stride1(levels - 1), stride2(levels - 1);
+        dst3[0] = src;
+        for (size_t level = 1; level < levels; ++level)
+        {
+            size_t w, h;
+            SimdPyramidBuilderLevelSize(builder1, level, &w, &h);
+            dst1[level].Recreate(w, h, View::Gray8, NULL, TEST_ALIGN(w));
+            dst2[level].Recreate(w, h, View::Gray8, NULL, TEST_ALIGN(w));
+            dst3[level].Recreate(w, h, View::Gray8, NULL, TEST_ALIGN(w));
+            data1[level - 1] = dst1[level].data;
+            stride1[level - 1] = dst1[level].stride;
+            data2[level - 1] = dst2[level].data;
+            stride2[level - 1] = dst2[level].stride;
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(builder1, src, data1, stride1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(builder2, src, data2, stride2));
+
+        SimdRelease(builder1);
+        SimdRelease(builder2);
+
+        for (size_t level = 1; level < levels; ++level)
+        {
+            if (scale == 2.0)
+                Simd::ReduceGray(dst3[level - 1], dst3[level], reduce, compensation);
+            else
+                Simd::Resize(dst3[level - 1], dst3[level], SimdResizeMethodBilinear);
+        }
+
+        for (size_t level = 1; level < levels && result; ++level)
+        {
+            result = result && Compare(dst1[level], dst3[level], 0, true, 64, 0, "level " + ToString(level));
+            result = result && Compare(dst1[level], dst2[level], 0, true, 64, 0, "level " + ToString(level));
+        }
+
+        return result;
+    }
+
+    bool PyramidBuilderAutoTest(const FuncPB& f1, const FuncPB& f2)
+    {
+        bool result = true;
+
+        result = result && PyramidBuilderAutoTest(W, H, 5, 2.0, SimdReduce2x2, true, f1, f2);
+        result = result && PyramidBuilderAutoTest(W + E, H - E, 5, 2.0, SimdReduce2x2, true, f1, f2);
+        result = result && PyramidBuilderAutoTest(W, H, 5, 2.0, SimdReduce3x3, true, f1, f2);
+        result = result && PyramidBuilderAutoTest(W + E, H - E, 5, 2.0, SimdReduce3x3, false, f1, f2);
+        result = result && PyramidBuilderAutoTest(W, H, 5, 2.0, SimdReduce4x4, true, f1, f2);
+        result = result && PyramidBuilderAutoTest(W + E, H - E, 5, 2.0, SimdReduce4x4, true, f1, f2);
+        result = result && PyramidBuilderAutoTest(W, H, 5, 2.0, SimdReduce5x5, true, f1, f2);
+        result = result && PyramidBuilderAutoTest(W + E, H - E, 5, 2.0, SimdReduce5x5, false, f1, f2);
+        result = result && PyramidBuilderAutoTest(W, H, 8, 1.25, SimdReduce2x2, true, f1, f2);
+        result = result && PyramidBuilderAutoTest(W + E, H - E, 6, 1.5, SimdReduce2x2, true, f1, f2);
+
+        return result;
+    }
+
+    bool PyramidBuilderAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && PyramidBuilderAutoTest(FUNC_PB(Simd::Base::PyramidBuilderInit), FUNC_PB(SimdPyramidBuilderInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && PyramidBuilderAutoTest(FUNC_PB(Simd::Sse41::PyramidBuilderInit), FUNC_PB(SimdPyramidBuilderInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && PyramidBuilderAutoTest(FUNC_PB(Simd::Avx2::PyramidBuilderInit), FUNC_PB(SimdPyramidBuilderInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && PyramidBuilderAutoTest(FUNC_PB(Simd::Avx512bw::PyramidBuilderInit), FUNC_PB(SimdPyramidBuilderInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && PyramidBuilderAutoTest(FUNC_PB(Simd::Neon::PyramidBuilderInit), FUNC_PB(SimdPyramidBuilderInit));
+#endif 
+
+        return result;
+    }
 }
@@ -42,6 +42,7 @@ namespace Test
         case SimdResizeMethodBicubic: return "BcO";
         case SimdResizeMethodArea: return "ArO";
         case SimdResizeMethodAreaFast: return "ArF";
+        case SimdResizeMethodLanczos: return "LcO";
         default: assert(0); return "";
         }
     }
@@ -98,6 +99,35 @@ namespace Test
                     SimdRelease(resizer);
                 }
             }
+
+            void CallTwice(const View& src, View& dst, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method) const
+            {
+                void* resizer = NULL;
+                if (src.format == View::Float || src.format == View::Int16)
+                    resizer = func(src.width / channels, src.height, dst.width / channels, dst.height, channels, type, method);
+                else
+                    resizer = func(src.width, src.height, dst.width, dst.height, channels, type, method);
+                if (resizer)
+                {
+                    SimdResizerRun(resizer, src.data, src.stride, dst.data, dst.stride);
+                    SimdResizerRun(resizer, src.data, src.stride, dst.data, dst.stride);
+                    SimdRelease(resizer);
+                }
+            }
+
+            void CallBands(const View& src, View& dst, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, size_t bands) const
+            {
+                size_t srcW = src.width, dstW = dst.width;
+                if (src.format == View::Float || src.format == View::Int16)
+                {
+                    srcW /= channels;
+                    dstW /= channels;
+                }
+                Simd::ResParam param(srcW, src.height, dstW, dst.height, channels, type, method, sizeof(void*));
+                Simd::Base::ResizerParallel resizer(param, func, bands);
+                if (resizer.Ok())
+                    resizer.Run(src.data, src.stride, dst.data, dst.stride);
+            }
         };
     }
 
@@ -170,7 +200,7 @@ namespace Test
         if (format == View::Int16)
         {
             Simd::FillPixel(dst1, uint16_t(0x0001));
-            Simd::FillPixel(dst1, uint16_t(0x0002));
+            Simd::FillPixel(dst2, uint16_t(0x0002));
         }
         else
         {
@@ -184,9 +214,12 @@ namespace Test
 
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, type, method));
 
+        bool filter = method == SimdResizeMethodBicubic || method == SimdResizeMethodArea || method == SimdResizeMethodAreaFast || method == SimdResizeMethodLanczos;
         if (format == View::Float)
-            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
-        else if (format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, filter ? DifferenceBoth : DifferenceAbsolute);
+        else if (type == SimdResizeChannelBf16 && method == SimdResizeMethodNearest)
+            result = result && Compare(dst1, dst2, 0, true, 64);
+        else if (type == SimdResizeChannelBf16)
         {
             View dst32f1(dstW, dstH, View::Float), dst32f2(dstW, dstH, View::Float);
             for (size_t row = 0; row < dstH; row++)
@@ -194,12 +227,28 @@ namespace Test
                 SimdBFloat16ToFloat32(dst1.Row<uint16_t>(row), dstW, dst32f1.Row<float>(row));
                 SimdBFloat16ToFloat32(dst2.Row<uint16_t>(row), dstW, dst32f2.Row<float>(row));
             }
-            result = result && Compare(dst32f1, dst32f2, EPS, true, 64, DifferenceAbsolute);
+            result = result && Compare(dst32f1, dst32f2, EPS * 10, true, 64, DifferenceRelative);
         }
         else if(format == View::Int16)
             result = result && Compare(dst1, dst2, 1, true, 64);
         else
-            result = result && Compare(dst1, dst2, 0, true, 64);
+            result = result && Compare(dst1, dst2, method == SimdResizeMethodLanczos ? 1 : 0, true, 64);
+
+        if (result && dstH >= 3)
+        {
+            View dst3(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+            Simd::Fill(dst3, 0x03);
+            f1.CallBands(src, dst3, channels, type, method, 3);
+            result = result && Compare(dst1, dst3, 0, true, 64, 0, "bands");
+        }
+
+        if (result)
+        {
+            View dst4(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+            Simd::Fill(dst4, 0x04);
+            f1.CallTwice(src, dst4, channels, type, method);
+            result = result && Compare(dst1, dst4, 0, true, 64, 0, "second run");
+        }
 
 #if defined(TEST_RESIZE_REAL_IMAGE) && 0
         String suffix = ToString(method) + "_" + ToString(method == SimdResizeMethodBicubic ? SIMD_RESIZER_BICUBIC_BITS : 4);
@@ -254,27 +303,34 @@ namespace Test
         result = result && ResizerAutoTest(SimdResizeMethodNearest, SimdResizeChannelBf16, 1, f1, f2);
         result = result && ResizerAutoTest(SimdResizeMethodNearest, SimdResizeChannelBf16, 3, f1, f2);
         result = result && ResizerAutoTest(SimdResizeMethodNearest, SimdResizeChannelBf16, 8, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodBilinear, SimdResizeChannelBf16, 1, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodBilinear, SimdResizeChannelBf16, 3, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodBilinearCaffe, SimdResizeChannelBf16, 1, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodBilinearPytorch, SimdResizeChannelBf16, 3, f1, f2);
+
+        result = result && ResizerAutoTest(SimdResizeMethodNearest, SimdResizeChannelByte, 1, 50, 40, 40, 30, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodNearest, SimdResizeChannelByte, 2, 30, 20, 20, 15, f1, f2);
 
         //result = result && ResizerAutoTest(SimdResizeMethodAreaFast, SimdResizeChannelByte, 3, 530, 404, 96, 96, f1, f2);
         //result = result && ResizerAutoTest(SimdResizeMethodBilinear, SimdResizeChannelByte, 4, 100, 1, 200, 10, f1, f2);
         //result = result && ResizerAutoTest(SimdResizeMethodBicubic, SimdResizeChannelByte, 4, 100, 2, 200, 10, f1, f2);
 
 #if !defined(__aarch64__) || 1  
-        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodNearest, SimdResizeMethodBilinear, SimdResizeMethodBicubic, SimdResizeMethodArea, SimdResizeMethodAreaFast };
+        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodNearest, SimdResizeMethodBilinear, SimdResizeMethodBicubic, SimdResizeMethodArea, SimdResizeMethodAreaFast, SimdResizeMethodLanczos };
         for (size_t m = 0; m < methods.size(); ++m)
         {
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelByte, 1, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelByte, 2, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelByte, 3, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelByte, 4, f1, f2);
-            if (methods[m] == SimdResizeMethodBicubic || methods[m] == SimdResizeMethodArea || methods[m] == SimdResizeMethodAreaFast)
+            result = result && ResizerAutoTest(methods[m], SimdResizeChannelFloat, 1, f1, f2);
+            result = result && ResizerAutoTest(methods[m], SimdResizeChannelFloat, 3, f1, f2);
+            if (methods[m] == SimdResizeMethodBicubic || methods[m] == SimdResizeMethodArea || methods[m] == SimdResizeMethodAreaFast || methods[m] == SimdResizeMethodLanczos)
                 continue;
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelShort, 1, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelShort, 2, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelShort, 3, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelShort, 4, f1, f2);
-            result = result && ResizerAutoTest(methods[m], SimdResizeChannelFloat, 1, f1, f2);
-            result = result && ResizerAutoTest(methods[m], SimdResizeChannelFloat, 3, f1, f2);
         }
 #endif
 
@@ -313,6 +369,135 @@ namespace Test
 
     //---------------------------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncCR
+        {
+            String description;
+
+            FuncCR(const String& d) : description(d) {}
+
+            void Update(SimdResizeMethodType method, SimdResizeChannelType type, size_t channels, size_t count, size_t dstW, size_t dstH)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels << ":" << count << "x" << dstW << "x" << dstH << ":" << ToString(method) << "-" << ToString(type) << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, const std::vector<size_t>& rects, View& dst, SimdResizeChannelType type, size_t channels, SimdResizeMethodType method, bool batch) const
+            {
+                size_t count = rects.size() / 4, dstH = dst.height / count;
+                size_t pixelSize = dst.ChannelSize() * channels, dstW = dst.width * dst.ChannelCount() / channels;
+                if (batch)
+                {
+                    void* resizer = SimdCropResizerInit(dstW, dstH, channels, type, method);
+                    if (resizer)
+                    {
+                        {
+                            TEST_PERFORMANCE_TEST(description);
+                            SimdCropResizerRun(resizer, src.data, src.stride, rects.data(), count, dst.data, dst.stride);
+                        }
+                        SimdRelease(resizer);
+                    }
+                }
+                else
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        const size_t* rect = rects.data() + i * 4;
+                        void* resizer = SimdResizerInit(rect[2] - rect[0], rect[3] - rect[1], dstW, dstH, channels, type, method);
+                        if (resizer)
+                        {
+                            SimdResizerRun(resizer, src.data + rect[1] * src.stride + rect[0] * pixelSize, src.stride, dst.data + i * dstH * dst.stride, dst.stride);
+                            SimdRelease(resizer);
+                        }
+                    }
+                }
+            }
+        };
+    }
+
+    bool CropResizerAutoTest(SimdResizeMethodType method, SimdResizeChannelType type, size_t channels, size_t count, size_t dstW, size_t dstH)
+    {
+        bool result = true;
+
+        FuncCR f1("SimdResizerRun"), f2("SimdCropResizerRun");
+        f1.Update(method, type, channels, count, dstW, dstH);
+        f2.Update(method, type, channels, count, dstW, dstH);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << W << ", " << H << "].");
+
+        View::Format format = channels == 1 ? View::Gray8 : (channels == 3 ? View::Bgr24 : View::Bgra32);
+        size_t k = 1;
+        if (type == SimdResizeChannelFloat || type == SimdResizeChannelBf16)
+        {
+            format = type == SimdResizeChannelFloat ? View::Float : View::Int16;
+            k = channels;
+        }
+        View src(W * k, H, format, NULL, TEST_ALIGN(W * k));
+        if (type == SimdResizeChannelFloat)
+            FillRandom32f(src);
+        else if (type == SimdResizeChannelBf16)
+        {
+            View src32f(W * k, H, View::Float);
+            FillRandom32f(src32f);
+            for (size_t row = 0; row < H; row++)
+                SimdFloat32ToBFloat16(src32f.Row<float>(row), W * k, src.Row<uint16_t>(row));
+        }
+        else
+            FillRandom(src);
+
+        std::vector<size_t> rects(count * 4);
+        for (size_t i = 0; i < count; ++i)
+        {
+            size_t w = i & 1 ? dstW * 3 / 2 : 2 + Random(W / 2), h = i & 1 ? dstH * 3 / 2 : 2 + Random(H / 2);
+            rects[i * 4 + 0] = Random(W - w);
+            rects[i * 4 + 1] = Random(H - h);
+            rects[i * 4 + 2] = rects[i * 4 + 0] + w;
+            rects[i * 4 + 3] = rects[i * 4 + 1] + h;
+        }
+
+        View dst1(dstW * k, dstH * count, format, NULL, TEST_ALIGN(dstW * k));
+        View dst2(dstW * k, dstH * count, format, NULL, TEST_ALIGN(dstW * k));
+        Simd::Fill(dst1, 0x01);
+        Simd::Fill(dst2, 0x02);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, rects, dst1, type, channels, method, false));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, rects, dst2, type, channels, method, true));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool CropResizerAutoTest()
+    {
+        bool result = true;
+
+        SimdResizeMethodType methods[] = { SimdResizeMethodNearest, SimdResizeMethodBilinear, SimdResizeMethodBicubic, SimdResizeMethodArea, SimdResizeMethodAreaFast, SimdResizeMethodLanczos };
+        for (size_t m = 0; m < sizeof(methods) / sizeof(methods[0]); ++m)
+        {
+            result = result && CropResizerAutoTest(methods[m], SimdResizeChannelByte, 1, 31, 112, 112);
+            result = result && CropResizerAutoTest(methods[m], SimdResizeChannelByte, 3, 31, 112, 112);
+            result = result && CropResizerAutoTest(methods[m], SimdResizeChannelByte, 4, 17, 64, 128);
+            result = result && CropResizerAutoTest(methods[m], SimdResizeChannelFloat, 1, 17, 64, 64);
+            result = result && CropResizerAutoTest(methods[m], SimdResizeChannelFloat, 3, 17, 64, 64);
+            if (methods[m] == SimdResizeMethodNearest || methods[m] == SimdResizeMethodBilinear)
+            {
+                result = result && CropResizerAutoTest(methods[m], SimdResizeChannelBf16, 1, 17, 64, 64);
+                result = result && CropResizerAutoTest(methods[m], SimdResizeChannelBf16, 3, 17, 64, 64);
+            }
+        }
+
+        result = result && CropResizerAutoTest(SimdResizeMethodBilinear, SimdResizeChannelByte, 3, 151, 32, 32);
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
     bool ResizeYuv420pSpecialTest(SimdResizeMethodType method)
     {
         bool result = true;
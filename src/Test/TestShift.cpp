@@ -26,6 +26,8 @@
 #include "Test/TestString.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdOpticalFlow.h"
+
 namespace Test
 {
     namespace
@@ -136,6 +138,140 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncLk
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t window, size_t levels, size_t iterations, float epsilon);
+
+            FuncPtr func;
+            String description;
+
+            FuncLk(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t window, size_t levels)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << window << "-" << levels << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& prev, const View& next, size_t window, size_t levels, const Buffer32f & prevPoints, Buffer32f & nextPoints, Buffer8u & status) const
+            {
+                void* context = func(prev.width, prev.height, window, levels, 30, 0.01f);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdOpticalFlowLkRun(context, prev.data, prev.stride, next.data, next.stride, prevPoints.data(), status.size(), nextPoints.data(), status.data());
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_LK(function) \
+    FuncLk(function, std::string(#function))
+
+    bool OpticalFlowLkAutoTest(size_t width, size_t height, size_t window, size_t levels, double dx, double dy, FuncLk f1, FuncLk f2)
+    {
+        bool result = true;
+
+        f1.Update(window, levels);
+        f2.Update(window, levels);
+
+        TEST_LOG_SS(Info, std::setprecision(1) << std::fixed << "Test " << f1.description << " & " << f2.description
+            << " [" << width << ", " << height << "]," << " (" << dx << ", " << dy << ").");
+
+        View prev(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View next(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(next);
+        SimdGaussianBlur3x3(next.data, next.stride, width, height, 1, prev.data, prev.stride);
+        SimdShiftBilinear(prev.data, prev.stride, width, height, 1, prev.data, prev.stride, &dx, &dy, 0, 0, width, height, next.data, next.stride);
+
+        const size_t count = 1000;
+        Buffer32f prevPoints(count * 2);
+        for (size_t i = 0; i < count; ++i)
+        {
+            prevPoints[2 * i + 0] = float(Random() * width);
+            prevPoints[2 * i + 1] = float(Random() * height);
+        }
+        Buffer32f nextPoints1(count * 2), nextPoints2(count * 2);
+        Buffer8u status1(count), status2(count);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(prev, next, window, levels, prevPoints, nextPoints1, status1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(prev, next, window, levels, prevPoints, nextPoints2, status2));
+
+        result = result && Compare(status1.data(), status1.size(), status2.data(), status2.size(), 0, true, 32, "status");
+
+        result = result && Compare(nextPoints1, nextPoints2, EPS, true, 32, DifferenceBoth, "nextPoints");
+
+        if (result)
+        {
+            const double border = double(window) + std::max(std::abs(dx), std::abs(dy));
+            size_t interior = 0, tracked = 0;
+            double error = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                double x = prevPoints[2 * i + 0], y = prevPoints[2 * i + 1];
+                if (x < border || x >= width - border || y < border || y >= height - border)
+                    continue;
+                interior++;
+                if (status1[i])
+                {
+                    tracked++;
+                    error += std::abs(nextPoints1[2 * i + 0] - (x - dx)) + std::abs(nextPoints1[2 * i + 1] - (y - dy));
+                }
+            }
+            error = tracked ? error / (2 * tracked) : 0;
+            if (tracked * 10 < interior * 9 || error > 0.1)
+            {
+                TEST_LOG_SS(Error, "Tracked " << tracked << " from " << interior << " interior points with mean error " << error << " (expected shift (" << -dx << ", " << -dy << ")) !");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool OpticalFlowLkAutoTest(const FuncLk& f1, const FuncLk& f2)
+    {
+        bool result = true;
+
+        result = result && OpticalFlowLkAutoTest(W, H, 21, 3, 2.3, -1.7, f1, f2);
+        result = result && OpticalFlowLkAutoTest(W + O, H - O, 15, 4, -7.6, 5.2, f1, f2);
+        result = result && OpticalFlowLkAutoTest(W - O, H + O, 31, 2, 0.4, 0.3, f1, f2);
+
+        return result;
+    }
+
+    bool OpticalFlowLkAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && OpticalFlowLkAutoTest(FUNC_LK(Simd::Base::OpticalFlowLkInit), FUNC_LK(SimdOpticalFlowLkInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && OpticalFlowLkAutoTest(FUNC_LK(Simd::Sse41::OpticalFlowLkInit), FUNC_LK(SimdOpticalFlowLkInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && OpticalFlowLkAutoTest(FUNC_LK(Simd::Avx2::OpticalFlowLkInit), FUNC_LK(SimdOpticalFlowLkInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && OpticalFlowLkAutoTest(FUNC_LK(Simd::Avx512bw::OpticalFlowLkInit), FUNC_LK(SimdOpticalFlowLkInit));
+#endif 
+
+        return result;
+    }
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -88,6 +88,7 @@ namespace Test
         case View::Rgba32:    return "Rgba32";
         case View::Uyvy16:    return "Uyvy16";
         case View::Argb32:    return "Argb32";
+        case View::Yuyv16:    return "Yuyv16";
         default: assert(0);  return "";
         }
     }
@@ -103,6 +104,7 @@ namespace Test
         case SimdImageFilePpmBin:       return "PpmB";
         case SimdImageFilePng:          return "Png";
         case SimdImageFileJpeg:         return "Jpeg";
+        case SimdImageFileQoi:          return "Qoi";
         default: assert(0);  return "";
         }
     }
@@ -169,6 +171,7 @@ namespace Test
         case SimdImageFilePpmBin: return "ppm";
         case SimdImageFilePng:    return "png";
         case SimdImageFileJpeg:   return "jpg";
+        case SimdImageFileQoi:    return "qoi";
         default: assert(0);  return "";
         }
     }
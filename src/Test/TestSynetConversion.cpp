@@ -28,6 +28,8 @@
 #include "Test/TestRandom.h"
 
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetPreprocess.h"
+#include "Simd/SimdBFloat16.h"
 
 namespace Test
 {
@@ -334,5 +336,184 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    inline String ToString(SimdSynetPreprocessFormatType format)
+    {
+        switch (format)
+        {
+        case SimdSynetPreprocessGray8: return "Gray8";
+        case SimdSynetPreprocessBgr24: return "Bgr24";
+        case SimdSynetPreprocessBgra32: return "Bgra32";
+        case SimdSynetPreprocessRgb24: return "Rgb24";
+        case SimdSynetPreprocessRgba32: return "Rgba32";
+        case SimdSynetPreprocessNv12: return "Nv12";
+        case SimdSynetPreprocessYuv420p: return "Yuv420p";
+        default: assert(0); return "Assert";
+        }
+    }
+
+    namespace
+    {
+        struct FuncSP
+        {
+            typedef void* (*FuncPtr)(size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, SimdYuvType yuvType, size_t dstW, size_t dstH, size_t channels,
+                SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, uint8_t padding, const float* mean, const float* scale);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSP(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t sw, size_t sh, SimdSynetPreprocessFormatType sf, size_t dw, size_t dh, size_t c, SimdResizeMethodType m, SimdTensorDataType dt, SimdTensorFormatType df, SimdBool rgb, SimdBool lb)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << sw << "x" << sh << ":" << ToString(sf) << "->" << c << "x" << dh << "x" << dw << ":" << ToString(dt) << "-" << ToString(df);
+                ss << (m == SimdResizeMethodNearest ? "-Nr" : "-Bl") << (rgb ? "-Rgb" : "") << (lb ? "-Lb" : "") << "]";
+                desc = ss.str();
+            }
+
+            void Call(void* context, const uint8_t* const* src, const size_t* stride, uint8_t* dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                SimdSynetPreprocessRun(context, src, stride, dst);
+            }
+        };
+    }
+
+#define FUNC_SP(function) FuncSP(function, #function)
+
+    bool SynetPreprocessAutoTest(size_t srcW, size_t srcH, SimdSynetPreprocessFormatType srcFormat, size_t dstW, size_t dstH, size_t c,
+        SimdResizeMethodType method, SimdTensorDataType dstType, SimdTensorFormatType dstFormat, SimdBool isRgb, SimdBool letterbox, FuncSP f1, FuncSP f2)
+    {
+        bool result = true;
+
+        f1.Update(srcW, srcH, srcFormat, dstW, dstH, c, method, dstType, dstFormat, isRgb, letterbox);
+        f2.Update(srcW, srcH, srcFormat, dstW, dstH, c, method, dstType, dstFormat, isRgb, letterbox);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        View planes[3];
+        switch (srcFormat)
+        {
+        case SimdSynetPreprocessGray8: planes[0].Recreate(srcW, srcH, View::Gray8); break;
+        case SimdSynetPreprocessBgr24: planes[0].Recreate(srcW, srcH, View::Bgr24); break;
+        case SimdSynetPreprocessBgra32: planes[0].Recreate(srcW, srcH, View::Bgra32); break;
+        case SimdSynetPreprocessRgb24: planes[0].Recreate(srcW, srcH, View::Rgb24); break;
+        case SimdSynetPreprocessRgba32: planes[0].Recreate(srcW, srcH, View::Rgba32); break;
+        case SimdSynetPreprocessNv12:
+            planes[0].Recreate(srcW, srcH, View::Gray8);
+            planes[1].Recreate(srcW / 2, srcH / 2, View::Uv16);
+            break;
+        case SimdSynetPreprocessYuv420p:
+            planes[0].Recreate(srcW, srcH, View::Gray8);
+            planes[1].Recreate(srcW / 2, srcH / 2, View::Gray8);
+            planes[2].Recreate(srcW / 2, srcH / 2, View::Gray8);
+            break;
+        default:
+            assert(0);
+        }
+        const uint8_t* src[3];
+        size_t stride[3];
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (planes[i].data)
+                FillRandom(planes[i]);
+            src[i] = planes[i].data;
+            stride[i] = planes[i].stride;
+        }
+
+        size_t elem = dstType == SimdTensorData32f ? 4 : (dstType == SimdTensorData16b ? 2 : 1);
+        Tensor8u dst1(Shp(c * dstH * dstW * elem));
+        Tensor8u dst2(Shp(c * dstH * dstW * elem));
+        memset(dst1.Data(), 1, dst1.Size());
+        memset(dst2.Data(), 2, dst2.Size());
+
+        float mean[3] = { 104.0f, 117.0f, 123.0f };
+        float scale[3] = { 0.0171f, 0.0175f, 0.0174f };
+        if (dstType == SimdTensorData8u)
+        {
+            mean[0] = mean[1] = mean[2] = 10.0f;
+            scale[0] = 0.9f, scale[1] = 1.0f, scale[2] = 1.1f;
+        }
+
+        void* context1 = f1.func(srcW, srcH, srcFormat, SimdYuvBt601, dstW, dstH, c, method, dstType, dstFormat, isRgb, letterbox, 114, mean, scale);
+        void* context2 = f2.func(srcW, srcH, srcFormat, SimdYuvBt601, dstW, dstH, c, method, dstType, dstFormat, isRgb, letterbox, 114, mean, scale);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, stride, dst1.Data()));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, stride, dst2.Data()));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        if (dstType == SimdTensorData32f)
+        {
+            Tensor32f d1(Shp(c * dstH * dstW)), d2(Shp(c * dstH * dstW));
+            memcpy(d1.Data(), dst1.Data(), dst1.Size());
+            memcpy(d2.Data(), dst2.Data(), dst2.Size());
+            result = result && Compare(d1, d2, EPS, true, 64, DifferenceBoth);
+        }
+        else if (dstType == SimdTensorData16b)
+        {
+            Tensor32f d1(Shp(c * dstH * dstW)), d2(Shp(c * dstH * dstW));
+            for (size_t i = 0; i < d1.Size(); ++i)
+            {
+                d1.Data()[i] = Simd::Base::BFloat16ToFloat32(((uint16_t*)dst1.Data())[i]);
+                d2.Data()[i] = Simd::Base::BFloat16ToFloat32(((uint16_t*)dst2.Data())[i]);
+            }
+            result = result && Compare(d1, d2, 0.01f, true, 64, DifferenceBoth);
+        }
+        else
+            result = result && Compare(dst1, dst2, 1, true, 64);
+
+        return result;
+    }
+
+    bool SynetPreprocessAutoTest(const FuncSP& f1, const FuncSP& f2)
+    {
+        bool result = true;
+
+        SimdBool t = SimdTrue, f = SimdFalse;
+        SimdResizeMethodType bl = SimdResizeMethodBilinear, nr = SimdResizeMethodNearest;
+        SimdTensorFormatType nchw = SimdTensorFormatNchw, nhwc = SimdTensorFormatNhwc;
+
+        for (int s = SimdSynetPreprocessGray8; s <= SimdSynetPreprocessYuv420p && result; ++s)
+        {
+            SimdSynetPreprocessFormatType format = (SimdSynetPreprocessFormatType)s;
+            result = result && SynetPreprocessAutoTest(W, H, format, 224, 224, 3, bl, SimdTensorData32f, nchw, f, f, f1, f2);
+            result = result && SynetPreprocessAutoTest(W, H, format, 320, 192, 3, nr, SimdTensorData16b, nhwc, t, t, f1, f2);
+            result = result && SynetPreprocessAutoTest(W, H, format, 127, 97, 1, bl, SimdTensorData8u, nhwc, f, t, f1, f2);
+            result = result && SynetPreprocessAutoTest(W, H, format, 159, 161, 3, bl, SimdTensorData8u, nchw, t, f, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool SynetPreprocessAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && SynetPreprocessAutoTest(FUNC_SP(Simd::Base::SynetPreprocessInit), FUNC_SP(SimdSynetPreprocessInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && SynetPreprocessAutoTest(FUNC_SP(Simd::Sse41::SynetPreprocessInit), FUNC_SP(SimdSynetPreprocessInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && SynetPreprocessAutoTest(FUNC_SP(Simd::Avx2::SynetPreprocessInit), FUNC_SP(SimdSynetPreprocessInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && SynetPreprocessAutoTest(FUNC_SP(Simd::Avx512bw::SynetPreprocessInit), FUNC_SP(SimdSynetPreprocessInit));
+#endif 
+
+        return result;
+    }
 #endif
 }
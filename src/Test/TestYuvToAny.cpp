@@ -453,6 +453,454 @@ namespace Test
 
     //-------------------------------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncNv12
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+                size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncNv12(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& bgr, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+            }
+        };
+    }
+
+#define FUNC_NV12(function) FuncNv12(function, #function)
+
+    bool Nv12ToBgr2AutoTest(int width, int height, const FuncNv12& f1, const FuncNv12& f2, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View bgr1(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        View bgr2(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, bgr1, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, bgr2, yuvType));
+
+        result = result && Compare(bgr1, bgr2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Nv12ToBgr2AutoTest(const FuncNv12& f1, const FuncNv12& f2)
+    {
+        bool result = true;
+
+        result = result && Nv12ToBgr2AutoTest(W, H, f1, f2, SimdYuvBt601);
+        result = result && Nv12ToBgr2AutoTest(W + O * 2, H - O * 2, f1, f2, SimdYuvBt709);
+        result = result && Nv12ToBgr2AutoTest(W - O * 2, H + O * 2, f1, f2, SimdYuvTrect871);
+
+        return result;
+    }
+
+    bool Nv12ToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Base::Nv12ToBgrV2), FUNC_NV12(SimdNv12ToBgrV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Sse41::Nv12ToBgrV2), FUNC_NV12(SimdNv12ToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Avx2::Nv12ToBgrV2), FUNC_NV12(SimdNv12ToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Avx512bw::Nv12ToBgrV2), FUNC_NV12(SimdNv12ToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Base::Nv21ToBgrV2), FUNC_NV12(SimdNv21ToBgrV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Sse41::Nv21ToBgrV2), FUNC_NV12(SimdNv21ToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Avx2::Nv21ToBgrV2), FUNC_NV12(SimdNv21ToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Avx512bw::Nv21ToBgrV2), FUNC_NV12(SimdNv21ToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Base::Nv12ToRgbV2), FUNC_NV12(SimdNv12ToRgbV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Sse41::Nv12ToRgbV2), FUNC_NV12(SimdNv12ToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Avx2::Nv12ToRgbV2), FUNC_NV12(SimdNv12ToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Avx512bw::Nv12ToRgbV2), FUNC_NV12(SimdNv12ToRgbV2));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Base::Nv21ToRgbV2), FUNC_NV12(SimdNv21ToRgbV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Sse41::Nv21ToRgbV2), FUNC_NV12(SimdNv21ToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Avx2::Nv21ToRgbV2), FUNC_NV12(SimdNv21ToRgbV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Nv12ToBgr2AutoTest(FUNC_NV12(Simd::Avx512bw::Nv21ToRgbV2), FUNC_NV12(SimdNv21ToRgbV2));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncYuv10
+        {
+            typedef void(*Yuv420p10ToBgrPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+                size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+            typedef void(*Yuv420p10ToBgraPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+                size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+            typedef void(*Yuv420p10ToBgr48pPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+                size_t width, size_t height, uint8_t* blue, size_t blueStride, uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride, SimdYuvType yuvType);
+            typedef void(*P010ToBgrPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+                size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+            typedef void(*P010ToBgraPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+                size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+            typedef void(*P010ToBgr48pPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+                size_t width, size_t height, uint8_t* blue, size_t blueStride, uint8_t* green, size_t greenStride, uint8_t* red, size_t redStride, SimdYuvType yuvType);
+
+            Yuv420p10ToBgrPtr yuvToBgr;
+            Yuv420p10ToBgraPtr yuvToBgra;
+            Yuv420p10ToBgr48pPtr yuvToBgr48p;
+            P010ToBgrPtr p010ToBgr;
+            P010ToBgraPtr p010ToBgra;
+            P010ToBgr48pPtr p010ToBgr48p;
+            String description;
+
+            FuncYuv10(const Yuv420p10ToBgrPtr& f, const String& d) : FuncYuv10(d) { yuvToBgr = f; }
+            FuncYuv10(const Yuv420p10ToBgraPtr& f, const String& d) : FuncYuv10(d) { yuvToBgra = f; }
+            FuncYuv10(const Yuv420p10ToBgr48pPtr& f, const String& d) : FuncYuv10(d) { yuvToBgr48p = f; }
+            FuncYuv10(const P010ToBgrPtr& f, const String& d) : FuncYuv10(d) { p010ToBgr = f; }
+            FuncYuv10(const P010ToBgraPtr& f, const String& d) : FuncYuv10(d) { p010ToBgra = f; }
+            FuncYuv10(const P010ToBgr48pPtr& f, const String& d) : FuncYuv10(d) { p010ToBgr48p = f; }
+
+            bool P010() const
+            {
+                return p010ToBgr || p010ToBgra || p010ToBgr48p;
+            }
+
+            View::Format DstFormat() const
+            {
+                if (yuvToBgr || p010ToBgr)
+                    return View::Bgr24;
+                if (yuvToBgra || p010ToBgra)
+                    return View::Bgra32;
+                return View::Int16;
+            }
+
+            void Call(const View& y, const View& u, const View& v, const View& uv, View& dst0, View& dst1, View& dst2, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (yuvToBgr)
+                    yuvToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst0.data, dst0.stride, yuvType);
+                else if (yuvToBgra)
+                    yuvToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst0.data, dst0.stride, alpha, yuvType);
+                else if (yuvToBgr48p)
+                    yuvToBgr48p(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst0.data, dst0.stride, dst1.data, dst1.stride, dst2.data, dst2.stride, yuvType);
+                else if (p010ToBgr)
+                    p010ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst0.data, dst0.stride, yuvType);
+                else if (p010ToBgra)
+                    p010ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst0.data, dst0.stride, alpha, yuvType);
+                else
+                    p010ToBgr48p(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst0.data, dst0.stride, dst1.data, dst1.stride, dst2.data, dst2.stride, yuvType);
+            }
+
+        private:
+            FuncYuv10(const String& d) : yuvToBgr(NULL), yuvToBgra(NULL), yuvToBgr48p(NULL),
+                p010ToBgr(NULL), p010ToBgra(NULL), p010ToBgr48p(NULL), description(d) {}
+        };
+    }
+
+#define FUNC_YUV10(function) FuncYuv10(function, #function)
+
+    bool Yuv10ToAnyAutoTest(int width, int height, const FuncYuv10& f1, const FuncYuv10& f2, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View u, v, uv;
+        if (f1.P010())
+        {
+            uv.Recreate(width / 2, height / 2, View::Int32, NULL, TEST_ALIGN(width));
+            FillRandom(uv);
+        }
+        else
+        {
+            u.Recreate(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+            FillRandom(u);
+            v.Recreate(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+            FillRandom(v);
+        }
+        uint8_t alpha = Random(256);
+
+        View::Format format = f1.DstFormat();
+        size_t count = format == View::Int16 ? 3 : 1;
+        View dst1[3], dst2[3];
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst1[i].Recreate(width, height, format, NULL, TEST_ALIGN(width));
+            dst2[i].Recreate(width, height, format, NULL, TEST_ALIGN(width));
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, uv, dst1[0], dst1[1], dst1[2], alpha, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, uv, dst2[0], dst2[1], dst2[2], alpha, yuvType));
+
+        for (size_t i = 0; i < count; ++i)
+            result = result && Compare(dst1[i], dst2[i], 0, true, 64);
+
+        if (result && format == View::Int16)
+        {
+            View bgra1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+            View bgra2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+            SimdBgr48pToBgra32(dst1[0].data, dst1[0].stride, width, height, dst1[1].data, dst1[1].stride,
+                dst1[2].data, dst1[2].stride, bgra1.data, bgra1.stride, alpha);
+            if (f1.P010())
+                SimdP010ToBgraV2(y.data, y.stride, uv.data, uv.stride, width, height, bgra2.data, bgra2.stride, alpha, yuvType);
+            else
+                SimdYuv420p10ToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, bgra2.data, bgra2.stride, alpha, yuvType);
+            result = result && Compare(bgra1, bgra2, 1, true, 64, 0, "bgr48p to bgra");
+        }
+
+        return result;
+    }
+
+    bool Yuv10ToAnyAutoTest(const FuncYuv10& f1, const FuncYuv10& f2)
+    {
+        bool result = true;
+
+        result = result && Yuv10ToAnyAutoTest(W, H, f1, f2, SimdYuvBt601);
+        result = result && Yuv10ToAnyAutoTest(W + O * 2, H - O * 2, f1, f2, SimdYuvBt709);
+        result = result && Yuv10ToAnyAutoTest(W - O * 2, H + O * 2, f1, f2, SimdYuvBt2020);
+        result = result && Yuv10ToAnyAutoTest(W, H, f1, f2, SimdYuvTrect871);
+
+        return result;
+    }
+
+    bool Yuv420p10ToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Base::Yuv420p10ToBgrV2), FUNC_YUV10(SimdYuv420p10ToBgrV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Sse41::Yuv420p10ToBgrV2), FUNC_YUV10(SimdYuv420p10ToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Avx2::Yuv420p10ToBgrV2), FUNC_YUV10(SimdYuv420p10ToBgrV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Avx512bw::Yuv420p10ToBgrV2), FUNC_YUV10(SimdYuv420p10ToBgrV2));
+#endif
+
+        return result;
+    }
+
+    bool Yuv420p10ToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Base::Yuv420p10ToBgraV2), FUNC_YUV10(SimdYuv420p10ToBgraV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Sse41::Yuv420p10ToBgraV2), FUNC_YUV10(SimdYuv420p10ToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Avx2::Yuv420p10ToBgraV2), FUNC_YUV10(SimdYuv420p10ToBgraV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Avx512bw::Yuv420p10ToBgraV2), FUNC_YUV10(SimdYuv420p10ToBgraV2));
+#endif
+
+        return result;
+    }
+
+    bool Yuv420p10ToBgr48pV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Base::Yuv420p10ToBgr48pV2), FUNC_YUV10(SimdYuv420p10ToBgr48pV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Sse41::Yuv420p10ToBgr48pV2), FUNC_YUV10(SimdYuv420p10ToBgr48pV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Avx2::Yuv420p10ToBgr48pV2), FUNC_YUV10(SimdYuv420p10ToBgr48pV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Avx512bw::Yuv420p10ToBgr48pV2), FUNC_YUV10(SimdYuv420p10ToBgr48pV2));
+#endif
+
+        return result;
+    }
+
+    bool P010ToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Base::P010ToBgrV2), FUNC_YUV10(SimdP010ToBgrV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Sse41::P010ToBgrV2), FUNC_YUV10(SimdP010ToBgrV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Avx2::P010ToBgrV2), FUNC_YUV10(SimdP010ToBgrV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Avx512bw::P010ToBgrV2), FUNC_YUV10(SimdP010ToBgrV2));
+#endif
+
+        return result;
+    }
+
+    bool P010ToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Base::P010ToBgraV2), FUNC_YUV10(SimdP010ToBgraV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Sse41::P010ToBgraV2), FUNC_YUV10(SimdP010ToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Avx2::P010ToBgraV2), FUNC_YUV10(SimdP010ToBgraV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Avx512bw::P010ToBgraV2), FUNC_YUV10(SimdP010ToBgraV2));
+#endif
+
+        return result;
+    }
+
+    bool P010ToBgr48pV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Base::P010ToBgr48pV2), FUNC_YUV10(SimdP010ToBgr48pV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Sse41::P010ToBgr48pV2), FUNC_YUV10(SimdP010ToBgr48pV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Avx2::P010ToBgr48pV2), FUNC_YUV10(SimdP010ToBgr48pV2));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw() && W >= Simd::Avx512bw::A)
+            result = result && Yuv10ToAnyAutoTest(FUNC_YUV10(Simd::Avx512bw::P010ToBgr48pV2), FUNC_YUV10(SimdP010ToBgr48pV2));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
     bool Yuv420pToRgbV2SpecialTest()
     {
         bool result = true;
@@ -363,4 +363,113 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncNv12
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+                size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncNv12(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& bgra, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+            }
+        };
+    }
+
+#define FUNC_NV12(function) FuncNv12(function, #function)
+
+    bool Nv12ToBgra2AutoTest(int width, int height, const FuncNv12& f1, const FuncNv12& f2, SimdYuvType yuvType)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View bgra1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View bgra2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        const uint8_t alpha = 0xFE;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, bgra1, alpha, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, bgra2, alpha, yuvType));
+
+        result = result && Compare(bgra1, bgra2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Nv12ToBgra2AutoTest(const FuncNv12& f1, const FuncNv12& f2)
+    {
+        bool result = true;
+
+        result = result && Nv12ToBgra2AutoTest(W, H, f1, f2, SimdYuvBt601);
+        result = result && Nv12ToBgra2AutoTest(W + O * 2, H - O * 2, f1, f2, SimdYuvBt709);
+        result = result && Nv12ToBgra2AutoTest(W - O * 2, H + O * 2, f1, f2, SimdYuvTrect871);
+
+        return result;
+    }
+
+    bool Nv12ToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToBgra2AutoTest(FUNC_NV12(Simd::Base::Nv12ToBgraV2), FUNC_NV12(SimdNv12ToBgraV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && Nv12ToBgra2AutoTest(FUNC_NV12(Simd::Sse41::Nv12ToBgraV2), FUNC_NV12(SimdNv12ToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && Nv12ToBgra2AutoTest(FUNC_NV12(Simd::Avx2::Nv12ToBgraV2), FUNC_NV12(SimdNv12ToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Nv12ToBgra2AutoTest(FUNC_NV12(Simd::Avx512bw::Nv12ToBgraV2), FUNC_NV12(SimdNv12ToBgraV2));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Nv12ToBgra2AutoTest(FUNC_NV12(Simd::Base::Nv21ToBgraV2), FUNC_NV12(SimdNv21ToBgraV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && Nv12ToBgra2AutoTest(FUNC_NV12(Simd::Sse41::Nv21ToBgraV2), FUNC_NV12(SimdNv21ToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && Nv12ToBgra2AutoTest(FUNC_NV12(Simd::Avx2::Nv21ToBgraV2), FUNC_NV12(SimdNv21ToBgraV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Nv12ToBgra2AutoTest(FUNC_NV12(Simd::Avx512bw::Nv21ToBgraV2), FUNC_NV12(SimdNv21ToBgraV2));
+#endif 
+
+        return result;
+    }
 }
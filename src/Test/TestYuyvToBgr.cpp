@@ -0,0 +1,266 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct Func3
+        {
+            typedef void(*FuncPtr)(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+            FuncPtr func;
+            String description;
+
+            Func3(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & yuyv, View & bgr, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, bgr.data, bgr.stride, yuvType);
+            }
+        };
+    }
+
+#define FUNC_3(func) Func3(func, #func)
+
+    bool Yuyv422ToBgrAutoTest(int width, int height, SimdYuvType yuvType, const Func3 & f1, const Func3 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View src(width, height, View::Yuyv16, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, yuvType));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Yuyv422ToBgrAutoTest(const Func3 & f1, const Func3 & f2)
+    {
+        bool result = true;
+
+        result = result && Yuyv422ToBgrAutoTest(W, H, SimdYuvBt601, f1, f2);
+        result = result && Yuyv422ToBgrAutoTest(W + E, H - E, SimdYuvBt709, f1, f2);
+        result = result && Yuyv422ToBgrAutoTest(W - E, H + E, SimdYuvTrect871, f1, f2);
+
+        return result;
+    }
+
+    bool Yuyv422ToBgrAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Yuyv422ToBgrAutoTest(FUNC_3(Simd::Base::Yuyv422ToBgr), FUNC_3(SimdYuyv422ToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && Yuyv422ToBgrAutoTest(FUNC_3(Simd::Sse41::Yuyv422ToBgr), FUNC_3(SimdYuyv422ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && Yuyv422ToBgrAutoTest(FUNC_3(Simd::Avx2::Yuyv422ToBgr), FUNC_3(SimdYuyv422ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Yuyv422ToBgrAutoTest(FUNC_3(Simd::Avx512bw::Yuyv422ToBgr), FUNC_3(SimdYuyv422ToBgr));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct Func4
+        {
+            typedef void(*FuncPtr)(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+            FuncPtr func;
+            String description;
+
+            Func4(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & yuyv, View & bgra, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, bgra.data, bgra.stride, alpha, yuvType);
+            }
+        };
+    }
+
+#define FUNC_4(func) Func4(func, #func)
+
+    bool Yuyv422ToBgraAutoTest(int width, int height, SimdYuvType yuvType, const Func4 & f1, const Func4 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View src(width, height, View::Yuyv16, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        uint8_t alpha = Random(256);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, alpha, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, alpha, yuvType));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Yuyv422ToBgraAutoTest(const Func4 & f1, const Func4 & f2)
+    {
+        bool result = true;
+
+        result = result && Yuyv422ToBgraAutoTest(W, H, SimdYuvBt601, f1, f2);
+        result = result && Yuyv422ToBgraAutoTest(W + E, H - E, SimdYuvBt709, f1, f2);
+        result = result && Yuyv422ToBgraAutoTest(W - E, H + E, SimdYuvBt2020, f1, f2);
+
+        return result;
+    }
+
+    bool Yuyv422ToBgraAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Yuyv422ToBgraAutoTest(FUNC_4(Simd::Base::Yuyv422ToBgra), FUNC_4(SimdYuyv422ToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && Yuyv422ToBgraAutoTest(FUNC_4(Simd::Sse41::Yuyv422ToBgra), FUNC_4(SimdYuyv422ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && Yuyv422ToBgraAutoTest(FUNC_4(Simd::Avx2::Yuyv422ToBgra), FUNC_4(SimdYuyv422ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Yuyv422ToBgraAutoTest(FUNC_4(Simd::Avx512bw::Yuyv422ToBgra), FUNC_4(SimdYuyv422ToBgra));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct Func1
+        {
+            typedef void(*FuncPtr)(const uint8_t* yuyv, size_t yuyvStride, size_t width, size_t height, uint8_t* gray, size_t grayStride);
+            FuncPtr func;
+            String description;
+
+            Func1(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & yuyv, View & gray) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(yuyv.data, yuyv.stride, yuyv.width, yuyv.height, gray.data, gray.stride);
+            }
+        };
+    }
+
+#define FUNC_1(func) Func1(func, #func)
+
+    bool Yuyv422ToGrayAutoTest(int width, int height, const Func1 & f1, const Func1 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View src(width, height, View::Yuyv16, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Yuyv422ToGrayAutoTest(const Func1 & f1, const Func1 & f2)
+    {
+        bool result = true;
+
+        result = result && Yuyv422ToGrayAutoTest(W, H, f1, f2);
+        result = result && Yuyv422ToGrayAutoTest(W + E, H - E, f1, f2);
+
+        return result;
+    }
+
+    bool Yuyv422ToGrayAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && Yuyv422ToGrayAutoTest(FUNC_1(Simd::Base::Yuyv422ToGray), FUNC_1(SimdYuyv422ToGray));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41() && W >= Simd::Sse41::DA)
+            result = result && Yuyv422ToGrayAutoTest(FUNC_1(Simd::Sse41::Yuyv422ToGray), FUNC_1(SimdYuyv422ToGray));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2() && W >= Simd::Avx2::DA)
+            result = result && Yuyv422ToGrayAutoTest(FUNC_1(Simd::Avx2::Yuyv422ToGray), FUNC_1(SimdYuyv422ToGray));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && Yuyv422ToGrayAutoTest(FUNC_1(Simd::Avx512bw::Yuyv422ToGray), FUNC_1(SimdYuyv422ToGray));
+#endif 
+
+        return result;
+    }
+}